@@ -1,10 +1,12 @@
 #include "Actors/AutomaticDoor.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Camera/CameraComponent.h"
 
 AAutomaticDoor::AAutomaticDoor()
@@ -55,12 +57,27 @@ void AAutomaticDoor::BeginPlay()
     // Cache player reference
     CachedPlayer = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
     
-    UE_LOG(LogTemp, Warning, TEXT("AutomaticDoor: Initialized at %s, Height: %.1f, ProximityRange: %.1f"), 
+    UE_LOG(LogBlackhole, Log, TEXT("AutomaticDoor: Initialized at %s, Height: %.1f, ProximityRange: %.1f"), 
         *GetActorLocation().ToString(), DoorHeight, ProximityRange);
 }
 
+void AAutomaticDoor::ResetDoor()
+{
+    CancelAutoCloseTimer();
+    
+    CurrentState = EDoorState::Closed;
+    CurrentHeight = 0.0f;
+    DoorMesh->SetRelativeLocation(ClosedPosition);
+    
+    bPlayerInside = false;
+    bPlayerNearby = false;
+    bPlayerLooking = false;
+}
+
 void AAutomaticDoor::Tick(float DeltaTime)
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Automatic Door Tick", STAT_Blackhole_AutomaticDoorTick, BlackholeSystemsChannel);
+
     Super::Tick(DeltaTime);
     
     // Check if player is looking at door when nearby
@@ -76,8 +93,8 @@ void AAutomaticDoor::Tick(float DeltaTime)
     #if WITH_EDITOR
     if (bPlayerNearby)
     {
-        DrawDebugBox(GetWorld(), GetActorLocation(), ProximityTrigger->GetScaledBoxExtent(), 
-            bPlayerLooking ? FColor::Green : FColor::Yellow, false, -1.0f, 0, 2.0f);
+        BLACKHOLE_DEBUG_DRAW(World, DrawDebugBox(GetWorld(), GetActorLocation(), ProximityTrigger->GetScaledBoxExtent(), 
+            bPlayerLooking ? FColor::Green : FColor::Yellow, false, -1.0f, 0, 2.0f));
     }
     #endif
 }
@@ -95,7 +112,7 @@ void AAutomaticDoor::UpdateDoorMovement(float DeltaTime)
             {
                 CurrentState = EDoorState::Open;
                 DoorMesh->SetRelativeLocation(OpenPosition);
-                UE_LOG(LogTemp, Warning, TEXT("Door fully opened"));
+                UE_LOG(LogBlackhole, Verbose, TEXT("Door fully opened"));
                 return;
             }
             break;
@@ -106,7 +123,7 @@ void AAutomaticDoor::UpdateDoorMovement(float DeltaTime)
             {
                 CurrentState = EDoorState::Closed;
                 DoorMesh->SetRelativeLocation(ClosedPosition);
-                UE_LOG(LogTemp, Warning, TEXT("Door fully closed"));
+                UE_LOG(LogBlackhole, Verbose, TEXT("Door fully closed"));
                 return;
             }
             break;
@@ -170,7 +187,7 @@ void AAutomaticDoor::OpenDoor()
     CurrentState = EDoorState::Opening;
     CancelAutoCloseTimer();
     
-    UE_LOG(LogTemp, Warning, TEXT("Door opening - Player is nearby and looking at door"));
+    UE_LOG(LogBlackhole, Verbose, TEXT("Door opening - Player is nearby and looking at door"));
 }
 
 void AAutomaticDoor::CloseDoor()
@@ -180,14 +197,14 @@ void AAutomaticDoor::CloseDoor()
     // Don't close if player is inside
     if (bPlayerInside)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Cannot close door - player is inside"));
+        UE_LOG(LogBlackhole, Verbose, TEXT("Cannot close door - player is inside"));
         return;
     }
     
     CurrentState = EDoorState::Closing;
     CancelAutoCloseTimer();
     
-    UE_LOG(LogTemp, Warning, TEXT("Door closing"));
+    UE_LOG(LogBlackhole, Verbose, TEXT("Door closing"));
 }
 
 void AAutomaticDoor::StartAutoCloseTimer()
@@ -195,7 +212,7 @@ void AAutomaticDoor::StartAutoCloseTimer()
     if (AutoCloseDelay > 0.0f && !bPlayerInside)
     {
         GetWorld()->GetTimerManager().SetTimer(AutoCloseTimer, this, &AAutomaticDoor::CloseDoor, AutoCloseDelay, false);
-        UE_LOG(LogTemp, Warning, TEXT("Auto-close timer started (%.1fs)"), AutoCloseDelay);
+        UE_LOG(LogBlackhole, Verbose, TEXT("Auto-close timer started (%.1fs)"), AutoCloseDelay);
     }
 }
 
@@ -204,7 +221,7 @@ void AAutomaticDoor::CancelAutoCloseTimer()
     if (GetWorld()->GetTimerManager().IsTimerActive(AutoCloseTimer))
     {
         GetWorld()->GetTimerManager().ClearTimer(AutoCloseTimer);
-        UE_LOG(LogTemp, Warning, TEXT("Auto-close timer cancelled"));
+        UE_LOG(LogBlackhole, Verbose, TEXT("Auto-close timer cancelled"));
     }
 }
 
@@ -216,7 +233,7 @@ void AAutomaticDoor::OnProximityBeginOverlap(UPrimitiveComponent* OverlappedComp
         bPlayerNearby = true;
         CachedPlayer = Player;
         
-        UE_LOG(LogTemp, Warning, TEXT("Player entered door proximity"));
+        UE_LOG(LogBlackhole, Verbose, TEXT("Player entered door proximity"));
     }
 }
 
@@ -234,7 +251,7 @@ void AAutomaticDoor::OnProximityEndOverlap(UPrimitiveComponent* OverlappedCompon
             StartAutoCloseTimer();
         }
         
-        UE_LOG(LogTemp, Warning, TEXT("Player left door proximity"));
+        UE_LOG(LogBlackhole, Verbose, TEXT("Player left door proximity"));
     }
 }
 
@@ -246,7 +263,7 @@ void AAutomaticDoor::OnInsideBeginOverlap(UPrimitiveComponent* OverlappedCompone
         bPlayerInside = true;
         CancelAutoCloseTimer(); // Don't close while player is inside
         
-        UE_LOG(LogTemp, Warning, TEXT("Player entered inside door area"));
+        UE_LOG(LogBlackhole, Verbose, TEXT("Player entered inside door area"));
     }
 }
 
@@ -260,6 +277,6 @@ void AAutomaticDoor::OnInsideEndOverlap(UPrimitiveComponent* OverlappedComponent
         // Close door immediately when player exits the inside area
         CloseDoor();
         
-        UE_LOG(LogTemp, Warning, TEXT("Player left inside door area - closing door"));
+        UE_LOG(LogBlackhole, Verbose, TEXT("Player left inside door area - closing door"));
     }
 }
\ No newline at end of file
@@ -1,10 +1,11 @@
 #include "Actors/GravityShiftVolume.h"
+#include "blackhole.h"
 #include "Components/BoxComponent.h"
 #include "Components/ArrowComponent.h"
 #include "GameFramework/Character.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Enemy/BaseEnemy.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 
 AGravityShiftVolume::AGravityShiftVolume()
 {
@@ -121,13 +122,13 @@ void AGravityShiftVolume::ApplyGravityToActor(AActor* Actor)
         GravityComp->SetGravityAxis(GravityAxis);
     }
 
-    UE_LOG(LogTemp, Log, TEXT("GravityShiftVolume: Applied gravity shift to %s"), *Actor->GetName());
+    UE_LOG(LogBlackholeMovement, Log, TEXT("GravityShiftVolume: Applied gravity shift to %s"), *Actor->GetName());
 
     #if WITH_EDITOR
     // Debug visualization
-    DrawDebugLine(GetWorld(), Actor->GetActorLocation(), 
+    BLACKHOLE_DEBUG_DRAW(Movement_Gravity, DrawDebugLine(GetWorld(), Actor->GetActorLocation(), 
         Actor->GetActorLocation() + (CustomGravityDirection * 300.0f), 
-        FColor::Blue, false, TransitionDuration + 1.0f, 0, 5.0f);
+        FColor::Blue, false, TransitionDuration + 1.0f, 0, 5.0f));
     #endif
 }
 
@@ -141,7 +142,7 @@ void AGravityShiftVolume::RestoreGravityForActor(AActor* Actor)
         // Restore to default gravity
         (*GravityCompPtr)->TransitionToGravityDirection(FVector(0, 0, -1), TransitionDuration);
         
-        UE_LOG(LogTemp, Log, TEXT("GravityShiftVolume: Restored gravity for %s"), *Actor->GetName());
+        UE_LOG(LogBlackholeMovement, Log, TEXT("GravityShiftVolume: Restored gravity for %s"), *Actor->GetName());
     }
 
     AffectedActors.Remove(Actor);
@@ -1,4 +1,6 @@
 #include "Actors/PsiDisruptor.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
 #include "Player/BlackholePlayerCharacter.h"
@@ -8,7 +10,8 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
+#include "Systems/BuildCoordinationSubsystem.h"
 
 APsiDisruptor::APsiDisruptor()
 {
@@ -42,6 +45,12 @@ void APsiDisruptor::BeginPlay()
 	DisruptionField->OnComponentBeginOverlap.AddDynamic(this, &APsiDisruptor::OnDisruptionFieldBeginOverlap);
 	DisruptionField->OnComponentEndOverlap.AddDynamic(this, &APsiDisruptor::OnDisruptionFieldEndOverlap);
 	
+	// Builders check this before starting another build
+	if (UBuildCoordinationSubsystem* Coordination = GetWorld()->GetSubsystem<UBuildCoordinationSubsystem>())
+	{
+		Coordination->RegisterDisruptor(this);
+	}
+	
 	// Start disruption effect
 	GetWorld()->GetTimerManager().SetTimer(DisruptionTickHandle, this, &APsiDisruptor::ApplyDisruption, 0.5f, true);
 	
@@ -49,7 +58,7 @@ void APsiDisruptor::BeginPlay()
 	if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
 	{
 		// TODO: Add UI notification
-		UE_LOG(LogTemp, Warning, TEXT("PSI-DISRUPTOR ACTIVE: Movement abilities disabled in area!"));
+		UE_LOG(LogBlackholeAI, Warning, TEXT("PSI-DISRUPTOR ACTIVE: Movement abilities disabled in area!"));
 	}
 }
 
@@ -59,6 +68,11 @@ void APsiDisruptor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (GetWorld())
 	{
 		GetWorld()->GetTimerManager().ClearTimer(DisruptionTickHandle);
+		
+		if (UBuildCoordinationSubsystem* Coordination = GetWorld()->GetSubsystem<UBuildCoordinationSubsystem>())
+		{
+			Coordination->UnregisterDisruptor(this);
+		}
 	}
 	
 	// Remove disruption from all affected players
@@ -69,6 +83,8 @@ void APsiDisruptor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void APsiDisruptor::Tick(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Psi Disruptor Tick", STAT_Blackhole_PsiDisruptorTick, BlackholeSystemsChannel);
+
 	Super::Tick(DeltaTime);
 	
 	// Visual effect - rotate core
@@ -81,7 +97,7 @@ void APsiDisruptor::Tick(float DeltaTime)
 	
 	#if WITH_EDITOR
 	// Debug visualization
-	DrawDebugSphere(GetWorld(), GetActorLocation(), DisruptionRadius, 32, FColor::Purple, false, -1.0f, 0, 2.0f);
+	BLACKHOLE_DEBUG_DRAW(World, DrawDebugSphere(GetWorld(), GetActorLocation(), DisruptionRadius, 32, FColor::Purple, false, -1.0f, 0, 2.0f));
 	#endif
 }
 
@@ -90,13 +106,13 @@ float APsiDisruptor::TakeDamage(float DamageAmount, struct FDamageEvent const& D
 {
 	// Psi-Disruptor is invulnerable to normal damage
 	// Can only be destroyed by singularity ability
-	UE_LOG(LogTemp, Warning, TEXT("Psi-Disruptor is immune to normal damage! Use Singularity (Ultimate Gravity Pull) to destroy it."));
+	UE_LOG(LogBlackholeAI, Warning, TEXT("Psi-Disruptor is immune to normal damage! Use Singularity (Ultimate Gravity Pull) to destroy it."));
 	return 0.0f;
 }
 
 void APsiDisruptor::DestroyByUltimate()
 {
-	UE_LOG(LogTemp, Warning, TEXT("Psi-Disruptor destroyed by Gravity Pull Ultimate!"));
+	UE_LOG(LogBlackholeAI, Warning, TEXT("Psi-Disruptor destroyed by Gravity Pull Ultimate!"));
 	
 	// Play destruction effect
 	// TODO: Add particle effect
@@ -109,7 +125,7 @@ void APsiDisruptor::ApplyDisruption()
 {
 	// Visual pulse effect
 	#if WITH_EDITOR
-	DrawDebugSphere(GetWorld(), GetActorLocation(), DisruptionRadius * 1.1f, 32, FColor::Red, false, 0.5f);
+	BLACKHOLE_DEBUG_DRAW(World, DrawDebugSphere(GetWorld(), GetActorLocation(), DisruptionRadius * 1.1f, 32, FColor::Red, false, 0.5f));
 	#endif
 }
 
@@ -134,7 +150,7 @@ void APsiDisruptor::RemoveDisruption()
 				WallRun->SetComponentTickEnabled(true);
 			}
 			
-			UE_LOG(LogTemp, Warning, TEXT("Movement abilities restored for player"));
+			UE_LOG(LogBlackholeAI, Warning, TEXT("Movement abilities restored for player"));
 		}
 	}
 	
@@ -162,7 +178,7 @@ void APsiDisruptor::OnDisruptionFieldBeginOverlap(UPrimitiveComponent* Overlappe
 		
 		AffectedPlayers.AddUnique(OtherActor);
 		
-		UE_LOG(LogTemp, Warning, TEXT("Player entered disruption field - movement abilities disabled!"));
+		UE_LOG(LogBlackholeAI, Warning, TEXT("Player entered disruption field - movement abilities disabled!"));
 	}
 }
 
@@ -187,6 +203,6 @@ void APsiDisruptor::OnDisruptionFieldEndOverlap(UPrimitiveComponent* OverlappedC
 		
 		AffectedPlayers.Remove(OtherActor);
 		
-		UE_LOG(LogTemp, Warning, TEXT("Player left disruption field - movement abilities restored!"));
+		UE_LOG(LogBlackholeAI, Warning, TEXT("Player left disruption field - movement abilities restored!"));
 	}
 }
\ No newline at end of file
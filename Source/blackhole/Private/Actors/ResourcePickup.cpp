@@ -1,4 +1,6 @@
 #include "Actors/ResourcePickup.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Systems/ResourceManager.h"
@@ -47,7 +49,7 @@ void AResourcePickup::BeginPlay()
 			ResourceManager = GameInstance->GetSubsystem<UResourceManager>();
 			if (!ResourceManager)
 			{
-				UE_LOG(LogTemp, Error, TEXT("ResourcePickup: Failed to get ResourceManager!"));
+				UE_LOG(LogBlackholeResources, Error, TEXT("ResourcePickup: Failed to get ResourceManager!"));
 			}
 		}
 	}
@@ -101,8 +103,8 @@ void AResourcePickup::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, A
 	}
 	else
 	{
-		// Destroy if no respawn
-		Destroy();
+		// No respawn - stay dormant rather than destroyed so a level restart can bring it back
+		SetActorTickEnabled(false);
 	}
 }
 
@@ -110,7 +112,7 @@ void AResourcePickup::ApplyPickupEffect(AActor* TargetActor)
 {
 	if (!ResourceManager)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ResourcePickup: ResourceManager is null in ApplyPickupEffect!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ResourcePickup: ResourceManager is null in ApplyPickupEffect!"));
 		return;
 	}
 	
@@ -142,13 +144,13 @@ void AResourcePickup::ApplyPickupEffect(AActor* TargetActor)
 	{
 		case EPickupType::WillPower:
 			ResourceManager->AddWillPower(RestoreAmount);
-			UE_LOG(LogTemp, Log, TEXT("Pickup: Restored %.0f WillPower"), RestoreAmount);
+			UE_LOG(LogBlackholeResources, Log, TEXT("Pickup: Restored %.0f WillPower"), RestoreAmount);
 			break;
 			
 		case EPickupType::HeatVent:
 			// Heat system removed - convert heat vents to WP pickups
 			ResourceManager->AddWillPower(RestoreAmount);
-			UE_LOG(LogTemp, Log, TEXT("Pickup: Restored %.0f WillPower (Heat system removed)"), RestoreAmount);
+			UE_LOG(LogBlackholeResources, Log, TEXT("Pickup: Restored %.0f WillPower (Heat system removed)"), RestoreAmount);
 			break;
 	}
 }
@@ -165,11 +167,28 @@ void AResourcePickup::RespawnPickup()
 		ActiveIdleEffect->ActivateSystem();
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Pickup: Respawned"));
+	UE_LOG(LogBlackholeResources, Log, TEXT("Pickup: Respawned"));
+}
+
+void AResourcePickup::ResetPickup()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(RespawnTimerHandle);
+	}
+	
+	SetActorTickEnabled(true);
+	
+	if (IsHidden())
+	{
+		RespawnPickup();
+	}
 }
 
 void AResourcePickup::Tick(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Resource Pickup Tick", STAT_Blackhole_ResourcePickupTick, BlackholeSystemsChannel);
+
 	Super::Tick(DeltaTime);
 	
 	// Rotate pickup
@@ -1,6 +1,11 @@
 #include "Components/Abilities/AbilityComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Systems/ResourceManager.h"
 #include "Systems/ThresholdManager.h"
+#include "Systems/BuffManager.h"
+#include "Systems/AbilityCooldownManager.h"
+#include "Systems/AbilityAssetPreloader.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "Config/GameplayConfig.h"
@@ -10,28 +15,25 @@
 
 UAbilityComponent::UAbilityComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = false; // Optimize: only tick when needed
+	// Cooldowns are timestamps in UAbilityCooldownManager - the base ability never ticks.
+	// Subclasses that need per-frame work (charge, channels, jump timers) opt back in.
+	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	
 	Cooldown = GameplayConfig::Abilities::Defaults::COOLDOWN;
 	WPCost = 0.0f;
 	Range = GameplayConfig::Abilities::Defaults::RANGE;
-	CurrentCooldown = 0.0f;
-	bIsOnCooldown = false;
 	bIsInUltimateMode = false;
 	bIsBasicAbility = false; // Most abilities are not basic
 	bIsDisabled = false; // Start enabled
 	CurrentState = EAbilityState::Ready;
-	bTickOnlyWhenActive = true;
+	CooldownManager = nullptr;
 }
 
 void UAbilityComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	
-	CurrentCooldown = 0.0f;
-	bIsOnCooldown = false;
-	
 	// Cache resource manager reference
 	ResourceManager = GetResourceManager();
 	
@@ -39,58 +41,72 @@ void UAbilityComponent::BeginPlay()
 	if (UWorld* World = GetWorld())
 	{
 		ThresholdManager = World->GetSubsystem<UThresholdManager>();
+		
+		CooldownManager = World->GetSubsystem<UAbilityCooldownManager>();
+		if (CooldownManager)
+		{
+			CooldownEntry = CooldownManager->RegisterAbility(this);
+		}
+		
+		// Player loadout and enemy roster both come through here as the level begins play
+		if (UAbilityAssetPreloader* Preloader = World->GetSubsystem<UAbilityAssetPreloader>())
+		{
+			Preloader->RequestAbilityAssets(this);
+		}
+		
+		// Combat buffs and the ability registry belong to the player - enemy abilities never use them
+		if (Cast<ABlackholePlayerCharacter>(GetOwner()))
+		{
+			BuffManager = World->GetSubsystem<UBuffManager>();
+			
+			if (ThresholdManager)
+			{
+				ThresholdManager->RegisterPlayerAbility(this);
+			}
+		}
 	}
 }
 
 void UAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Reset cooldown state to prevent persistence between PIE sessions
-	CurrentCooldown = 0.0f;
-	bIsOnCooldown = false;
+	// Release the cooldown row to prevent persistence between PIE sessions
+	if (IsValid(CooldownManager))
+	{
+		CooldownManager->UnregisterAbility(CooldownEntry);
+	}
+	CooldownEntry = INDEX_NONE;
 	bIsInUltimateMode = false;
 	// DO NOT reset bIsDisabled - it should persist for the game session
 	// bIsDisabled = false; // REMOVED - disabled abilities should stay disabled
 	
+	if (IsValid(ThresholdManager) && RegistrySlot != INDEX_NONE)
+	{
+		ThresholdManager->UnregisterPlayerAbility(this);
+	}
+	
 	// Clear cached references
 	ResourceManager = nullptr;
 	ThresholdManager = nullptr;
+	BuffManager = nullptr;
+	CooldownManager = nullptr;
 	
 	Super::EndPlay(EndPlayReason);
 }
 
-void UAbilityComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	if (bIsOnCooldown && CurrentCooldown > 0.0f)
-	{
-		CurrentCooldown -= DeltaTime;
-		
-		if (CurrentCooldown <= 0.0f)
-		{
-			ResetCooldown();
-			// Disable tick when not needed
-			if (bTickOnlyWhenActive)
-			{
-				SetTickEnabled(false);
-			}
-		}
-	}
-}
-
 bool UAbilityComponent::CanExecute() const
 {
 	// FIRST AND MOST IMPORTANT CHECK - permanently disabled abilities cannot execute
 	if (bIsDisabled)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Ability %s: CanExecute() = FALSE - PERMANENTLY DISABLED after ultimate sacrifice!"), *GetName());
+		// Polled every frame by the player input buffer - keep this quiet
+		UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: CanExecute() = FALSE - PERMANENTLY DISABLED after ultimate sacrifice!"), *GetName());
 		return false;
 	}
 	
 	// ULTIMATE MODE BYPASS - if in ultimate mode, skip most checks
 	if (bIsInUltimateMode && !bIsBasicAbility)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Ability %s: Ultimate mode active - bypassing normal checks"), *GetName());
+		UE_LOG(LogBlackholeAbilities, VeryVerbose, TEXT("Ability %s: Ultimate mode active - bypassing normal checks"), *GetName());
 		
 		// Only check if owner is alive
 		if (AActor* Owner = GetOwner())
@@ -106,7 +122,7 @@ bool UAbilityComponent::CanExecute() const
 	// Check ability state
 	if (CurrentState == EAbilityState::Disabled || CurrentState == EAbilityState::Executing)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("Ability %s: CanExecute() = FALSE - State is %d"), *GetName(), (int32)CurrentState);
+		UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: CanExecute() = FALSE - State is %d"), *GetName(), (int32)CurrentState);
 		return false;
 	}
 	
@@ -125,7 +141,7 @@ bool UAbilityComponent::CanExecute() const
 			{
 				if (!StatusComp->CanAct())
 				{
-					UE_LOG(LogTemp, Verbose, TEXT("Ability %s: CanExecute() = FALSE - Status effects prevent action"), *GetName());
+					UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: CanExecute() = FALSE - Status effects prevent action"), *GetName());
 					return false;
 				}
 			}
@@ -135,7 +151,7 @@ bool UAbilityComponent::CanExecute() const
 			{
 				if (!WallRunComp->CanUseAbilityDuringWallRun(this))
 				{
-					UE_LOG(LogTemp, Verbose, TEXT("Ability %s: CanExecute() = FALSE - Blocked during wall run"), *GetName());
+					UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: CanExecute() = FALSE - Blocked during wall run"), *GetName());
 					return false;
 				}
 			}
@@ -147,7 +163,7 @@ bool UAbilityComponent::CanExecute() const
 			{
 				if (!StatusComp->CanAct())
 				{
-					UE_LOG(LogTemp, Verbose, TEXT("Ability %s: CanExecute() = FALSE - Status effects prevent action"), *GetName());
+					UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: CanExecute() = FALSE - Status effects prevent action"), *GetName());
 					return false;
 				}
 			}
@@ -158,7 +174,7 @@ bool UAbilityComponent::CanExecute() const
 		return false;
 	}
 	
-	if (bIsOnCooldown)
+	if (!bIgnoreCooldownCheck && IsOnCooldown())
 	{
 		return false;
 	}
@@ -167,12 +183,18 @@ bool UAbilityComponent::CanExecute() const
 	return ValidateResources();
 }
 
+bool UAbilityComponent::CanExecuteIgnoringCooldown() const
+{
+	TGuardValue<bool> IgnoreCooldown(bIgnoreCooldownCheck, true);
+	return CanExecute();
+}
+
 bool UAbilityComponent::ValidateResources() const
 {
 	// If in ultimate mode, resources are not required
 	if (bIsInUltimateMode)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("Ability %s: Resource validation bypassed - in ultimate mode"), *GetName());
+		UE_LOG(LogBlackholeAbilities, VeryVerbose, TEXT("Ability %s: Resource validation bypassed - in ultimate mode"), *GetName());
 		return true;
 	}
 	
@@ -190,7 +212,7 @@ bool UAbilityComponent::ValidateResources() const
 		// If WP > 0, ALWAYS allow ability use (to trigger critical state)
 		if (CurrentWP > 0.0f)
 		{
-			UE_LOG(LogTemp, Verbose, TEXT("Ability %s: WP > 0 (%.1f) - allowing use regardless of cost (%.1f)"), 
+			UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: WP > 0 (%.1f) - allowing use regardless of cost (%.1f)"), 
 				*GetName(), CurrentWP, WPCost);
 			return true;
 		}
@@ -198,7 +220,7 @@ bool UAbilityComponent::ValidateResources() const
 		// If WP = 0, only block if not in ultimate mode
 		if (CurrentWP <= 0.0f)
 		{
-			UE_LOG(LogTemp, Verbose, TEXT("Ability %s: WP at 0, blocking unless in ultimate mode"), *GetName());
+			UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: WP at 0, blocking unless in ultimate mode"), *GetName());
 			return false; // Will be bypassed if in ultimate mode
 		}
 	}
@@ -208,14 +230,17 @@ bool UAbilityComponent::ValidateResources() const
 
 void UAbilityComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("AbilityComponent Execute", STAT_Blackhole_AbilityComponent_Execute, BlackholeAbilitiesChannel);
+	INC_DWORD_STAT(STAT_Blackhole_AbilityExecutions);
+
 	// Double-check disabled state
 	if (bIsDisabled)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Ability %s: Execute called on DISABLED ability! This should not happen!"), *GetName());
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("Ability %s: Execute called on DISABLED ability! This should not happen!"), *GetName());
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("Ability %s: Execute() called, bIsInUltimateMode=%s, bIsDisabled=%s"), 
+	UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Ability %s: Execute() called, bIsInUltimateMode=%s, bIsDisabled=%s"), 
 		*GetName(), bIsInUltimateMode ? TEXT("TRUE") : TEXT("FALSE"), bIsDisabled ? TEXT("TRUE") : TEXT("FALSE"));
 	
 	if (CanExecute())
@@ -226,7 +251,7 @@ void UAbilityComponent::Execute()
 		if (bIsInUltimateMode && !bIsBasicAbility)
 		{
 			// Execute ultimate version - no resource cost, no cooldown
-			UE_LOG(LogTemp, Warning, TEXT("Ability %s: Executing ULTIMATE version!"), *GetName());
+			UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ability %s: Executing ULTIMATE version!"), *GetName());
 			ExecuteUltimate();
 			
 			// Notify threshold manager that an ultimate was used
@@ -249,15 +274,17 @@ void UAbilityComponent::Execute()
 			// Use new resource consumption
 			ConsumeAbilityResources();
 			
-			SetAbilityState(EAbilityState::Cooldown);
+			SetAbilityState(IsOnCooldown() ? EAbilityState::Cooldown : EAbilityState::Ready);
 		}
 	}
 }
 
 void UAbilityComponent::ExecuteUltimate()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("AbilityComponent Execute Ultimate", STAT_Blackhole_AbilityComponent_ExecuteUltimate, BlackholeAbilitiesChannel);
+
 	// Default implementation - abilities will override this
-	UE_LOG(LogTemp, Warning, TEXT("Ability %s: ExecuteUltimate (base implementation, IsInUltimateMode=%s)"), 
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ability %s: ExecuteUltimate (base implementation, IsInUltimateMode=%s)"), 
 		*GetName(), bIsInUltimateMode ? TEXT("TRUE") : TEXT("FALSE"));
 	
 	// Ultimate abilities have no resource costs and no cooldowns
@@ -266,7 +293,7 @@ void UAbilityComponent::ExecuteUltimate()
 	// Ensure the ability is marked as being in ultimate mode
 	if (!bIsInUltimateMode)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Ability %s: ExecuteUltimate called but bIsInUltimateMode is FALSE! Setting to TRUE"), *GetName());
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("Ability %s: ExecuteUltimate called but bIsInUltimateMode is FALSE! Setting to TRUE"), *GetName());
 		bIsInUltimateMode = true;
 	}
 }
@@ -278,8 +305,7 @@ void UAbilityComponent::SetUltimateMode(bool bEnabled)
 	if (bEnabled && !bIsBasicAbility)
 	{
 		// Clear cooldown when entering ultimate mode
-		bIsOnCooldown = false;
-		CurrentCooldown = 0.0f;
+		ResetCooldown();
 		
 		// Reset ability state to ready
 		if (CurrentState == EAbilityState::Cooldown)
@@ -287,41 +313,70 @@ void UAbilityComponent::SetUltimateMode(bool bEnabled)
 			SetAbilityState(EAbilityState::Ready);
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("Ability %s: Ultimate mode enabled - cooldown cleared"), *GetName());
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ability %s: Ultimate mode enabled - cooldown cleared"), *GetName());
 	}
 }
 
+float UAbilityComponent::GetCooldownRemaining() const
+{
+	return CooldownManager ? CooldownManager->GetCooldownRemaining(CooldownEntry) : 0.0f;
+}
+
+float UAbilityComponent::GetCooldownDuration() const
+{
+	return CooldownManager ? CooldownManager->GetCooldownDuration(CooldownEntry) : 0.0f;
+}
+
 float UAbilityComponent::GetCooldownPercentage() const
 {
-	return Cooldown > 0.0f ? CurrentCooldown / Cooldown : 0.0f;
+	return Cooldown > 0.0f ? GetCooldownRemaining() / Cooldown : 0.0f;
+}
+
+bool UAbilityComponent::IsOnCooldown() const
+{
+	return CooldownManager && CooldownManager->IsOnCooldown(CooldownEntry);
+}
+
+void UAbilityComponent::OnCooldownReady()
+{
+	if (CurrentState == EAbilityState::Cooldown)
+	{
+		SetAbilityState(EAbilityState::Ready);
+	}
 }
 
 void UAbilityComponent::StartCooldown()
 {
 	float CooldownDuration = GetCooldownWithReduction();
-	if (CooldownDuration > 0.0f)
+	if (CooldownDuration > 0.0f && CooldownManager)
 	{
-		bIsOnCooldown = true;
-		CurrentCooldown = CooldownDuration;
-		// Enable tick for cooldown countdown
-		if (bTickOnlyWhenActive)
-		{
-			SetTickEnabled(true);
-		}
+		// Stored as an expiry timestamp - nothing ticks while the cooldown runs
+		CooldownManager->StartCooldown(CooldownEntry, CooldownDuration);
 	}
 	else
 	{
 		// No cooldown needed
-		bIsOnCooldown = false;
-		CurrentCooldown = 0.0f;
+		ResetCooldown();
 		SetAbilityState(EAbilityState::Ready);
 	}
 }
 
 void UAbilityComponent::ResetCooldown()
 {
-	bIsOnCooldown = false;
-	CurrentCooldown = 0.0f;
+	if (CooldownManager)
+	{
+		CooldownManager->ClearCooldown(CooldownEntry);
+	}
+}
+
+void UAbilityComponent::ResetCooldownForRestart()
+{
+	ResetCooldown();
+
+	if (CurrentState == EAbilityState::Cooldown)
+	{
+		SetAbilityState(EAbilityState::Ready);
+	}
 }
 
 UResourceManager* UAbilityComponent::GetResourceManager() const
@@ -339,21 +394,13 @@ UResourceManager* UAbilityComponent::GetResourceManager() const
 
 float UAbilityComponent::GetDamageMultiplier() const
 {
-	// Use default value if ThresholdManager is not available
-	// This prevents crashes when the subsystem isn't initialized yet
-	return 1.0f;
+	// Cached final value from the buff stack - no aggregation happens here
+	return IsValid(BuffManager) ? BuffManager->GetAttributeValue(EBuffAttribute::Damage) : 1.0f;
 }
 
 float UAbilityComponent::GetCooldownWithReduction() const
 {
-	// Use base cooldown without reduction for now
-	// This prevents crashes when the subsystem isn't initialized yet
-	return Cooldown;
-}
-
-void UAbilityComponent::SetTickEnabled(bool bEnabled)
-{
-	SetComponentTickEnabled(bEnabled);
+	return IsValid(BuffManager) ? BuffManager->CalculateFinalCooldown(Cooldown) : Cooldown;
 }
 
 void UAbilityComponent::SetAbilityState(EAbilityState NewState)
@@ -394,10 +441,10 @@ bool UAbilityComponent::ConsumeAbilityResources()
 		{
 			if (!ResMgr->ConsumeWillPower(WPCost))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("%s: Not enough WP to use ability (need %.1f)"), *GetName(), WPCost);
+				UE_LOG(LogBlackholeAbilities, Warning, TEXT("%s: Not enough WP to use ability (need %.1f)"), *GetName(), WPCost);
 				return false;
 			}
-			UE_LOG(LogTemp, VeryVerbose, TEXT("%s consumed %.1f WP"), *GetName(), WPCost);
+			UE_LOG(LogBlackholeAbilities, VeryVerbose, TEXT("%s consumed %.1f WP"), *GetName(), WPCost);
 		}
 
 		return true;
@@ -1,14 +1,19 @@
 #include "Components/Abilities/ComboAbilityComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Systems/HitStopManager.h"
 #include "Systems/ResourceManager.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Config/GameplayConfig.h"
 #include "Math/UnrealMathUtility.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
 
 UComboAbilityComponent::UComboAbilityComponent()
 {
@@ -56,7 +61,7 @@ void UComboAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
             WorldSettings->SetTimeDilation(1.0f);
         }
         bIsTimeSlowActive = false;
-        UE_LOG(LogTemp, Log, TEXT("ComboAbility: Reset time dilation in EndPlay"));
+        UE_LOG(LogBlackholeAbilities, Log, TEXT("ComboAbility: Reset time dilation in EndPlay"));
     }
     
     Super::EndPlay(EndPlayReason);
@@ -71,12 +76,14 @@ bool UComboAbilityComponent::CanExecute() const
 
 void UComboAbilityComponent::Execute()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("ComboAbility Execute", STAT_Blackhole_ComboAbility_Execute, BlackholeAbilitiesChannel);
+
     // Reset any existing time slow before executing new combo
     if (bIsTimeSlowActive && IsValid(CachedWorld))
     {
         UGameplayStatics::SetGlobalTimeDilation(CachedWorld, 1.0f);
         bIsTimeSlowActive = false;
-        UE_LOG(LogTemp, Log, TEXT("ComboAbility: Reset time before new combo execution"));
+        UE_LOG(LogBlackholeAbilities, Log, TEXT("ComboAbility: Reset time before new combo execution"));
     }
     
     // Execute the combo
@@ -86,12 +93,14 @@ void UComboAbilityComponent::Execute()
     if (UResourceManager* ResourceMgr = GetResourceManager())
     {
         ResourceMgr->AddWillPower(WPRewardAmount);
-        UE_LOG(LogTemp, Warning, TEXT("Combo %s executed: Player gained +%.1f WP"), *GetName(), WPRewardAmount);
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("Combo %s executed: Player gained +%.1f WP"), *GetName(), WPRewardAmount);
     }
 }
 
 void UComboAbilityComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("ComboAbility Tick", STAT_Blackhole_ComboAbility_Tick, BlackholeAbilitiesChannel);
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     // Check if time slow should end (using real time)
@@ -123,7 +132,7 @@ void UComboAbilityComponent::TickComponent(float DeltaTime, ELevelTick TickType,
             
             // Verify the reset worked
             float NewDilation = UGameplayStatics::GetGlobalTimeDilation(CachedWorld);
-            UE_LOG(LogTemp, Warning, TEXT("ComboAbility: Time reset - Was: %f, Now: %f, TimeSlowEndTime: %f, CurrentTime: %f"), 
+            UE_LOG(LogBlackholeAbilities, Warning, TEXT("ComboAbility: Time reset - Was: %f, Now: %f, TimeSlowEndTime: %f, CurrentTime: %f"), 
                 CurrentDilation, NewDilation, TimeSlowEndTime, CurrentRealTime);
         }
     }
@@ -136,7 +145,7 @@ void UComboAbilityComponent::ApplyTimeSlow()
     // If scale is 0 or negative, don't apply time slow
     if (TimeSlowScale <= 0.0f)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ComboAbility: TimeSlowScale is %f, skipping time slow"), TimeSlowScale);
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("ComboAbility: TimeSlowScale is %f, skipping time slow"), TimeSlowScale);
         return;
     }
     
@@ -145,7 +154,7 @@ void UComboAbilityComponent::ApplyTimeSlow()
     {
         if (HitStopMgr->IsHitStopActive())
         {
-            UE_LOG(LogTemp, Warning, TEXT("ComboAbility: HitStop is active, skipping time slow to avoid conflicts"));
+            UE_LOG(LogBlackholeAbilities, Warning, TEXT("ComboAbility: HitStop is active, skipping time slow to avoid conflicts"));
             return;
         }
     }
@@ -158,7 +167,7 @@ void UComboAbilityComponent::ApplyTimeSlow()
     {
         UGameplayStatics::SetGlobalTimeDilation(CachedWorld, 1.0f);
         bIsTimeSlowActive = false;
-        UE_LOG(LogTemp, Warning, TEXT("ComboAbility: Reset existing time slow from %f to 1.0"), CurrentDilation);
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("ComboAbility: Reset existing time slow from %f to 1.0"), CurrentDilation);
     }
     
     // Apply time dilation using both methods to ensure consistency
@@ -174,7 +183,7 @@ void UComboAbilityComponent::ApplyTimeSlow()
     
     // Verify it was applied
     float NewDilation = UGameplayStatics::GetGlobalTimeDilation(CachedWorld);
-    UE_LOG(LogTemp, Warning, TEXT("ComboAbility: Applied time slow - Requested: %f, Actual: %f, Duration: %f, EndTime: %f"), 
+    UE_LOG(LogBlackholeAbilities, Warning, TEXT("ComboAbility: Applied time slow - Requested: %f, Actual: %f, Duration: %f, EndTime: %f"), 
         TimeSlowScale, NewDilation, TimeSlowDuration, TimeSlowEndTime);
 }
 
@@ -207,10 +216,10 @@ void UComboAbilityComponent::DrawComboVisuals(const FVector& Start, const FVecto
     
     #if WITH_EDITOR
     // Draw combo trail
-    DrawDebugLine(CachedWorld, Start, End, ComboTrailColor.ToFColor(true), false, 2.0f, 0, 5.0f);
+    BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugLine(CachedWorld, Start, End, ComboTrailColor.ToFColor(true), false, 2.0f, 0, 5.0f));
     
     // Draw impact sphere
-    DrawDebugSphere(CachedWorld, End, 50.0f, 16, ComboTrailColor.ToFColor(true), false, 1.0f);
+    BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, End, 50.0f, 16, ComboTrailColor.ToFColor(true), false, 1.0f));
     #endif
 }
 
@@ -219,15 +228,15 @@ void UComboAbilityComponent::PlayComboFeedback(const FVector& Location)
     if (!IsValid(CachedWorld)) return;
     
     // Play sound
-    if (ComboSound)
+    if (USoundBase* Sound = ResolveAbilityAsset(ComboSound))
     {
-        UGameplayStatics::PlaySoundAtLocation(CachedWorld, ComboSound, Location);
+        UGameplayStatics::PlaySoundAtLocation(CachedWorld, Sound, Location);
     }
     
     // Spawn particle effect
-    if (ComboParticle)
+    if (UParticleSystem* Effect = ResolveAbilityAsset(ComboParticle))
     {
-        UGameplayStatics::SpawnEmitterAtLocation(CachedWorld, ComboParticle, Location);
+        UGameplayStatics::SpawnEmitterAtLocation(CachedWorld, Effect, Location);
     }
     
     // Camera shake
@@ -238,4 +247,10 @@ void UComboAbilityComponent::PlayComboFeedback(const FVector& Location)
             PC->ClientStartCameraShake(nullptr, CameraShakeScale);
         }
     }
+}
+
+void UComboAbilityComponent::GatherAssetManifest(FAbilityAssetManifest& Manifest) const
+{
+    Manifest.Add(ComboSound);
+    Manifest.Add(ComboParticle);
 }
\ No newline at end of file
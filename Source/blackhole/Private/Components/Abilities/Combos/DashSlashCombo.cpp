@@ -1,16 +1,20 @@
 #include "Components/Abilities/Combos/DashSlashCombo.h"
+#include "Debug/BlackholeStats.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Systems/HitStopManager.h"
 #include "Engine/DamageEvents.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "CollisionQueryParams.h"
 #include "Engine/EngineTypes.h"
 #include "Components/CapsuleComponent.h"
 #include "Particles/ParticleSystemComponent.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
 
 UDashSlashCombo::UDashSlashCombo()
 {
@@ -66,14 +70,14 @@ void UDashSlashCombo::ExecuteCombo()
             ApplyTimeSlow();
             
             // Play teleport effects
-            if (TeleportParticle)
+            if (UParticleSystem* Effect = ResolveAbilityAsset(TeleportParticle))
             {
-                UGameplayStatics::SpawnEmitterAtLocation(CachedWorld, TeleportParticle, 
+                UGameplayStatics::SpawnEmitterAtLocation(CachedWorld, Effect, 
                     OwnerCharacter->GetActorLocation());
             }
-            if (TeleportSound)
+            if (USoundBase* Sound = ResolveAbilityAsset(TeleportSound))
             {
-                UGameplayStatics::PlaySoundAtLocation(CachedWorld, TeleportSound, 
+                UGameplayStatics::PlaySoundAtLocation(CachedWorld, Sound, 
                     OwnerCharacter->GetActorLocation());
             }
             
@@ -116,6 +120,7 @@ bool UDashSlashCombo::TeleportBehindTarget(AActor* Target)
     FVector GroundCheckStart = TeleportLocation + FVector(0, 0, 100);
     FVector GroundCheckEnd = TeleportLocation - FVector(0, 0, 200);
     
+    BLACKHOLE_COUNT_QUERY(MovementTraces);
     if (CachedWorld->LineTraceSingleByChannel(GroundHit, GroundCheckStart, GroundCheckEnd, 
         ECC_WorldStatic))
     {
@@ -146,7 +151,7 @@ void UDashSlashCombo::CreatePhantomAfterImage()
     if (bShowDebugVisuals && OwnerCharacter)
     {
         // Debug visualization of after-image
-        DrawDebugCapsule(CachedWorld, 
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugCapsule(CachedWorld, 
             OwnerCharacter->GetActorLocation(),
             OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight(),
             OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius(),
@@ -155,7 +160,7 @@ void UDashSlashCombo::CreatePhantomAfterImage()
             false,
             PhantomAfterImageDuration,
             0,
-            1.0f);
+            1.0f));
     }
     #endif
 }
@@ -181,6 +186,7 @@ AActor* UDashSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
     // First, try a direct line trace to see if we hit something in the crosshair
     FVector End = Start + (Forward * SearchRange);
     FHitResult DirectHit;
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     bool bDirectHit = CachedWorld->LineTraceSingleByChannel(DirectHit, Start, End, ECC_Pawn, QueryParams);
     
     if (bDirectHit && DirectHit.GetActor())
@@ -195,8 +201,8 @@ AActor* UDashSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
                 #if WITH_EDITOR
                 if (bShowDebugVisuals)
                 {
-                    DrawDebugSphere(CachedWorld, DirectTarget->GetActorLocation(), 60.0f, 12, FColor::Orange, false, 1.0f, 0, 4.0f);
-                    DrawDebugLine(CachedWorld, Start, DirectTarget->GetActorLocation(), FColor::Orange, false, 1.0f, 0, 3.0f);
+                    BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, DirectTarget->GetActorLocation(), 60.0f, 12, FColor::Orange, false, 1.0f, 0, 4.0f));
+                    BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugLine(CachedWorld, Start, DirectTarget->GetActorLocation(), FColor::Orange, false, 1.0f, 0, 3.0f));
                 }
                 #endif
                 return DirectTarget;
@@ -209,6 +215,7 @@ AActor* UDashSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
     float SphereRadius = AimForgivenessRadius;
     
     // Sphere sweep to find all potential targets
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     CachedWorld->SweepMultiByChannel(
         HitResults,
         Start,
@@ -293,18 +300,26 @@ AActor* UDashSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
     {
         // Show the search area with different colors for ground vs air
         FColor SearchColor = bPlayerOnGround ? FColor::Red : FColor::Yellow;
-        DrawDebugSphere(CachedWorld, Start, SphereRadius, 16, SearchColor, false, 0.5f);
-        DrawDebugSphere(CachedWorld, End, SphereRadius, 16, SearchColor, false, 0.5f);
-        DrawDebugLine(CachedWorld, Start, End, SearchColor, false, 0.5f, 0, 2.0f);
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, Start, SphereRadius, 16, SearchColor, false, 0.5f));
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, End, SphereRadius, 16, SearchColor, false, 0.5f));
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugLine(CachedWorld, Start, End, SearchColor, false, 0.5f, 0, 2.0f));
         
         // Highlight the selected target
         if (BestTarget)
         {
             FColor TargetColor = bPlayerOnGround ? FColor::Cyan : FColor::Green;
-            DrawDebugSphere(CachedWorld, BestTarget->GetActorLocation(), 50.0f, 12, TargetColor, false, 1.0f, 0, 3.0f);
+            BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, BestTarget->GetActorLocation(), 50.0f, 12, TargetColor, false, 1.0f, 0, 3.0f));
         }
     }
     #endif
     
     return BestTarget;
+}
+
+void UDashSlashCombo::GatherAssetManifest(FAbilityAssetManifest& Manifest) const
+{
+    Super::GatherAssetManifest(Manifest);
+
+    Manifest.Add(TeleportParticle);
+    Manifest.Add(TeleportSound);
 }
\ No newline at end of file
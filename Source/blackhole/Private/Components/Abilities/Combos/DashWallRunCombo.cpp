@@ -1,5 +1,6 @@
 // DashWallRunCombo.cpp
 #include "Components/Abilities/Combos/DashWallRunCombo.h"
+#include "blackhole.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Components/Movement/WallRunComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -43,7 +44,7 @@ void UDashWallRunCombo::ExecuteCombo()
     {
         // This would require adding a speed multiplier method to WallRunComponent
         // For now, the combo detection and WP reward is the main feature
-        UE_LOG(LogTemp, Warning, TEXT("Dash + Wall Run combo executed successfully!"));
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("Dash + Wall Run combo executed successfully!"));
     }
     
     // Grant WP reward
@@ -52,7 +53,7 @@ void UDashWallRunCombo::ExecuteCombo()
         if (UResourceManager* ResourceMgr = GameInstance->GetSubsystem<UResourceManager>())
         {
             ResourceMgr->AddWillPower(WPRewardAmount);
-            UE_LOG(LogTemp, Warning, TEXT("Dash + Wall Run combo: Granted %f WP"), WPRewardAmount);
+            UE_LOG(LogBlackholeAbilities, Warning, TEXT("Dash + Wall Run combo: Granted %f WP"), WPRewardAmount);
         }
     }
     
@@ -1,11 +1,13 @@
 #include "Components/Abilities/Combos/JumpSlashCombo.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Systems/HitStopManager.h"
 #include "Engine/DamageEvents.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "CollisionQueryParams.h"
 #include "Engine/EngineTypes.h"
@@ -13,6 +15,9 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "TimerManager.h"
 #include "Engine/OverlapResult.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
 
 UJumpSlashCombo::UJumpSlashCombo()
 {
@@ -47,7 +52,7 @@ void UJumpSlashCombo::ExecuteCombo()
     // Check if airborne requirement is met
     if (bRequireAirborne && !IsCharacterAirborne())
     {
-        UE_LOG(LogTemp, Warning, TEXT("JumpSlashCombo: Character must be airborne"));
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("JumpSlashCombo: Character must be airborne"));
         return;
     }
     
@@ -133,6 +138,7 @@ void UJumpSlashCombo::CreateShockwave()
     FCollisionQueryParams QueryParams;
     QueryParams.AddIgnoredActor(OwnerCharacter);
     
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     if (CachedWorld->OverlapMultiByChannel(OverlapResults, ShockwaveOrigin, FQuat::Identity, 
         ECC_Pawn, CollisionShape, QueryParams))
     {
@@ -166,14 +172,14 @@ void UJumpSlashCombo::CreateShockwave()
     }
     
     // Visual effects
-    if (ShockwaveParticle)
+    if (UParticleSystem* Effect = ResolveAbilityAsset(ShockwaveParticle))
     {
-        UGameplayStatics::SpawnEmitterAtLocation(CachedWorld, ShockwaveParticle, ShockwaveOrigin);
+        UGameplayStatics::SpawnEmitterAtLocation(CachedWorld, Effect, ShockwaveOrigin);
     }
     
-    if (ShockwaveSound)
+    if (USoundBase* Sound = ResolveAbilityAsset(ShockwaveSound))
     {
-        UGameplayStatics::PlaySoundAtLocation(CachedWorld, ShockwaveSound, ShockwaveOrigin);
+        UGameplayStatics::PlaySoundAtLocation(CachedWorld, Sound, ShockwaveOrigin);
     }
     
     // Debug visualization
@@ -184,8 +190,8 @@ void UJumpSlashCombo::CreateShockwave()
         for (int32 i = 1; i <= 3; i++)
         {
             float RingRadius = (ShockwaveRadius / 3.0f) * i;
-            DrawDebugSphere(CachedWorld, ShockwaveOrigin, RingRadius, 
-                24, ShockwaveColor.ToFColor(true), false, 1.0f);
+            BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, ShockwaveOrigin, RingRadius, 
+                24, ShockwaveColor.ToFColor(true), false, 1.0f));
         }
     }
     #endif
@@ -224,6 +230,7 @@ AActor* UJumpSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
     // First, try a direct line trace to see if we hit something in the crosshair
     FVector End = Start + (Forward * SearchRange);
     FHitResult DirectHit;
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     bool bDirectHit = CachedWorld->LineTraceSingleByChannel(DirectHit, Start, End, ECC_Pawn, QueryParams);
     
     if (bDirectHit && DirectHit.GetActor())
@@ -238,8 +245,8 @@ AActor* UJumpSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
                 #if WITH_EDITOR
                 if (bShowDebugVisuals)
                 {
-                    DrawDebugSphere(CachedWorld, DirectTarget->GetActorLocation(), 60.0f, 12, FColor::Orange, false, 1.0f, 0, 4.0f);
-                    DrawDebugLine(CachedWorld, Start, DirectTarget->GetActorLocation(), FColor::Orange, false, 1.0f, 0, 3.0f);
+                    BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, DirectTarget->GetActorLocation(), 60.0f, 12, FColor::Orange, false, 1.0f, 0, 4.0f));
+                    BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugLine(CachedWorld, Start, DirectTarget->GetActorLocation(), FColor::Orange, false, 1.0f, 0, 3.0f));
                 }
                 #endif
                 return DirectTarget;
@@ -252,6 +259,7 @@ AActor* UJumpSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
     float SphereRadius = AimForgivenessRadius;
     
     // Sphere sweep to find all potential targets
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     CachedWorld->SweepMultiByChannel(
         HitResults,
         Start,
@@ -336,18 +344,26 @@ AActor* UJumpSlashCombo::FindBestTarget(const FVector& Start, const FVector& For
     {
         // Show the search area with different colors for ground vs air
         FColor SearchColor = bPlayerOnGround ? FColor::Magenta : FColor::Blue;
-        DrawDebugSphere(CachedWorld, Start, SphereRadius, 16, SearchColor, false, 0.5f);
-        DrawDebugSphere(CachedWorld, End, SphereRadius, 16, SearchColor, false, 0.5f);
-        DrawDebugLine(CachedWorld, Start, End, SearchColor, false, 0.5f, 0, 2.0f);
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, Start, SphereRadius, 16, SearchColor, false, 0.5f));
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, End, SphereRadius, 16, SearchColor, false, 0.5f));
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugLine(CachedWorld, Start, End, SearchColor, false, 0.5f, 0, 2.0f));
         
         // Highlight the selected target
         if (BestTarget)
         {
             FColor TargetColor = bPlayerOnGround ? FColor::Purple : FColor::Green;
-            DrawDebugSphere(CachedWorld, BestTarget->GetActorLocation(), 50.0f, 12, TargetColor, false, 1.0f, 0, 3.0f);
+            BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(CachedWorld, BestTarget->GetActorLocation(), 50.0f, 12, TargetColor, false, 1.0f, 0, 3.0f));
         }
     }
     #endif
     
     return BestTarget;
+}
+
+void UJumpSlashCombo::GatherAssetManifest(FAbilityAssetManifest& Manifest) const
+{
+    Super::GatherAssetManifest(Manifest);
+
+    Manifest.Add(ShockwaveParticle);
+    Manifest.Add(ShockwaveSound);
 }
\ No newline at end of file
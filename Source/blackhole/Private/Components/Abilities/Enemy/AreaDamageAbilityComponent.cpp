@@ -1,17 +1,22 @@
 // AreaDamageAbilityComponent.cpp
 #include "Components/Abilities/Enemy/AreaDamageAbilityComponent.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Components/Movement/ForcedMovement.h"
 #include "Components/CapsuleComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Engine/OverlapResult.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "TimerManager.h"
 #include "Engine/DamageEvents.h"
 #include "GameFramework/DamageType.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
 
 UAreaDamageAbilityComponent::UAreaDamageAbilityComponent()
 {
@@ -23,6 +28,8 @@ UAreaDamageAbilityComponent::UAreaDamageAbilityComponent()
 
 void UAreaDamageAbilityComponent::Execute()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("AreaDamageAbility Execute", STAT_Blackhole_AreaDamageAbility_Execute, BlackholeAbilitiesChannel);
+
     if (!CanExecute())
     {
         return;
@@ -67,6 +74,8 @@ void UAreaDamageAbilityComponent::Execute()
 
 void UAreaDamageAbilityComponent::ExecuteUltimate()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("AreaDamageAbility Execute Ultimate", STAT_Blackhole_AreaDamageAbility_ExecuteUltimate, BlackholeAbilitiesChannel);
+
     // Ultimate version: Double damage and radius
     float OriginalDamage = BaseDamage;
     float OriginalRadius = DamageRadius;
@@ -191,6 +200,7 @@ TArray<AActor*> UAreaDamageAbilityComponent::GetActorsInPattern()
             FCollisionQueryParams QueryParams;
             QueryParams.AddIgnoredActor(Owner);
 
+            BLACKHOLE_COUNT_QUERY(HitQueries);
             World->OverlapMultiByChannel(
                 OverlapResults,
                 DamageOrigin,
@@ -217,6 +227,7 @@ TArray<AActor*> UAreaDamageAbilityComponent::GetActorsInPattern()
             FCollisionQueryParams QueryParams;
             QueryParams.AddIgnoredActor(Owner);
 
+            BLACKHOLE_COUNT_QUERY(HitQueries);
             World->OverlapMultiByChannel(
                 OverlapResults,
                 DamageOrigin,
@@ -247,6 +258,7 @@ TArray<AActor*> UAreaDamageAbilityComponent::GetActorsInPattern()
             FVector LineEnd = DamageOrigin + (DamageDirection * DamageRadius);
             FVector BoxExtent(LineWidth / 2.0f, LineWidth / 2.0f, 100.0f);
 
+            BLACKHOLE_COUNT_QUERY(HitQueries);
             World->OverlapMultiByChannel(
                 OverlapResults,
                 (DamageOrigin + LineEnd) / 2.0f,
@@ -273,6 +285,7 @@ TArray<AActor*> UAreaDamageAbilityComponent::GetActorsInPattern()
             FCollisionQueryParams QueryParams;
             QueryParams.AddIgnoredActor(Owner);
 
+            BLACKHOLE_COUNT_QUERY(HitQueries);
             World->OverlapMultiByChannel(
                 OverlapResults,
                 DamageOrigin,
@@ -383,7 +396,7 @@ void UAreaDamageAbilityComponent::ApplyKnockbackToActor(AActor* Target)
     
     // Apply knockback
     FVector KnockbackVelocity = KnockbackDirection * KnockbackForce;
-    TargetCharacter->GetCharacterMovement()->Launch(KnockbackVelocity);
+    FForcedMovement::ApplyKnockback(TargetCharacter, KnockbackVelocity);
 }
 
 void UAreaDamageAbilityComponent::ApplyPostEffectsToActor(AActor* Target)
@@ -430,22 +443,22 @@ void UAreaDamageAbilityComponent::PlayVisualEffects()
     }
 
     // Spawn particle effect
-    if (VisualEffects.ImpactParticle)
+    if (UParticleSystem* Effect = ResolveAbilityAsset(VisualEffects.ImpactParticle))
     {
         UGameplayStatics::SpawnEmitterAtLocation(
             Owner->GetWorld(),
-            VisualEffects.ImpactParticle,
+            Effect,
             DamageOrigin,
             DamageDirection.Rotation()
         );
     }
 
     // Play sound
-    if (VisualEffects.ImpactSound)
+    if (USoundBase* Sound = ResolveAbilityAsset(VisualEffects.ImpactSound))
     {
         UGameplayStatics::PlaySoundAtLocation(
             Owner->GetWorld(),
-            VisualEffects.ImpactSound,
+            Sound,
             DamageOrigin
         );
     }
@@ -468,7 +481,7 @@ void UAreaDamageAbilityComponent::PlayVisualEffects()
         switch (DamagePattern)
         {
             case EAreaDamagePattern::Circular:
-                DrawDebugSphere(GetWorld(), DamageOrigin, DamageRadius, 32, FColor::Red, false, 2.0f);
+                BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), DamageOrigin, DamageRadius, 32, FColor::Red, false, 2.0f));
                 break;
             
             case EAreaDamagePattern::Cone:
@@ -477,23 +490,23 @@ void UAreaDamageAbilityComponent::PlayVisualEffects()
                 FVector LeftEdge = DamageDirection.RotateAngleAxis(-ConeAngle/2, FVector::UpVector) * DamageRadius;
                 FVector RightEdge = DamageDirection.RotateAngleAxis(ConeAngle/2, FVector::UpVector) * DamageRadius;
                 
-                DrawDebugLine(GetWorld(), DamageOrigin, DamageOrigin + LeftEdge, FColor::Red, false, 2.0f, 0, 3.0f);
-                DrawDebugLine(GetWorld(), DamageOrigin, DamageOrigin + RightEdge, FColor::Red, false, 2.0f, 0, 3.0f);
-                DrawDebugLine(GetWorld(), DamageOrigin + LeftEdge, DamageOrigin + RightEdge, FColor::Red, false, 2.0f, 0, 3.0f);
+                BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), DamageOrigin, DamageOrigin + LeftEdge, FColor::Red, false, 2.0f, 0, 3.0f));
+                BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), DamageOrigin, DamageOrigin + RightEdge, FColor::Red, false, 2.0f, 0, 3.0f));
+                BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), DamageOrigin + LeftEdge, DamageOrigin + RightEdge, FColor::Red, false, 2.0f, 0, 3.0f));
                 break;
             }
             
             case EAreaDamagePattern::Line:
             {
                 FVector LineEnd = DamageOrigin + (DamageDirection * DamageRadius);
-                DrawDebugBox(GetWorld(), (DamageOrigin + LineEnd) / 2.0f, FVector(DamageRadius/2, LineWidth/2, 100), FColor::Red, false, 2.0f);
+                BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugBox(GetWorld(), (DamageOrigin + LineEnd) / 2.0f, FVector(DamageRadius/2, LineWidth/2, 100), FColor::Red, false, 2.0f));
                 break;
             }
             
             case EAreaDamagePattern::Cross:
             {
-                DrawDebugLine(GetWorld(), DamageOrigin - FVector(DamageRadius, 0, 0), DamageOrigin + FVector(DamageRadius, 0, 0), FColor::Red, false, 2.0f, 0, LineWidth);
-                DrawDebugLine(GetWorld(), DamageOrigin - FVector(0, DamageRadius, 0), DamageOrigin + FVector(0, DamageRadius, 0), FColor::Red, false, 2.0f, 0, LineWidth);
+                BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), DamageOrigin - FVector(DamageRadius, 0, 0), DamageOrigin + FVector(DamageRadius, 0, 0), FColor::Red, false, 2.0f, 0, LineWidth));
+                BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), DamageOrigin - FVector(0, DamageRadius, 0), DamageOrigin + FVector(0, DamageRadius, 0), FColor::Red, false, 2.0f, 0, LineWidth));
                 break;
             }
         }
@@ -513,4 +526,10 @@ void UAreaDamageAbilityComponent::TrackHitActor(AActor* Actor)
     }
     
     RecentlyHitActors.Add(Actor, GetWorld()->GetTimeSeconds());
+}
+
+void UAreaDamageAbilityComponent::GatherAssetManifest(FAbilityAssetManifest& Manifest) const
+{
+    Manifest.Add(VisualEffects.ImpactParticle);
+    Manifest.Add(VisualEffects.ImpactSound);
 }
\ No newline at end of file
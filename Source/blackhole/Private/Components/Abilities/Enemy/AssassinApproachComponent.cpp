@@ -1,4 +1,6 @@
 #include "Components/Abilities/Enemy/AssassinApproachComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Components/Abilities/Enemy/StabAttackComponent.h"
 #include "Enemy/BaseEnemy.h"
 #include "Enemy/AgileEnemy.h"
@@ -7,7 +9,8 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
+#include "Components/Movement/ForcedMovement.h"
 
 UAssassinApproachComponent::UAssassinApproachComponent()
 {
@@ -27,7 +30,7 @@ void UAssassinApproachComponent::BeginPlay()
 		StabAttackComponent = Owner->FindComponentByClass<UStabAttackComponent>();
 		if (!StabAttackComponent)
 		{
-			UE_LOG(LogTemp, Error, TEXT("AssassinApproach: No StabAttackComponent found on %s"), *Owner->GetName());
+			UE_LOG(LogBlackholeAbilities, Error, TEXT("AssassinApproach: No StabAttackComponent found on %s"), *Owner->GetName());
 		}
 	}
 	
@@ -57,6 +60,8 @@ bool UAssassinApproachComponent::CanExecute() const
 
 void UAssassinApproachComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("AssassinApproach Execute", STAT_Blackhole_AssassinApproach_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -105,13 +110,13 @@ void UAssassinApproachComponent::ExecuteDashBehind()
 	float DashDistance = DistanceToTarget + DashBehindDistance;
 	FVector DashDirection = DirectionToTarget;
 	
-	// Apply dash impulse
+	// Dash at DashForce speed; CharacterMovement sweeps the path and stops exactly at the end
 	if (UCharacterMovementComponent* Movement = Enemy->GetCharacterMovement())
 	{
 		Movement->StopMovementImmediately();
-		Movement->AddImpulse(DashDirection * DashForce, true);
+		FForcedMovement::ApplyDash(Enemy, EnemyLocation + (DashDirection * DashDistance), DashDistance / DashForce);
 		
-		// UE_LOG(LogTemp, Warning, TEXT("AssassinApproach: Dashing %.0f units behind target"), DashDistance);
+		// UE_LOG(LogBlackholeAbilities, Warning, TEXT("AssassinApproach: Dashing %.0f units behind target"), DashDistance);
 	}
 	
 	// Schedule backstab attack
@@ -126,8 +131,8 @@ void UAssassinApproachComponent::ExecuteDashBehind()
 	
 	#if WITH_EDITOR
 	// Debug visualization
-	DrawDebugLine(GetWorld(), EnemyLocation, EnemyLocation + (DashDirection * DashDistance), 
-		FColor::Purple, false, 2.0f, 0, 2.0f);
+	BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), EnemyLocation, EnemyLocation + (DashDirection * DashDistance), 
+		FColor::Purple, false, 2.0f, 0, 2.0f));
 	#endif
 }
 
@@ -161,7 +166,7 @@ void UAssassinApproachComponent::ExecuteBackstab()
 		if (Distance <= StabAttackComponent->AttackRange)
 		{
 			Player->ApplyStagger(BackstabStaggerDuration);
-			// UE_LOG(LogTemp, Warning, TEXT("AssassinApproach: Backstab successful! Applied %.1fs stagger"), BackstabStaggerDuration);
+			// UE_LOG(LogBlackholeAbilities, Warning, TEXT("AssassinApproach: Backstab successful! Applied %.1fs stagger"), BackstabStaggerDuration);
 		}
 	}
 	
@@ -1,4 +1,5 @@
 #include "Components/Abilities/Enemy/BlockComponent.h"
+#include "Debug/BlackholeStats.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "GameFramework/Actor.h"
@@ -19,6 +20,8 @@ void UBlockComponent::BeginPlay()
 
 void UBlockComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Block Execute", STAT_Blackhole_Block_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
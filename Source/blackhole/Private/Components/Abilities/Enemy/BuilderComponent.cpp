@@ -1,8 +1,7 @@
 #include "Components/Abilities/Enemy/BuilderComponent.h"
+#include "blackhole.h"
 #include "Enemy/StandardEnemy.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
-#include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "Actors/PsiDisruptor.h"
 #include "UI/BlackholeHUD.h"
@@ -10,23 +9,17 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Engine/StaticMesh.h"
 #include "Enemy/AI/EnemyStateMachine.h"
-
-// Static member initialization
-TArray<UBuilderComponent*> UBuilderComponent::AllActiveBuilders;
+#include "Systems/BuildCoordinationSubsystem.h"
 
 UBuilderComponent::UBuilderComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = false;
+	// Build progress is advanced by UBuildCoordinationSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	
 	bIsBuilding = false;
 	bIsBuildLeader = false;
-	bBuildPaused = false;
-	BuildProgress = 0.0f;
-	CurrentBuildTime = BuildTime;
-	TimeSpentBuilding = 0.0f;
-	LeaderComponent = nullptr;
-	InitialBuilderCount = 0;
+	BuildGroup = INDEX_NONE;
+	Coordination = nullptr;
 }
 
 void UBuilderComponent::BeginPlay()
@@ -34,329 +27,145 @@ void UBuilderComponent::BeginPlay()
 	Super::BeginPlay();
 	
 	// Register this builder
-	AllActiveBuilders.Add(this);
+	if (UWorld* World = GetWorld())
+	{
+		Coordination = World->GetSubsystem<UBuildCoordinationSubsystem>();
+		if (Coordination)
+		{
+			Coordination->RegisterBuilder(this);
+		}
+	}
 }
 
 void UBuilderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Unregister this builder
-	AllActiveBuilders.Remove(this);
-	
-	// Cancel any ongoing build
-	if (bIsBuilding)
+	// Unregister this builder; cancels the build if we were leading it
+	if (Coordination)
 	{
-		CancelBuild();
+		Coordination->UnregisterBuilder(this);
+		Coordination = nullptr;
 	}
 	
 	Super::EndPlay(EndPlayReason);
 }
 
-void UBuilderComponent::InitiateBuild(const FVector& BuildLocation)
+void UBuilderComponent::OnOwnerDied()
 {
-	if (bIsBuilding) return;
-	
-	CurrentBuildLocation = BuildLocation;
-	bIsBuilding = true;
-	bIsBuildLeader = true;
-	bBuildPaused = false;
-	BuildProgress = 0.0f;
-	CurrentBuildTime = BuildTime;
-	TimeSpentBuilding = 0.0f;
-	LeaderComponent = this;
-	ParticipatingBuilders.Empty();
-	ParticipatingBuilders.Add(this);
-	
-	// Create visual build sphere
-	CreateBuildSphere();
-	
-	// Notify nearby builders to join
-	for (UBuilderComponent* Builder : AllActiveBuilders)
-	{
-		if (Builder != this && !Builder->IsBuilding())
-		{
-			float Distance = FVector::Dist(Builder->GetOwner()->GetActorLocation(), BuildLocation);
-			if (Distance <= BuildRadius)
-			{
-				Builder->JoinBuild(this);
-			}
-		}
-	}
-	
-	// Check if we have enough builders
-	if (ParticipatingBuilders.Num() >= MinBuildersRequired)
+	if (Coordination)
 	{
-		// Store initial builder count for timer calculations
-		InitialBuilderCount = ParticipatingBuilders.Num();
-		
-		SetComponentTickEnabled(true);
-		OnBuildingStarted.Broadcast(BuildLocation);
-		
-		// Notify HUD
-		if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
-		{
-			if (ABlackholeHUD* HUD = Cast<ABlackholeHUD>(PC->GetHUD()))
-			{
-				HUD->OnPsiDisruptorBuildStarted(BuildLocation);
-			}
-		}
-		
-		// Start build timer
-		GetWorld()->GetTimerManager().SetTimer(BuildTimerHandle, this, &UBuilderComponent::UpdateBuildProgress, 0.1f, true);
-		
-		// Notify owner to enter building state
-		if (AStandardEnemy* StandardEnemy = Cast<AStandardEnemy>(GetOwner()))
-		{
-			if (UEnemyStateMachine* StateMachine = StandardEnemy->GetStateMachine())
-			{
-				StateMachine->ChangeState(EEnemyState::Building);
-			}
-		}
-		
-		// UE_LOG(LogTemp, Warning, TEXT("Building started with %d builders at location %s"), 
-		//	ParticipatingBuilders.Num(), *BuildLocation.ToString());
+		Coordination->UnregisterBuilder(this);
 	}
-	else
+}
+
+void UBuilderComponent::OnOwnerRevived()
+{
+	if (Coordination)
 	{
-		// Not enough builders - destroy sphere and cancel
-		DestroyBuildSphere();
-		CancelBuild();
-		// UE_LOG(LogTemp, Warning, TEXT("Not enough builders to start build. Required: %d, Have: %d"), 
-		//	MinBuildersRequired, ParticipatingBuilders.Num());
+		// A builder still in a group (restart of a live enemy) leaves it first
+		Coordination->UnregisterBuilder(this);
+		Coordination->RegisterBuilder(this);
 	}
 }
 
-void UBuilderComponent::JoinBuild(UBuilderComponent* Leader)
+void UBuilderComponent::InitiateBuild(const FVector& BuildLocation)
 {
-	if (bIsBuilding || !Leader || !Leader->IsBuilding()) return;
-	
-	bIsBuilding = true;
-	bIsBuildLeader = false;
-	LeaderComponent = Leader;
-	CurrentBuildLocation = Leader->GetBuildLocation();
-	
-	// Add to leader's participant list
-	Leader->ParticipatingBuilders.Add(this);
+	if (bIsBuilding || !Coordination) return;
 	
-	SetComponentTickEnabled(true);
+	// Recruits nearby idle builders; does nothing if there aren't enough of them
+	Coordination->StartGroup(this, BuildLocation);
+}
+
+void UBuilderComponent::JoinBuild(UBuilderComponent* Leader)
+{
+	if (bIsBuilding || !Leader || !Leader->IsBuilding() || !Coordination) return;
 	
-	// Notify owner to enter building state
-	if (AStandardEnemy* StandardEnemy = Cast<AStandardEnemy>(GetOwner()))
-	{
-		if (UEnemyStateMachine* StateMachine = StandardEnemy->GetStateMachine())
-		{
-			StateMachine->ChangeState(EEnemyState::Building);
-		}
-	}
+	Coordination->JoinGroup(Leader->BuildGroup, this);
 }
 
 void UBuilderComponent::CancelBuild()
 {
-	if (!bIsBuilding) return;
-	
-	// Clear timer
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(BuildTimerHandle);
-	}
-	
-	// If we're the leader, notify all participants
-	if (bIsBuildLeader)
-	{
-		for (UBuilderComponent* Builder : ParticipatingBuilders)
-		{
-			if (Builder && Builder != this)
-			{
-				Builder->CancelBuild();
-			}
-		}
-		
-		// Destroy visual sphere
-		DestroyBuildSphere();
-		
-		OnBuildingCancelled.Broadcast();
-	}
+	if (!bIsBuilding || !Coordination) return;
 	
-	// Notify owner to exit building state
-	if (AStandardEnemy* StandardEnemy = Cast<AStandardEnemy>(GetOwner()))
-	{
-		if (UEnemyStateMachine* StateMachine = StandardEnemy->GetStateMachine())
-		{
-			// Return to idle state after cancelling build
-			if (StateMachine->GetCurrentState() == EEnemyState::Building)
-			{
-				StateMachine->ChangeState(EEnemyState::Idle);
-			}
-		}
-	}
+	// The leader cancels the whole group, anyone else just leaves it
+	Coordination->LeaveGroup(this);
+}
+
+void UBuilderComponent::PauseBuild()
+{
+	if (!bIsBuildLeader || !bIsBuilding || !Coordination) return;
 	
-	// Reset state
-	bIsBuilding = false;
-	bIsBuildLeader = false;
-	bBuildPaused = false;
-	BuildProgress = 0.0f;
-	CurrentBuildTime = BuildTime;
-	TimeSpentBuilding = 0.0f;
-	LeaderComponent = nullptr;
-	ParticipatingBuilders.Empty();
-	InitialBuilderCount = 0;
-	SetComponentTickEnabled(false);
+	Coordination->SetGroupPaused(BuildGroup, true);
+}
+
+void UBuilderComponent::ResumeBuild()
+{
+	if (!bIsBuildLeader || !bIsBuilding || !Coordination) return;
 	
-	// UE_LOG(LogTemp, Warning, TEXT("Build cancelled"));
+	Coordination->SetGroupPaused(BuildGroup, false);
+}
+
+bool UBuilderComponent::IsBuildPaused() const
+{
+	return bIsBuilding && Coordination && Coordination->IsGroupPaused(BuildGroup);
 }
 
 float UBuilderComponent::GetBuildProgress() const
 {
-	if (bIsBuildLeader)
+	if (!bIsBuilding || !Coordination)
 	{
-		return BuildProgress;
-	}
-	else if (LeaderComponent)
-	{
-		return LeaderComponent->GetBuildProgress();
+		return 0.0f;
 	}
 	
-	return 0.0f;
+	return Coordination->GetGroupProgress(BuildGroup);
 }
 
-void UBuilderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UBuilderComponent::EnterBuild(int32 Group, const FVector& BuildLocation, bool bLeader)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	if (!bIsBuilding) return;
+	bIsBuilding = true;
+	bIsBuildLeader = bLeader;
+	BuildGroup = Group;
+	CurrentBuildLocation = BuildLocation;
 	
-	// Visual feedback - draw progress circle
-	#if WITH_EDITOR
-	if (bIsBuildLeader)
+	// Notify owner to enter building state
+	if (UEnemyStateMachine* StateMachine = GetOwnerStateMachine())
 	{
-		float Radius = 100.0f * BuildProgress;
-		DrawDebugCircle(GetWorld(), CurrentBuildLocation, Radius, 32, FColor::Blue, false, -1.0f, 0, 2.0f);
+		StateMachine->ChangeState(EEnemyState::Building);
 	}
-	#endif
+}
+
+void UBuilderComponent::ExitBuild()
+{
+	bIsBuilding = false;
+	bIsBuildLeader = false;
+	BuildGroup = INDEX_NONE;
 	
-	// Check if builders are still alive and in range
-	if (bIsBuildLeader)
-	{
-		TArray<UBuilderComponent*> ValidBuilders;
-		for (UBuilderComponent* Builder : ParticipatingBuilders)
-		{
-			if (Builder && IsValid(Builder->GetOwner()))
-			{
-				float Distance = FVector::Dist(Builder->GetOwner()->GetActorLocation(), CurrentBuildLocation);
-				if (Distance <= BuildRadius * 1.5f)
-				{
-					ValidBuilders.Add(Builder);
-				}
-			}
-		}
-		
-		ParticipatingBuilders = ValidBuilders;
-		
-		// Cancel if not enough builders
-		if (ParticipatingBuilders.Num() < MinBuildersRequired)
-		{
-			CancelBuild();
-		}
-	}
+	// Return to idle state after the build ends
+	LeaveBuildingState(EEnemyState::Idle);
 }
 
-void UBuilderComponent::UpdateBuildProgress()
+void UBuilderComponent::HandleBuildStarted()
 {
-	if (!bIsBuildLeader || !bIsBuilding || bBuildPaused) return;
+	// Create visual build sphere
+	CreateBuildSphere();
+	
+	OnBuildingStarted.Broadcast(CurrentBuildLocation);
 	
-	// Check if all participating builders are still alive
-	TArray<UBuilderComponent*> AliveBuilders;
-	for (UBuilderComponent* Builder : ParticipatingBuilders)
+	// Notify HUD
+	if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
 	{
-		if (Builder && IsValid(Builder) && IsValid(Builder->GetOwner()))
+		if (ABlackholeHUD* HUD = Cast<ABlackholeHUD>(PC->GetHUD()))
 		{
-			AliveBuilders.Add(Builder);
+			HUD->OnPsiDisruptorBuildStarted(CurrentBuildLocation);
 		}
 	}
-	
-	// Update participating builders list
-	ParticipatingBuilders = AliveBuilders;
-	
-	// Check if we still have builders
-	if (ParticipatingBuilders.Num() == 0)
-	{
-		// All builders are dead - pause the build
-		// UE_LOG(LogTemp, Warning, TEXT("All builders dead - pausing build at %.1f%% progress"), 
-		//	BuildProgress * 100.0f);
-		PauseBuild();
-		return;
-	}
-	
-	// Check if a builder was killed and adjust timer
-	if (ParticipatingBuilders.Num() < InitialBuilderCount)
-	{
-		// Calculate time remaining based on current progress
-		float TimeRemaining = CurrentBuildTime - TimeSpentBuilding;
-		
-		// Double the remaining time for each builder killed
-		int32 BuildersKilled = InitialBuilderCount - ParticipatingBuilders.Num();
-		float NewTimeRemaining = TimeRemaining * FMath::Pow(1.5f, BuildersKilled); // 1.5x multiplier per death
-		
-		// Update current build time
-		CurrentBuildTime = TimeSpentBuilding + NewTimeRemaining;
-		
-		// Update initial builder count to prevent repeated adjustments
-		InitialBuilderCount = ParticipatingBuilders.Num();
-		
-		// UE_LOG(LogTemp, Warning, TEXT("Builder killed! Adjusting timer - was %.1fs remaining, now %.1fs (total build time: %.1fs)"), 
-		//	TimeRemaining, NewTimeRemaining, CurrentBuildTime);
-	}
-	
-	// Update time spent building
-	TimeSpentBuilding += 0.1f; // 0.1f is timer interval
-	
-	// Calculate progress based on adjusted build time
-	BuildProgress = TimeSpentBuilding / CurrentBuildTime;
-	
-	UE_LOG(LogTemp, Verbose, TEXT("Build progress: %.1f%% with %d builders"), 
-		BuildProgress * 100.0f, ParticipatingBuilders.Num());
-	
-	if (BuildProgress >= 1.0f)
-	{
-		// UE_LOG(LogTemp, Warning, TEXT("Build progress reached 100%%! Calling CompleteBuild..."));
-		CompleteBuild();
-	}
 }
 
-void UBuilderComponent::CompleteBuild()
+void UBuilderComponent::HandleBuildCompleted()
 {
-	// UE_LOG(LogTemp, Warning, TEXT("CompleteBuild called! bIsBuildLeader = %s"), bIsBuildLeader ? TEXT("true") : TEXT("false"));
-	
-	if (!bIsBuildLeader) 
-	{
-		UE_LOG(LogTemp, Error, TEXT("CompleteBuild: Not the build leader, aborting!"));
-		return;
-	}
-	
-	UE_LOG(LogTemp, Warning, TEXT("Build completed! Spawning Psi-Disruptor..."));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("Build completed! Spawning Psi-Disruptor..."));
 	
 	SpawnPsiDisruptor();
-	
-	// Notify all participants
-	for (UBuilderComponent* Builder : ParticipatingBuilders)
-	{
-		if (Builder)
-		{
-			Builder->bIsBuilding = false;
-			Builder->SetComponentTickEnabled(false);
-			
-			// Notify to exit building state
-			if (AStandardEnemy* StandardEnemy = Cast<AStandardEnemy>(Builder->GetOwner()))
-			{
-				if (UEnemyStateMachine* StateMachine = StandardEnemy->GetStateMachine())
-				{
-					if (StateMachine->GetCurrentState() == EEnemyState::Building)
-					{
-						StateMachine->ChangeState(EEnemyState::Idle);
-					}
-				}
-			}
-		}
-	}
+	DestroyBuildSphere();
 	
 	OnBuildingComplete.Broadcast();
 	
@@ -368,22 +177,48 @@ void UBuilderComponent::CompleteBuild()
 			HUD->OnPsiDisruptorBuildComplete();
 		}
 	}
+}
+
+void UBuilderComponent::HandleBuildCancelled()
+{
+	// Destroy visual sphere
+	DestroyBuildSphere();
 	
-	// Reset leader state
-	CancelBuild();
+	OnBuildingCancelled.Broadcast();
+}
+
+void UBuilderComponent::HandleBuildPaused()
+{
+	// Builders go fight while the build waits
+	LeaveBuildingState(EEnemyState::Combat);
+}
+
+UEnemyStateMachine* UBuilderComponent::GetOwnerStateMachine() const
+{
+	const AStandardEnemy* StandardEnemy = Cast<AStandardEnemy>(GetOwner());
+	return StandardEnemy ? StandardEnemy->GetStateMachine() : nullptr;
+}
+
+void UBuilderComponent::LeaveBuildingState(EEnemyState NextState)
+{
+	UEnemyStateMachine* StateMachine = GetOwnerStateMachine();
+	if (StateMachine && StateMachine->GetCurrentState() == EEnemyState::Building)
+	{
+		StateMachine->ChangeState(NextState);
+	}
 }
 
 void UBuilderComponent::SpawnPsiDisruptor()
 {
 	if (!PsiDisruptorClass)
 	{
-		UE_LOG(LogTemp, Error, TEXT("SpawnPsiDisruptor FAILED: PsiDisruptorClass is not set! Please set it in the Blueprint."));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("SpawnPsiDisruptor FAILED: PsiDisruptorClass is not set! Please set it in the Blueprint."));
 		return;
 	}
 	
 	if (!GetWorld())
 	{
-		UE_LOG(LogTemp, Error, TEXT("SpawnPsiDisruptor FAILED: No valid world context!"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("SpawnPsiDisruptor FAILED: No valid world context!"));
 		return;
 	}
 	
@@ -393,13 +228,13 @@ void UBuilderComponent::SpawnPsiDisruptor()
 	FVector SpawnLocation = CurrentBuildLocation + FVector(0, 0, 50); // Slight offset
 	FRotator SpawnRotation = FRotator::ZeroRotator;
 	
-	// UE_LOG(LogTemp, Warning, TEXT("Attempting to spawn PsiDisruptor at %s..."), *SpawnLocation.ToString());
+	// UE_LOG(LogBlackholeAbilities, Warning, TEXT("Attempting to spawn PsiDisruptor at %s..."), *SpawnLocation.ToString());
 	
 	AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(PsiDisruptorClass, SpawnLocation, SpawnRotation, SpawnParams);
 	
 	if (!SpawnedActor)
 	{
-		UE_LOG(LogTemp, Error, TEXT("SpawnPsiDisruptor FAILED: SpawnActor returned null!"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("SpawnPsiDisruptor FAILED: SpawnActor returned null!"));
 		return;
 	}
 	
@@ -407,83 +242,12 @@ void UBuilderComponent::SpawnPsiDisruptor()
 	
 	if (SpawnedDisruptor)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Psi-Disruptor spawned successfully at %s"), *SpawnLocation.ToString());
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("Psi-Disruptor spawned successfully at %s"), *SpawnLocation.ToString());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("SpawnPsiDisruptor: Actor spawned but is not a PsiDisruptor class!"));
-	}
-}
-
-UBuilderComponent* UBuilderComponent::FindNearestBuildLeader(AActor* SearchOrigin, float MaxRange)
-{
-	if (!SearchOrigin) return nullptr;
-	
-	UBuilderComponent* NearestLeader = nullptr;
-	float NearestDistance = MaxRange;
-	
-	for (UBuilderComponent* Builder : AllActiveBuilders)
-	{
-		if (Builder && Builder->IsBuilding() && Builder->IsLeader())
-		{
-			float Distance = FVector::Dist(SearchOrigin->GetActorLocation(), Builder->GetBuildLocation());
-			if (Distance < NearestDistance)
-			{
-				NearestDistance = Distance;
-				NearestLeader = Builder;
-			}
-		}
-	}
-	
-	return NearestLeader;
-}
-
-TArray<UBuilderComponent*> UBuilderComponent::GetAllActiveBuilders()
-{
-	return AllActiveBuilders;
-}
-
-void UBuilderComponent::PauseBuild()
-{
-	if (!bIsBuildLeader || !bIsBuilding || bBuildPaused) return;
-	
-	bBuildPaused = true;
-	
-	// Clear the timer but keep all state
-	GetWorld()->GetTimerManager().ClearTimer(BuildTimerHandle);
-	
-	// Notify all builders to exit building state
-	for (UBuilderComponent* Builder : ParticipatingBuilders)
-	{
-		if (Builder && IsValid(Builder->GetOwner()))
-		{
-			if (AStandardEnemy* StandardEnemy = Cast<AStandardEnemy>(Builder->GetOwner()))
-			{
-				if (UEnemyStateMachine* StateMachine = StandardEnemy->GetStateMachine())
-				{
-					if (StateMachine->GetCurrentState() == EEnemyState::Building)
-					{
-						StateMachine->ChangeState(EEnemyState::Combat);
-					}
-				}
-			}
-		}
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("SpawnPsiDisruptor: Actor spawned but is not a PsiDisruptor class!"));
 	}
-	
-	// UE_LOG(LogTemp, Warning, TEXT("Build paused at %.1f%% progress (%.1fs spent, %.1fs total)"), 
-	//	BuildProgress * 100.0f, TimeSpentBuilding, CurrentBuildTime);
-}
-
-void UBuilderComponent::ResumeBuild()
-{
-	if (!bIsBuildLeader || !bIsBuilding || !bBuildPaused) return;
-	
-	bBuildPaused = false;
-	
-	// Restart the timer
-	GetWorld()->GetTimerManager().SetTimer(BuildTimerHandle, this, &UBuilderComponent::UpdateBuildProgress, 0.1f, true);
-	
-	// UE_LOG(LogTemp, Warning, TEXT("Build resumed at %.1f%% progress"), BuildProgress * 100.0f);
 }
 
 void UBuilderComponent::CreateBuildSphere()
@@ -534,7 +298,7 @@ void UBuilderComponent::CreateBuildSphere()
 		// Set collision to no collision (visual only)
 		BuildSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 		
-		// UE_LOG(LogTemp, Warning, TEXT("Created build sphere at %s with radius %.0f"), 
+		// UE_LOG(LogBlackholeAbilities, Warning, TEXT("Created build sphere at %s with radius %.0f"), 
 		//	*CurrentBuildLocation.ToString(), BuildRadius);
 	}
 }
@@ -547,6 +311,6 @@ void UBuilderComponent::DestroyBuildSphere()
 		BuildSphereActor = nullptr;
 		BuildSphere = nullptr;
 		
-		// UE_LOG(LogTemp, Warning, TEXT("Destroyed build sphere"));
+		// UE_LOG(LogBlackholeAbilities, Warning, TEXT("Destroyed build sphere"));
 	}
 }
\ No newline at end of file
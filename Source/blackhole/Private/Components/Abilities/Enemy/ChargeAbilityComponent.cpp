@@ -1,13 +1,16 @@
 #include "Components/Abilities/Enemy/ChargeAbilityComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/DamageEvents.h"
 #include "Components/StatusEffectComponent.h"
+#include "Components/Movement/ForcedMovement.h"
 
 UChargeAbilityComponent::UChargeAbilityComponent()
 {
@@ -17,7 +20,7 @@ UChargeAbilityComponent::UChargeAbilityComponent()
 	WPCost = 0.0f; // No cost for enemy ability
 	bIsBasicAbility = false;
 	bIsCharging = false;
-	ChargeTimeElapsed = 0.0f;
+	ChargeSourceID = 0;
 }
 
 void UChargeAbilityComponent::BeginPlay()
@@ -28,6 +31,8 @@ void UChargeAbilityComponent::BeginPlay()
 
 void UChargeAbilityComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("ChargeAbility Execute", STAT_Blackhole_ChargeAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute() || bIsCharging)
 	{
 		return;
@@ -58,38 +63,63 @@ void UChargeAbilityComponent::StartCharge()
 	ACharacter* Owner = Cast<ACharacter>(GetOwner());
 	if (!Owner || !ChargeTarget) return;
 	
-	bIsCharging = true;
-	ChargeTimeElapsed = 0.0f;
-	ChargeStartLocation = Owner->GetActorLocation();
-	
 	// Calculate charge direction
-	FVector ToTarget = ChargeTarget->GetActorLocation() - ChargeStartLocation;
+	FVector ToTarget = ChargeTarget->GetActorLocation() - Owner->GetActorLocation();
 	ToTarget.Z = 0; // Keep charge horizontal
 	ChargeDirection = ToTarget.GetSafeNormal();
 	
-	// Disable normal movement
 	if (UCharacterMovementComponent* Movement = Owner->GetCharacterMovement())
 	{
-		Movement->SetMovementMode(EMovementMode::MOVE_Flying);
 		Movement->StopMovementImmediately();
 	}
 	
+	// CharacterMovement runs the charge; it overrides normal movement until the distance is covered
+	ChargeSourceID = FForcedMovement::ApplyCharge(Owner, ChargeDirection * ChargeSpeed, ChargeDistance / FMath::Max(ChargeSpeed, 1.0f));
+	if (ChargeSourceID == 0)
+	{
+		return;
+	}
+	
+	bIsCharging = true;
+	Owner->OnActorHit.AddDynamic(this, &UChargeAbilityComponent::OnOwnerHit);
 	SetComponentTickEnabled(true);
 	
-	UE_LOG(LogTemp, Warning, TEXT("Tank starting charge towards target!"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("Tank starting charge towards target!"));
+}
+
+void UChargeAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bIsCharging)
+	{
+		EndCharge(false);
+	}
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+void UChargeAbilityComponent::Deactivate()
+{
+	if (bIsCharging)
+	{
+		EndCharge(false);
+	}
+	
+	Super::Deactivate();
 }
 
 void UChargeAbilityComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("ChargeAbility Tick", STAT_Blackhole_ChargeAbility_Tick, BlackholeAbilitiesChannel);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
 	if (bIsCharging)
 	{
-		UpdateCharge(DeltaTime);
+		UpdateCharge();
 	}
 }
 
-void UChargeAbilityComponent::UpdateCharge(float DeltaTime)
+void UChargeAbilityComponent::UpdateCharge()
 {
 	ACharacter* Owner = Cast<ACharacter>(GetOwner());
 	if (!Owner)
@@ -98,43 +128,38 @@ void UChargeAbilityComponent::UpdateCharge(float DeltaTime)
 		return;
 	}
 	
-	ChargeTimeElapsed += DeltaTime;
-	
-	// Move the character
-	FVector CurrentLocation = Owner->GetActorLocation();
-	FVector NewLocation = CurrentLocation + (ChargeDirection * ChargeSpeed * DeltaTime);
-	
-	// Check for collision
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(Owner);
-	
-	if (GetWorld()->LineTraceSingleByChannel(HitResult, CurrentLocation, NewLocation, ECC_Pawn, QueryParams))
+	// The root motion source expires once the charge distance is covered
+	if (!FForcedMovement::IsActive(Owner, ChargeSourceID))
 	{
-		// Hit something
-		Owner->SetActorLocation(HitResult.Location);
-		ApplyImpactDamage(HitResult.Location);
-		EndCharge(true);
+		EndCharge(false);
 		return;
 	}
 	
-	// Check max distance
-	float DistanceTraveled = FVector::Dist(ChargeStartLocation, NewLocation);
-	if (DistanceTraveled >= ChargeDistance)
+	// Check if we're close enough to target for impact
+	const FVector CurrentLocation = Owner->GetActorLocation();
+	if (ChargeTarget && FVector::Dist(CurrentLocation, ChargeTarget->GetActorLocation()) < ImpactRadius)
+	{
+		ApplyImpactDamage(CurrentLocation);
+		EndCharge(true);
+	}
+}
+
+void UChargeAbilityComponent::OnOwnerHit(AActor* SelfActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit)
+{
+	if (!bIsCharging)
 	{
-		EndCharge(false);
 		return;
 	}
 	
-	// Move to new location
-	Owner->SetActorLocation(NewLocation);
-	
-	// Check if we're close enough to target for impact
-	if (ChargeTarget && FVector::Dist(NewLocation, ChargeTarget->GetActorLocation()) < ImpactRadius)
+	// Floors and ramps the charge runs along aren't impacts
+	ACharacter* Owner = Cast<ACharacter>(GetOwner());
+	if (Owner && Owner->GetCharacterMovement() && Owner->GetCharacterMovement()->IsWalkable(Hit))
 	{
-		ApplyImpactDamage(NewLocation);
-		EndCharge(true);
+		return;
 	}
+	
+	ApplyImpactDamage(Hit.Location);
+	EndCharge(true);
 }
 
 void UChargeAbilityComponent::EndCharge(bool bHitTarget)
@@ -142,13 +167,14 @@ void UChargeAbilityComponent::EndCharge(bool bHitTarget)
 	bIsCharging = false;
 	SetComponentTickEnabled(false);
 	
-	ACharacter* Owner = Cast<ACharacter>(GetOwner());
-	if (Owner && Owner->GetCharacterMovement())
+	if (ACharacter* Owner = Cast<ACharacter>(GetOwner()))
 	{
-		Owner->GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Walking);
+		Owner->OnActorHit.RemoveDynamic(this, &UChargeAbilityComponent::OnOwnerHit);
+		FForcedMovement::Stop(Owner, ChargeSourceID);
 	}
+	ChargeSourceID = 0;
 	
-	UE_LOG(LogTemp, Warning, TEXT("Tank charge ended. Hit target: %s"), bHitTarget ? TEXT("Yes") : TEXT("No"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("Tank charge ended. Hit target: %s"), bHitTarget ? TEXT("Yes") : TEXT("No"));
 }
 
 void UChargeAbilityComponent::ApplyImpactDamage(const FVector& ImpactLocation)
@@ -157,6 +183,7 @@ void UChargeAbilityComponent::ApplyImpactDamage(const FVector& ImpactLocation)
 	
 	// Find all actors in impact radius
 	TArray<AActor*> ActorsInRange;
+	BLACKHOLE_COUNT_QUERY(HitQueries);
 	UKismetSystemLibrary::SphereOverlapActors(GetWorld(), ImpactLocation, ImpactRadius, 
 		TArray<TEnumAsByte<EObjectTypeQuery>>(), nullptr, TArray<AActor*>{GetOwner()}, ActorsInRange);
 	
@@ -174,10 +201,7 @@ void UChargeAbilityComponent::ApplyImpactDamage(const FVector& ImpactLocation)
 		// Apply knockback
 		if (ACharacter* Character = Cast<ACharacter>(Actor))
 		{
-			if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
-			{
-				Movement->Launch(KnockbackDirection * KnockbackForce);
-			}
+			FForcedMovement::ApplyKnockback(Character, KnockbackDirection * KnockbackForce);
 			
 			// Apply knockdown effect
 			if (UStatusEffectComponent* StatusEffect = Character->FindComponentByClass<UStatusEffectComponent>())
@@ -187,11 +211,11 @@ void UChargeAbilityComponent::ApplyImpactDamage(const FVector& ImpactLocation)
 			}
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("Charge impact: Dealt %.0f damage and knockback to %s"), ImpactDamage, *Actor->GetName());
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("Charge impact: Dealt %.0f damage and knockback to %s"), ImpactDamage, *Actor->GetName());
 	}
 	
 	#if WITH_EDITOR
 	// Debug visualization
-	DrawDebugSphere(GetWorld(), ImpactLocation, ImpactRadius, 16, FColor::Red, false, 2.0f);
+	BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), ImpactLocation, ImpactRadius, 16, FColor::Red, false, 2.0f));
 	#endif
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Components/Abilities/Enemy/DodgeComponent.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
@@ -17,6 +18,8 @@ void UDodgeComponent::BeginPlay()
 
 void UDodgeComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Dodge Execute", STAT_Blackhole_Dodge_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -1,11 +1,8 @@
 #include "Components/Abilities/Enemy/HeatAuraComponent.h"
-#include "Enemy/BaseEnemy.h"
-#include "Player/BlackholePlayerCharacter.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Systems/AuraFieldSubsystem.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
-#include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
-#include "Components/Attributes/WillPowerComponent.h"
 
 UHeatAuraComponent::UHeatAuraComponent()
 {
@@ -29,17 +26,15 @@ void UHeatAuraComponent::BeginPlay()
 
 void UHeatAuraComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Clean up timer
-	if (GetWorld() && GetWorld()->GetTimerManager().IsTimerActive(AuraTickHandle))
-	{
-		GetWorld()->GetTimerManager().ClearTimer(AuraTickHandle);
-	}
+	SetAuraActive(false);
 	
 	Super::EndPlay(EndPlayReason);
 }
 
 void UHeatAuraComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HeatAura Execute", STAT_Blackhole_HeatAura_Execute, BlackholeAbilitiesChannel);
+
 	if (bAuraActive)
 	{
 		return;
@@ -59,73 +54,33 @@ void UHeatAuraComponent::SetAuraActive(bool bActive)
 {
 	bAuraActive = bActive;
 	
-	if (bActive)
+	UAuraFieldSubsystem* AuraField = GetWorld() ? GetWorld()->GetSubsystem<UAuraFieldSubsystem>() : nullptr;
+	if (!AuraField)
 	{
-		// Start the aura tick
-		if (GetWorld())
-		{
-			GetWorld()->GetTimerManager().SetTimer(AuraTickHandle, this, &UHeatAuraComponent::AuraTick, TickInterval, true);
-			// Apply damage immediately
-			AuraTick();
-		}
+		AuraFieldHandle = INDEX_NONE;
+		return;
 	}
-	else
+
+	if (bActive && AuraFieldHandle == INDEX_NONE)
 	{
-		// Stop the aura tick
-		if (GetWorld() && GetWorld()->GetTimerManager().IsTimerActive(AuraTickHandle))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(AuraTickHandle);
-		}
+		AuraFieldHandle = AuraField->RegisterEmitter(GetOwner(), AuraRadius, DamagePerSecond, TickInterval, bAffectsEnemies);
 	}
-}
-
-void UHeatAuraComponent::AuraTick()
-{
-	if (!bAuraActive || !GetOwner())
+	else if (!bActive && AuraFieldHandle != INDEX_NONE)
 	{
-		return;
+		AuraField->UnregisterEmitter(AuraFieldHandle);
+		AuraFieldHandle = INDEX_NONE;
 	}
-	
-	ApplyAuraDamage();
 }
 
-void UHeatAuraComponent::ApplyAuraDamage()
+void UHeatAuraComponent::RefreshAura()
 {
-	if (!GetOwner()) return;
-	
-	AActor* Owner = GetOwner();
-	FVector OwnerLocation = Owner->GetActorLocation();
-	
-	// Find all actors in radius
-	TArray<AActor*> ActorsInRange;
-	UKismetSystemLibrary::SphereOverlapActors(GetWorld(), OwnerLocation, AuraRadius, 
-		TArray<TEnumAsByte<EObjectTypeQuery>>(), nullptr, TArray<AActor*>{Owner}, ActorsInRange);
-	
-	for (AActor* Actor : ActorsInRange)
+	Range = AuraRadius;
+
+	if (AuraFieldHandle != INDEX_NONE)
 	{
-		// Check if it's a player
-		if (ABlackholePlayerCharacter* Player = Cast<ABlackholePlayerCharacter>(Actor))
-		{
-			// Drain WP from player
-			if (UWillPowerComponent* WPComp = Player->FindComponentByClass<UWillPowerComponent>())
-			{
-				WPComp->DrainWillPower(DamagePerSecond * TickInterval);
-				UE_LOG(LogTemp, Warning, TEXT("HeatAura: Draining %.0f WP from player"), DamagePerSecond * TickInterval);
-			}
-		}
-		// Check if it's another enemy and we affect enemies
-		else if (bAffectsEnemies && Actor->IsA<ABaseEnemy>() && Actor != Owner)
+		if (UAuraFieldSubsystem* AuraField = GetWorld()->GetSubsystem<UAuraFieldSubsystem>())
 		{
-			// Drain WP from enemy
-			if (UWillPowerComponent* WPComp = Actor->FindComponentByClass<UWillPowerComponent>())
-			{
-				WPComp->DrainWillPower(DamagePerSecond * TickInterval);
-			}
+			AuraField->UpdateEmitter(AuraFieldHandle, AuraRadius, DamagePerSecond, TickInterval, bAffectsEnemies);
 		}
 	}
-	
-	#if WITH_EDITOR
-	// Debug visualization
-	DrawDebugSphere(GetWorld(), OwnerLocation, AuraRadius, 16, FColor::Orange, false, TickInterval - 0.1f);
-	#endif
-}
\ No newline at end of file
+}
@@ -1,15 +1,15 @@
 #include "Components/Abilities/Enemy/MindmeldComponent.h"
-#include "Components/Attributes/WillPowerComponent.h"
-#include "Systems/ResourceManager.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Systems/MindmeldChannelSubsystem.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
-#include "Engine/GameInstance.h"
-#include "DrawDebugHelpers.h"
 
 UMindmeldComponent::UMindmeldComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Active channels are updated by UMindmeldChannelSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	
 	Cooldown = 0.0f;
 	Range = 5000.0f;
@@ -23,90 +23,79 @@ void UMindmeldComponent::BeginPlay()
 	bIsMindmeldActive = false;
 }
 
+void UMindmeldComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopMindmeld();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UMindmeldComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Mindmeld Execute", STAT_Blackhole_Mindmeld_Execute, BlackholeAbilitiesChannel);
+
 	bIsMindmeldActive = !bIsMindmeldActive;
 	
 	if (!bIsMindmeldActive)
 	{
 		StopMindmeld();
+		return;
+	}
+
+	// Only player characters can be corrupted
+	if (!TargetActor || !TargetActor->IsA<ABlackholePlayerCharacter>())
+	{
+		StopMindmeld();
+		return;
+	}
+
+	if (UMindmeldChannelSubsystem* Channels = GetWorld()->GetSubsystem<UMindmeldChannelSubsystem>())
+	{
+		Channels->StartCorruption(this, TargetActor);
 	}
 	
 	// Removed execute logging to reduce spam
 }
 
-void UMindmeldComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UMindmeldComponent::SetTarget(AActor* NewTarget)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	if (bIsMindmeldActive && TargetActor)
+	TargetActor = NewTarget;
+
+	// Retarget a running channel
+	if (!bIsMindmeldActive)
 	{
-		bool bHasLOS = HasLineOfSight();
-		
-		if (bHasLOS)
-		{
-			// Only corrupt player characters
-			if (TargetActor->IsA<ABlackholePlayerCharacter>())
-			{
-				// Use ResourceManager for WP corruption
-				if (UGameInstance* GameInstance = GetWorld()->GetGameInstance())
-				{
-					if (UResourceManager* ResourceMgr = GameInstance->GetSubsystem<UResourceManager>())
-					{
-						// ADD WP corruption to player (positive value increases corruption)
-						ResourceMgr->AddWillPower(DrainRate * DeltaTime);
-						
-						#if WITH_EDITOR
-						if (AActor* Owner = GetOwner())
-						{
-							DrawDebugLine(GetWorld(), Owner->GetActorLocation() + FVector(0,0,50), 
-										  TargetActor->GetActorLocation() + FVector(0,0,50), 
-										  FColor::Purple, false, 0.0f, 0, 2.0f);
-						}
-						#endif
-						
-						// Removed tick logging to reduce spam
-					}
-					else
-					{
-						// Only log once
-						static bool bLoggedOnce = false;
-						if (!bLoggedOnce)
-						{
-							UE_LOG(LogTemp, Warning, TEXT("Mindmeld: ResourceManager not found!"));
-							bLoggedOnce = true;
-						}
-					}
-				}
-			}
-			else
-			{
-				// Target is not a player - stop mindmeld
-				StopMindmeld();
-			}
-		}
-		else
-		{
-			// Lost line of sight - stop mindmeld
-			StopMindmeld();
-		}
+		return;
 	}
-	else if (bIsMindmeldActive)
+
+	if (!TargetActor || !TargetActor->IsA<ABlackholePlayerCharacter>())
 	{
-		// No target - stop mindmeld
 		StopMindmeld();
 	}
+	else if (UMindmeldChannelSubsystem* Channels = GetWorld()->GetSubsystem<UMindmeldChannelSubsystem>())
+	{
+		Channels->StartCorruption(this, TargetActor);
+	}
 }
 
-void UMindmeldComponent::SetTarget(AActor* NewTarget)
+void UMindmeldComponent::Deactivate()
 {
-	TargetActor = NewTarget;
+	StopMindmeld();
+
+	Super::Deactivate();
 }
 
 void UMindmeldComponent::StopMindmeld()
 {
 	bIsMindmeldActive = false;
 	TargetActor = nullptr;
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UMindmeldChannelSubsystem* Channels = World->GetSubsystem<UMindmeldChannelSubsystem>())
+		{
+			Channels->StopCorruption(this);
+		}
+	}
 }
 
 bool UMindmeldComponent::HasLineOfSight() const
@@ -125,6 +114,7 @@ bool UMindmeldComponent::HasLineOfSight() const
 	FVector End = TargetActor->GetActorLocation() + FVector(0, 0, 50); // Target eye level
 	
 	// Check if there's anything blocking the path
+	BLACKHOLE_COUNT_QUERY(LOSTraces);
 	bool bHit = GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
 	
 	// If nothing was hit, we have line of sight
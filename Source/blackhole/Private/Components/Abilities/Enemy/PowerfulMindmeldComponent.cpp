@@ -1,20 +1,24 @@
 #include "Components/Abilities/Enemy/PowerfulMindmeldComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Utils/ErrorHandling.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Components/Attributes/WillPowerComponent.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
 #include "UI/BlackholeHUD.h"
 #include "Systems/ResourceManager.h"
 #include "Systems/ThresholdManager.h"
+#include "Systems/MindmeldChannelSubsystem.h"
 
 UPowerfulMindmeldComponent::UPowerfulMindmeldComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
+	// Channels are updated by UMindmeldChannelSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	
 	Cooldown = 45.0f; // Reduced cooldown for more frequent use
 	Range = 3000.0f;
@@ -35,7 +39,7 @@ void UPowerfulMindmeldComponent::EndPlay(const EEndPlayReason::Type EndPlayReaso
 	// Interrupt channel if owner is being destroyed
 	if (bIsChanneling)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PowerfulMindmeld: MindMelder destroyed, interrupting channel!"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("PowerfulMindmeld: MindMelder destroyed, interrupting channel!"));
 		InterruptChannel();
 	}
 	
@@ -44,6 +48,8 @@ void UPowerfulMindmeldComponent::EndPlay(const EEndPlayReason::Type EndPlayReaso
 
 void UPowerfulMindmeldComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("PowerfulMindmeld Execute", STAT_Blackhole_PowerfulMindmeld_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute() || bIsChanneling)
 	{
 		return;
@@ -69,6 +75,7 @@ void UPowerfulMindmeldComponent::Execute()
 		FCollisionQueryParams QueryParams;
 		QueryParams.AddIgnoredActor(GetOwner());
 		
+		BLACKHOLE_COUNT_QUERY(LOSTraces);
 		bool bHitSomething = GetWorld()->LineTraceSingleByChannel(HitResult, 
 			GetOwner()->GetActorLocation() + FVector(0, 0, 50), 
 			Player->GetActorLocation() + FVector(0, 0, 50),
@@ -84,7 +91,7 @@ void UPowerfulMindmeldComponent::Execute()
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("PowerfulMindmeld: No line of sight to player"));
+			UE_LOG(LogBlackholeAbilities, Warning, TEXT("PowerfulMindmeld: No line of sight to player"));
 			return;
 		}
 	}
@@ -101,39 +108,33 @@ void UPowerfulMindmeldComponent::StartChannel()
 	bIsChanneling = true;
 	ChannelStartTime = GetWorld()->GetTimeSeconds();
 	
-	UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Starting channel! CastTime=%.1f, Target=%s"), 
+	UE_LOG(LogBlackholeAbilities, Log, TEXT("PowerfulMindmeld: Starting channel! CastTime=%.1f, Target=%s"), 
 		CastTime, ChannelTarget ? *ChannelTarget->GetName() : TEXT("nullptr"));
 	
 	// Start completion timer
 	FTimerDelegate TimerDelegate;
 	TimerDelegate.BindLambda([this]()
 	{
-		UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Timer fired! Calling CompleteChannel..."));
+		UE_LOG(LogBlackholeAbilities, Verbose, TEXT("PowerfulMindmeld: Timer fired! Calling CompleteChannel..."));
 		CompleteChannel();
 	});
 	
 	GetWorld()->GetTimerManager().SetTimer(ChannelCompleteTimer, TimerDelegate, CastTime, false);
+
+	if (UMindmeldChannelSubsystem* Channels = GetWorld()->GetSubsystem<UMindmeldChannelSubsystem>())
+	{
+		Channels->StartTimedChannel(this);
+	}
 	
 	// Verify timer was set
 	if (GetWorld()->GetTimerManager().IsTimerActive(ChannelCompleteTimer))
 	{
 		float TimeRemaining = GetWorld()->GetTimerManager().GetTimerRemaining(ChannelCompleteTimer);
-		UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Timer successfully set! CastTime=%.1f, TimeRemaining=%.1f"), CastTime, TimeRemaining);
-		
-		// Set a recurring log timer to track progress
-		FTimerHandle LogTimer;
-		GetWorld()->GetTimerManager().SetTimer(LogTimer, [this]()
-		{
-			if (bIsChanneling)
-			{
-				float Remaining = GetWorld()->GetTimerManager().GetTimerRemaining(ChannelCompleteTimer);
-				UE_LOG(LogTemp, Warning, TEXT("PowerfulMindmeld: Channel progress - %.1f seconds remaining"), Remaining);
-			}
-		}, 5.0f, true);
+		UE_LOG(LogBlackholeAbilities, Verbose, TEXT("PowerfulMindmeld: Timer successfully set! CastTime=%.1f, TimeRemaining=%.1f"), CastTime, TimeRemaining);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: FAILED to set timer!"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("PowerfulMindmeld: FAILED to set timer!"));
 	}
 	
 	// Notify about channel start
@@ -155,7 +156,7 @@ void UPowerfulMindmeldComponent::StartChannel()
 		// TODO: Play channeling animation/effect
 	}
 	
-	UE_LOG(LogTemp, Error, TEXT("MIND MELDER: Starting %.0f second channel! Only death can interrupt!"), CastTime);
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("MIND MELDER: Starting %.0f second channel! Only death can interrupt!"), CastTime);
 }
 
 void UPowerfulMindmeldComponent::UpdateChannel()
@@ -167,7 +168,7 @@ void UPowerfulMindmeldComponent::UpdateChannel()
 	
 	if (!ChannelTarget)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PowerfulMindmeld: UpdateChannel - Lost target during channel!"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("PowerfulMindmeld: UpdateChannel - Lost target during channel!"));
 		InterruptChannel();
 		return;
 	}
@@ -175,17 +176,13 @@ void UPowerfulMindmeldComponent::UpdateChannel()
 	// Check if we should interrupt (only if owner dies)
 	if (CheckInterruptConditions())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PowerfulMindmeld: UpdateChannel - Interrupt conditions met (owner died)!"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("PowerfulMindmeld: UpdateChannel - Interrupt conditions met (owner died)!"));
 		InterruptChannel();
 		return;
 	}
 	
-	// Log progress
-	float TimeRemaining = GetTimeRemaining();
-	if (FMath::Fmod(TimeRemaining, 5.0f) < 0.2f) // Log every 5 seconds
-	{
-		UE_LOG(LogTemp, Warning, TEXT("PowerfulMindmeld: Channel in progress - %.1f seconds remaining"), TimeRemaining);
-	}
+	// Log progress every 5 seconds
+	BLACKHOLE_LOG_RATE_LIMITED(LogBlackholeAbilities, Log, 5.0, TEXT("PowerfulMindmeld: Channel in progress - %.1f seconds remaining"), GetTimeRemaining());
 	
 	// Visual feedback
 	#if WITH_EDITOR
@@ -195,17 +192,17 @@ void UPowerfulMindmeldComponent::UpdateChannel()
 	// Draw channeling beam
 	float Progress = GetChannelProgress();
 	FColor BeamColor = FColor::MakeRedToGreenColorFromScalar(1.0f - Progress);
-	DrawDebugLine(GetWorld(), OwnerLoc, TargetLoc, BeamColor, false, -1.0f, 0, 5.0f);
+	BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), OwnerLoc, TargetLoc, BeamColor, false, -1.0f, 0, 5.0f));
 	
 	// Draw progress circle
-	DrawDebugCircle(GetWorld(), GetOwner()->GetActorLocation(), 100.0f * Progress, 32, 
-		BeamColor, false, -1.0f, 0, 5.0f, FVector(0, 1, 0), FVector(1, 0, 0));
+	BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugCircle(GetWorld(), GetOwner()->GetActorLocation(), 100.0f * Progress, 32, 
+		BeamColor, false, -1.0f, 0, 5.0f, FVector(0, 1, 0), FVector(1, 0, 0)));
 	#endif
 }
 
 void UPowerfulMindmeldComponent::CompleteChannel()
 {
-	UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: CompleteChannel called! bIsChanneling=%d, ChannelTarget=%s"), 
+	UE_LOG(LogBlackholeAbilities, Verbose, TEXT("PowerfulMindmeld: CompleteChannel called! bIsChanneling=%d, ChannelTarget=%s"), 
 		bIsChanneling, ChannelTarget ? *ChannelTarget->GetName() : TEXT("nullptr"));
 	
 	if (!bIsChanneling || !ChannelTarget) return;
@@ -213,28 +210,28 @@ void UPowerfulMindmeldComponent::CompleteChannel()
 	// Drop player WP to 0
 	if (ABlackholePlayerCharacter* Player = Cast<ABlackholePlayerCharacter>(ChannelTarget))
 	{
-		UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Found player %s"), *Player->GetName());
+		UE_LOG(LogBlackholeAbilities, Verbose, TEXT("PowerfulMindmeld: Found player %s"), *Player->GetName());
 		
 		// Get ResourceManager to properly drain WP and trigger critical state
 		if (UResourceManager* ResMgr = GetWorld()->GetGameInstance()->GetSubsystem<UResourceManager>())
 		{
 			float CurrentWP = ResMgr->GetCurrentWillPower();
 			float MaxWP = ResMgr->GetMaxWillPower();
-			UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Player current WP = %.1f, draining all via ResourceManager..."), CurrentWP);
+			UE_LOG(LogBlackholeAbilities, Verbose, TEXT("PowerfulMindmeld: Player current WP = %.1f, draining all via ResourceManager..."), CurrentWP);
 			
 			// Use TakeDamage to drain all WP - this will trigger OnWPDepleted and start critical timer
 			ResMgr->TakeDamage(CurrentWP);
 			
 			// Verify it worked
 			float NewWP = ResMgr->GetCurrentWillPower();
-			UE_LOG(LogTemp, Error, TEXT("MIND MELD COMPLETE: Player WP dropped from %.1f to %.1f!"), CurrentWP, NewWP);
+			UE_LOG(LogBlackholeAbilities, Warning, TEXT("MIND MELD COMPLETE: Player WP dropped from %.1f to %.1f!"), CurrentWP, NewWP);
 			
 			// Force a special MindMeld critical state that ignores entries
 			if (UThresholdManager* ThreshMgr = GetWorld()->GetSubsystem<UThresholdManager>())
 			{
 				// Notify ThresholdManager that this is a MindMeld-induced critical state
 				// This should force ultimate usage, not just consume an entry
-				UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Forcing MindMeld critical state - player MUST use ultimate!"));
+				UE_LOG(LogBlackholeAbilities, Verbose, TEXT("PowerfulMindmeld: Forcing MindMeld critical state - player MUST use ultimate!"));
 				ThreshMgr->StartCriticalTimer();
 			}
 		}
@@ -242,17 +239,17 @@ void UPowerfulMindmeldComponent::CompleteChannel()
 		{
 			// Fallback to direct component access
 			float CurrentWP = WPComp->GetCurrentValue();
-			UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: No ResourceManager, using WillPowerComponent directly"));
+			UE_LOG(LogBlackholeAbilities, Warning, TEXT("PowerfulMindmeld: No ResourceManager, using WillPowerComponent directly"));
 			WPComp->SetCurrentValue(0.0f);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Could not find WillPowerComponent on player!"));
+			UE_LOG(LogBlackholeAbilities, Error, TEXT("PowerfulMindmeld: Could not find WillPowerComponent on player!"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PowerfulMindmeld: Failed to cast ChannelTarget to player!"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("PowerfulMindmeld: Failed to cast ChannelTarget to player!"));
 	}
 	
 	OnMindmeldComplete.Broadcast();
@@ -269,13 +266,17 @@ void UPowerfulMindmeldComponent::CompleteChannel()
 	bIsChanneling = false;
 	ChannelTarget = nullptr;
 	GetWorld()->GetTimerManager().ClearTimer(ChannelCompleteTimer);
+	if (UMindmeldChannelSubsystem* Channels = GetWorld()->GetSubsystem<UMindmeldChannelSubsystem>())
+	{
+		Channels->StopTimedChannel(this);
+	}
 }
 
 void UPowerfulMindmeldComponent::InterruptChannel()
 {
 	if (!bIsChanneling) return;
 	
-	UE_LOG(LogTemp, Warning, TEXT("Mind meld interrupted!"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("Mind meld interrupted!"));
 	
 	OnMindmeldInterrupted.Broadcast();
 	
@@ -291,6 +292,10 @@ void UPowerfulMindmeldComponent::InterruptChannel()
 	bIsChanneling = false;
 	ChannelTarget = nullptr;
 	GetWorld()->GetTimerManager().ClearTimer(ChannelCompleteTimer);
+	if (UMindmeldChannelSubsystem* Channels = GetWorld()->GetSubsystem<UMindmeldChannelSubsystem>())
+	{
+		Channels->StopTimedChannel(this);
+	}
 	
 	// Put ability on cooldown
 	StartCooldown();
@@ -306,16 +311,6 @@ void UPowerfulMindmeldComponent::Deactivate()
 	Super::Deactivate();
 }
 
-void UPowerfulMindmeldComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	if (bIsChanneling)
-	{
-		UpdateChannel();
-	}
-}
-
 float UPowerfulMindmeldComponent::GetChannelProgress() const
 {
 	if (!bIsChanneling) return 0.0f;
@@ -363,12 +358,12 @@ void UPowerfulMindmeldComponent::NotifyPlayerOfChannel()
 		// Show location indicator
 		FVector EnemyLocation = GetOwner()->GetActorLocation();
 		
-		UE_LOG(LogTemp, Error, TEXT("WARNING: MIND MELDER channeling PowerfulMindmeld! %.0f seconds until WP drops to 0! Kill the MindMelder to interrupt!"), 
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("WARNING: MIND MELDER channeling PowerfulMindmeld! %.0f seconds until WP drops to 0! Kill the MindMelder to interrupt!"), 
 			CastTime);
 		
 		// Draw debug sphere at enemy location
 		#if WITH_EDITOR
-		DrawDebugSphere(GetWorld(), EnemyLocation, 200.0f, 32, FColor::Red, false, CastTime, 0, 10.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), EnemyLocation, 200.0f, 32, FColor::Red, false, CastTime, 0, 10.0f));
 		#endif
 		
 		// HUD notifications are now handled in StartChannel()
@@ -1,14 +1,17 @@
 #include "Components/Abilities/Enemy/SmashAbilityComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 #include "Engine/EngineTypes.h"
 #include "CollisionQueryParams.h"
 #include "Engine/OverlapResult.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Engine/DamageEvents.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Character.h"
+#include "Components/Movement/ForcedMovement.h"
 
 USmashAbilityComponent::USmashAbilityComponent()
 {
@@ -27,6 +30,8 @@ void USmashAbilityComponent::BeginPlay()
 
 void USmashAbilityComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("SmashAbility Execute", STAT_Blackhole_SmashAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -59,6 +64,7 @@ void USmashAbilityComponent::PerformSingleTargetDamage(AActor* Owner)
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(Owner);
 	
+	BLACKHOLE_COUNT_QUERY(HitQueries);
 	if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Pawn, QueryParams))
 	{
 		if (AActor* HitActor = HitResult.GetActor())
@@ -66,12 +72,12 @@ void USmashAbilityComponent::PerformSingleTargetDamage(AActor* Owner)
 			// Apply damage using actor's TakeDamage method (routes to WP)
 			FPointDamageEvent DamageEvent(Damage, HitResult, Owner->GetActorForwardVector(), nullptr);
 			HitActor->TakeDamage(Damage, DamageEvent, nullptr, Owner);
-			UE_LOG(LogTemp, Warning, TEXT("SmashAbility: Dealt %f damage to %s"), Damage, *HitActor->GetName());
+			UE_LOG(LogBlackholeAbilities, Warning, TEXT("SmashAbility: Dealt %f damage to %s"), Damage, *HitActor->GetName());
 		}
 	}
 	
 	#if WITH_EDITOR
-	DrawDebugLine(GetWorld(), Start, End, FColor::Orange, false, 1.0f, 0, 2.0f);
+	BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), Start, End, FColor::Orange, false, 1.0f, 0, 2.0f));
 	#endif
 }
 
@@ -86,6 +92,7 @@ void USmashAbilityComponent::PerformAreaDamage(AActor* Owner)
 	
 	FCollisionShape SphereShape = FCollisionShape::MakeSphere(AreaRadius);
 	
+	BLACKHOLE_COUNT_QUERY(HitQueries);
 	if (GetWorld()->OverlapMultiByChannel(OverlapResults, Center, FQuat::Identity, ECC_Pawn, SphereShape, QueryParams))
 	{
 		for (const FOverlapResult& Result : OverlapResults)
@@ -116,20 +123,18 @@ void USmashAbilityComponent::PerformAreaDamage(AActor* Owner)
 					// Calculate knockback force based on distance (closer = stronger)
 					float ActualKnockbackForce = KnockbackForce * DamageFalloff;
 					
-					if (UCharacterMovementComponent* CharMovement = TargetCharacter->GetCharacterMovement())
+					if (FForcedMovement::ApplyKnockback(TargetCharacter, KnockbackDirection * ActualKnockbackForce) != 0)
 					{
-						// Launch the character
-						CharMovement->Launch(KnockbackDirection * ActualKnockbackForce);
-						UE_LOG(LogTemp, Warning, TEXT("SmashAbility Area: Applied knockback force %f to %s"), ActualKnockbackForce, *HitActor->GetName());
+						UE_LOG(LogBlackholeAbilities, Warning, TEXT("SmashAbility Area: Applied knockback force %f to %s"), ActualKnockbackForce, *HitActor->GetName());
 					}
 				}
 				
-				UE_LOG(LogTemp, Warning, TEXT("SmashAbility Area: Dealt %f damage to %s"), FinalDamage, *HitActor->GetName());
+				UE_LOG(LogBlackholeAbilities, Warning, TEXT("SmashAbility Area: Dealt %f damage to %s"), FinalDamage, *HitActor->GetName());
 			}
 		}
 	}
 	
 	#if WITH_EDITOR
-	DrawDebugSphere(GetWorld(), Center, AreaRadius, 12, FColor::Red, false, 1.0f);
+	BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), Center, AreaRadius, 12, FColor::Red, false, 1.0f));
 	#endif
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "Components/Abilities/Enemy/StabAttackComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Enemy/BaseEnemy.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/DamageEvents.h"
 #include "Components/StatusEffectComponent.h"
@@ -30,6 +32,8 @@ void UStabAttackComponent::BeginPlay()
 
 void UStabAttackComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("StabAttack Execute", STAT_Blackhole_StabAttack_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -56,6 +60,7 @@ void UStabAttackComponent::PerformStabAttack()
 	// Sweep in front of the enemy
 	FVector EndLocation = StartLocation + (ForwardVector * AttackRange);
 	
+	BLACKHOLE_COUNT_QUERY(HitQueries);
 	if (GetWorld()->SweepMultiByChannel(HitResults, StartLocation, EndLocation, FQuat::Identity, 
 		ECC_Pawn, CollisionShape, QueryParams))
 	{
@@ -84,7 +89,7 @@ void UStabAttackComponent::PerformStabAttack()
 						}
 					}
 					
-					UE_LOG(LogTemp, Warning, TEXT("StabAttack: Dealt %.0f damage to %s"), BaseDamage, *HitActor->GetName());
+					UE_LOG(LogBlackholeAbilities, Warning, TEXT("StabAttack: Dealt %.0f damage to %s"), BaseDamage, *HitActor->GetName());
 				}
 			}
 		}
@@ -92,8 +97,8 @@ void UStabAttackComponent::PerformStabAttack()
 	
 	#if WITH_EDITOR
 	// Debug visualization
-	DrawDebugCone(GetWorld(), StartLocation, ForwardVector, AttackRange, 
+	BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugCone(GetWorld(), StartLocation, ForwardVector, AttackRange, 
 		FMath::DegreesToRadians(AttackAngle), FMath::DegreesToRadians(AttackAngle), 
-		12, FColor::Red, false, 1.0f);
+		12, FColor::Red, false, 1.0f));
 	#endif
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "Components/Abilities/Enemy/SwordAttackComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Enemy/BaseEnemy.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/DamageEvents.h"
 
@@ -29,6 +31,8 @@ void USwordAttackComponent::BeginPlay()
 
 void USwordAttackComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("SwordAttack Execute", STAT_Blackhole_SwordAttack_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -55,6 +59,7 @@ void USwordAttackComponent::PerformSwordAttack()
 	// Sweep in front of the enemy
 	FVector EndLocation = StartLocation + (ForwardVector * AttackRange);
 	
+	BLACKHOLE_COUNT_QUERY(HitQueries);
 	if (GetWorld()->SweepMultiByChannel(HitResults, StartLocation, EndLocation, FQuat::Identity, 
 		ECC_Pawn, CollisionShape, QueryParams))
 	{
@@ -73,7 +78,7 @@ void USwordAttackComponent::PerformSwordAttack()
 					FPointDamageEvent DamageEvent(BaseDamage, Hit, ForwardVector, nullptr);
 					HitActor->TakeDamage(BaseDamage, DamageEvent, nullptr, Owner);
 					
-					UE_LOG(LogTemp, Warning, TEXT("SwordAttack: Dealt %.0f damage to %s"), BaseDamage, *HitActor->GetName());
+					UE_LOG(LogBlackholeAbilities, Warning, TEXT("SwordAttack: Dealt %.0f damage to %s"), BaseDamage, *HitActor->GetName());
 				}
 			}
 		}
@@ -81,8 +86,8 @@ void USwordAttackComponent::PerformSwordAttack()
 	
 	#if WITH_EDITOR
 	// Debug visualization
-	DrawDebugCone(GetWorld(), StartLocation, ForwardVector, AttackRange, 
+	BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugCone(GetWorld(), StartLocation, ForwardVector, AttackRange, 
 		FMath::DegreesToRadians(AttackAngle), FMath::DegreesToRadians(AttackAngle), 
-		12, FColor::Yellow, false, 1.0f);
+		12, FColor::Yellow, false, 1.0f));
 	#endif
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 #include "Components/Abilities/Player/Basic/KillAbilityComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Systems/ResourceManager.h"
 #include "GameFramework/Actor.h"
 #include "Engine/DamageEvents.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Camera/CameraComponent.h"
@@ -35,6 +37,8 @@ bool UKillAbilityComponent::CanExecute() const
 
 void UKillAbilityComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("KillAbility Execute", STAT_Blackhole_KillAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -75,6 +79,7 @@ void UKillAbilityComponent::Execute()
 		FCollisionQueryParams QueryParams;
 		QueryParams.AddIgnoredActor(Owner);
 		
+		BLACKHOLE_COUNT_QUERY(HitQueries);
 		if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Pawn, QueryParams))
 		{
 			if (AActor* HitActor = HitResult.GetActor())
@@ -97,7 +102,7 @@ void UKillAbilityComponent::Execute()
 		// Only draw debug line for non-player owners (enemies)
 		if (!Owner->IsA<ABlackholePlayerCharacter>())
 		{
-			DrawDebugLine(GetWorld(), Start, End, FColor::Black, false, 1.0f, 0, 3.0f);
+			BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), Start, End, FColor::Black, false, 1.0f, 0, 3.0f));
 		}
 		#endif
 	}
@@ -105,8 +110,10 @@ void UKillAbilityComponent::Execute()
 
 void UKillAbilityComponent::ExecuteUltimate()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("KillAbility Execute Ultimate", STAT_Blackhole_KillAbility_ExecuteUltimate, BlackholeAbilitiesChannel);
+
 	// Ultimate Kill - kills all enemies on screen
-	UE_LOG(LogTemp, Warning, TEXT("ULTIMATE KILL: Death Wave!"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("ULTIMATE KILL: Death Wave!"));
 	
 	Super::ExecuteUltimate();
 	
@@ -123,6 +130,7 @@ void UKillAbilityComponent::ExecuteUltimate()
 		float UltimateRadius = 5000.0f;
 		
 		FVector Location = Owner->GetActorLocation();
+		BLACKHOLE_COUNT_QUERY(HitQueries);
 		GetWorld()->OverlapMultiByChannel(
 			OverlapResults,
 			Location,
@@ -159,7 +167,7 @@ void UKillAbilityComponent::ExecuteUltimate()
 		for (int32 i = 0; i < 10; i++)
 		{
 			float Radius = (i / 10.0f) * UltimateRadius;
-			DrawDebugSphere(GetWorld(), Location, Radius, 32, FColor::Red, false, 1.0f, 0, 2.0f);
+			BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), Location, Radius, 32, FColor::Red, false, 1.0f, 0, 2.0f));
 		}
 		#endif
 	}
@@ -1,8 +1,9 @@
 #include "Components/Abilities/Player/Basic/SlashAbilityComponent.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Actor.h"
 #include "Engine/DamageEvents.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Camera/CameraComponent.h"
 #include "Engine/EngineTypes.h"
@@ -43,6 +44,8 @@ bool USlashAbilityComponent::CanExecute() const
 
 void USlashAbilityComponent::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("SlashAbility Execute", STAT_Blackhole_SlashAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -73,44 +76,27 @@ void USlashAbilityComponent::Execute()
 					TraceParams.AddIgnoredActor(Owner);
 					
 					// Extended line trace
+					BLACKHOLE_COUNT_QUERY(HitQueries);
 					bool bTraceHit = GetWorld()->LineTraceSingleByChannel(TraceHit, CameraLocation, TraceEnd, ECC_Pawn, TraceParams);
 					
 					// Step 2: Sphere check around player (300 unit radius)
-					float SphereRadius = 300.0f; // Attack range around player
+					float SphereRadius = TargetSphereRadius; // Attack range around player
 					FVector PlayerLocation = Owner->GetActorLocation();
 					
-					TArray<FOverlapResult> OverlapResults;
-					FCollisionQueryParams SphereParams;
-					SphereParams.AddIgnoredActor(Owner);
-					
-					bool bSphereHit = GetWorld()->OverlapMultiByChannel(
-						OverlapResults,
-						PlayerLocation,
-						FQuat::Identity,
-						ECC_Pawn,
-						FCollisionShape::MakeSphere(SphereRadius),
-						SphereParams
-					);
-					
 					// Step 3: Check if BOTH trace and sphere hit the same target
 					AActor* ValidTarget = nullptr;
 					FHitResult ValidHit;
 					
-					if (bTraceHit && TraceHit.GetActor())
+					if (bTraceHit && TraceHit.GetActor() && IsTargetInSphere(TraceHit, PlayerLocation))
 					{
-						// Check if traced actor is also in sphere
-						for (const FOverlapResult& Overlap : OverlapResults)
-						{
-							if (Overlap.GetActor() == TraceHit.GetActor())
-							{
-								// Both trace and sphere hit the same target!
-								ValidTarget = TraceHit.GetActor();
-								ValidHit = TraceHit;
-								break;
-							}
-						}
+						ValidTarget = TraceHit.GetActor();
+						ValidHit = TraceHit;
 					}
 					
+					// Warm-up results are single use
+					WarmCandidates.Reset();
+					WarmFrame = 0;
+					
 					if (ValidTarget)
 					{
 						// We have a valid target - apply damage
@@ -128,9 +114,9 @@ void USlashAbilityComponent::Execute()
 						
 						#if WITH_EDITOR
 						// Show successful hit
-						DrawDebugSphere(GetWorld(), ValidHit.Location, 20.0f, 8, FColor::Green, false, 0.5f);
-						DrawDebugLine(GetWorld(), CameraLocation, ValidHit.Location, FColor::Green, false, 0.5f, 0, 2.0f);
-						DrawDebugSphere(GetWorld(), PlayerLocation, SphereRadius, 16, FColor::Blue, false, 0.5f);
+						BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), ValidHit.Location, 20.0f, 8, FColor::Green, false, 0.5f));
+						BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), CameraLocation, ValidHit.Location, FColor::Green, false, 0.5f, 0, 2.0f));
+						BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), PlayerLocation, SphereRadius, 16, FColor::Blue, false, 0.5f));
 						#endif
 					}
 					else
@@ -140,15 +126,15 @@ void USlashAbilityComponent::Execute()
 						if (bTraceHit)
 						{
 							// Trace hit but not in sphere
-							DrawDebugLine(GetWorld(), CameraLocation, TraceHit.Location, FColor::Yellow, false, 0.5f, 0, 2.0f);
-							DrawDebugSphere(GetWorld(), TraceHit.Location, 20.0f, 8, FColor::Yellow, false, 0.5f);
+							BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), CameraLocation, TraceHit.Location, FColor::Yellow, false, 0.5f, 0, 2.0f));
+							BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), TraceHit.Location, 20.0f, 8, FColor::Yellow, false, 0.5f));
 						}
 						else
 						{
 							// Complete miss
-							DrawDebugLine(GetWorld(), CameraLocation, TraceEnd, FColor::Red, false, 0.5f, 0, 2.0f);
+							BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), CameraLocation, TraceEnd, FColor::Red, false, 0.5f, 0, 2.0f));
 						}
-						DrawDebugSphere(GetWorld(), PlayerLocation, SphereRadius, 16, FColor::Red, false, 0.5f);
+						BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), PlayerLocation, SphereRadius, 16, FColor::Red, false, 0.5f));
 						#endif
 					}
 				}
@@ -162,6 +148,7 @@ void USlashAbilityComponent::Execute()
 				FCollisionQueryParams QueryParams;
 				QueryParams.AddIgnoredActor(Owner);
 				
+				BLACKHOLE_COUNT_QUERY(HitQueries);
 				if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Pawn, QueryParams))
 				{
 					if (AActor* HitActor = HitResult.GetActor())
@@ -191,6 +178,7 @@ void USlashAbilityComponent::Execute()
 			FCollisionQueryParams QueryParams;
 			QueryParams.AddIgnoredActor(Owner);
 			
+			BLACKHOLE_COUNT_QUERY(HitQueries);
 			if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Pawn, QueryParams))
 			{
 				if (AActor* HitActor = HitResult.GetActor())
@@ -212,3 +200,79 @@ void USlashAbilityComponent::Execute()
 		}
 	}
 }
+
+void USlashAbilityComponent::PrepareExecution()
+{
+	AActor* Owner = GetOwner();
+	UWorld* World = GetWorld();
+	if (!Owner || !World || WarmFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	TArray<FOverlapResult> OverlapResults;
+	FCollisionQueryParams SphereParams;
+	SphereParams.AddIgnoredActor(Owner);
+
+	BLACKHOLE_COUNT_QUERY(HitQueries);
+	World->OverlapMultiByChannel(
+		OverlapResults,
+		Owner->GetActorLocation(),
+		FQuat::Identity,
+		ECC_Pawn,
+		FCollisionShape::MakeSphere(TargetSphereRadius + WarmupRadiusMargin),
+		SphereParams
+	);
+
+	WarmCandidates.Reset();
+	for (const FOverlapResult& Overlap : OverlapResults)
+	{
+		if (AActor* Candidate = Overlap.GetActor())
+		{
+			WarmCandidates.AddUnique(Candidate);
+		}
+	}
+	WarmFrame = GFrameCounter;
+}
+
+bool USlashAbilityComponent::HasFreshWarmup() const
+{
+	return WarmFrame != 0 && GFrameCounter - WarmFrame <= 1;
+}
+
+bool USlashAbilityComponent::IsTargetInSphere(const FHitResult& TraceHit, const FVector& PlayerLocation) const
+{
+	AActor* TracedActor = TraceHit.GetActor();
+
+	// A warm hit with its impact point inside the sphere overlaps it - no query needed. A miss
+	// proves nothing (the target may have spawned or moved in since), so it takes the full test
+	if (HasFreshWarmup() && WarmCandidates.Contains(TracedActor)
+		&& FVector::DistSquared(TraceHit.ImpactPoint, PlayerLocation) <= FMath::Square(TargetSphereRadius))
+	{
+		return true;
+	}
+
+	// Cold path (or unknown warm result) - run the full sphere overlap
+	TArray<FOverlapResult> OverlapResults;
+	FCollisionQueryParams SphereParams;
+	SphereParams.AddIgnoredActor(GetOwner());
+
+	BLACKHOLE_COUNT_QUERY(HitQueries);
+	GetWorld()->OverlapMultiByChannel(
+		OverlapResults,
+		PlayerLocation,
+		FQuat::Identity,
+		ECC_Pawn,
+		FCollisionShape::MakeSphere(TargetSphereRadius),
+		SphereParams
+	);
+
+	for (const FOverlapResult& Overlap : OverlapResults)
+	{
+		if (Overlap.GetActor() == TracedActor)
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -1,10 +1,12 @@
 #include "Components/Abilities/Player/Hacker/DataSpikeAbility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "Engine/World.h"
 #include "Engine/EngineTypes.h"
 #include "CollisionQueryParams.h"
 #include "TimerManager.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "Camera/CameraComponent.h"
 #include "Player/BlackholePlayerCharacter.h"
@@ -13,6 +15,9 @@
 #include "Engine/DamageEvents.h"
 #include "Systems/HitStopManager.h"
 #include "Utils/ErrorHandling.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
 
 UDataSpikeAbility::UDataSpikeAbility()
 {
@@ -38,6 +43,8 @@ bool UDataSpikeAbility::CanExecute() const
 
 void UDataSpikeAbility::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("DataSpikeAbility Execute", STAT_Blackhole_DataSpikeAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -58,9 +65,11 @@ void UDataSpikeAbility::Execute()
 
 void UDataSpikeAbility::ExecuteUltimate()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("DataSpikeAbility Execute Ultimate", STAT_Blackhole_DataSpikeAbility_ExecuteUltimate, BlackholeAbilitiesChannel);
+
 	// Ultimate Data Spike - "System Corruption"
 	// Pierces all enemies and applies enhanced data corruption
-	UE_LOG(LogTemp, Warning, TEXT("ULTIMATE DATA SPIKE: System Corruption!"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("ULTIMATE DATA SPIKE: System Corruption!"));
 	
 	Super::ExecuteUltimate();
 	
@@ -71,7 +80,7 @@ void UDataSpikeAbility::ExecuteUltimate()
 	if (UResourceManager* ResourceMgr = GetGameInstanceSubsystemSafe<UResourceManager>(this))
 	{
 		ResourceMgr->AddWillPower(-UltimateWPCleanse);
-		UE_LOG(LogTemp, Warning, TEXT("Ultimate Data Spike: Cleansed %.0f WP!"), 
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ultimate Data Spike: Cleansed %.0f WP!"), 
 			UltimateWPCleanse);
 	}
 }
@@ -102,7 +111,7 @@ void UDataSpikeAbility::FireProjectile(bool bIsUltimate)
 	AActor* Owner = GetOwner();
 	if (!Owner)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DataSpikeAbility: FireProjectile failed - no owner"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("DataSpikeAbility: FireProjectile failed - no owner"));
 		return;
 	}
 	
@@ -126,6 +135,7 @@ void UDataSpikeAbility::FireProjectile(bool bIsUltimate)
 	bool bHit = false;
 	if (UWorld* World = GetWorld())
 	{
+		BLACKHOLE_COUNT_QUERY(HitQueries);
 		bHit = World->LineTraceMultiByChannel(
 			HitResults,
 			Start,
@@ -163,16 +173,16 @@ void UDataSpikeAbility::FireProjectile(bool bIsUltimate)
 	}
 
 	// Play fire sound
-	if (FireSound)
+	if (USoundBase* Sound = ResolveAbilityAsset(FireSound))
 	{
 		if (UWorld* World = GetWorld())
 		{
-			UGameplayStatics::PlaySoundAtLocation(World, FireSound, Start);
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, Start);
 		}
 	}
 
 	// Spawn projectile trail effect
-	if (ProjectileEffect)
+	if (UParticleSystem* Effect = ResolveAbilityAsset(ProjectileEffect))
 	{
 		FVector EffectEnd = HitResults.Num() > 0 ? HitResults.Last().Location : End;
 		
@@ -182,7 +192,7 @@ void UDataSpikeAbility::FireProjectile(bool bIsUltimate)
 		{
 			UGameplayStatics::SpawnEmitterAtLocation(
 				World,
-				ProjectileEffect,
+				Effect,
 				Start,
 				Direction.Rotation(),
 				FVector(1.0f)
@@ -195,14 +205,14 @@ void UDataSpikeAbility::FireProjectile(bool bIsUltimate)
 	if (UWorld* World = GetWorld())
 	{
 		FColor LineColor = bIsUltimate ? FColor::Purple : FColor::Green;
-		DrawDebugLine(World, Start, End, LineColor, false, 2.0f, 0, 3.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(World, Start, End, LineColor, false, 2.0f, 0, 3.0f));
 		
 		// Draw hit points
 		for (const FHitResult& Hit : HitResults)
 		{
 			if (Hit.GetActor() && (Hit.GetActor()->ActorHasTag("Enemy") || Hit.GetActor()->IsA<ABaseEnemy>()))
 			{
-				DrawDebugSphere(World, Hit.Location, 25.0f, 12, FColor::Red, false, 1.0f);
+				BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(World, Hit.Location, 25.0f, 12, FColor::Red, false, 1.0f));
 			}
 		}
 	}
@@ -241,20 +251,20 @@ void UDataSpikeAbility::ProcessProjectileHit(const FHitResult& HitResult, int32&
 		HitStopMgr->RequestMediumHitStop();
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Data Spike hit %s for %.1f damage"), 
+	UE_LOG(LogBlackholeAbilities, Log, TEXT("Data Spike hit %s for %.1f damage"), 
 		*Enemy->GetName(), FinalDamage);
 
 	// Apply data corruption DOT
 	ApplyDataCorruption(Enemy, bIsUltimate);
 
 	// Spawn hit effect
-	if (HitEffect)
+	if (UParticleSystem* Effect = ResolveAbilityAsset(HitEffect))
 	{
 		if (UWorld* World = GetWorld())
 		{
 			UGameplayStatics::SpawnEmitterAtLocation(
 				World,
-				HitEffect,
+				Effect,
 				HitResult.Location,
 				FRotator::ZeroRotator,
 				FVector(1.0f)
@@ -263,11 +273,11 @@ void UDataSpikeAbility::ProcessProjectileHit(const FHitResult& HitResult, int32&
 	}
 
 	// Play hit sound
-	if (HitSound)
+	if (USoundBase* Sound = ResolveAbilityAsset(HitSound))
 	{
 		if (UWorld* World = GetWorld())
 		{
-			UGameplayStatics::PlaySoundAtLocation(World, HitSound, HitResult.Location);
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, HitResult.Location);
 		}
 	}
 
@@ -331,15 +341,15 @@ void UDataSpikeAbility::ApplyDataCorruption(ABaseEnemy* Enemy, bool bIsUltimate)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("DataSpikeAbility: Cannot set DOT timer - no valid world"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("DataSpikeAbility: Cannot set DOT timer - no valid world"));
 	}
 
 	// Spawn DOT visual effect on enemy
-	if (DOTEffect)
+	if (UParticleSystem* Effect = ResolveAbilityAsset(DOTEffect))
 	{
 		// TODO: Attach effect to enemy for duration
 		UGameplayStatics::SpawnEmitterAttached(
-			DOTEffect,
+			Effect,
 			Enemy->GetRootComponent(),
 			NAME_None,
 			FVector::ZeroVector,
@@ -349,7 +359,7 @@ void UDataSpikeAbility::ApplyDataCorruption(ABaseEnemy* Enemy, bool bIsUltimate)
 		);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Applied data corruption to %s: %.1f damage every %.1fs for %.1fs"), 
+	UE_LOG(LogBlackholeAbilities, Log, TEXT("Applied data corruption to %s: %.1f damage every %.1fs for %.1fs"), 
 		*Enemy->GetName(), DOTDamageAmount, DOTTickRate, DOTDuration);
 }
 
@@ -373,7 +383,7 @@ void UDataSpikeAbility::OnDOTTick(ABaseEnemy* Enemy)
 	FPointDamageEvent DamageEvent(Corruption.DamagePerTick, FHitResult(), FVector::ForwardVector, nullptr);
 	Enemy->TakeDamage(Corruption.DamagePerTick, DamageEvent, nullptr, GetOwner());
 	
-	UE_LOG(LogTemp, Verbose, TEXT("Data corruption tick on %s: %.1f damage (%d ticks remaining)"), 
+	UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Data corruption tick on %s: %.1f damage (%d ticks remaining)"), 
 		*Enemy->GetName(), Corruption.DamagePerTick, Corruption.TicksRemaining - 1);
 
 	// Reduce remaining ticks
@@ -466,4 +476,13 @@ FVector UDataSpikeAbility::GetProjectileStart() const
 	FVector ActorLocation = Character->GetActorLocation();
 	FVector ForwardOffset = Character->GetActorForwardVector() * 100.0f; // 1 meter forward
 	return ActorLocation + ForwardOffset;
+}
+
+void UDataSpikeAbility::GatherAssetManifest(FAbilityAssetManifest& Manifest) const
+{
+	Manifest.Add(ProjectileEffect);
+	Manifest.Add(HitEffect);
+	Manifest.Add(DOTEffect);
+	Manifest.Add(FireSound);
+	Manifest.Add(HitSound);
 }
\ No newline at end of file
@@ -1,8 +1,10 @@
 #include "Components/Abilities/Player/Hacker/FirewallBreachAbility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Systems/ResourceManager.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Camera/CameraComponent.h"
@@ -33,6 +35,8 @@ bool UFirewallBreachAbility::CanExecute() const
 
 void UFirewallBreachAbility::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("FirewallBreachAbility Execute", STAT_Blackhole_FirewallBreachAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -84,6 +88,7 @@ void UFirewallBreachAbility::Execute()
 		
 		if (UWorld* World = GetWorld())
 		{
+			BLACKHOLE_COUNT_QUERY(HitQueries);
 			if (World->LineTraceSingleByChannel(HitResult, Start, End, ECC_Pawn, QueryParams))
 			{
 				if (AActor* HitActor = HitResult.GetActor())
@@ -109,13 +114,13 @@ void UFirewallBreachAbility::Execute()
 								EffectDuration, false);
 						}
 						
-						UE_LOG(LogTemp, Log, TEXT("FirewallBreach: Applied armor shred to %s"), *HitActor->GetName());
+						UE_LOG(LogBlackholeAbilities, Log, TEXT("FirewallBreach: Applied armor shred to %s"), *HitActor->GetName());
 					}
 				}
 			}
 			
 			#if WITH_EDITOR
-			DrawDebugLine(World, Start, End, FColor::Purple, false, 1.0f, 0, 2.0f);
+			BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(World, Start, End, FColor::Purple, false, 1.0f, 0, 2.0f));
 			#endif
 		}
 	}
@@ -123,9 +128,11 @@ void UFirewallBreachAbility::Execute()
 
 void UFirewallBreachAbility::ExecuteUltimate()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("FirewallBreachAbility Execute Ultimate", STAT_Blackhole_FirewallBreachAbility_ExecuteUltimate, BlackholeAbilitiesChannel);
+
 	// Ultimate Firewall Breach - "Total System Compromise"
 	// Instantly removes ALL armor from ALL enemies on screen and makes them vulnerable
-	UE_LOG(LogTemp, Warning, TEXT("ULTIMATE FIREWALL BREACH: Total System Compromise!"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("ULTIMATE FIREWALL BREACH: Total System Compromise!"));
 	
 	Super::ExecuteUltimate();
 	
@@ -144,6 +151,7 @@ void UFirewallBreachAbility::ExecuteUltimate()
 		
 		if (UWorld* World = GetWorld())
 		{
+			BLACKHOLE_COUNT_QUERY(HitQueries);
 			World->SweepMultiByChannel(
 				HitResults,
 				OwnerLocation,
@@ -156,7 +164,7 @@ void UFirewallBreachAbility::ExecuteUltimate()
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("FirewallBreachAbility: Cannot sweep - no valid world"));
+			UE_LOG(LogBlackholeAbilities, Error, TEXT("FirewallBreachAbility: Cannot sweep - no valid world"));
 			return;
 		}
 		
@@ -194,19 +202,19 @@ void UFirewallBreachAbility::ExecuteUltimate()
 					
 					EnemiesBreached++;
 					
-					UE_LOG(LogTemp, Warning, TEXT("Total System Compromise: Breached %s - 100%% vulnerable!"), 
+					UE_LOG(LogBlackholeAbilities, Warning, TEXT("Total System Compromise: Breached %s - 100%% vulnerable!"), 
 						*HitActor->GetName());
 				}
 			}
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("Ultimate Firewall Breach: Compromised %d enemy systems!"), EnemiesBreached);
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ultimate Firewall Breach: Compromised %d enemy systems!"), EnemiesBreached);
 		
 		#if WITH_EDITOR
 		// Draw debug sphere showing affected area
 		if (UWorld* World = GetWorld())
 		{
-			DrawDebugSphere(World, OwnerLocation, UltimateRadius, 32, FColor::Purple, false, 2.0f);
+			BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(World, OwnerLocation, UltimateRadius, 32, FColor::Purple, false, 2.0f));
 			
 			// Draw lines to all breached enemies
 			for (const FHitResult& Result : HitResults)
@@ -215,8 +223,8 @@ void UFirewallBreachAbility::ExecuteUltimate()
 				{
 					if (HitActor->ActorHasTag("TotalArmorBreach"))
 					{
-						DrawDebugLine(World, OwnerLocation, HitActor->GetActorLocation(), 
-							FColor::Purple, false, 2.0f, 0, 3.0f);
+						BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(World, OwnerLocation, HitActor->GetActorLocation(), 
+							FColor::Purple, false, 2.0f, 0, 3.0f));
 					}
 				}
 			}
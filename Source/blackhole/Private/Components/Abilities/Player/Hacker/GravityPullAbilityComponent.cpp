@@ -1,11 +1,13 @@
 #include "Components/Abilities/Player/Hacker/GravityPullAbilityComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Components/Interaction/HackableComponent.h"
 #include "Systems/ResourceManager.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
 #include "Camera/CameraComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Engine/EngineTypes.h"
@@ -35,6 +37,8 @@ void UGravityPullAbilityComponent::BeginPlay()
 
 void UGravityPullAbilityComponent::Execute()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("GravityPullAbility Execute", STAT_Blackhole_GravityPullAbility_Execute, BlackholeAbilitiesChannel);
+
     if (!CanExecute()) return;
 
     // ALWAYS call base class first - it will handle ultimate detection and execution
@@ -43,7 +47,7 @@ void UGravityPullAbilityComponent::Execute()
     // If we executed as ultimate, we're done
     if (IsInUltimateMode())
     {
-        UE_LOG(LogTemp, Warning, TEXT("GravityPull: Ultimate version was executed"));
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("GravityPull: Ultimate version was executed"));
         return;
     }
 
@@ -64,6 +68,7 @@ void UGravityPullAbilityComponent::Execute()
 
     FVector TraceEnd = CameraLocation + (CameraDirection * Range);
     
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     bool bHit = GetWorld()->LineTraceSingleByChannel(
         HitResult,
         CameraLocation,
@@ -74,12 +79,12 @@ void UGravityPullAbilityComponent::Execute()
 
     // Debug visualization
     #if WITH_EDITOR
-    DrawDebugLine(GetWorld(), CameraLocation, TraceEnd, FColor::Cyan, false, 1.0f, 0, 2.0f);
+    BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), CameraLocation, TraceEnd, FColor::Cyan, false, 1.0f, 0, 2.0f));
     #endif
 
     if (!bHit || !HitResult.GetActor())
     {
-        UE_LOG(LogTemp, Warning, TEXT("GravityPull: No target hit by trace"));
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("GravityPull: No target hit by trace"));
         return;
     }
 
@@ -89,14 +94,14 @@ void UGravityPullAbilityComponent::Execute()
     ACharacter* TargetCharacter = Cast<ACharacter>(Target);
     if (!TargetCharacter || !Target->ActorHasTag("Enemy"))
     {
-        UE_LOG(LogTemp, Warning, TEXT("GravityPull: Target is not an enemy"));
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("GravityPull: Target is not an enemy"));
         return;
     }
 
     // Check if it's a Tank enemy - they are immune
     if (Target->IsA<ATankEnemy>())
     {
-        UE_LOG(LogTemp, Warning, TEXT("GravityPull: Tank enemies are immune to Gravity Pull"));
+        UE_LOG(LogBlackholeAbilities, Warning, TEXT("GravityPull: Tank enemies are immune to Gravity Pull"));
         return;
     }
 
@@ -130,11 +135,11 @@ void UGravityPullAbilityComponent::Execute()
 
     // Visual feedback
     #if WITH_EDITOR
-    DrawDebugSphere(GetWorld(), TargetPosition, 50.0f, 12, FColor::Green, false, 2.0f);
-    DrawDebugLine(GetWorld(), Target->GetActorLocation(), TargetPosition, FColor::Green, false, 2.0f, 0, 3.0f);
+    BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), TargetPosition, 50.0f, 12, FColor::Green, false, 2.0f));
+    BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), Target->GetActorLocation(), TargetPosition, FColor::Green, false, 2.0f, 0, 3.0f));
     #endif
 
-    UE_LOG(LogTemp, Warning, TEXT("GravityPull: Pulled %s from %.1f to target distance %.1f"), 
+    UE_LOG(LogBlackholeAbilities, Warning, TEXT("GravityPull: Pulled %s from %.1f to target distance %.1f"), 
         *Target->GetName(), CurrentDistance, TargetDistance);
 }
 
@@ -183,9 +188,11 @@ bool UGravityPullAbilityComponent::IsWithinTargetingAngle(const FVector& CameraD
 
 void UGravityPullAbilityComponent::ExecuteUltimate()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("GravityPullAbility Execute Ultimate", STAT_Blackhole_GravityPullAbility_ExecuteUltimate, BlackholeAbilitiesChannel);
+
     // Ultimate Gravity Pull - "Singularity"
     // Creates a black hole that pulls ALL enemies to a central point
-    UE_LOG(LogTemp, Warning, TEXT("ULTIMATE GRAVITY PULL: Singularity!"));
+    UE_LOG(LogBlackholeAbilities, Warning, TEXT("ULTIMATE GRAVITY PULL: Singularity!"));
     
     Super::ExecuteUltimate();
     
@@ -214,6 +221,7 @@ void UGravityPullAbilityComponent::ExecuteUltimate()
     ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_WorldStatic));
     ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_PhysicsBody));
     
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     UKismetSystemLibrary::SphereOverlapActors(
         GetWorld(),
         SingularityPoint,
@@ -224,7 +232,7 @@ void UGravityPullAbilityComponent::ExecuteUltimate()
         OutActors
     );
     
-    UE_LOG(LogTemp, Warning, TEXT("Singularity: Found %d actors in radius %.1f"), OutActors.Num(), UltimateRadius);
+    UE_LOG(LogBlackholeAbilities, Warning, TEXT("Singularity: Found %d actors in radius %.1f"), OutActors.Num(), UltimateRadius);
     
     int32 EntitiesPulled = 0;
     
@@ -233,13 +241,13 @@ void UGravityPullAbilityComponent::ExecuteUltimate()
     {
         if (!Actor) continue;
         
-        UE_LOG(LogTemp, Verbose, TEXT("Singularity checking actor: %s (Class: %s)"), 
+        UE_LOG(LogBlackholeAbilities, Verbose, TEXT("Singularity checking actor: %s (Class: %s)"), 
             *Actor->GetName(), *Actor->GetClass()->GetName());
         
         // Check if it's a PsiDisruptor
         if (APsiDisruptor* Disruptor = Cast<APsiDisruptor>(Actor))
         {
-            UE_LOG(LogTemp, Error, TEXT("SINGULARITY: Found Psi-Disruptor! Destroying it!"));
+            UE_LOG(LogBlackholeAbilities, Error, TEXT("SINGULARITY: Found Psi-Disruptor! Destroying it!"));
             Disruptor->DestroyByUltimate();
             EntitiesPulled++;
             continue;
@@ -247,7 +255,7 @@ void UGravityPullAbilityComponent::ExecuteUltimate()
         else if (Actor->GetClass()->GetName().Contains(TEXT("PsiDisruptor")))
         {
             // Fallback check in case cast fails
-            UE_LOG(LogTemp, Error, TEXT("SINGULARITY: Found PsiDisruptor by name but cast failed! Class: %s"), 
+            UE_LOG(LogBlackholeAbilities, Error, TEXT("SINGULARITY: Found PsiDisruptor by name but cast failed! Class: %s"), 
                 *Actor->GetClass()->GetName());
         }
     }
@@ -269,7 +277,7 @@ void UGravityPullAbilityComponent::ExecuteUltimate()
         // Skip Tank enemies - they are immune
         if (Actor->IsA<ATankEnemy>())
         {
-            UE_LOG(LogTemp, Warning, TEXT("Singularity: Tank enemy %s is immune to pull"), *Actor->GetName());
+            UE_LOG(LogBlackholeAbilities, Warning, TEXT("Singularity: Tank enemy %s is immune to pull"), *Actor->GetName());
             continue;
         }
         
@@ -285,7 +293,7 @@ void UGravityPullAbilityComponent::ExecuteUltimate()
             Character->LaunchCharacter(LaunchVelocity, true, true);
             EntitiesPulled++;
             
-            UE_LOG(LogTemp, Warning, TEXT("Singularity pulled character %s!"), *Actor->GetName());
+            UE_LOG(LogBlackholeAbilities, Warning, TEXT("Singularity pulled character %s!"), *Actor->GetName());
         }
         else if (UPrimitiveComponent* PrimComp = Actor->FindComponentByClass<UPrimitiveComponent>())
         {
@@ -295,25 +303,25 @@ void UGravityPullAbilityComponent::ExecuteUltimate()
                 PrimComp->AddImpulse(PullDirection * UltimatePullForce * PrimComp->GetMass());
                 EntitiesPulled++;
                 
-                UE_LOG(LogTemp, Warning, TEXT("Singularity pulled object %s!"), *Actor->GetName());
+                UE_LOG(LogBlackholeAbilities, Warning, TEXT("Singularity pulled object %s!"), *Actor->GetName());
             }
         }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("Ultimate Gravity Pull: Created singularity, pulled %d entities!"), EntitiesPulled);
+    UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ultimate Gravity Pull: Created singularity, pulled %d entities!"), EntitiesPulled);
     
     // Visual effect at singularity point
     #if WITH_EDITOR
     // Draw debug sphere at singularity
-    DrawDebugSphere(GetWorld(), SingularityPoint, 200.0f, 32, FColor::Purple, false, 3.0f, 0, 5.0f);
+    BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), SingularityPoint, 200.0f, 32, FColor::Purple, false, 3.0f, 0, 5.0f));
     
     // Draw pull lines
     for (AActor* Actor : OutActors)
     {
         if (Actor && (Actor->ActorHasTag("Enemy") || Actor->ActorHasTag("Hackable")))
         {
-            DrawDebugLine(GetWorld(), Actor->GetActorLocation(), SingularityPoint, 
-                FColor::Purple, false, 2.0f, 0, 2.0f);
+            BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), Actor->GetActorLocation(), SingularityPoint, 
+                FColor::Purple, false, 2.0f, 0, 2.0f));
         }
     }
     #endif
@@ -1,10 +1,12 @@
 #include "Components/Abilities/Player/Hacker/GravityShiftAbilityComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Components/GravityDirectionComponent.h"
 #include "GameFramework/Character.h"
 #include "Camera/CameraComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Enemy/BaseEnemy.h"
 
 UGravityShiftAbilityComponent::UGravityShiftAbilityComponent()
@@ -36,6 +38,8 @@ void UGravityShiftAbilityComponent::BeginPlay()
 
 void UGravityShiftAbilityComponent::Execute()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("GravityShiftAbility Execute", STAT_Blackhole_GravityShiftAbility_Execute, BlackholeAbilitiesChannel);
+
     if (!CanExecute()) return;
     
     // Skip base class Execute to avoid any ultimate system
@@ -60,7 +64,7 @@ void UGravityShiftAbilityComponent::Execute()
     // Apply gravity shift
     ApplyAreaGravityShift(NewGravityDirection, ShiftRadius, TransitionDuration);
     
-    UE_LOG(LogTemp, Log, TEXT("Gravity Shift: Initiating smooth transition to gravity direction %s over %.1f seconds"), 
+    UE_LOG(LogBlackholeAbilities, Log, TEXT("Gravity Shift: Initiating smooth transition to gravity direction %s over %.1f seconds"), 
         *NewGravityDirection.ToString(), TransitionDuration);
     
     // Visual feedback for gravity shift
@@ -74,12 +78,12 @@ void UGravityShiftAbilityComponent::Execute()
         {
             float Delay = i * 0.5f;
             float Radius = 100.0f + (i * 200.0f);
-            DrawDebugSphere(GetWorld(), CharLocation, Radius, 24, FColor::Cyan, false, TransitionDuration - Delay, 0, 2.0f);
+            BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), CharLocation, Radius, 24, FColor::Cyan, false, TransitionDuration - Delay, 0, 2.0f));
         }
         
         // Draw gravity direction indicator
-        DrawDebugLine(GetWorld(), CharLocation, CharLocation + (NewGravityDirection * 1000.0f), 
-            FColor::Magenta, false, TransitionDuration, 0, 10.0f);
+        BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), CharLocation, CharLocation + (NewGravityDirection * 1000.0f), 
+            FColor::Magenta, false, TransitionDuration, 0, 10.0f));
         #endif
     }
 }
@@ -134,6 +138,7 @@ FVector UGravityShiftAbilityComponent::GetGravityFromLookDirection() const
     FCollisionQueryParams QueryParams;
     QueryParams.AddIgnoredActor(GetOwner());
     
+    BLACKHOLE_COUNT_QUERY(HitQueries);
     if (GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
     {
         // Use the surface normal as the new "up" direction
@@ -142,10 +147,10 @@ FVector UGravityShiftAbilityComponent::GetGravityFromLookDirection() const
         
         #if WITH_EDITOR
         // Debug visualization
-        DrawDebugLine(GetWorld(), TraceStart, HitResult.ImpactPoint, FColor::Green, false, 2.0f);
-        DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, 50.0f, 12, FColor::Green, false, 2.0f);
-        DrawDebugLine(GetWorld(), HitResult.ImpactPoint, HitResult.ImpactPoint + (NewGravity * 200.0f), 
-            FColor::Blue, false, 2.0f, 0, 5.0f);
+        BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), TraceStart, HitResult.ImpactPoint, FColor::Green, false, 2.0f));
+        BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, 50.0f, 12, FColor::Green, false, 2.0f));
+        BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), HitResult.ImpactPoint, HitResult.ImpactPoint + (NewGravity * 200.0f), 
+            FColor::Blue, false, 2.0f, 0, 5.0f));
         #endif
         
         return NewGravity;
@@ -199,12 +204,12 @@ void UGravityShiftAbilityComponent::ApplyAreaGravityShift(FVector NewGravityDire
             if (Actor->ActorHasTag(FName("Enemy")))
             {
                 AffectedEnemies++;
-                UE_LOG(LogTemp, Log, TEXT("Applied gravity shift to enemy: %s at distance %.1f"), *Actor->GetName(), Distance);
+                UE_LOG(LogBlackholeAbilities, Log, TEXT("Applied gravity shift to enemy: %s at distance %.1f"), *Actor->GetName(), Distance);
             }
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Gravity shift affected %d total characters (%d enemies) within radius %.1f"), 
+    UE_LOG(LogBlackholeAbilities, Log, TEXT("Gravity shift affected %d total characters (%d enemies) within radius %.1f"), 
         AffectedTotal, AffectedEnemies, Radius);
     
     #if WITH_EDITOR
@@ -212,7 +217,7 @@ void UGravityShiftAbilityComponent::ApplyAreaGravityShift(FVector NewGravityDire
     for (int32 i = 0; i < 3; i++)
     {
         float Delay = i * (Duration / 3.0f);
-        DrawDebugSphere(GetWorld(), Center, Radius - (i * 100.0f), 32, FColor::Blue, false, Duration - Delay, 0, 3.0f);
+        BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), Center, Radius - (i * 100.0f), 32, FColor::Blue, false, Duration - Delay, 0, 3.0f));
     }
     #endif
 }
\ No newline at end of file
@@ -1,13 +1,18 @@
 #include "Components/Abilities/Player/Hacker/PulseHackAbility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Engine/EngineTypes.h"
 #include "TimerManager.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "Enemy/BaseEnemy.h"
 #include "Systems/ResourceManager.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
 
 UPulseHackAbility::UPulseHackAbility()
 {
@@ -33,6 +38,8 @@ bool UPulseHackAbility::CanExecute() const
 
 void UPulseHackAbility::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("PulseHackAbility Execute", STAT_Blackhole_PulseHackAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -50,7 +57,7 @@ void UPulseHackAbility::Execute()
 	AActor* Owner = GetOwner();
 	if (!Owner)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PulseHackAbility: Execute failed - no owner"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("PulseHackAbility: Execute failed - no owner"));
 		return;
 	}
 	
@@ -69,6 +76,7 @@ void UPulseHackAbility::Execute()
 
 	if (UWorld* World = GetWorld())
 	{
+		BLACKHOLE_COUNT_QUERY(HitQueries);
 		World->SweepMultiByChannel(
 			HitResults,
 			CharacterLocation,
@@ -81,7 +89,7 @@ void UPulseHackAbility::Execute()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PulseHackAbility: Cannot sweep - no valid world"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("PulseHackAbility: Cannot sweep - no valid world"));
 		return;
 	}
 
@@ -118,20 +126,20 @@ void UPulseHackAbility::Execute()
 					// Reduce WP corruption (negative value to AddWillPower reduces WP)
 					ResourceMgr->AddWillPower(-CleansingAmount);
 					
-					UE_LOG(LogTemp, Log, TEXT("Pulse Hack: Hit %d enemies, cleansed %.1f WP corruption"), EnemiesHit, CleansingAmount);
+					UE_LOG(LogBlackholeAbilities, Log, TEXT("Pulse Hack: Hit %d enemies, cleansed %.1f WP corruption"), EnemiesHit, CleansingAmount);
 				}
 			}
 		}
 	}
 
 	// Spawn visual effect
-	if (PulseEffect)
+	if (UParticleSystem* Effect = ResolveAbilityAsset(PulseEffect))
 	{
 		if (UWorld* World = GetWorld())
 		{
 			UGameplayStatics::SpawnEmitterAtLocation(
 				World,
-				PulseEffect,
+				Effect,
 				CharacterLocation,
 				FRotator::ZeroRotator,
 				FVector(1.0f)
@@ -140,11 +148,11 @@ void UPulseHackAbility::Execute()
 	}
 
 	// Play sound
-	if (PulseSound)
+	if (USoundBase* Sound = ResolveAbilityAsset(PulseSound))
 	{
 		if (UWorld* World = GetWorld())
 		{
-			UGameplayStatics::PlaySoundAtLocation(World, PulseSound, CharacterLocation);
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, CharacterLocation);
 		}
 	}
 
@@ -152,7 +160,7 @@ void UPulseHackAbility::Execute()
 #if WITH_EDITOR
 	if (UWorld* World = GetWorld())
 	{
-		DrawDebugSphere(World, CharacterLocation, HackRadius, 32, FColor::Cyan, false, 1.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(World, CharacterLocation, HackRadius, 32, FColor::Cyan, false, 1.0f));
 	}
 #endif
 }
@@ -192,7 +200,7 @@ void UPulseHackAbility::ApplySlowToEnemy(ABaseEnemy* Enemy)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PulseHackAbility: Cannot set timer - no valid world"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("PulseHackAbility: Cannot set timer - no valid world"));
 	}
 
 	// Visual feedback on enemy
@@ -215,16 +223,18 @@ void UPulseHackAbility::RestoreEnemySpeed(ABaseEnemy* Enemy, float OriginalSpeed
 
 void UPulseHackAbility::ExecuteUltimate()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("PulseHackAbility Execute Ultimate", STAT_Blackhole_PulseHackAbility_ExecuteUltimate, BlackholeAbilitiesChannel);
+
 	// Ultimate Pulse Hack - "System Overload"
 	// Massive pulse that stuns all enemies on screen and cleanses 50 WP
-	UE_LOG(LogTemp, Warning, TEXT("ULTIMATE PULSE HACK: System Overload!"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("ULTIMATE PULSE HACK: System Overload!"));
 	
 	Super::ExecuteUltimate();
 	
 	AActor* Owner = GetOwner();
 	if (!Owner)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PulseHackAbility: ExecuteUltimate failed - no owner"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("PulseHackAbility: ExecuteUltimate failed - no owner"));
 		return;
 	}
 	
@@ -248,6 +258,7 @@ void UPulseHackAbility::ExecuteUltimate()
 	
 	if (UWorld* World = GetWorld())
 	{
+		BLACKHOLE_COUNT_QUERY(HitQueries);
 		World->SweepMultiByChannel(
 			HitResults,
 			CharacterLocation,
@@ -260,7 +271,7 @@ void UPulseHackAbility::ExecuteUltimate()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PulseHackAbility: Cannot sweep - no valid world"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("PulseHackAbility: Cannot sweep - no valid world"));
 		return;
 	}
 	
@@ -299,12 +310,12 @@ void UPulseHackAbility::ExecuteUltimate()
 				}
 				else
 				{
-					UE_LOG(LogTemp, Error, TEXT("PulseHackAbility: Cannot set timer - no valid world"));
+					UE_LOG(LogBlackholeAbilities, Error, TEXT("PulseHackAbility: Cannot set timer - no valid world"));
 				}
 				
 				EnemiesAffected++;
 				
-				UE_LOG(LogTemp, Warning, TEXT("Ultimate Pulse stunned %s for %.1f seconds!"), 
+				UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ultimate Pulse stunned %s for %.1f seconds!"), 
 					*Enemy->GetName(), StunDuration);
 			}
 		}
@@ -318,20 +329,20 @@ void UPulseHackAbility::ExecuteUltimate()
 			if (UResourceManager* ResourceMgr = GameInstance->GetSubsystem<UResourceManager>())
 			{
 				ResourceMgr->AddWillPower(-UltimateWPCleanse);
-				UE_LOG(LogTemp, Warning, TEXT("Ultimate Pulse Hack: Cleansed %.0f WP, stunned %d enemies!"), 
+				UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ultimate Pulse Hack: Cleansed %.0f WP, stunned %d enemies!"), 
 					UltimateWPCleanse, EnemiesAffected);
 			}
 		}
 	}
 	
 	// Spawn massive visual effect
-	if (PulseEffect)
+	if (UParticleSystem* Effect = ResolveAbilityAsset(PulseEffect))
 	{
 		if (UWorld* World = GetWorld())
 		{
 			UGameplayStatics::SpawnEmitterAtLocation(
 				World,
-				PulseEffect,
+				Effect,
 				CharacterLocation,
 				FRotator::ZeroRotator,
 				FVector(4.0f) // Larger effect
@@ -340,11 +351,11 @@ void UPulseHackAbility::ExecuteUltimate()
 	}
 	
 	// Play enhanced sound
-	if (PulseSound)
+	if (USoundBase* Sound = ResolveAbilityAsset(PulseSound))
 	{
 		if (UWorld* World = GetWorld())
 		{
-			UGameplayStatics::PlaySoundAtLocation(World, PulseSound, CharacterLocation, 2.0f); // Louder
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, CharacterLocation, 2.0f); // Louder
 		}
 	}
 	
@@ -352,7 +363,13 @@ void UPulseHackAbility::ExecuteUltimate()
 #if WITH_EDITOR
 	if (UWorld* World = GetWorld())
 	{
-		DrawDebugSphere(World, CharacterLocation, UltimateRadius, 64, FColor::Purple, false, 2.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(World, CharacterLocation, UltimateRadius, 64, FColor::Purple, false, 2.0f));
 	}
 #endif
+}
+
+void UPulseHackAbility::GatherAssetManifest(FAbilityAssetManifest& Manifest) const
+{
+	Manifest.Add(PulseEffect);
+	Manifest.Add(PulseSound);
 }
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "Components/Abilities/Player/Hacker/SystemOverrideAbility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
@@ -6,12 +8,15 @@
 #include "CollisionQueryParams.h"
 #include "Engine/OverlapResult.h"
 #include "TimerManager.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "Enemy/BaseEnemy.h"
 #include "Systems/ResourceManager.h"
 #include "Engine/DamageEvents.h"
 #include "Systems/HitStopManager.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
 
 USystemOverrideAbility::USystemOverrideAbility()
 {
@@ -37,6 +42,8 @@ bool USystemOverrideAbility::CanExecute() const
 
 void USystemOverrideAbility::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("SystemOverrideAbility Execute", STAT_Blackhole_SystemOverrideAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -57,9 +64,11 @@ void USystemOverrideAbility::Execute()
 
 void USystemOverrideAbility::ExecuteUltimate()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("SystemOverrideAbility Execute Ultimate", STAT_Blackhole_SystemOverrideAbility_ExecuteUltimate, BlackholeAbilitiesChannel);
+
 	// System Override is itself an ultimate-level ability
 	// When used in ultimate mode, it has enhanced effects
-	UE_LOG(LogTemp, Warning, TEXT("ULTIMATE SYSTEM OVERRIDE: Total System Shutdown!"));
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("ULTIMATE SYSTEM OVERRIDE: Total System Shutdown!"));
 	
 	Super::ExecuteUltimate();
 	
@@ -75,7 +84,7 @@ void USystemOverrideAbility::ExecuteUltimate()
 			{
 				float UltimateWPCleanse = WPCleanse * UltimateWPCleanseMultiplier;
 				ResourceMgr->AddWillPower(-UltimateWPCleanse);
-				UE_LOG(LogTemp, Warning, TEXT("Ultimate System Override: Enhanced WP cleanse %.0f!"), 
+				UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ultimate System Override: Enhanced WP cleanse %.0f!"), 
 					UltimateWPCleanse);
 			}
 		}
@@ -108,7 +117,7 @@ void USystemOverrideAbility::PerformSystemOverride()
 	AActor* Owner = GetOwner();
 	if (!Owner)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SystemOverrideAbility: PerformSystemOverride failed - no owner"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("SystemOverrideAbility: PerformSystemOverride failed - no owner"));
 		return;
 	}
 	
@@ -125,7 +134,7 @@ void USystemOverrideAbility::PerformSystemOverride()
 	
 	if (EnemiesInRange.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("System Override: No enemies in range"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("System Override: No enemies in range"));
 		return;
 	}
 
@@ -142,7 +151,7 @@ void USystemOverrideAbility::PerformSystemOverride()
 			FPointDamageEvent DamageEvent(FinalDamage, FHitResult(), ImpactDirection, nullptr);
 			Enemy->TakeDamage(FinalDamage, DamageEvent, nullptr, GetOwner());
 			
-			UE_LOG(LogTemp, Log, TEXT("System Override damaged %s for %.1f"), 
+			UE_LOG(LogBlackholeAbilities, Log, TEXT("System Override damaged %s for %.1f"), 
 				*Enemy->GetName(), FinalDamage);
 
 			// Disable enemy systems
@@ -161,7 +170,7 @@ void USystemOverrideAbility::PerformSystemOverride()
 				if (UResourceManager* ResourceMgr = GameInstance->GetSubsystem<UResourceManager>())
 				{
 					ResourceMgr->AddWillPower(-WPCleanse);
-					UE_LOG(LogTemp, Warning, TEXT("System Override: Cleansed %.0f WP, affected %d enemies"), 
+					UE_LOG(LogBlackholeAbilities, Warning, TEXT("System Override: Cleansed %.0f WP, affected %d enemies"), 
 						WPCleanse, EnemiesAffected);
 				}
 			}
@@ -178,22 +187,22 @@ void USystemOverrideAbility::PerformSystemOverride()
 	}
 
 	// Play activation sound
-	if (ActivationSound)
+	if (USoundBase* Sound = ResolveAbilityAsset(ActivationSound))
 	{
 		if (UWorld* World = GetWorld())
 		{
-			UGameplayStatics::PlaySoundAtLocation(World, ActivationSound, CharacterLocation);
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, CharacterLocation);
 		}
 	}
 
 	// Spawn main override effect
-	if (OverrideEffect)
+	if (UParticleSystem* Effect = ResolveAbilityAsset(OverrideEffect))
 	{
 		if (UWorld* World = GetWorld())
 		{
 			UGameplayStatics::SpawnEmitterAtLocation(
 				World,
-				OverrideEffect,
+				Effect,
 				CharacterLocation,
 				FRotator::ZeroRotator,
 				FVector(2.0f) // Larger effect
@@ -205,15 +214,15 @@ void USystemOverrideAbility::PerformSystemOverride()
 #if WITH_EDITOR
 	if (UWorld* World = GetWorld())
 	{
-		DrawDebugSphere(World, CharacterLocation, EffectRadius, 32, FColor::Orange, false, 3.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(World, CharacterLocation, EffectRadius, 32, FColor::Orange, false, 3.0f));
 		
 		// Draw lines to affected enemies
 		for (ABaseEnemy* Enemy : EnemiesInRange)
 		{
 			if (IsValid(Enemy))
 			{
-				DrawDebugLine(World, CharacterLocation, Enemy->GetActorLocation(), 
-					FColor::Red, false, 2.0f, 0, 3.0f);
+				BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(World, CharacterLocation, Enemy->GetActorLocation(), 
+					FColor::Red, false, 2.0f, 0, 3.0f));
 			}
 		}
 	}
@@ -272,23 +281,23 @@ void USystemOverrideAbility::DisableEnemy(ABaseEnemy* Enemy)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("SystemOverrideAbility: Cannot set timer - no valid world"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("SystemOverrideAbility: Cannot set timer - no valid world"));
 	}
 
 	// Play disable sound
-	if (DisableSound)
+	if (USoundBase* Sound = ResolveAbilityAsset(DisableSound))
 	{
 		if (UWorld* World = GetWorld())
 		{
-			UGameplayStatics::PlaySoundAtLocation(World, DisableSound, Enemy->GetActorLocation());
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, Enemy->GetActorLocation());
 		}
 	}
 
 	// Spawn disable effect on enemy
-	if (DisableEffect)
+	if (UParticleSystem* Effect = ResolveAbilityAsset(DisableEffect))
 	{
 		UGameplayStatics::SpawnEmitterAttached(
-			DisableEffect,
+			Effect,
 			Enemy->GetRootComponent(),
 			NAME_None,
 			FVector::ZeroVector,
@@ -298,7 +307,7 @@ void USystemOverrideAbility::DisableEnemy(ABaseEnemy* Enemy)
 		);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("System Override disabled %s for %.1f seconds"), 
+	UE_LOG(LogBlackholeAbilities, Log, TEXT("System Override disabled %s for %.1f seconds"), 
 		*Enemy->GetName(), DisableDuration);
 }
 
@@ -330,7 +339,7 @@ void USystemOverrideAbility::RestoreEnemy(ABaseEnemy* Enemy)
 	if (Movement)
 	{
 		Movement->MaxWalkSpeed = DisableInfo.OriginalMaxWalkSpeed;
-		UE_LOG(LogTemp, Log, TEXT("System Override restored %s (speed: %.1f)"), 
+		UE_LOG(LogBlackholeAbilities, Log, TEXT("System Override restored %s (speed: %.1f)"), 
 			*Enemy->GetName(), DisableInfo.OriginalMaxWalkSpeed);
 	}
 
@@ -364,6 +373,7 @@ TArray<ABaseEnemy*> USystemOverrideAbility::GetEnemiesInRadius() const
 	bool bFoundOverlaps = false;
 	if (UWorld* World = GetWorld())
 	{
+		BLACKHOLE_COUNT_QUERY(HitQueries);
 		bFoundOverlaps = World->OverlapMultiByChannel(
 			OverlapResults,
 			CharacterLocation,
@@ -390,4 +400,12 @@ TArray<ABaseEnemy*> USystemOverrideAbility::GetEnemiesInRadius() const
 	}
 
 	return EnemiesInRange;
+}
+
+void USystemOverrideAbility::GatherAssetManifest(FAbilityAssetManifest& Manifest) const
+{
+	Manifest.Add(OverrideEffect);
+	Manifest.Add(DisableEffect);
+	Manifest.Add(ActivationSound);
+	Manifest.Add(DisableSound);
 }
\ No newline at end of file
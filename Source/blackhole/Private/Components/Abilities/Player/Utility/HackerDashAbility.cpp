@@ -1,9 +1,11 @@
 #include "Components/Abilities/Player/Utility/HackerDashAbility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Systems/ComboSystem.h"
 #include "Camera/CameraComponent.h"
@@ -28,6 +30,8 @@ UHackerDashAbility::UHackerDashAbility()
 
 void UHackerDashAbility::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HackerDashAbility Execute", STAT_Blackhole_HackerDashAbility_Execute, BlackholeAbilitiesChannel);
+
 	// Call parent implementation
 	Super::Execute();
 	
@@ -51,7 +55,7 @@ void UHackerDashAbility::ApplyMovement(ACharacter* Character)
 	// Safety check - ensure character is valid and not dead
 	if (!IsValid(Character))
 	{
-		UE_LOG(LogTemp, Error, TEXT("HackerDashAbility: Character is invalid during ApplyMovement"));
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("HackerDashAbility: Character is invalid during ApplyMovement"));
 		return;
 	}
 	
@@ -197,16 +201,16 @@ void UHackerDashAbility::ApplyMovement(ACharacter* Character)
 		DashColor = FColor::Cyan;
 	}
 	
-	DrawDebugLine(GetWorld(), Start, End, DashColor, false, 2.0f, 0, 5.0f);
+	BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), Start, End, DashColor, false, 2.0f, 0, 5.0f));
 	
 	// Show dash direction arrow
-	DrawDebugDirectionalArrow(GetWorld(), Start, End, 120.0f, DashColor, false, 2.0f, 0, 3.0f);
+	BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugDirectionalArrow(GetWorld(), Start, End, 120.0f, DashColor, false, 2.0f, 0, 3.0f));
 	
 	// Show input vector for debugging
 	if (bHasInput)
 	{
 		FVector InputVec = Character->GetLastMovementInputVector() * 200.0f;
-		DrawDebugLine(GetWorld(), Start, Start + InputVec, FColor::Yellow, false, 2.0f, 0, 2.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), Start, Start + InputVec, FColor::Yellow, false, 2.0f, 0, 2.0f));
 	}
 	#endif
 }
@@ -223,6 +227,6 @@ void UHackerDashAbility::StopMovement()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerDashAbility: CachedMovement is invalid during StopMovement"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerDashAbility: CachedMovement is invalid during StopMovement"));
 	}
 }
\ No newline at end of file
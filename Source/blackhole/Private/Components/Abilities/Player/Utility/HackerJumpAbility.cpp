@@ -1,8 +1,10 @@
 #include "Components/Abilities/Player/Utility/HackerJumpAbility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Systems/ComboSystem.h"
 #include "Components/Movement/WallRunComponent.h"
@@ -19,9 +21,6 @@ UHackerJumpAbility::UHackerJumpAbility()
 	// Mark as basic ability - not affected by ultimate system
 	bIsBasicAbility = true;
 	
-	// Disable tick optimization since we need constant ticking for jump timer
-	bTickOnlyWhenActive = false;
-	
 	// Jump costs stamina but no cooldown for the ability itself
 	WPCost = 0.0f; // Utility abilities don't add WP corruption
 	Cooldown = 0.0f; // No cooldown for jumps
@@ -54,14 +53,14 @@ bool UHackerJumpAbility::CanExecute() const
 	// CRITICAL: Check if ability is disabled (e.g., by PsiDisruptor)
 	if (bIsDisabled)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: Cannot execute - ability is DISABLED"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: Cannot execute - ability is DISABLED"));
 		return false;
 	}
 	
 	// Don't check additional resource requirements for jumps
 	if (!GetCharacterOwner() || !CachedMovement)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: No owner or movement component"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: No owner or movement component"));
 		return false;
 	}
 	
@@ -72,13 +71,15 @@ bool UHackerJumpAbility::CanExecute() const
 	bool bCanJump = CanJump();
 	if (!bCanJump)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: CanJump returned false (CurrentJump: %d, Max: %d, TimeSinceLastJump: %.2f)"), CurrentJumpCount, MaxJumpCount, TimeSinceLastJump);
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: CanJump returned false (CurrentJump: %d, Max: %d, TimeSinceLastJump: %.2f)"), CurrentJumpCount, MaxJumpCount, TimeSinceLastJump);
 	}
 	return bCanJump;
 }
 
 void UHackerJumpAbility::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HackerJumpAbility Execute", STAT_Blackhole_HackerJumpAbility_Execute, BlackholeAbilitiesChannel);
+
 	// Skip parent's Execute to avoid cooldown application
 	// We manage our own jump cooldown internally
 	
@@ -98,7 +99,7 @@ void UHackerJumpAbility::ApplyMovement(ACharacter* Character)
 {
 	if (!Character || !CachedMovement || !CanJump())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: ApplyMovement failed - Character=%s, Movement=%s, CanJump=%s"),
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: ApplyMovement failed - Character=%s, Movement=%s, CanJump=%s"),
 			Character ? TEXT("Valid") : TEXT("NULL"),
 			CachedMovement ? TEXT("Valid") : TEXT("NULL"),
 			CanJump() ? TEXT("TRUE") : TEXT("FALSE"));
@@ -108,7 +109,7 @@ void UHackerJumpAbility::ApplyMovement(ACharacter* Character)
 	// For first jump, use the character's built-in jump
 	if (CurrentJumpCount == 0 && CachedMovement->IsMovingOnGround())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: First jump - CurrentJumpCount=%d"), CurrentJumpCount);
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: First jump - CurrentJumpCount=%d"), CurrentJumpCount);
 		Character->Jump();
 		CurrentJumpCount = 1;
 		TimeSinceLastJump = 0.0f; // Reset jump timer
@@ -118,7 +119,7 @@ void UHackerJumpAbility::ApplyMovement(ACharacter* Character)
 	}
 	else if (CurrentJumpCount < MaxJumpCount && TimeSinceLastJump >= JumpCooldown)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: Double jump - CurrentJumpCount=%d, TimeSince=%.2f"), CurrentJumpCount, TimeSinceLastJump);
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: Double jump - CurrentJumpCount=%d, TimeSince=%.2f"), CurrentJumpCount, TimeSinceLastJump);
 		// For double jump, manually apply velocity
 		CurrentJumpCount++;
 		TimeSinceLastJump = 0.0f; // Reset jump timer
@@ -142,17 +143,17 @@ void UHackerJumpAbility::ApplyMovement(ACharacter* Character)
 		#if WITH_EDITOR
 		// Debug visualization
 		FVector CharLocation = Character->GetActorLocation();
-		DrawDebugLine(GetWorld(), CharLocation, CharLocation + (UpDirection * JumpVelocity), FColor::Cyan, false, 1.0f, 0, 3.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), CharLocation, CharLocation + (UpDirection * JumpVelocity), FColor::Cyan, false, 1.0f, 0, 3.0f));
 		
 		// Show jump count
 		FString JumpText = FString::Printf(TEXT("Jump %d/%d"), CurrentJumpCount, MaxJumpCount);
-		DrawDebugString(GetWorld(), CharLocation + (UpDirection * 100), JumpText, nullptr, FColor::White, 1.0f);
+		BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugString(GetWorld(), CharLocation + (UpDirection * 100), JumpText, nullptr, FColor::White, 1.0f));
 		#endif
 	}
 	else
 	{
 		// Log why we can't jump
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: Cannot jump - CurrentJump=%d/%d, OnGround=%s, TimeSince=%.2f, Cooldown=%.2f"), 
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: Cannot jump - CurrentJump=%d/%d, OnGround=%s, TimeSince=%.2f, Cooldown=%.2f"), 
 			CurrentJumpCount, MaxJumpCount, 
 			CachedMovement->IsMovingOnGround() ? TEXT("YES") : TEXT("NO"),
 			TimeSinceLastJump, JumpCooldown);
@@ -169,7 +170,7 @@ void UHackerJumpAbility::OnLanded(const FHitResult& Hit)
 			if (WallRunComp->IsWallRunning())
 			{
 				// Don't reset jump count during wall run
-				UE_LOG(LogTemp, Log, TEXT("HackerJump: Landed during wall run - preserving jump count (%d)"), CurrentJumpCount);
+				UE_LOG(LogBlackholeAbilities, Log, TEXT("HackerJump: Landed during wall run - preserving jump count (%d)"), CurrentJumpCount);
 				return;
 			}
 		}
@@ -186,7 +187,7 @@ void UHackerJumpAbility::OnLanded(const FHitResult& Hit)
 	}
 	
 	#if WITH_EDITOR
-	UE_LOG(LogTemp, Log, TEXT("HackerJump: Landed, jump count reset"));
+	UE_LOG(LogBlackholeAbilities, Log, TEXT("HackerJump: Landed, jump count reset"));
 	#endif
 }
 
@@ -194,14 +195,14 @@ bool UHackerJumpAbility::CanJump() const
 {
 	if (!CachedMovement)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: CanJump - No CachedMovement"));
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: CanJump - No CachedMovement"));
 		return false;
 	}
 	
 	// Can jump if on ground (first jump)
 	if (CachedMovement->IsMovingOnGround())
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("HackerJump: CanJump - On ground, can jump"));
+		UE_LOG(LogBlackholeAbilities, VeryVerbose, TEXT("HackerJump: CanJump - On ground, can jump"));
 		return true;
 	}
 	
@@ -210,17 +211,19 @@ bool UHackerJumpAbility::CanJump() const
 	{
 		// Must wait for cooldown between jumps
 		bool bCanDoubleJump = TimeSinceLastJump >= JumpCooldown;
-		UE_LOG(LogTemp, Warning, TEXT("HackerJump: CanJump - In air, CurrentJump=%d/%d, TimeSince=%.3f, Cooldown=%.3f, CanDoubleJump=%s"), 
+		UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: CanJump - In air, CurrentJump=%d/%d, TimeSince=%.3f, Cooldown=%.3f, CanDoubleJump=%s"), 
 			CurrentJumpCount, MaxJumpCount, TimeSinceLastJump, JumpCooldown, bCanDoubleJump ? TEXT("YES") : TEXT("NO"));
 		return bCanDoubleJump;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("HackerJump: CanJump - Jump count exhausted (%d/%d)"), CurrentJumpCount, MaxJumpCount);
+	UE_LOG(LogBlackholeAbilities, Warning, TEXT("HackerJump: CanJump - Jump count exhausted (%d/%d)"), CurrentJumpCount, MaxJumpCount);
 	return false;
 }
 
 void UHackerJumpAbility::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HackerJumpAbility Tick", STAT_Blackhole_HackerJumpAbility_Tick, BlackholeAbilitiesChannel);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
 	// Update time since last jump
@@ -237,12 +240,12 @@ void UHackerJumpAbility::OnWallRunStateChanged(bool bIsWallRunning)
 	if (bIsWallRunning)
 	{
 		// Entering wall run - preserve current jump state
-		UE_LOG(LogTemp, Log, TEXT("HackerJump: Entering wall run - preserving jump count (%d/%d)"), CurrentJumpCount, MaxJumpCount);
+		UE_LOG(LogBlackholeAbilities, Log, TEXT("HackerJump: Entering wall run - preserving jump count (%d/%d)"), CurrentJumpCount, MaxJumpCount);
 	}
 	else
 	{
 		// Exiting wall run - don't reset jump count, let player continue their jump sequence
-		UE_LOG(LogTemp, Log, TEXT("HackerJump: Exiting wall run - maintaining jump count (%d/%d)"), CurrentJumpCount, MaxJumpCount);
+		UE_LOG(LogBlackholeAbilities, Log, TEXT("HackerJump: Exiting wall run - maintaining jump count (%d/%d)"), CurrentJumpCount, MaxJumpCount);
 		
 		// Reset the jump timer to allow immediate jump after wall run
 		TimeSinceLastJump = JumpCooldown; // Set to cooldown value so player can jump immediately
@@ -1,4 +1,6 @@
 #include "Components/Abilities/UtilityAbility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
@@ -24,6 +26,8 @@ void UUtilityAbility::BeginPlay()
 
 void UUtilityAbility::Execute()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("UtilityAbility Execute", STAT_Blackhole_UtilityAbility_Execute, BlackholeAbilitiesChannel);
+
 	if (!CanExecute())
 	{
 		return;
@@ -59,7 +63,7 @@ void UUtilityAbility::Execute()
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("UtilityAbility: Cannot set timer - no valid world"));
+			UE_LOG(LogBlackholeAbilities, Error, TEXT("UtilityAbility: Cannot set timer - no valid world"));
 		}
 	}
 }
@@ -1,4 +1,5 @@
 #include "Components/Attributes/AttributeComponent.h"
+#include "Debug/BlackholeStats.h"
 #include "Config/GameplayConfig.h"
 
 UAttributeComponent::UAttributeComponent()
@@ -19,6 +20,8 @@ void UAttributeComponent::BeginPlay()
 
 void UAttributeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Attribute Tick", STAT_Blackhole_AttributeTick, BlackholeSystemsChannel);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
 	if (RegenRate > 0.0f && CurrentValue < MaxValue)
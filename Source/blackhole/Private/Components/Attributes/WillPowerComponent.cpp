@@ -1,4 +1,6 @@
 #include "Components/Attributes/WillPowerComponent.h"
+#include "Systems/AuraFieldSubsystem.h"
+#include "Engine/World.h"
 
 UWillPowerComponent::UWillPowerComponent()
 {
@@ -10,6 +12,21 @@ UWillPowerComponent::UWillPowerComponent()
 void UWillPowerComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (UAuraFieldSubsystem* AuraField = GetWorld()->GetSubsystem<UAuraFieldSubsystem>())
+	{
+		AuraField->RegisterReceiver(this);
+	}
+}
+
+void UWillPowerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraFieldSubsystem* AuraField = GetWorld() ? GetWorld()->GetSubsystem<UAuraFieldSubsystem>() : nullptr)
+	{
+		AuraField->UnregisterReceiver(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 bool UWillPowerComponent::UseWillPower(float Amount)
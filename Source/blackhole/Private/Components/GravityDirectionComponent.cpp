@@ -1,9 +1,10 @@
 #include "Components/GravityDirectionComponent.h"
+#include "Debug/BlackholeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Camera/CameraComponent.h"
@@ -66,6 +67,8 @@ void UGravityDirectionComponent::EndPlay(const EEndPlayReason::Type EndPlayReaso
 
 void UGravityDirectionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Gravity Direction Tick", STAT_Blackhole_GravityDirectionTick, BlackholeMovementChannel);
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     // Handle gravity direction transition
@@ -116,14 +119,14 @@ void UGravityDirectionComponent::TickComponent(float DeltaTime, ELevelTick TickT
             {
                 FVector CharLocation = OwnerCharacter->GetActorLocation();
                 // Show both current and target gravity during transition
-                DrawDebugLine(GetWorld(), CharLocation, CharLocation + (CurrentGravityDirection * 200.0f), 
-                    FColor::Blue, false, -1.0f, 0, 5.0f);
-                DrawDebugLine(GetWorld(), CharLocation, CharLocation + (TargetGravityDirection * 200.0f), 
-                    FColor::Green, false, -1.0f, 0, 3.0f);
+                BLACKHOLE_DEBUG_DRAW(Movement_Gravity, DrawDebugLine(GetWorld(), CharLocation, CharLocation + (CurrentGravityDirection * 200.0f), 
+                    FColor::Blue, false, -1.0f, 0, 5.0f));
+                BLACKHOLE_DEBUG_DRAW(Movement_Gravity, DrawDebugLine(GetWorld(), CharLocation, CharLocation + (TargetGravityDirection * 200.0f), 
+                    FColor::Green, false, -1.0f, 0, 3.0f));
                 
                 // Show transition progress
                 FString ProgressText = FString::Printf(TEXT("Gravity Shift: %.1f%%"), Alpha * 100.0f);
-                DrawDebugString(GetWorld(), CharLocation + FVector(0, 0, 100), ProgressText, nullptr, FColor::White, -1.0f);
+                BLACKHOLE_DEBUG_DRAW(Movement_Gravity, DrawDebugString(GetWorld(), CharLocation + FVector(0, 0, 100), ProgressText, nullptr, FColor::White, -1.0f));
             }
             #endif
         }
@@ -1,4 +1,5 @@
 #include "Components/Interaction/HackableComponent.h"
+#include "blackhole.h"
 #include "Components/PrimitiveComponent.h"
 #include "Materials/MaterialInterface.h"
 #include "Engine/World.h"
@@ -25,7 +26,7 @@ void UHackableComponent::BeginPlay()
         }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("HackableComponent BeginPlay - LaunchDirection set to: %d"), (int32)LaunchDirection);
+    UE_LOG(LogBlackhole, Warning, TEXT("HackableComponent BeginPlay - LaunchDirection set to: %d"), (int32)LaunchDirection);
 }
 
 void UHackableComponent::OnTargeted()
@@ -40,7 +41,7 @@ void UHackableComponent::OnTargeted()
 
     if (AActor* Owner = GetOwner())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Hackable object targeted: %s"), *Owner->GetName());
+        UE_LOG(LogBlackhole, Warning, TEXT("Hackable object targeted: %s"), *Owner->GetName());
     }
 }
 
@@ -93,7 +94,7 @@ void UHackableComponent::OnHacked(float LaunchForce, const FVector& PlayerLocati
 
     if (AActor* Owner = GetOwner())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Hackable object launched: %s with force %f in direction %s"), 
+        UE_LOG(LogBlackhole, Warning, TEXT("Hackable object launched: %s with force %f in direction %s"), 
             *Owner->GetName(), LaunchForce, *Direction.ToString());
     }
 }
@@ -106,10 +107,10 @@ FVector UHackableComponent::GetLaunchDirection(const FVector& PlayerLocation) co
     FVector ObjectLocation = Owner->GetActorLocation();
     FVector PlayerToObject = ObjectLocation - PlayerLocation;
     
-    UE_LOG(LogTemp, Warning, TEXT("GetLaunchDirection - LaunchDirection: %d"), (int32)LaunchDirection);
-    UE_LOG(LogTemp, Warning, TEXT("Player Location: %s"), *PlayerLocation.ToString());
-    UE_LOG(LogTemp, Warning, TEXT("Object Location: %s"), *ObjectLocation.ToString());
-    UE_LOG(LogTemp, Warning, TEXT("PlayerToObject: %s"), *PlayerToObject.ToString());
+    UE_LOG(LogBlackhole, Warning, TEXT("GetLaunchDirection - LaunchDirection: %d"), (int32)LaunchDirection);
+    UE_LOG(LogBlackhole, Warning, TEXT("Player Location: %s"), *PlayerLocation.ToString());
+    UE_LOG(LogBlackhole, Warning, TEXT("Object Location: %s"), *ObjectLocation.ToString());
+    UE_LOG(LogBlackhole, Warning, TEXT("PlayerToObject: %s"), *PlayerToObject.ToString());
     
     switch (LaunchDirection)
     {
@@ -120,12 +121,12 @@ FVector UHackableComponent::GetLaunchDirection(const FVector& PlayerLocation) co
             // If object is behind player (negative X), launch forward (+X)
             if (PlayerToObject.X > 0)
             {
-                UE_LOG(LogTemp, Warning, TEXT("X-Axis: Object is forward of player, launching BACKWARD"));
+                UE_LOG(LogBlackhole, Warning, TEXT("X-Axis: Object is forward of player, launching BACKWARD"));
                 return FVector(-1, 0, 0);
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("X-Axis: Object is behind player, launching FORWARD"));
+                UE_LOG(LogBlackhole, Warning, TEXT("X-Axis: Object is behind player, launching FORWARD"));
                 return FVector(1, 0, 0);
             }
         }
@@ -137,12 +138,12 @@ FVector UHackableComponent::GetLaunchDirection(const FVector& PlayerLocation) co
             // If object is to the left of player (negative Y), launch right (+Y)
             if (PlayerToObject.Y > 0)
             {
-                UE_LOG(LogTemp, Warning, TEXT("Y-Axis: Object is right of player, launching LEFT"));
+                UE_LOG(LogBlackhole, Warning, TEXT("Y-Axis: Object is right of player, launching LEFT"));
                 return FVector(0, -1, 0);
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("Y-Axis: Object is left of player, launching RIGHT"));
+                UE_LOG(LogBlackhole, Warning, TEXT("Y-Axis: Object is left of player, launching RIGHT"));
                 return FVector(0, 1, 0);
             }
         }
@@ -160,7 +161,7 @@ FVector UHackableComponent::GetLaunchDirection(const FVector& PlayerLocation) co
         case EHackableLaunchDirection::Auto:
         default:
             // For auto mode, launch away from player in all directions
-            UE_LOG(LogTemp, Warning, TEXT("Auto mode: Launching away from player"));
+            UE_LOG(LogBlackhole, Warning, TEXT("Auto mode: Launching away from player"));
             return PlayerToObject.GetSafeNormal();
     }
 }
@@ -0,0 +1,112 @@
+#include "Components/Movement/ForcedMovement.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/RootMotionSource.h"
+
+namespace
+{
+	// Being knocked back wins over the victim's own charge or dash
+	constexpr uint16 PRIORITY_ABILITY_MOVE = 100;
+	constexpr uint16 PRIORITY_KNOCKBACK = 200;
+
+	constexpr float MIN_KNOCKBACK_DURATION = 0.15f;
+
+	UCharacterMovementComponent* GetMovement(const ACharacter* Character)
+	{
+		return Character ? Character->GetCharacterMovement() : nullptr;
+	}
+}
+
+uint16 FForcedMovement::ApplyCharge(ACharacter* Character, const FVector& Velocity, float Duration)
+{
+	UCharacterMovementComponent* Movement = GetMovement(Character);
+	if (!Movement || Duration <= 0.0f)
+	{
+		return (uint16)ERootMotionSourceID::Invalid;
+	}
+
+	TSharedPtr<FRootMotionSource_ConstantForce> Source = MakeShared<FRootMotionSource_ConstantForce>();
+	Source->InstanceName = TEXT("Charge");
+	Source->AccumulateMode = ERootMotionAccumulateMode::Override;
+	Source->Priority = PRIORITY_ABILITY_MOVE;
+	Source->Force = FVector(Velocity.X, Velocity.Y, 0.0f);
+	Source->Duration = Duration;
+	Source->FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::SetVelocity;
+	Source->FinishVelocityParams.SetVelocity = FVector::ZeroVector;
+
+	return Movement->ApplyRootMotionSource(Source);
+}
+
+uint16 FForcedMovement::ApplyDash(ACharacter* Character, const FVector& Destination, float Duration)
+{
+	UCharacterMovementComponent* Movement = GetMovement(Character);
+	if (!Movement || Duration <= 0.0f)
+	{
+		return (uint16)ERootMotionSourceID::Invalid;
+	}
+
+	const FVector Start = Character->GetActorLocation();
+
+	TSharedPtr<FRootMotionSource_MoveToForce> Source = MakeShared<FRootMotionSource_MoveToForce>();
+	Source->InstanceName = TEXT("Dash");
+	Source->AccumulateMode = ERootMotionAccumulateMode::Override;
+	Source->Priority = PRIORITY_ABILITY_MOVE;
+	Source->StartLocation = Start;
+	Source->TargetLocation = FVector(Destination.X, Destination.Y, Start.Z);
+	Source->Duration = Duration;
+	Source->bRestrictSpeedToExpected = true;
+	Source->FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::SetVelocity;
+	Source->FinishVelocityParams.SetVelocity = FVector::ZeroVector;
+
+	return Movement->ApplyRootMotionSource(Source);
+}
+
+uint16 FForcedMovement::ApplyKnockback(ACharacter* Character, const FVector& LaunchVelocity)
+{
+	UCharacterMovementComponent* Movement = GetMovement(Character);
+	if (!Movement)
+	{
+		return (uint16)ERootMotionSourceID::Invalid;
+	}
+
+	// Same arc a launch would fly: airtime from the vertical speed, distance from the horizontal
+	const float Gravity = FMath::Max(-Movement->GetGravityZ(), UE_KINDA_SMALL_NUMBER);
+	const float UpSpeed = FMath::Max(LaunchVelocity.Z, 0.0f);
+	const FVector Horizontal(LaunchVelocity.X, LaunchVelocity.Y, 0.0f);
+	const float Duration = FMath::Max(2.0f * UpSpeed / Gravity, MIN_KNOCKBACK_DURATION);
+
+	TSharedPtr<FRootMotionSource_JumpForce> Source = MakeShared<FRootMotionSource_JumpForce>();
+	Source->InstanceName = TEXT("Knockback");
+	Source->AccumulateMode = ERootMotionAccumulateMode::Override;
+	Source->Priority = PRIORITY_KNOCKBACK;
+	Source->Rotation = Horizontal.Rotation();
+	Source->Distance = Horizontal.Size() * Duration;
+	Source->Height = FMath::Square(UpSpeed) / (2.0f * Gravity);
+	Source->Duration = Duration;
+	Source->bDisableTimeout = false;
+
+	// A new knockback replaces the previous one instead of stacking
+	Movement->RemoveRootMotionSource(Source->InstanceName);
+
+	if (Source->Height > 0.0f && Movement->IsMovingOnGround())
+	{
+		Movement->SetMovementMode(MOVE_Falling);
+	}
+
+	return Movement->ApplyRootMotionSource(Source);
+}
+
+bool FForcedMovement::IsActive(ACharacter* Character, uint16 SourceID)
+{
+	UCharacterMovementComponent* Movement = GetMovement(Character);
+	return Movement && SourceID != (uint16)ERootMotionSourceID::Invalid && Movement->GetRootMotionSourceByID(SourceID).IsValid();
+}
+
+void FForcedMovement::Stop(ACharacter* Character, uint16 SourceID)
+{
+	UCharacterMovementComponent* Movement = GetMovement(Character);
+	if (Movement && SourceID != (uint16)ERootMotionSourceID::Invalid)
+	{
+		Movement->RemoveRootMotionSourceByID(SourceID);
+	}
+}
@@ -1,4 +1,6 @@
 #include "Components/Movement/WallRunComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -6,7 +8,7 @@
 #include "Components/Abilities/AbilityComponent.h"
 #include "Components/Abilities/Player/Utility/HackerJumpAbility.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Components/AudioComponent.h"
@@ -80,6 +82,8 @@ void UWallRunComponent::InitializeComponent()
 
 void UWallRunComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Wall Run Tick", STAT_Blackhole_WallRunTick, BlackholeMovementChannel);
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     if (!OwnerCharacter || !MovementComponent)
@@ -122,6 +126,7 @@ void UWallRunComponent::UpdateStateMachine(float DeltaTime)
                     FCollisionQueryParams QueryParams;
                     QueryParams.AddIgnoredActor(OwnerCharacter);
                     
+                    BLACKHOLE_COUNT_QUERY(MovementTraces);
                     if (GetWorld()->LineTraceSingleByChannel(QuickGroundCheck, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
                     {
                         bIsHighEnough = false; // Too close to ground
@@ -310,6 +315,7 @@ bool UWallRunComponent::DetectWall(FVector& OutWallNormal, EWallSide& OutWallSid
         QueryParams.AddIgnoredActor(OwnerCharacter);
         QueryParams.bTraceComplex = false;
         
+        BLACKHOLE_COUNT_QUERY(MovementTraces);
         bool bHit = GetWorld()->SweepSingleByChannel(
             HitResult,
             TraceStart,
@@ -365,6 +371,7 @@ bool UWallRunComponent::CheckWallHeight(const FVector& WallLocation, const FVect
     QueryParams.AddIgnoredActor(OwnerCharacter);
     
     // If we don't hit anything going up, the wall is tall enough
+    BLACKHOLE_COUNT_QUERY(MovementTraces);
     bool bHit = GetWorld()->LineTraceSingleByChannel(
         HitResult,
         TraceStart,
@@ -396,13 +403,13 @@ bool UWallRunComponent::IsLookingAtWall(const FVector& WallNormal, EWallSide Wal
     if (bShowDebugVisuals && GetWorld())
     {
         FVector PlayerLocation = OwnerCharacter->GetActorLocation();
-        DrawDebugLine(GetWorld(), PlayerLocation, PlayerLocation + CameraForward * 200.0f, 
-            FColor::Green, false, 0.1f, 0, 2.0f);
-        DrawDebugLine(GetWorld(), PlayerLocation, PlayerLocation + ToWall * 200.0f, 
-            FColor::Blue, false, 0.1f, 0, 2.0f);
-        DrawDebugString(GetWorld(), PlayerLocation + FVector(0, 0, 120), 
+        BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugLine(GetWorld(), PlayerLocation, PlayerLocation + CameraForward * 200.0f, 
+            FColor::Green, false, 0.1f, 0, 2.0f));
+        BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugLine(GetWorld(), PlayerLocation, PlayerLocation + ToWall * 200.0f, 
+            FColor::Blue, false, 0.1f, 0, 2.0f));
+        BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugString(GetWorld(), PlayerLocation + FVector(0, 0, 120), 
             FString::Printf(TEXT("Look Dot: %.2f (need %.2f)"), DotProduct, Settings.MinLookAtDotProduct), 
-            nullptr, DotProduct >= Settings.MinLookAtDotProduct ? FColor::Green : FColor::Red, 0.1f);
+            nullptr, DotProduct >= Settings.MinLookAtDotProduct ? FColor::Green : FColor::Red, 0.1f));
     }
     
     return DotProduct >= Settings.MinLookAtDotProduct;
@@ -489,10 +496,11 @@ bool UWallRunComponent::CanStartWallRun() const
         #if WITH_EDITOR
         if (bShowDebugVisuals)
         {
-            DrawDebugLine(GetWorld(), TraceStart, TraceEnd, FColor::Yellow, false, 0.1f, 0, 2.0f);
+            BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugLine(GetWorld(), TraceStart, TraceEnd, FColor::Yellow, false, 0.1f, 0, 2.0f));
         }
         #endif
         
+        BLACKHOLE_COUNT_QUERY(MovementTraces);
         if (GetWorld()->LineTraceSingleByChannel(GroundHit, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
         {
             float HeightFromGround = (TraceStart - GroundHit.Location).Z;
@@ -500,8 +508,8 @@ bool UWallRunComponent::CanStartWallRun() const
             #if WITH_EDITOR
             if (bShowDebugVisuals)
             {
-                DrawDebugString(GetWorld(), GroundHit.Location, FString::Printf(TEXT("Height: %.1f"), HeightFromGround), 
-                    nullptr, HeightFromGround >= Settings.MinHeightFromGround ? FColor::Green : FColor::Red, 0.1f);
+                BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugString(GetWorld(), GroundHit.Location, FString::Printf(TEXT("Height: %.1f"), HeightFromGround), 
+                    nullptr, HeightFromGround >= Settings.MinHeightFromGround ? FColor::Green : FColor::Red, 0.1f));
             }
             #endif
             
@@ -525,7 +533,7 @@ bool UWallRunComponent::CanStartWallRun() const
         else
         {
             // No ground found within trace distance - player is high enough
-            UE_LOG(LogTemp, VeryVerbose, TEXT("WallRun: No ground found - height check passed"));
+            UE_LOG(LogBlackholeMovement, VeryVerbose, TEXT("WallRun: No ground found - height check passed"));
         }
     }
     
@@ -641,7 +649,7 @@ void UWallRunComponent::StartWallRunInternal(const FVector& WallNormal, EWallSid
                 {
                     float WPReward = 10.0f; // Wall run combo reward
                     ResourceMgr->AddWillPower(WPReward);
-                    UE_LOG(LogTemp, Warning, TEXT("Dash + Wall Run combo: Player gained +%.1f WP, Speed capped at 1000"), WPReward);
+                    UE_LOG(LogBlackholeMovement, Warning, TEXT("Dash + Wall Run combo: Player gained +%.1f WP, Speed capped at 1000"), WPReward);
                 }
             }
         }
@@ -795,12 +803,12 @@ void UWallRunComponent::RestoreNormalMovement()
 {
     if (!MovementComponent)
     {
-        UE_LOG(LogTemp, Error, TEXT("WallRun: RestoreNormalMovement - MovementComponent is NULL!"));
+        UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: RestoreNormalMovement - MovementComponent is NULL!"));
         return;
     }
     
     // Remove verbose logs - these are normal operations, not errors
-    // UE_LOG(LogTemp, Warning, TEXT("WallRun: Restoring gravity scale from %.2f to %.2f"), 
+    // UE_LOG(LogBlackholeMovement, Warning, TEXT("WallRun: Restoring gravity scale from %.2f to %.2f"), 
     //     MovementComponent->GravityScale, OriginalGravityScale);
     
     // Restore gravity
@@ -811,7 +819,7 @@ void UWallRunComponent::RestoreNormalMovement()
     
     // Set to falling mode to allow the launch to work properly
     MovementComponent->SetMovementMode(MOVE_Falling);
-    // UE_LOG(LogTemp, Warning, TEXT("WallRun: Gravity restored, movement mode set to FALLING for jump"));
+    // UE_LOG(LogBlackholeMovement, Warning, TEXT("WallRun: Gravity restored, movement mode set to FALLING for jump"));
     
     // If player had high speed (from dash), gradually reduce speed instead of immediate stop
     if (CurrentWallRunSpeed > Settings.WallRunSpeed * 1.5f)
@@ -903,52 +911,52 @@ FVector UWallRunComponent::CalculateLaunchVelocity(bool bJumpCancel) const
 
 void UWallRunComponent::OnJumpPressed()
 {
-    UE_LOG(LogTemp, Error, TEXT("WallRun: OnJumpPressed() called! CurrentState = %d"), (int32)CurrentState);
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: OnJumpPressed() called! CurrentState = %d"), (int32)CurrentState);
     
     // Debug message removed - jump pressed state
     
     if (CurrentState == EWallRunState::WallRunning)
     {
-        UE_LOG(LogTemp, Error, TEXT("WallRun: State is WallRunning, calling ExecuteWallJump()"));
+        UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: State is WallRunning, calling ExecuteWallJump()"));
         // Execute dedicated wall jump immediately
         ExecuteWallJump();
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("WallRun: NOT in WallRunning state, ignoring jump"));
+        UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: NOT in WallRunning state, ignoring jump"));
     }
 }
 
 void UWallRunComponent::ExecuteWallJump()
 {
-    UE_LOG(LogTemp, Error, TEXT("WallRun: ExecuteWallJump() called!"));
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: ExecuteWallJump() called!"));
     
     if (!OwnerCharacter)
     {
-        UE_LOG(LogTemp, Error, TEXT("WallRun: ExecuteWallJump() failed - OwnerCharacter is NULL"));
+        UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: ExecuteWallJump() failed - OwnerCharacter is NULL"));
         return;
     }
     
     if (!MovementComponent)
     {
-        UE_LOG(LogTemp, Error, TEXT("WallRun: ExecuteWallJump() failed - MovementComponent is NULL"));
+        UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: ExecuteWallJump() failed - MovementComponent is NULL"));
         return;
     }
     
     if (CurrentState != EWallRunState::WallRunning)
     {
-        UE_LOG(LogTemp, Error, TEXT("WallRun: ExecuteWallJump() failed - CurrentState is %d, not WallRunning"), (int32)CurrentState);
+        UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: ExecuteWallJump() failed - CurrentState is %d, not WallRunning"), (int32)CurrentState);
         return;
     }
     
-    UE_LOG(LogTemp, Error, TEXT("WallRun: ExecuteWallJump() - All checks passed, executing wall jump!"));
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: ExecuteWallJump() - All checks passed, executing wall jump!"));
     
     // Store wall side before resetting it
     EWallSide JumpWallSide = CurrentWallSide;
     
     // Calculate diagonal wall jump velocity based on wall side
     FVector WallJumpVelocity = CalculateWallJumpVelocity();
-    UE_LOG(LogTemp, Error, TEXT("WallRun: Calculated WallJumpVelocity = %s"), *WallJumpVelocity.ToString());
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: Calculated WallJumpVelocity = %s"), *WallJumpVelocity.ToString());
     
     // Set wall run end time for cooldown
     LastWallRunEndTime = GetWorld()->GetTimeSeconds();
@@ -958,22 +966,22 @@ void UWallRunComponent::ExecuteWallJump()
     
     // Apply wall jump velocity FIRST before any state changes
     FVector VelocityBefore = MovementComponent->Velocity;
-    UE_LOG(LogTemp, Error, TEXT("WallRun: Velocity BEFORE = %s"), *VelocityBefore.ToString());
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: Velocity BEFORE = %s"), *VelocityBefore.ToString());
     
     // Use Launch instead of directly setting velocity - this is more reliable
-    UE_LOG(LogTemp, Error, TEXT("WallRun: Launching character with velocity = %s"), *WallJumpVelocity.ToString());
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: Launching character with velocity = %s"), *WallJumpVelocity.ToString());
     MovementComponent->Launch(WallJumpVelocity);
     
     FVector VelocityAfter = MovementComponent->Velocity;
-    UE_LOG(LogTemp, Error, TEXT("WallRun: Velocity AFTER Launch = %s"), *VelocityAfter.ToString());
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: Velocity AFTER Launch = %s"), *VelocityAfter.ToString());
     
     // Now end wall run state
-    UE_LOG(LogTemp, Error, TEXT("WallRun: Changing state to None"));
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: Changing state to None"));
     ChangeState(EWallRunState::None);
     CurrentWallSide = EWallSide::None;
     
     // Restore normal movement AFTER launching
-    UE_LOG(LogTemp, Error, TEXT("WallRun: Restoring normal movement"));
+    UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: Restoring normal movement"));
     RestoreNormalMovement();
     
     // Remove gameplay tags
@@ -996,7 +1004,7 @@ void UWallRunComponent::ExecuteWallJump()
         if (MovementComponent)
         {
             FVector CurrentVel = MovementComponent->Velocity;
-            UE_LOG(LogTemp, Error, TEXT("WallRun: Velocity after 0.1s delay = %s"), *CurrentVel.ToString());
+            UE_LOG(LogBlackholeMovement, Error, TEXT("WallRun: Velocity after 0.1s delay = %s"), *CurrentVel.ToString());
         }
     }, 0.1f, false);
 }
@@ -1267,18 +1275,18 @@ void UWallRunComponent::DrawDebugInfo() const
     FVector RightTraceEnd = ActorLocation + (RightVector * Settings.WallDetectionDistance);
     FVector LeftTraceEnd = ActorLocation + (-RightVector * Settings.WallDetectionDistance);
     
-    DrawDebugCapsule(GetWorld(), RightTraceEnd, 50.0f, Settings.WallDetectionRadius, 
-        FQuat::Identity, FColor::Yellow, false, 0.0f, 0, 2.0f);
-    DrawDebugCapsule(GetWorld(), LeftTraceEnd, 50.0f, Settings.WallDetectionRadius, 
-        FQuat::Identity, FColor::Yellow, false, 0.0f, 0, 2.0f);
+    BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugCapsule(GetWorld(), RightTraceEnd, 50.0f, Settings.WallDetectionRadius, 
+        FQuat::Identity, FColor::Yellow, false, 0.0f, 0, 2.0f));
+    BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugCapsule(GetWorld(), LeftTraceEnd, 50.0f, Settings.WallDetectionRadius, 
+        FQuat::Identity, FColor::Yellow, false, 0.0f, 0, 2.0f));
     
     // Draw current wall normal if wall running
     if (CurrentState == EWallRunState::WallRunning)
     {
-        DrawDebugLine(GetWorld(), ActorLocation, ActorLocation + (CurrentWallNormal * 200.0f), 
-            FColor::Red, false, 0.0f, 0, 3.0f);
-        DrawDebugLine(GetWorld(), ActorLocation, ActorLocation + (WallRunDirection * 300.0f), 
-            FColor::Blue, false, 0.0f, 0, 3.0f);
+        BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugLine(GetWorld(), ActorLocation, ActorLocation + (CurrentWallNormal * 200.0f), 
+            FColor::Red, false, 0.0f, 0, 3.0f));
+        BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugLine(GetWorld(), ActorLocation, ActorLocation + (WallRunDirection * 300.0f), 
+            FColor::Blue, false, 0.0f, 0, 3.0f));
     }
     
     // Draw state info without timer
@@ -1286,15 +1294,15 @@ void UWallRunComponent::DrawDebugInfo() const
     FString StateName = (int32)CurrentState < 5 ? StateNames[(int32)CurrentState] : TEXT("Unknown");
     FString StateText = FString::Printf(TEXT("State: %s (%d), Side: %d, Speed: %.1f"), 
         *StateName, (int32)CurrentState, (int32)CurrentWallSide, CurrentWallRunSpeed);
-    DrawDebugString(GetWorld(), ActorLocation + FVector(0, 0, 100), StateText, 
-        nullptr, FColor::White, 0.0f);
+    BLACKHOLE_DEBUG_DRAW(Movement_WallRun, DrawDebugString(GetWorld(), ActorLocation + FVector(0, 0, 100), StateText, 
+        nullptr, FColor::White, 0.0f));
 }
 
 void UWallRunComponent::LogWallRunInfo(const FString& Message) const
 {
     if (bShowDebugLogs)
     {
-        UE_LOG(LogTemp, Warning, TEXT("WallRun: %s"), *Message);
+        UE_LOG(LogBlackholeMovement, Warning, TEXT("WallRun: %s"), *Message);
     }
 }
 
@@ -1,4 +1,7 @@
 #include "Components/StatusEffectComponent.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
@@ -25,10 +28,12 @@ void UStatusEffectComponent::ApplyStatusEffect(EStatusEffectType EffectType, flo
 {
 	if (EffectType == EStatusEffectType::None) return;
 	
+	BLACKHOLE_LLM_SCOPE(StatusEffects);
+
 	// Check immunities
 	if (Immunities & (1 << (int32)EffectType))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StatusEffect: %s is immune to effect type %d"), 
+		UE_LOG(LogBlackhole, Warning, TEXT("StatusEffect: %s is immune to effect type %d"), 
 			*GetOwner()->GetName(), (int32)EffectType);
 		return;
 	}
@@ -39,7 +44,7 @@ void UStatusEffectComponent::ApplyStatusEffect(EStatusEffectType EffectType, flo
 		// Check priority - only apply if new effect has equal or higher priority
 		if (Priority < ExistingEffect->Priority)
 		{
-			UE_LOG(LogTemp, Verbose, TEXT("StatusEffect: New effect %d has lower priority (%d < %d), ignoring"), 
+			UE_LOG(LogBlackhole, Verbose, TEXT("StatusEffect: New effect %d has lower priority (%d < %d), ignoring"), 
 				(int32)EffectType, Priority, ExistingEffect->Priority);
 			return;
 		}
@@ -129,12 +134,17 @@ void UStatusEffectComponent::ApplyStatusEffect(EStatusEffectType EffectType, flo
 	}
 	
 	// Store effect
+	const int32 PreviousEffectCount = ActiveEffects.Num();
 	ActiveEffects.Add(EffectType, NewEffect);
+	if (ActiveEffects.Num() > PreviousEffectCount)
+	{
+		INC_DWORD_STAT(STAT_Blackhole_StatusEffectsAlive);
+	}
 	
 	// Broadcast event
 	OnStatusEffectApplied.Broadcast(EffectType, Duration);
 	
-	UE_LOG(LogTemp, Warning, TEXT("StatusEffect: Applied %d to %s for %.1fs"), 
+	UE_LOG(LogBlackhole, Warning, TEXT("StatusEffect: Applied %d to %s for %.1fs"), 
 		(int32)EffectType, *GetOwner()->GetName(), Duration);
 }
 
@@ -154,11 +164,12 @@ void UStatusEffectComponent::RemoveStatusEffect(EStatusEffectType EffectType)
 	
 	// Remove from map
 	ActiveEffects.Remove(EffectType);
+	DEC_DWORD_STAT(STAT_Blackhole_StatusEffectsAlive);
 	
 	// Broadcast event
 	OnStatusEffectRemoved.Broadcast(EffectType);
 	
-	UE_LOG(LogTemp, Warning, TEXT("StatusEffect: Removed %d from %s"), 
+	UE_LOG(LogBlackhole, Warning, TEXT("StatusEffect: Removed %d from %s"), 
 		(int32)EffectType, *GetOwner()->GetName());
 }
 
@@ -356,7 +367,7 @@ void UStatusEffectComponent::RemoveEffectsFromSource(AActor* Source)
 		RemoveStatusEffect(EffectType);
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("StatusEffect: Removed %d effects from source %s"), 
+	UE_LOG(LogBlackhole, Warning, TEXT("StatusEffect: Removed %d effects from source %s"), 
 		EffectsToRemove.Num(), *Source->GetName());
 }
 
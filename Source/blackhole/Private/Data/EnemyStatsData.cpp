@@ -1,16 +1,6 @@
 #include "Data/EnemyStatsData.h"
+#include "blackhole.h"
 #include "Enemy/BaseEnemy.h"
-#include "Enemy/TankEnemy.h"
-#include "Enemy/AgileEnemy.h"
-#include "Enemy/CombatEnemy.h"
-#include "Enemy/HackerEnemy.h"
-#include "Enemy/AI/EnemyStateMachine.h"
-#include "Enemy/AI/EnemyStates.h"
-#include "Components/Abilities/Enemy/SmashAbilityComponent.h"
-#include "Components/Abilities/Enemy/AreaDamageAbilityComponent.h"
-#include "Components/Abilities/Enemy/BlockComponent.h"
-#include "Components/Abilities/Enemy/DodgeComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/DataTable.h"
 
 FEnemyStatsData UEnemyStatsManager::GetEnemyStats(UObject* WorldContextObject, UDataTable* EnemyDataTable, FName RowName)
@@ -19,7 +9,7 @@ FEnemyStatsData UEnemyStatsManager::GetEnemyStats(UObject* WorldContextObject, U
 	
 	if (!EnemyDataTable)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GetEnemyStats: No data table provided!"));
+		UE_LOG(LogBlackholeAI, Error, TEXT("GetEnemyStats: No data table provided!"));
 		return DefaultStats;
 	}
 	
@@ -27,7 +17,7 @@ FEnemyStatsData UEnemyStatsManager::GetEnemyStats(UObject* WorldContextObject, U
 	
 	if (!StatsRow)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GetEnemyStats: Could not find row %s in data table"), *RowName.ToString());
+		UE_LOG(LogBlackholeAI, Error, TEXT("GetEnemyStats: Could not find row %s in data table"), *RowName.ToString());
 		return DefaultStats;
 	}
 	
@@ -38,129 +28,141 @@ void UEnemyStatsManager::ApplyStatsToEnemy(ABaseEnemy* Enemy, const FEnemyStatsD
 {
 	if (!Enemy)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ApplyStatsToEnemy: Null enemy provided!"));
+		UE_LOG(LogBlackholeAI, Error, TEXT("ApplyStatsToEnemy: Null enemy provided!"));
 		return;
 	}
 	
-	// Apply health as WP
-	Enemy->SetMaxWP(Stats.MaxHealth);
-	Enemy->SetCurrentWP(Stats.MaxHealth);
+	// Rows from tables go through UEnemyArchetypeCache; this path builds a one-off archetype
+	FEnemyArchetype Archetype;
+	BuildArchetype(NAME_None, Stats, Archetype);
+	Enemy->ApplyArchetype(Archetype, EEnemyArchetypeFields::All | EEnemyArchetypeFields::Spawn);
 	
-	// Apply movement stats
-	if (UCharacterMovementComponent* Movement = Enemy->GetCharacterMovement())
+	UE_LOG(LogBlackholeAI, Log, TEXT("Applied stats from data table to enemy: %s"), *Enemy->GetName());
+}
+
+void UEnemyStatsManager::BuildArchetype(FName RowName, const FEnemyStatsData& Stats, FEnemyArchetype& OutArchetype)
+{
+	OutArchetype.RowName = RowName;
+	OutArchetype.Stats = Stats;
+	FEnemyStatsData& Valid = OutArchetype.Stats;
+	
+	// Validation - fix what would break enemies and say so
+	if (Valid.EnemyType == EEnemyType::None)
 	{
-		Movement->MaxWalkSpeed = Stats.MovementSpeed;
-		Movement->MaxAcceleration = Stats.Acceleration;
-		Movement->BrakingDecelerationWalking = Stats.BrakingDeceleration;
-		Movement->RotationRate = FRotator(0.0f, Stats.RotationRate, 0.0f);
-		Movement->Mass = Stats.Mass;
+		UE_LOG(LogBlackholeAI, Warning, TEXT("Enemy stats row '%s': EnemyType is None"), *RowName.ToString());
 	}
 	
-	// Apply combat range stats
-	Enemy->MinimumEngagementDistance = Stats.MinimumEngagementDistance;
-	
-	// Apply AI parameters through state machine
-	if (UEnemyStateMachine* StateMachine = Enemy->FindComponentByClass<UEnemyStateMachine>())
+	if (Valid.MaxHealth < 1.0f)
 	{
-		FEnemyAIParameters AIParams;
-		
-		// Health thresholds
-		AIParams.RetreatHealthPercent = Stats.RetreatHealthPercent;
-		AIParams.DefensiveHealthPercent = Stats.DefensiveHealthPercent;
-		
-		// Distance thresholds
-		AIParams.AttackRange = Stats.AttackRange;
-		AIParams.ChaseRange = Stats.ChaseRange;
-		AIParams.SightRange = Stats.SightRange;
-		AIParams.PreferredCombatDistance = Stats.PreferredCombatDistance;
-		
-		// Timing parameters
-		AIParams.ReactionTime = Stats.ReactionTime;
-		AIParams.SearchDuration = Stats.SearchDuration;
-		AIParams.MaxTimeInCombat = Stats.MaxTimeInCombat;
-		AIParams.PatrolWaitTime = Stats.PatrolWaitTime;
-		
-		// Combat parameters
-		AIParams.DodgeChance = Stats.DodgeChance;
-		AIParams.BlockChance = Stats.BlockChance;
-		AIParams.ReactiveDefenseChance = Stats.ReactiveDefenseChance;
-		AIParams.AttackCooldown = Stats.AttackCooldown / Stats.AttackSpeedMultiplier;
-		AIParams.AbilityCooldown = Stats.DefensiveCooldown;
-		
-		// Personality
-		AIParams.AggressionLevel = Stats.AggressionLevel;
-		
-		StateMachine->SetAIParameters(AIParams);
+		UE_LOG(LogBlackholeAI, Warning, TEXT("Enemy stats row '%s': MaxHealth %.1f is below 1, using 1"), *RowName.ToString(), Valid.MaxHealth);
+		Valid.MaxHealth = 1.0f;
 	}
 	
-	// Apply ability configurations
-	if (USmashAbilityComponent* SmashAbility = Enemy->FindComponentByClass<USmashAbilityComponent>())
+	if (Valid.AttackSpeedMultiplier <= 0.0f)
 	{
-		SmashAbility->SetDamage(Stats.SmashDamage);
-		SmashAbility->SetCooldownTime(Stats.SmashCooldown / Stats.AttackSpeedMultiplier);
-		SmashAbility->SetRange(Stats.SmashRange);
-		SmashAbility->SetKnockbackForce(Stats.SmashKnockbackForce);
-		
-		// Area damage for ground slam
-		if (Stats.bHasAreaDamage)
-		{
-			SmashAbility->SetAreaDamage(true);
-			SmashAbility->SetAreaRadius(Stats.GroundSlamRadius);
-		}
+		UE_LOG(LogBlackholeAI, Warning, TEXT("Enemy stats row '%s': AttackSpeedMultiplier %.2f must be positive, using 1"), *RowName.ToString(), Valid.AttackSpeedMultiplier);
+		Valid.AttackSpeedMultiplier = 1.0f;
 	}
 	
-	// Apply enemy-specific stats
-	if (ATankEnemy* Tank = Cast<ATankEnemy>(Enemy))
+	if (Valid.RetreatHealthPercent > Valid.DefensiveHealthPercent)
 	{
-		// Configure AreaDamageAbilityComponent from data table
-		if (UAreaDamageAbilityComponent* AreaDamageAbility = Tank->GetAreaDamageAbility())
-		{
-			AreaDamageAbility->DamageRadius = Stats.GroundSlamRadius;
-			AreaDamageAbility->BaseDamage = Stats.SmashDamage * Stats.GroundSlamDamageMultiplier;
-			AreaDamageAbility->KnockbackForce = Stats.GroundSlamKnockbackForce;
-			AreaDamageAbility->SetCooldown(Stats.GroundSlamCooldown);
-		}
-		Tank->AttackRange = Stats.AttackRange;
-		Tank->ChaseRange = Stats.ChaseRange;
-		Tank->BlockChance = Stats.BlockChance;
+		UE_LOG(LogBlackholeAI, Warning, TEXT("Enemy stats row '%s': RetreatHealthPercent (%.2f) is above DefensiveHealthPercent (%.2f)"),
+			*RowName.ToString(), Valid.RetreatHealthPercent, Valid.DefensiveHealthPercent);
 	}
-	else if (AAgileEnemy* Agile = Cast<AAgileEnemy>(Enemy))
+	
+	if (Valid.AttackRange > Valid.ChaseRange)
 	{
-		Agile->AttackRange = Stats.AttackRange;
-		Agile->ChaseRange = Stats.ChaseRange;
-		Agile->DodgeChance = Stats.DodgeChance;
-		Agile->MovementSpeed = Stats.MovementSpeed;
-		Agile->AttackSpeedMultiplier = Stats.AttackSpeedMultiplier;
-		Agile->DashCooldown = Stats.DashCooldown;
-		Agile->DashBehindDistance = Stats.DashBehindDistance;
+		UE_LOG(LogBlackholeAI, Warning, TEXT("Enemy stats row '%s': AttackRange (%.0f) is beyond ChaseRange (%.0f)"),
+			*RowName.ToString(), Valid.AttackRange, Valid.ChaseRange);
 	}
-	else if (ACombatEnemy* Combat = Cast<ACombatEnemy>(Enemy))
+	
+	// AI parameters for the state machine
+	FEnemyAIParameters& AIParams = OutArchetype.AIParameters;
+	
+	// Health thresholds
+	AIParams.RetreatHealthPercent = Valid.RetreatHealthPercent;
+	AIParams.DefensiveHealthPercent = Valid.DefensiveHealthPercent;
+	
+	// Distance thresholds
+	AIParams.AttackRange = Valid.AttackRange;
+	AIParams.ChaseRange = Valid.ChaseRange;
+	AIParams.SightRange = Valid.SightRange;
+	AIParams.PreferredCombatDistance = Valid.PreferredCombatDistance;
+	
+	// Timing parameters
+	AIParams.ReactionTime = Valid.ReactionTime;
+	AIParams.SearchDuration = Valid.SearchDuration;
+	AIParams.MaxTimeInCombat = Valid.MaxTimeInCombat;
+	AIParams.PatrolWaitTime = Valid.PatrolWaitTime;
+	
+	// Combat parameters
+	AIParams.DodgeChance = Valid.DodgeChance;
+	AIParams.BlockChance = Valid.BlockChance;
+	AIParams.ReactiveDefenseChance = Valid.ReactiveDefenseChance;
+	AIParams.AttackCooldown = Valid.AttackCooldown / Valid.AttackSpeedMultiplier;
+	AIParams.AbilityCooldown = Valid.DefensiveCooldown;
+	
+	// Personality
+	AIParams.AggressionLevel = Valid.AggressionLevel;
+	
+	// Ability values derived from several fields
+	OutArchetype.SmashCooldown = Valid.SmashCooldown / Valid.AttackSpeedMultiplier;
+	OutArchetype.GroundSlamDamage = Valid.SmashDamage * Valid.GroundSlamDamageMultiplier;
+}
+
+EEnemyArchetypeFields UEnemyStatsManager::DiffArchetypes(const FEnemyArchetype& Old, const FEnemyArchetype& New)
+{
+	const FEnemyStatsData& A = Old.Stats;
+	const FEnemyStatsData& B = New.Stats;
+	EEnemyArchetypeFields Changed = EEnemyArchetypeFields::None;
+	
+	if (A.MaxHealth != B.MaxHealth)
 	{
-		Combat->AttackRange = Stats.AttackRange;
-		Combat->ChaseRange = Stats.ChaseRange;
-		Combat->DodgeChance = Stats.DodgeChance;
-		Combat->BlockChance = Stats.BlockChance;
+		Changed |= EEnemyArchetypeFields::Health;
 	}
-	else if (AHackerEnemy* Hacker = Cast<AHackerEnemy>(Enemy))
+	
+	if (A.MovementSpeed != B.MovementSpeed || A.Acceleration != B.Acceleration || A.BrakingDeceleration != B.BrakingDeceleration
+		|| A.RotationRate != B.RotationRate || A.Mass != B.Mass)
 	{
-		Hacker->MindmeldRange = Stats.RangedAttackRange;
-		Hacker->SafeDistance = Stats.SafeDistance;
+		Changed |= EEnemyArchetypeFields::Movement;
 	}
 	
-	// Apply block ability settings
-	if (UBlockComponent* BlockAbility = Enemy->FindComponentByClass<UBlockComponent>())
+	if (A.MinimumEngagementDistance != B.MinimumEngagementDistance
+		|| !FEnemyAIParameters::StaticStruct()->CompareScriptStruct(&Old.AIParameters, &New.AIParameters, PPF_None))
 	{
-		BlockAbility->BlockDuration = Stats.BlockDuration;
-		BlockAbility->SetCooldown(Stats.BlockCooldown);
-		// Note: DamageReduction would need to be added to BlockComponent if desired
+		Changed |= EEnemyArchetypeFields::AI;
 	}
 	
-	// Apply dodge ability settings
-	if (UDodgeComponent* DodgeAbility = Enemy->FindComponentByClass<UDodgeComponent>())
+	// Everything else configures abilities and per-class tuning. Mask out the groups above and
+	// compare what is left. AttackSpeedMultiplier stays in: it also scales SmashCooldown.
+	FEnemyStatsData Rest = B;
+	Rest.MaxHealth = A.MaxHealth;
+	Rest.MovementSpeed = A.MovementSpeed;
+	Rest.Acceleration = A.Acceleration;
+	Rest.BrakingDeceleration = A.BrakingDeceleration;
+	Rest.RotationRate = A.RotationRate;
+	Rest.Mass = A.Mass;
+	Rest.MinimumEngagementDistance = A.MinimumEngagementDistance;
+	Rest.RetreatHealthPercent = A.RetreatHealthPercent;
+	Rest.DefensiveHealthPercent = A.DefensiveHealthPercent;
+	Rest.AttackRange = A.AttackRange;
+	Rest.ChaseRange = A.ChaseRange;
+	Rest.SightRange = A.SightRange;
+	Rest.PreferredCombatDistance = A.PreferredCombatDistance;
+	Rest.ReactionTime = A.ReactionTime;
+	Rest.SearchDuration = A.SearchDuration;
+	Rest.MaxTimeInCombat = A.MaxTimeInCombat;
+	Rest.PatrolWaitTime = A.PatrolWaitTime;
+	Rest.DodgeChance = A.DodgeChance;
+	Rest.BlockChance = A.BlockChance;
+	Rest.ReactiveDefenseChance = A.ReactiveDefenseChance;
+	Rest.AttackCooldown = A.AttackCooldown;
+	Rest.DefensiveCooldown = A.DefensiveCooldown;
+	Rest.AggressionLevel = A.AggressionLevel;
+	if (!FEnemyStatsData::StaticStruct()->CompareScriptStruct(&A, &Rest, PPF_None))
 	{
-		DodgeAbility->SetCooldown(Stats.DodgeCooldown);
-		DodgeAbility->DodgeDistance = Stats.DodgeDistance;
+		Changed |= EEnemyArchetypeFields::Abilities;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Applied stats from data table to enemy: %s"), *Enemy->GetName());
-}
\ No newline at end of file
+	return Changed;
+}
@@ -0,0 +1,280 @@
+#include "Debug/BlackholeDebugDraw.h"
+
+#if ENABLE_DRAW_DEBUG
+
+#include "DrawDebugHelpers.h"
+#include "Components/LineBatchComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
+
+uint32 FBlackholeDebugDraw::EnabledMask = 0;
+
+namespace
+{
+	struct FDebugDrawCategoryCVar
+	{
+		EBlackholeDebugDraw Category;
+		TAutoConsoleVariable<bool>* CVar;
+	};
+
+	FConsoleVariableDelegate MakeRefreshDelegate();
+
+	TAutoConsoleVariable<bool> CVarDebugAll(TEXT("blackhole.debug.all"), false, TEXT("Enable every blackhole debug draw category."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugAILOS(TEXT("blackhole.debug.ai.los"), false, TEXT("Draw enemy line-of-sight checks."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugAIState(TEXT("blackhole.debug.ai.state"), false, TEXT("Draw enemy AI state ranges and targets."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugAbilitiesAoE(TEXT("blackhole.debug.abilities.aoe"), false, TEXT("Draw ability areas (spheres, cones, boxes)."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugAbilitiesHits(TEXT("blackhole.debug.abilities.hits"), false, TEXT("Draw ability traces, hits and directions."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugAbilitiesCombos(TEXT("blackhole.debug.abilities.combos"), false, TEXT("Draw combo effects and windows."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugMovementWallRun(TEXT("blackhole.debug.movement.wallrun"), false, TEXT("Draw wall run detection and state."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugMovementGravity(TEXT("blackhole.debug.movement.gravity"), false, TEXT("Draw gravity direction changes and volumes."), MakeRefreshDelegate());
+	TAutoConsoleVariable<bool> CVarDebugWorld(TEXT("blackhole.debug.world"), false, TEXT("Draw world actors (doors, psi disruptors)."), MakeRefreshDelegate());
+
+	const FDebugDrawCategoryCVar CategoryCVars[] = {
+		{ EBlackholeDebugDraw::AI_LOS, &CVarDebugAILOS },
+		{ EBlackholeDebugDraw::AI_State, &CVarDebugAIState },
+		{ EBlackholeDebugDraw::Abilities_AoE, &CVarDebugAbilitiesAoE },
+		{ EBlackholeDebugDraw::Abilities_Hits, &CVarDebugAbilitiesHits },
+		{ EBlackholeDebugDraw::Abilities_Combos, &CVarDebugAbilitiesCombos },
+		{ EBlackholeDebugDraw::Movement_WallRun, &CVarDebugMovementWallRun },
+		{ EBlackholeDebugDraw::Movement_Gravity, &CVarDebugMovementGravity },
+		{ EBlackholeDebugDraw::World, &CVarDebugWorld }
+	};
+
+	// One buffer per line batcher type: [persistent][foreground]
+	struct FWorldLineBuffers
+	{
+		TArray<FBatchedLine> Lines[2][2];
+	};
+
+	TMap<TObjectKey<UWorld>, FWorldLineBuffers> PendingLines;
+	bool bDelegatesBound = false;
+
+	bool CanDraw(const UWorld* World)
+	{
+		return World && GEngine && GEngine->GetNetMode(World) != NM_DedicatedServer;
+	}
+}
+
+struct FBlackholeDebugDrawRegistration
+{
+	static void Refresh(IConsoleVariable*)
+	{
+		FBlackholeDebugDraw::RefreshEnabledMask();
+	}
+};
+
+namespace
+{
+	FConsoleVariableDelegate MakeRefreshDelegate()
+	{
+		return FConsoleVariableDelegate::CreateStatic(&FBlackholeDebugDrawRegistration::Refresh);
+	}
+}
+
+void FBlackholeDebugDraw::RefreshEnabledMask()
+{
+	if (CVarDebugAll.GetValueOnAnyThread())
+	{
+		EnabledMask = ~0u;
+		return;
+	}
+
+	uint32 Mask = 0;
+	for (const FDebugDrawCategoryCVar& Entry : CategoryCVars)
+	{
+		if (Entry.CVar->GetValueOnAnyThread())
+		{
+			Mask |= (uint32)Entry.Category;
+		}
+	}
+	EnabledMask = Mask;
+}
+
+void FBlackholeDebugDraw::AddLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color,
+	bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness)
+{
+	if (!bDelegatesBound)
+	{
+		bDelegatesBound = true;
+		FWorldDelegates::OnWorldPostActorTick.AddLambda([](UWorld* TickedWorld, ELevelTick, float)
+		{
+			FlushWorld(TickedWorld);
+		});
+		FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld* CleanedWorld, bool, bool)
+		{
+			ForgetWorld(CleanedWorld);
+		});
+	}
+
+	// Same batcher selection and lifetime rules as DrawDebugHelpers
+	const bool bUsePersistent = bPersistent || LifeTime > 0.0f;
+	const bool bForeground = DepthPriority == SDPG_Foreground;
+	const float LineLifeTime = bPersistent ? -1.0f : (LifeTime > 0.0f ? LifeTime : 0.0f);
+
+	FWorldLineBuffers& Buffers = PendingLines.FindOrAdd(TObjectKey<UWorld>(World));
+	Buffers.Lines[bUsePersistent][bForeground].Emplace(Start, End, Color, LineLifeTime, Thickness, DepthPriority);
+}
+
+void FBlackholeDebugDraw::FlushWorld(UWorld* World)
+{
+	FWorldLineBuffers* Buffers = PendingLines.Find(TObjectKey<UWorld>(World));
+	if (!Buffers)
+	{
+		return;
+	}
+
+	static const UWorld::ELineBatcherType BatcherTypes[2][2] = {
+		{ UWorld::ELineBatcherType::World, UWorld::ELineBatcherType::Foreground },
+		{ UWorld::ELineBatcherType::WorldPersistent, UWorld::ELineBatcherType::ForegroundPersistent }
+	};
+
+	for (int32 Persistent = 0; Persistent < 2; Persistent++)
+	{
+		for (int32 Foreground = 0; Foreground < 2; Foreground++)
+		{
+			TArray<FBatchedLine>& Lines = Buffers->Lines[Persistent][Foreground];
+			if (Lines.Num() == 0)
+			{
+				continue;
+			}
+
+			if (ULineBatchComponent* LineBatcher = World->GetLineBatcher(BatcherTypes[Persistent][Foreground]))
+			{
+				LineBatcher->DrawLines(Lines);
+			}
+
+			// Keep the allocation for next frame
+			Lines.Reset();
+		}
+	}
+}
+
+void FBlackholeDebugDraw::ForgetWorld(UWorld* World)
+{
+	PendingLines.Remove(TObjectKey<UWorld>(World));
+}
+
+void FBlackholeDebugDraw::DrawDebugLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color,
+	bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness)
+{
+	if (CanDraw(World))
+	{
+		AddLine(World, Start, End, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+	}
+}
+
+void FBlackholeDebugDraw::DrawDebugDirectionalArrow(const UWorld* World, const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color,
+	bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness)
+{
+	if (!CanDraw(World))
+	{
+		return;
+	}
+
+	AddLine(World, Start, End, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+
+	const FVector Direction = (End - Start).GetSafeNormal();
+	if (Direction.IsNearlyZero())
+	{
+		return;
+	}
+
+	// Four head lines around the shaft, like the engine arrow
+	FVector Up, Right;
+	Direction.FindBestAxisVectors(Up, Right);
+	const FVector Back = End - Direction * ArrowSize;
+	const float HeadWidth = ArrowSize * 0.5f;
+	AddLine(World, End, Back + Up * HeadWidth, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+	AddLine(World, End, Back - Up * HeadWidth, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+	AddLine(World, End, Back + Right * HeadWidth, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+	AddLine(World, End, Back - Right * HeadWidth, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+}
+
+void FBlackholeDebugDraw::DrawDebugBox(const UWorld* World, const FVector& Center, const FVector& Extent, const FColor& Color,
+	bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness)
+{
+	if (!CanDraw(World))
+	{
+		return;
+	}
+
+	FVector Corners[8];
+	for (int32 i = 0; i < 8; i++)
+	{
+		Corners[i] = Center + FVector(
+			(i & 1) ? Extent.X : -Extent.X,
+			(i & 2) ? Extent.Y : -Extent.Y,
+			(i & 4) ? Extent.Z : -Extent.Z);
+	}
+
+	// Each edge joins two corners that differ in exactly one axis bit
+	for (int32 i = 0; i < 8; i++)
+	{
+		for (int32 Bit = 1; Bit < 8; Bit <<= 1)
+		{
+			if (!(i & Bit))
+			{
+				AddLine(World, Corners[i], Corners[i | Bit], Color, bPersistent, LifeTime, DepthPriority, Thickness);
+			}
+		}
+	}
+}
+
+void FBlackholeDebugDraw::DrawDebugCircle(const UWorld* World, const FVector& Center, float Radius, int32 Segments, const FColor& Color,
+	bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness, const FVector& YAxis, const FVector& ZAxis, bool bDrawAxis)
+{
+	if (!CanDraw(World))
+	{
+		return;
+	}
+
+	// Circle lies in the plane spanned by YAxis and ZAxis, matching the engine helper
+	Segments = FMath::Max(Segments, 4);
+	const float AngleStep = 2.0f * PI / Segments;
+	FVector Previous = Center + YAxis * Radius;
+	for (int32 i = 1; i <= Segments; i++)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, AngleStep * i);
+		const FVector Next = Center + (YAxis * Cos + ZAxis * Sin) * Radius;
+		AddLine(World, Previous, Next, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+		Previous = Next;
+	}
+
+	if (bDrawAxis)
+	{
+		AddLine(World, Center - YAxis * Radius, Center + YAxis * Radius, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+		AddLine(World, Center - ZAxis * Radius, Center + ZAxis * Radius, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+	}
+}
+
+void FBlackholeDebugDraw::DrawDebugSphere(const UWorld* World, const FVector& Center, float Radius, int32 Segments, const FColor& Color,
+	bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness)
+{
+	// Three great circles instead of the engine's full lat/long grid - a fraction of the lines
+	DrawDebugCircle(World, Center, Radius, Segments, Color, bPersistent, LifeTime, DepthPriority, Thickness, FVector::ForwardVector, FVector::RightVector, false);
+	DrawDebugCircle(World, Center, Radius, Segments, Color, bPersistent, LifeTime, DepthPriority, Thickness, FVector::ForwardVector, FVector::UpVector, false);
+	DrawDebugCircle(World, Center, Radius, Segments, Color, bPersistent, LifeTime, DepthPriority, Thickness, FVector::RightVector, FVector::UpVector, false);
+}
+
+void FBlackholeDebugDraw::DrawDebugCapsule(const UWorld* World, const FVector& Center, float HalfHeight, float Radius, const FQuat& Rotation, const FColor& Color,
+	bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness)
+{
+	::DrawDebugCapsule(World, Center, HalfHeight, Radius, Rotation, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+}
+
+void FBlackholeDebugDraw::DrawDebugCone(const UWorld* World, const FVector& Origin, const FVector& Direction, float Length, float AngleWidth, float AngleHeight,
+	int32 NumSides, const FColor& Color, bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness)
+{
+	::DrawDebugCone(World, Origin, Direction, Length, AngleWidth, AngleHeight, NumSides, Color, bPersistent, LifeTime, DepthPriority, Thickness);
+}
+
+void FBlackholeDebugDraw::DrawDebugString(const UWorld* World, const FVector& TextLocation, const FString& Text, AActor* TestBaseActor,
+	const FColor& TextColor, float Duration, bool bDrawShadow, float FontScale)
+{
+	::DrawDebugString(World, TextLocation, Text, TestBaseActor, TextColor, Duration, bDrawShadow, FontScale);
+}
+
+#endif // ENABLE_DRAW_DEBUG
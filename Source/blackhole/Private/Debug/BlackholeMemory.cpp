@@ -0,0 +1,279 @@
+#include "Debug/BlackholeMemory.h"
+#include "blackhole.h"
+#include "HAL/LowLevelMemStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Containers/Ticker.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectHash.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Enemy/BaseEnemy.h"
+#include "Enemy/AI/EnemyStateMachine.h"
+#include "Components/StatusEffectComponent.h"
+#include "Systems/ComboSystem.h"
+#include "Systems/ComboDetectionSubsystem.h"
+#include "Systems/ObjectPoolSubsystem.h"
+#include "UI/BlackholeHUD.h"
+#include "UI/BlackholeHUDWidget.h"
+#include "Data/ComboDataAsset.h"
+#include "Data/EnemyStatsData.h"
+
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole"), STAT_BlackholeLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole"), STAT_BlackholeSummaryLLM, STATGROUP_LLM);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole Enemies"), STAT_BlackholeEnemiesLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole Enemy AI"), STAT_BlackholeEnemyAILLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole Object Pools"), STAT_BlackholeObjectPoolsLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole Combos"), STAT_BlackholeCombosLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole Status Effects"), STAT_BlackholeStatusEffectsLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole UI"), STAT_BlackholeUILLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Blackhole Data"), STAT_BlackholeDataLLM, STATGROUP_LLMFULL);
+
+LLM_DEFINE_TAG(Blackhole, NAME_None, NAME_None, GET_STATFNAME(STAT_BlackholeLLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+LLM_DEFINE_TAG(Blackhole_Enemies, TEXT("Enemies"), TEXT("Blackhole"), GET_STATFNAME(STAT_BlackholeEnemiesLLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+LLM_DEFINE_TAG(Blackhole_EnemyAI, TEXT("EnemyAI"), TEXT("Blackhole"), GET_STATFNAME(STAT_BlackholeEnemyAILLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+LLM_DEFINE_TAG(Blackhole_ObjectPools, TEXT("ObjectPools"), TEXT("Blackhole"), GET_STATFNAME(STAT_BlackholeObjectPoolsLLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+LLM_DEFINE_TAG(Blackhole_Combos, TEXT("Combos"), TEXT("Blackhole"), GET_STATFNAME(STAT_BlackholeCombosLLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+LLM_DEFINE_TAG(Blackhole_StatusEffects, TEXT("StatusEffects"), TEXT("Blackhole"), GET_STATFNAME(STAT_BlackholeStatusEffectsLLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+LLM_DEFINE_TAG(Blackhole_UI, TEXT("UI"), TEXT("Blackhole"), GET_STATFNAME(STAT_BlackholeUILLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+LLM_DEFINE_TAG(Blackhole_Data, TEXT("Data"), TEXT("Blackhole"), GET_STATFNAME(STAT_BlackholeDataLLM), GET_STATFNAME(STAT_BlackholeSummaryLLM));
+
+FBlackholeMemorySample FBlackholeMemoryReport::HighWater[FBlackholeMemoryReport::NumCategories];
+
+namespace
+{
+	// Same measure as "obj list": the object itself, reflected containers, plus whatever the
+	// class reports through GetResourceSizeEx for memory the serializer can't see
+	uint64 MeasureObject(UObject* Object)
+	{
+		FArchiveCountMem CountMem(Object);
+		return (uint64)Object->GetClass()->GetStructureSize()
+			+ CountMem.GetMax()
+			+ Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+	}
+
+	void AddObject(FBlackholeMemorySample& Sample, UObject* Object)
+	{
+		Sample.Objects++;
+		Sample.Bytes += MeasureObject(Object);
+	}
+
+	// The object plus everything outered to it (state objects, widget trees)
+	void AddObjectAndInners(FBlackholeMemorySample& Sample, UObject* Object)
+	{
+		AddObject(Sample, Object);
+		ForEachObjectWithOuter(Object, [&Sample](UObject* Inner)
+		{
+			AddObject(Sample, Inner);
+		}, true);
+	}
+
+	UWorld* FindGameWorld()
+	{
+		if (!GEngine)
+		{
+			return nullptr;
+		}
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+			{
+				return Context.World();
+			}
+		}
+		return nullptr;
+	}
+
+	FTSTicker::FDelegateHandle SampleTickerHandle;
+
+	void OnSampleIntervalChanged(IConsoleVariable* Var)
+	{
+		if (SampleTickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(SampleTickerHandle);
+			SampleTickerHandle.Reset();
+		}
+
+		const float Interval = Var->GetFloat();
+		if (Interval > 0.0f)
+		{
+			SampleTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateLambda([](float)
+				{
+					if (UWorld* World = FindGameWorld())
+					{
+						FBlackholeMemorySample Samples[FBlackholeMemoryReport::NumCategories];
+						FBlackholeMemoryReport::Sample(World, Samples);
+					}
+					return true;
+				}),
+				Interval);
+		}
+	}
+
+	TAutoConsoleVariable<float> CVarMemReportSampleInterval(
+		TEXT("blackhole.MemReport.SampleInterval"),
+		0.0f,
+		TEXT("Seconds between background samples that update the blackhole memory high-water marks. 0 disables."),
+		FConsoleVariableDelegate::CreateStatic(&OnSampleIntervalChanged));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("blackhole.MemReport"),
+		TEXT("Logs object counts and bytes per blackhole system for the current world, with high-water marks."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld* World, FOutputDevice& Ar)
+		{
+			FBlackholeMemoryReport::Dump(World, Ar);
+		}));
+
+	FAutoConsoleCommand MemReportResetCommand(
+		TEXT("blackhole.MemReport.Reset"),
+		TEXT("Clears the blackhole memory high-water marks."),
+		FConsoleCommandDelegate::CreateStatic(&FBlackholeMemoryReport::ResetHighWater));
+}
+
+void FBlackholeMemoryReport::Sample(UWorld* World, FBlackholeMemorySample (&OutSamples)[NumCategories])
+{
+	for (FBlackholeMemorySample& Sample : OutSamples)
+	{
+		Sample = FBlackholeMemorySample();
+	}
+
+	auto Category = [&OutSamples](EBlackholeMemoryCategory InCategory) -> FBlackholeMemorySample&
+	{
+		return OutSamples[(int32)InCategory];
+	};
+
+	if (World)
+	{
+		// Enemies - components that belong to another category are counted there
+		for (TActorIterator<ABaseEnemy> It(World); It; ++It)
+		{
+			ABaseEnemy* Enemy = *It;
+			AddObject(Category(EBlackholeMemoryCategory::Enemies), Enemy);
+
+			TInlineComponentArray<UActorComponent*> Components(Enemy);
+			for (UActorComponent* Component : Components)
+			{
+				if (Component->IsA<UEnemyStateMachine>())
+				{
+					AddObjectAndInners(Category(EBlackholeMemoryCategory::EnemyAI), Component);
+				}
+				else if (!Component->IsA<UStatusEffectComponent>() && !Component->IsA<UComboSystem>())
+				{
+					AddObject(Category(EBlackholeMemoryCategory::Enemies), Component);
+				}
+			}
+		}
+
+		for (TObjectIterator<UStatusEffectComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World)
+			{
+				AddObject(Category(EBlackholeMemoryCategory::StatusEffects), *It);
+			}
+		}
+
+		for (TObjectIterator<UComboSystem> It; It; ++It)
+		{
+			if (It->GetWorld() == World)
+			{
+				AddObject(Category(EBlackholeMemoryCategory::Combos), *It);
+			}
+		}
+		if (UComboDetectionSubsystem* ComboDetection = World->GetSubsystem<UComboDetectionSubsystem>())
+		{
+			AddObject(Category(EBlackholeMemoryCategory::Combos), ComboDetection);
+		}
+
+		if (UObjectPoolSubsystem* Pools = World->GetSubsystem<UObjectPoolSubsystem>())
+		{
+			AddObject(Category(EBlackholeMemoryCategory::ObjectPools), Pools);
+
+			TArray<AActor*> PooledObjects;
+			Pools->GetPooledObjects(PooledObjects);
+			for (AActor* PooledObject : PooledObjects)
+			{
+				AddObject(Category(EBlackholeMemoryCategory::ObjectPools), PooledObject);
+			}
+		}
+
+		for (TActorIterator<ABlackholeHUD> It(World); It; ++It)
+		{
+			AddObject(Category(EBlackholeMemoryCategory::UI), *It);
+		}
+		for (TObjectIterator<UBlackholeHUDWidget> It; It; ++It)
+		{
+			if (It->GetWorld() == World)
+			{
+				AddObjectAndInners(Category(EBlackholeMemoryCategory::UI), *It);
+			}
+		}
+	}
+
+	// Data is shared between worlds
+	for (TObjectIterator<UComboDataAsset> It; It; ++It)
+	{
+		AddObject(Category(EBlackholeMemoryCategory::Data), *It);
+	}
+	for (TObjectIterator<UDataTable> It; It; ++It)
+	{
+		if (It->GetRowStruct() == FEnemyStatsData::StaticStruct())
+		{
+			AddObject(Category(EBlackholeMemoryCategory::Data), *It);
+		}
+	}
+
+	for (int32 Index = 0; Index < NumCategories; Index++)
+	{
+		HighWater[Index].Objects = FMath::Max(HighWater[Index].Objects, OutSamples[Index].Objects);
+		HighWater[Index].Bytes = FMath::Max(HighWater[Index].Bytes, OutSamples[Index].Bytes);
+	}
+}
+
+void FBlackholeMemoryReport::Dump(UWorld* World, FOutputDevice& Ar)
+{
+	FBlackholeMemorySample Samples[NumCategories];
+	Sample(World, Samples);
+
+	Ar.Logf(TEXT("Blackhole memory report for %s"), World ? *World->GetMapName() : TEXT("<no world>"));
+	Ar.Logf(TEXT("%-16s %8s %12s %10s %12s"), TEXT("System"), TEXT("Objects"), TEXT("KB"), TEXT("PeakObjs"), TEXT("PeakKB"));
+
+	FBlackholeMemorySample Total;
+	for (int32 Index = 0; Index < NumCategories; Index++)
+	{
+		Ar.Logf(TEXT("%-16s %8d %12.1f %10d %12.1f"),
+			GetCategoryName((EBlackholeMemoryCategory)Index),
+			Samples[Index].Objects, Samples[Index].Bytes / 1024.0,
+			HighWater[Index].Objects, HighWater[Index].Bytes / 1024.0);
+
+		Total.Objects += Samples[Index].Objects;
+		Total.Bytes += Samples[Index].Bytes;
+	}
+	Ar.Logf(TEXT("%-16s %8d %12.1f"), TEXT("Total"), Total.Objects, Total.Bytes / 1024.0);
+}
+
+void FBlackholeMemoryReport::ResetHighWater()
+{
+	for (FBlackholeMemorySample& Sample : HighWater)
+	{
+		Sample = FBlackholeMemorySample();
+	}
+}
+
+const TCHAR* FBlackholeMemoryReport::GetCategoryName(EBlackholeMemoryCategory Category)
+{
+	switch (Category)
+	{
+	case EBlackholeMemoryCategory::Enemies:			return TEXT("Enemies");
+	case EBlackholeMemoryCategory::EnemyAI:			return TEXT("EnemyAI");
+	case EBlackholeMemoryCategory::ObjectPools:		return TEXT("ObjectPools");
+	case EBlackholeMemoryCategory::Combos:			return TEXT("Combos");
+	case EBlackholeMemoryCategory::StatusEffects:	return TEXT("StatusEffects");
+	case EBlackholeMemoryCategory::UI:				return TEXT("UI");
+	case EBlackholeMemoryCategory::Data:			return TEXT("Data");
+	default:										return TEXT("Unknown");
+	}
+}
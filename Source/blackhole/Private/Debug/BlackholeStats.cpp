@@ -0,0 +1,19 @@
+#include "Debug/BlackholeStats.h"
+
+DEFINE_STAT(STAT_Blackhole_LOSTraces);
+DEFINE_STAT(STAT_Blackhole_HitQueries);
+DEFINE_STAT(STAT_Blackhole_MovementTraces);
+DEFINE_STAT(STAT_Blackhole_AbilityExecutions);
+DEFINE_STAT(STAT_Blackhole_ActiveEnemies);
+DEFINE_STAT(STAT_Blackhole_StatusEffectsAlive);
+DEFINE_STAT(STAT_Blackhole_UnwarmedAbilityAssets);
+
+uint32 FBlackholeFrameCounters::LOSTraces = 0;
+uint32 FBlackholeFrameCounters::HitQueries = 0;
+uint32 FBlackholeFrameCounters::MovementTraces = 0;
+
+UE_TRACE_CHANNEL_DEFINE(BlackholeAIChannel);
+UE_TRACE_CHANNEL_DEFINE(BlackholeAbilitiesChannel);
+UE_TRACE_CHANNEL_DEFINE(BlackholeMovementChannel);
+UE_TRACE_CHANNEL_DEFINE(BlackholeSystemsChannel);
+UE_TRACE_CHANNEL_DEFINE(BlackholeUIChannel);
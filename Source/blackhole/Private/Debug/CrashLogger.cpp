@@ -1,22 +1,60 @@
 #include "Debug/CrashLogger.h"
-#include "HAL/PlatformFilemanager.h"
+#include "blackhole.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/DateTime.h"
+#include "Misc/StringBuilder.h"
 #include "Engine/Engine.h"
 
 FCrashLogger* FCrashLogger::Instance = nullptr;
 
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<bool> CVarCrashCheckpointsOnScreen(
+	TEXT("blackhole.CrashCheckpoints.OnScreen"),
+	false,
+	TEXT("Echo crash checkpoints as on-screen debug messages (game thread only)."));
+#endif
+
+namespace
+{
+	FString GetCheckpointLogPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("CrashCheckpoints.log");
+	}
+}
+
 FCrashLogger::FCrashLogger()
 {
+	StartTime = FDateTime::Now();
+	StartCycles = FPlatformTime::Cycles64();
+
 	// Initialize crash logger
 	ClearLog();
-	UE_LOG(LogTemp, Warning, TEXT("CrashLogger initialized"));
+
+	FCoreDelegates::OnHandleSystemError.AddRaw(this, &FCrashLogger::OnSystemError);
+	FCoreDelegates::OnHandleSystemEnsure.AddRaw(this, &FCrashLogger::Flush);
+	FCoreDelegates::OnEnginePreExit.AddRaw(this, &FCrashLogger::OnEnginePreExit);
+
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		WriterThread = FRunnableThread::Create(this, TEXT("CrashCheckpointWriter"), 0, TPri_BelowNormal);
+	}
+
+	UE_LOG(LogBlackhole, Log, TEXT("CrashLogger initialized (%s)"), WriterThread ? TEXT("async writer") : TEXT("inline writer"));
 }
 
 FCrashLogger::~FCrashLogger()
 {
-	// Cleanup
+	OnEnginePreExit();
 }
 
 FCrashLogger& FCrashLogger::Get()
@@ -28,69 +66,283 @@ FCrashLogger& FCrashLogger::Get()
 	return *Instance;
 }
 
-void FCrashLogger::LogCheckpoint(const FString& Function, const FString& File, int32 Line, const FString& Context)
-{
-	FString LogEntry = FString::Printf(TEXT("[%s] %s:%d - %s %s\n"), 
-		*FDateTime::Now().ToString(), 
-		*Function, 
-		Line,
-		*File,
-		Context.IsEmpty() ? TEXT("") : *FString::Printf(TEXT("Context: %s"), *Context)
-	);
-	
-	// Log to console with high verbosity
-	UE_LOG(LogTemp, Warning, TEXT("CHECKPOINT: %s"), *LogEntry);
-	
-	// Also log to screen in development builds
-#if !UE_BUILD_SHIPPING
-	if (GEngine)
+FCrashLogger::FCheckpointRecord& FCrashLogger::BeginRecord(const TCHAR* Function, const TCHAR* File, int32 Line, bool bIsError, uint64& OutIndex)
+{
+	OutIndex = WriteIndex.fetch_add(1, std::memory_order_relaxed);
+	FCheckpointRecord& Record = Records[OutIndex & (RingCapacity - 1)];
+
+	// Mark the slot as being rewritten so a concurrent reader discards what it copied
+	Record.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Record.Cycles = FPlatformTime::Cycles64();
+	Record.Function = Function;
+	Record.File = File;
+	Record.Line = Line;
+	Record.ThreadId = FPlatformTLS::GetCurrentThreadId();
+	Record.bIsError = bIsError;
+	Record.Context[0] = TEXT('\0');
+	return Record;
+}
+
+void FCrashLogger::PublishRecord(FCheckpointRecord& Record, uint64 Index)
+{
+	Record.Sequence.store(Index + 1, std::memory_order_release);
+
+	if (!WriterThread && Index - ReadIndex >= RingCapacity / 2)
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Cyan, FString::Printf(TEXT("CP: %s:%d"), *Function, Line));
+		// No writer thread (e.g. -nothreading), drain in batches instead of per record
+		DrainRing();
 	}
-#endif
-	
-	// Write to crash log file
+
 #if !UE_BUILD_SHIPPING
-	FString FilePath = FPaths::ProjectSavedDir() / TEXT("CrashCheckpoints.log");
-	
-	// Append to file
-	FFileHelper::SaveStringToFile(LogEntry, *FilePath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	if (GEngine && IsInGameThread() && CVarCrashCheckpointsOnScreen.GetValueOnGameThread())
+	{
+		GEngine->AddOnScreenDebugMessage(-1, Record.bIsError ? 10.0f : 5.0f, Record.bIsError ? FColor::Red : FColor::Cyan,
+			FString::Printf(TEXT("%s: %s:%d %s"), Record.bIsError ? TEXT("ERROR") : TEXT("CP"), Record.Function, Record.Line, Record.Context));
+	}
 #endif
 }
 
-void FCrashLogger::LogError(const FString& Function, const FString& File, int32 Line, const FString& Error)
+void FCrashLogger::LogCheckpoint(const TCHAR* Function, const TCHAR* File, int32 Line, const TCHAR* Context)
+{
+	uint64 Index;
+	FCheckpointRecord& Record = BeginRecord(Function, File, Line, false, Index);
+	FCString::Strncpy(Record.Context, Context ? Context : TEXT(""), MaxContextLength + 1);
+	PublishRecord(Record, Index);
+
+	UE_LOG(LogBlackhole, Verbose, TEXT("CHECKPOINT: %s:%d %s"), Function, Line, Record.Context);
+}
+
+void FCrashLogger::LogCheckpoint(const TCHAR* Function, const TCHAR* File, int32 Line, const ANSICHAR* Context)
 {
-	FString LogEntry = FString::Printf(TEXT("[ERROR] [%s] %s:%d - %s - %s\n"), 
-		*FDateTime::Now().ToString(), 
-		*Function, 
-		Line,
-		*File,
-		*Error
-	);
-	
+	uint64 Index;
+	FCheckpointRecord& Record = BeginRecord(Function, File, Line, false, Index);
+
+	// Checkpoint messages are plain ASCII literals, so a per-character widen is enough
+	int32 Length = 0;
+	for (; Context && Context[Length] && Length < MaxContextLength; Length++)
+	{
+		Record.Context[Length] = (TCHAR)Context[Length];
+	}
+	Record.Context[Length] = TEXT('\0');
+	PublishRecord(Record, Index);
+
+	UE_LOG(LogBlackhole, Verbose, TEXT("CHECKPOINT: %s:%d %s"), Function, Line, Record.Context);
+}
+
+void FCrashLogger::LogCheckpoint(const TCHAR* Function, const TCHAR* File, int32 Line, const FString& Context)
+{
+	LogCheckpoint(Function, File, Line, *Context);
+}
+
+void FCrashLogger::LogError(const TCHAR* Function, const TCHAR* File, int32 Line, const FString& Error)
+{
+	uint64 Index;
+	FCheckpointRecord& Record = BeginRecord(Function, File, Line, true, Index);
+	FCString::Strncpy(Record.Context, *Error, MaxContextLength + 1);
+	PublishRecord(Record, Index);
+
 	// Log error with high priority
-	UE_LOG(LogTemp, Error, TEXT("CRASH_LOGGER: %s"), *LogEntry);
-	
-	// Also log to screen in development builds
-#if !UE_BUILD_SHIPPING
-	if (GEngine)
+	UE_LOG(LogBlackhole, Error, TEXT("CRASH_LOGGER: %s:%d - %s"), Function, Line, *Error);
+
+	// Errors are rare - get them to disk promptly
+	if (WakeEvent)
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, FString::Printf(TEXT("ERROR: %s - %s"), *Function, *Error));
+		WakeEvent->Trigger();
 	}
-#endif
-	
-	// Write to crash log file
-#if !UE_BUILD_SHIPPING
-	FString FilePath = FPaths::ProjectSavedDir() / TEXT("CrashCheckpoints.log");
-	FFileHelper::SaveStringToFile(LogEntry, *FilePath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
-#endif
 }
 
 void FCrashLogger::ClearLog()
 {
-#if !UE_BUILD_SHIPPING
-	FString FilePath = FPaths::ProjectSavedDir() / TEXT("CrashCheckpoints.log");
-	FString Header = FString::Printf(TEXT("=== Crash Logger Started: %s ===\n"), *FDateTime::Now().ToString());
+	FScopeLock Lock(&DrainLock);
+
+	if (LogFile)
+	{
+		delete LogFile;
+		LogFile = nullptr;
+	}
+
+	const FString FilePath = GetCheckpointLogPath();
+	const FString Header = FString::Printf(TEXT("=== Crash Logger Started: %s ===\n"), *FDateTime::Now().ToString());
 	FFileHelper::SaveStringToFile(Header, *FilePath);
-#endif
-}
\ No newline at end of file
+
+	// Keep one handle open for the lifetime of the logger instead of reopening per record
+	LogFile = IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_Append | FILEWRITE_AllowRead);
+}
+
+void FCrashLogger::Flush()
+{
+	DrainRing();
+
+	FScopeLock Lock(&DrainLock);
+	if (LogFile)
+	{
+		LogFile->Flush();
+	}
+}
+
+uint32 FCrashLogger::Run()
+{
+	while (!bStopping.load(std::memory_order_relaxed))
+	{
+		WakeEvent->Wait(FTimespan::FromMilliseconds(100));
+		DrainRing();
+	}
+
+	Flush();
+	return 0;
+}
+
+void FCrashLogger::Stop()
+{
+	bStopping.store(true, std::memory_order_relaxed);
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FCrashLogger::DrainRing()
+{
+	FScopeLock Lock(&DrainLock);
+
+	const uint64 End = WriteIndex.load(std::memory_order_acquire);
+
+	// The writer fell a full lap behind - everything older than one ring is gone
+	if (End - ReadIndex > RingCapacity)
+	{
+		DroppedRecords += End - RingCapacity - ReadIndex;
+		ReadIndex = End - RingCapacity;
+	}
+
+	while (ReadIndex < End)
+	{
+		const FCheckpointRecord& Slot = Records[ReadIndex & (RingCapacity - 1)];
+		const uint64 Published = Slot.Sequence.load(std::memory_order_acquire);
+
+		if (Published == 0 || Published < ReadIndex + 1)
+		{
+			// Claimed but not published yet; pick it up on the next pass
+			break;
+		}
+
+		if (Published > ReadIndex + 1)
+		{
+			// Overwritten by a newer record since we sampled End
+			DroppedRecords++;
+			ReadIndex++;
+			continue;
+		}
+
+		FCheckpointRecord Copy;
+		Copy.Cycles = Slot.Cycles;
+		Copy.Function = Slot.Function;
+		Copy.File = Slot.File;
+		Copy.Line = Slot.Line;
+		Copy.ThreadId = Slot.ThreadId;
+		Copy.bIsError = Slot.bIsError;
+		FMemory::Memcpy(Copy.Context, Slot.Context, sizeof(Copy.Context));
+		Copy.Context[MaxContextLength] = TEXT('\0');
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Sequence.load(std::memory_order_relaxed) != Published)
+		{
+			// A producer lapped us mid-copy
+			DroppedRecords++;
+			ReadIndex++;
+			continue;
+		}
+
+		WriteRecord(Copy);
+		ReadIndex++;
+	}
+}
+
+void FCrashLogger::WriteRecord(const FCheckpointRecord& Record)
+{
+	if (!LogFile)
+	{
+		return;
+	}
+
+	const double SecondsSinceStart = (Record.Cycles - StartCycles) * FPlatformTime::GetSecondsPerCycle64();
+	const FDateTime Timestamp = StartTime + FTimespan::FromSeconds(SecondsSinceStart);
+
+	TStringBuilder<512> Line;
+	if (DroppedRecords > 0)
+	{
+		Line.Appendf(TEXT("[WARNING] %llu checkpoints dropped (writer fell behind)\n"), DroppedRecords);
+		DroppedRecords = 0;
+	}
+
+	Line.Appendf(TEXT("%s[%s] [T%u] %s:%d - %s"),
+		Record.bIsError ? TEXT("[ERROR] ") : TEXT(""),
+		*Timestamp.ToString(TEXT("%Y.%m.%d-%H.%M.%S.%s")),
+		Record.ThreadId,
+		Record.Function,
+		Record.Line,
+		Record.File);
+
+	if (Record.Context[0] != TEXT('\0'))
+	{
+		Line.Appendf(TEXT(" %s: %s"), Record.bIsError ? TEXT("Error") : TEXT("Context"), Record.Context);
+	}
+	Line.AppendChar(TEXT('\n'));
+
+	const FTCHARToUTF8 Utf8(Line.ToString(), Line.Len());
+	LogFile->Serialize((void*)Utf8.Get(), Utf8.Length());
+}
+
+void FCrashLogger::OnSystemError()
+{
+	// The writer thread may be frozen mid-drain by the crash, so never block on it
+	if (DrainLock.TryLock())
+	{
+		DrainLock.Unlock();
+		Flush();
+		return;
+	}
+
+	// Fall back to the main log, which the crash reporter collects
+	const uint64 End = WriteIndex.load(std::memory_order_acquire);
+	const uint64 Begin = End > 32 ? End - 32 : 0;
+	UE_LOG(LogBlackhole, Error, TEXT("CrashLogger: writer busy at crash, last checkpoints:"));
+	for (uint64 Index = Begin; Index < End; Index++)
+	{
+		const FCheckpointRecord& Slot = Records[Index & (RingCapacity - 1)];
+		if (Slot.Sequence.load(std::memory_order_acquire) == Index + 1)
+		{
+			UE_LOG(LogBlackhole, Error, TEXT("  %s:%d %s"), Slot.Function, Slot.Line, Slot.Context);
+		}
+	}
+}
+
+void FCrashLogger::OnEnginePreExit()
+{
+	FCoreDelegates::OnHandleSystemError.RemoveAll(this);
+	FCoreDelegates::OnHandleSystemEnsure.RemoveAll(this);
+	FCoreDelegates::OnEnginePreExit.RemoveAll(this);
+
+	if (WriterThread)
+	{
+		// Kill(true) calls Stop() and waits for Run() to drain and return
+		WriterThread->Kill(true);
+		delete WriterThread;
+		WriterThread = nullptr;
+	}
+	else
+	{
+		Flush();
+	}
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	FScopeLock Lock(&DrainLock);
+	delete LogFile;
+	LogFile = nullptr;
+}
@@ -1,4 +1,5 @@
 #include "Enemy/AI/AgileEnemyStateMachine.h"
+#include "blackhole.h"
 #include "Enemy/AI/States/IdleState.h"
 #include "Enemy/AI/States/AlertState.h"
 #include "Enemy/AI/States/AgileChaseState.h"
@@ -8,34 +9,34 @@
 
 void UAgileEnemyStateMachine::BeginPlay()
 {
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: BeginPlay started"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: BeginPlay started"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
     
     Super::BeginPlay();
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: Setting up parameters"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: Setting up parameters"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
     SetupAgileParameters();
     
     // Initialize immediately - BaseEnemy has already set the target in its BeginPlay
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: Calling Initialize immediately"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: Calling Initialize immediately"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
     Initialize();
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: BeginPlay complete"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: BeginPlay complete"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
 }
 
 void UAgileEnemyStateMachine::InitializeStates()
 {
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: InitializeStates called"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: InitializeStates called"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
     CreateDefaultStates();
 }
 
 void UAgileEnemyStateMachine::CreateDefaultStates()
 {
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: CreateDefaultStates started"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: CreateDefaultStates started"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
     
     // Create states
@@ -45,7 +46,7 @@ void UAgileEnemyStateMachine::CreateDefaultStates()
     UAgileCombatState* CombatState = NewObject<UAgileCombatState>(this, UAgileCombatState::StaticClass());
     // No retreat state for agile enemies - they never retreat
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: States created, now registering"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: States created, now registering"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
     
     // Register states
@@ -55,7 +56,7 @@ void UAgileEnemyStateMachine::CreateDefaultStates()
     RegisterState(EEnemyState::Combat, CombatState);
     // No retreat state registered - agile enemies fight to the death
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s AgileStateMachine: All states registered"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AgileStateMachine: All states registered"), 
     //     GetOwner() ? *GetOwner()->GetName() : TEXT("NoOwner"));
     
     // Agile enemies don't use defensive state - they dodge instead
@@ -1,4 +1,5 @@
 #include "Enemy/AI/BlackholeAIController.h"
+#include "blackhole.h"
 #include "Enemy/BaseEnemy.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -27,7 +28,7 @@ void ABlackholeAIController::OnPossess(APawn* InPawn)
     // Configure movement for possessed enemy
     if (ABaseEnemy* Enemy = Cast<ABaseEnemy>(InPawn))
     {
-        // UE_LOG(LogTemp, Warning, TEXT("AIController possessed enemy: %s"), *Enemy->GetName());
+        // UE_LOG(LogBlackholeAI, Warning, TEXT("AIController possessed enemy: %s"), *Enemy->GetName());
     }
 }
 
@@ -49,7 +50,7 @@ void ABlackholeAIController::ConfigureMovement()
             MovementComp->RotationRate = FRotator(0.0f, 360.0f, 0.0f);
             
             // Log current movement settings
-            // UE_LOG(LogTemp, Warning, TEXT("%s AIController: Movement configured - MaxWalkSpeed: %.0f, MovementMode: %d"),
+            // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AIController: Movement configured - MaxWalkSpeed: %.0f, MovementMode: %d"),
             //     *Enemy->GetName(),
             //     MovementComp->MaxWalkSpeed,
             //     (int32)MovementComp->MovementMode);
@@ -58,12 +59,12 @@ void ABlackholeAIController::ConfigureMovement()
             if (MovementComp->MovementMode != MOVE_Walking)
             {
                 MovementComp->SetMovementMode(MOVE_Walking);
-                // UE_LOG(LogTemp, Warning, TEXT("%s AIController: Setting movement mode to Walking"), *Enemy->GetName());
+                // UE_LOG(LogBlackholeAI, Warning, TEXT("%s AIController: Setting movement mode to Walking"), *Enemy->GetName());
             }
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("%s AIController: No movement component found!"), *Enemy->GetName());
+            UE_LOG(LogBlackholeAI, Error, TEXT("%s AIController: No movement component found!"), *Enemy->GetName());
         }
     }
 }
\ No newline at end of file
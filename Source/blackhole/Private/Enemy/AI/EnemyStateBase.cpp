@@ -1,10 +1,11 @@
 #include "Enemy/AI/EnemyStateBase.h"
+#include "blackhole.h"
 #include "Enemy/BaseEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Player/BlackholePlayerCharacter.h"
+#include "Systems/EnemyPerceptionSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
 
 UEnemyStateBase::UEnemyStateBase()
 {
@@ -13,14 +14,14 @@ UEnemyStateBase::UEnemyStateBase()
 void UEnemyStateBase::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
     TimeInState = 0.0f;
-    // UE_LOG(LogTemp, Warning, TEXT("%s: Entered %s state"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Entered %s state"), 
     //     Enemy ? *Enemy->GetName() : TEXT("Unknown"), 
     //     *UEnum::GetValueAsString(GetStateType()));
 }
 
 void UEnemyStateBase::Exit(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
-    // UE_LOG(LogTemp, Warning, TEXT("%s: Exited %s state (Duration: %.2fs)"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Exited %s state (Duration: %.2fs)"), 
     //     Enemy ? *Enemy->GetName() : TEXT("Unknown"), 
     //     *UEnum::GetValueAsString(GetStateType()),
     //     TimeInState);
@@ -35,31 +36,32 @@ bool UEnemyStateBase::IsPlayerInRange(ABaseEnemy* Enemy, float Range) const
 {
     if (!Enemy) 
     {
-        UE_LOG(LogTemp, Error, TEXT("IsPlayerInRange: Enemy is NULL!"));
+        UE_LOG(LogBlackholeAI, Error, TEXT("IsPlayerInRange: Enemy is NULL!"));
         return false;
     }
     
     // Get the state machine's target instead of enemy's target
-    UEnemyStateMachine* StateMachine = Enemy->FindComponentByClass<UEnemyStateMachine>();
+    UEnemyStateMachine* StateMachine = Enemy->GetStateMachine();
     if (!StateMachine) 
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: IsPlayerInRange: No StateMachine component found!"), *Enemy->GetName());
+        UE_LOG(LogBlackholeAI, Error, TEXT("%s: IsPlayerInRange: No StateMachine component found!"), *Enemy->GetName());
         return false;
     }
     
     AActor* Target = StateMachine->GetTarget();
     if (!Target) 
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("%s: IsPlayerInRange: No target set in StateMachine!"), *Enemy->GetName());
+        UE_LOG(LogBlackholeAI, VeryVerbose, TEXT("%s: IsPlayerInRange: No target set in StateMachine!"), *Enemy->GetName());
         return false;
     }
     
-    float Distance = FVector::Dist(Enemy->GetActorLocation(), Target->GetActorLocation());
+    const FEnemyPerception* Perception = StateMachine->GetPerception();
+    float Distance = Perception ? Perception->Distance : FVector::Dist(Enemy->GetActorLocation(), Target->GetActorLocation());
     
     bool bInRange = Distance <= Range;
     
     // Always log range check results
-    // UE_LOG(LogTemp, Verbose, TEXT("%s: IsPlayerInRange - Distance: %.0f, Range: %.0f, InRange: %s"),
+    // UE_LOG(LogBlackholeAI, Verbose, TEXT("%s: IsPlayerInRange - Distance: %.0f, Range: %.0f, InRange: %s"),
     //     *Enemy->GetName(), Distance, Range, bInRange ? TEXT("YES") : TEXT("NO"));
     
     // Debug message removed - player range check
@@ -71,7 +73,7 @@ bool UEnemyStateBase::HasLineOfSightToPlayer(ABaseEnemy* Enemy) const
 {
     if (!Enemy) return false;
     
-    UEnemyStateMachine* StateMachine = Enemy->FindComponentByClass<UEnemyStateMachine>();
+    UEnemyStateMachine* StateMachine = Enemy->GetStateMachine();
     return StateMachine ? StateMachine->HasLineOfSight() : false;
 }
 
@@ -80,15 +82,45 @@ float UEnemyStateBase::GetDistanceToPlayer(ABaseEnemy* Enemy) const
     if (!Enemy) return MAX_FLT;
     
     // Get the state machine's target instead of enemy's target
-    UEnemyStateMachine* StateMachine = Enemy->FindComponentByClass<UEnemyStateMachine>();
+    UEnemyStateMachine* StateMachine = Enemy->GetStateMachine();
     if (!StateMachine) return MAX_FLT;
     
     AActor* Target = StateMachine->GetTarget();
     if (!Target) return MAX_FLT;
     
+    if (const FEnemyPerception* Perception = StateMachine->GetPerception())
+    {
+        return Perception->Distance;
+    }
+    
     return FVector::Dist(Enemy->GetActorLocation(), Target->GetActorLocation());
 }
 
+EEnemyRangeBand UEnemyStateBase::GetRangeBand(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine) const
+{
+    if (!StateMachine) return EEnemyRangeBand::Beyond;
+    
+    if (const FEnemyPerception* Perception = StateMachine->GetPerception())
+    {
+        return Perception->RangeBand;
+    }
+    
+    const FEnemyAIParameters& Params = StateMachine->GetAIParameters();
+    return UEnemyPerceptionSubsystem::ClassifyRange(GetDistanceToPlayer(Enemy), Params.AttackRange, Params.ChaseRange, Params.SightRange);
+}
+
+FVector UEnemyStateBase::GetDirectionToPlayer(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine) const
+{
+    if (!Enemy || !StateMachine || !StateMachine->GetTarget()) return FVector::ZeroVector;
+    
+    if (const FEnemyPerception* Perception = StateMachine->GetPerception())
+    {
+        return Perception->ToPlayer;
+    }
+    
+    return (StateMachine->GetTarget()->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal();
+}
+
 float UEnemyStateBase::GetHealthPercent(ABaseEnemy* Enemy) const
 {
     if (!Enemy) return 0.0f;
@@ -104,7 +136,7 @@ bool UEnemyStateBase::IsAbilityOnCooldown(ABaseEnemy* Enemy, const FString& Abil
 {
     if (!Enemy) return true;
     
-    UEnemyStateMachine* StateMachine = Enemy->FindComponentByClass<UEnemyStateMachine>();
+    UEnemyStateMachine* StateMachine = Enemy->GetStateMachine();
     return StateMachine ? StateMachine->IsCooldownActive(AbilityName) : true;
 }
 
@@ -112,7 +144,7 @@ void UEnemyStateBase::StartAbilityCooldown(ABaseEnemy* Enemy, const FString& Abi
 {
     if (!Enemy) return;
     
-    UEnemyStateMachine* StateMachine = Enemy->FindComponentByClass<UEnemyStateMachine>();
+    UEnemyStateMachine* StateMachine = Enemy->GetStateMachine();
     if (StateMachine)
     {
         StateMachine->StartCooldown(AbilityName, Duration);
@@ -126,10 +158,8 @@ void UEnemyStateBase::RotateTowardsTarget(ABaseEnemy* Enemy, UEnemyStateMachine*
     AActor* Target = StateMachine->GetTarget();
     if (!Target) return;
     
-    // Get direction to target
-    FVector DirectionToTarget = Target->GetActorLocation() - Enemy->GetActorLocation();
-    DirectionToTarget.Z = 0.0f; // Keep rotation on horizontal plane
-    DirectionToTarget.Normalize();
+    // Get direction to target, kept on the horizontal plane
+    FVector DirectionToTarget = GetDirectionToPlayer(Enemy, StateMachine).GetSafeNormal2D();
     
     // Get desired rotation
     FRotator DesiredRotation = DirectionToTarget.Rotation();
@@ -142,7 +172,7 @@ void UEnemyStateBase::RotateTowardsTarget(ABaseEnemy* Enemy, UEnemyStateMachine*
     float YawDiff = FMath::Abs(FMath::FindDeltaAngleDegrees(CurrentRotation.Yaw, DesiredRotation.Yaw));
     if (YawDiff > 1.0f) // Only log if there's meaningful rotation needed
     {
-        // UE_LOG(LogTemp, VeryVerbose, TEXT("%s: Rotating - Current: %.1f, Desired: %.1f, New: %.1f, Speed: %.1f"),
+        // UE_LOG(LogBlackholeAI, VeryVerbose, TEXT("%s: Rotating - Current: %.1f, Desired: %.1f, New: %.1f, Speed: %.1f"),
         //     *Enemy->GetName(),
         //     CurrentRotation.Yaw,
         //     DesiredRotation.Yaw,
@@ -1,11 +1,15 @@
 #include "Enemy/AI/EnemyStateMachine.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
 #include "Enemy/AI/EnemyStateBase.h"
 #include "Enemy/AI/EnemyStates.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
+#include "Systems/EnemyPerceptionSubsystem.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 
 UEnemyStateMachine::UEnemyStateMachine()
@@ -24,11 +28,11 @@ void UEnemyStateMachine::BeginPlay()
     OwnerEnemy = Cast<ABaseEnemy>(GetOwner());
     if (!OwnerEnemy)
     {
-        UE_LOG(LogTemp, Error, TEXT("EnemyStateMachine: No valid BaseEnemy owner!"));
+        UE_LOG(LogBlackholeAI, Error, TEXT("EnemyStateMachine: No valid BaseEnemy owner!"));
         return;
     }
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s StateMachine: BeginPlay - Owner set"), *OwnerEnemy->GetName());
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s StateMachine: BeginPlay - Owner set"), *OwnerEnemy->GetName());
     
     // Don't initialize here - let derived classes do it after setting parameters
     // InitializeStates();
@@ -37,7 +41,13 @@ void UEnemyStateMachine::BeginPlay()
     if (GetWorld())
     {
         GetWorld()->GetTimerManager().SetTimer(LineOfSightTimer, this, &UEnemyStateMachine::CheckLineOfSight, 0.2f, true);
-        // UE_LOG(LogTemp, Warning, TEXT("%s StateMachine: Line of sight timer started"), *OwnerEnemy->GetName());
+        // UE_LOG(LogBlackholeAI, Warning, TEXT("%s StateMachine: Line of sight timer started"), *OwnerEnemy->GetName());
+        
+        PerceptionSubsystem = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>();
+        if (PerceptionSubsystem)
+        {
+            PerceptionHandle = PerceptionSubsystem->RegisterEnemy(this);
+        }
     }
     
     // Don't enter initial state here - do it after states are created
@@ -53,6 +63,9 @@ void UEnemyStateMachine::EndPlay(const EEndPlayReason::Type EndPlayReason)
         GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
     }
     
+    UnregisterPerception();
+    PerceptionSubsystem = nullptr;
+    
     // Clean up current state
     if (CurrentStateObject)
     {
@@ -80,6 +93,8 @@ void UEnemyStateMachine::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void UEnemyStateMachine::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Enemy State Machine Tick", STAT_Blackhole_EnemyStateMachineTick, BlackholeAIChannel);
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     // Safety check - don't tick if not initialized
@@ -95,7 +110,7 @@ void UEnemyStateMachine::TickComponent(float DeltaTime, ELevelTick TickType, FAc
     {
         if (!OwnerEnemy)
         {
-            UE_LOG(LogTemp, Error, TEXT("StateMachine: No owner enemy in tick!"));
+            UE_LOG(LogBlackholeAI, Error, TEXT("StateMachine: No owner enemy in tick!"));
         }
         if (!CurrentStateObject)
         {
@@ -105,20 +120,20 @@ void UEnemyStateMachine::TickComponent(float DeltaTime, ELevelTick TickType, FAc
                 return;
             }
             
-            UE_LOG(LogTemp, Error, TEXT("StateMachine: No current state object in tick! Initialized: %s"),
+            UE_LOG(LogBlackholeAI, Error, TEXT("StateMachine: No current state object in tick! Initialized: %s"),
                 bIsInitialized ? TEXT("Yes") : TEXT("No"));
             
             // Try to recover by re-entering current state if we have states
             if (States.Contains(CurrentState))
             {
-                UE_LOG(LogTemp, Warning, TEXT("StateMachine: Attempting to recover by re-entering state %s"),
+                UE_LOG(LogBlackholeAI, Warning, TEXT("StateMachine: Attempting to recover by re-entering state %s"),
                     *UEnum::GetValueAsString(CurrentState));
                 EnterState(CurrentState);
                 
                 // If still no state object, something is very wrong
                 if (!CurrentStateObject)
                 {
-                    UE_LOG(LogTemp, Error, TEXT("StateMachine: Recovery failed - disabling tick"));
+                    UE_LOG(LogBlackholeAI, Error, TEXT("StateMachine: Recovery failed - disabling tick"));
                     SetComponentTickEnabled(false);
                 }
             }
@@ -126,13 +141,14 @@ void UEnemyStateMachine::TickComponent(float DeltaTime, ELevelTick TickType, FAc
         return;
     }
     
-    // Auto-acquire target if we don't have one
+    // Auto-acquire target if we don't have one - the perception step already looked the player up
     if (!Target && GetWorld())
     {
-        if (AActor* PlayerActor = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0))
+        AActor* PlayerActor = PerceptionSubsystem ? PerceptionSubsystem->GetPlayer() : UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+        if (PlayerActor)
         {
             SetTarget(PlayerActor);
-            // UE_LOG(LogTemp, Warning, TEXT("%s: Auto-acquired player target in TickComponent"), *GetName());
+            // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Auto-acquired player target in TickComponent"), *GetName());
         }
     }
     
@@ -158,27 +174,30 @@ void UEnemyStateMachine::InitializeStates()
 
 void UEnemyStateMachine::Initialize()
 {
-    // UE_LOG(LogTemp, Warning, TEXT("%s: Initializing state machine"), *GetName());
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Initializing state machine"), *GetName());
     
     // This should be called by derived classes after they've set up their parameters
-    InitializeStates();
+    {
+        BLACKHOLE_LLM_SCOPE(EnemyAI);
+        InitializeStates();
+    }
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s: %d states registered"), *GetName(), States.Num());
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: %d states registered"), *GetName(), States.Num());
     
     // Log target status
     if (Target)
     {
-        // UE_LOG(LogTemp, Warning, TEXT("%s: Target is set: %s"), *GetName(), *Target->GetName());
+        // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Target is set: %s"), *GetName(), *Target->GetName());
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: No target set during initialization!"), *GetName());
+        UE_LOG(LogBlackholeAI, Error, TEXT("%s: No target set during initialization!"), *GetName());
     }
     
     // Now enter the initial state
     if (States.Contains(CurrentState))
     {
-        // UE_LOG(LogTemp, Warning, TEXT("%s: Entering initial state %s"), 
+        // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Entering initial state %s"), 
         //     *GetName(), 
         //     *UEnum::GetValueAsString(CurrentState));
         EnterState(CurrentState);
@@ -188,16 +207,16 @@ void UEnemyStateMachine::Initialize()
         {
             bIsInitialized = true;
             SetComponentTickEnabled(true); // Enable tick only after successful initialization
-            // UE_LOG(LogTemp, Warning, TEXT("%s: State machine initialization complete - tick enabled"), *GetName());
+            // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: State machine initialization complete - tick enabled"), *GetName());
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("%s: Failed to set current state object!"), *GetName());
+            UE_LOG(LogBlackholeAI, Error, TEXT("%s: Failed to set current state object!"), *GetName());
         }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: No state registered for initial state %s! States registered: %d"),
+        UE_LOG(LogBlackholeAI, Error, TEXT("%s: No state registered for initial state %s! States registered: %d"),
             *GetName(),
             *UEnum::GetValueAsString(CurrentState),
             States.Num());
@@ -205,11 +224,36 @@ void UEnemyStateMachine::Initialize()
         // Log all registered states
         for (const auto& StatePair : States)
         {
-            UE_LOG(LogTemp, Error, TEXT("  - %s"), *UEnum::GetValueAsString(StatePair.Key));
+            UE_LOG(LogBlackholeAI, Error, TEXT("  - %s"), *UEnum::GetValueAsString(StatePair.Key));
         }
     }
 }
 
+void UEnemyStateMachine::ResetForRestart(AActor* NewTarget)
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearAllTimersForObject(this);
+        World->GetTimerManager().SetTimer(LineOfSightTimer, this, &UEnemyStateMachine::CheckLineOfSight, 0.2f, true);
+    }
+    
+    // The Dead state unregisters from the shared perception step
+    if (PerceptionSubsystem && PerceptionHandle == INDEX_NONE)
+    {
+        PerceptionHandle = PerceptionSubsystem->RegisterEnemy(this);
+    }
+    
+    ActiveCooldowns.Empty();
+    bHasLineOfSight = false;
+    SetTarget(NewTarget);
+    
+    if (bIsInitialized)
+    {
+        ForceState(EEnemyState::Idle);
+        SetComponentTickEnabled(true);
+    }
+}
+
 void UEnemyStateMachine::CreateDefaultStates()
 {
     // This will be overridden by specific enemy types
@@ -220,21 +264,21 @@ void UEnemyStateMachine::RegisterState(EEnemyState StateType, UEnemyStateBase* S
 {
     if (!StateObject) 
     {
-        UE_LOG(LogTemp, Error, TEXT("RegisterState: Null state object for %s"), *UEnum::GetValueAsString(StateType));
+        UE_LOG(LogBlackholeAI, Error, TEXT("RegisterState: Null state object for %s"), *UEnum::GetValueAsString(StateType));
         return;
     }
     
     // Check if state object is valid
     if (!IsValid(StateObject))
     {
-        UE_LOG(LogTemp, Error, TEXT("RegisterState: Invalid state object for %s"), *UEnum::GetValueAsString(StateType));
+        UE_LOG(LogBlackholeAI, Error, TEXT("RegisterState: Invalid state object for %s"), *UEnum::GetValueAsString(StateType));
         return;
     }
     
     StateObject->AddToRoot(); // Prevent garbage collection
     States.Add(StateType, StateObject);
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s: Registered state %s (Object: %s)"), 
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Registered state %s (Object: %s)"), 
     //     *GetName(), 
     //     *UEnum::GetValueAsString(StateType),
     //     *StateObject->GetName());
@@ -252,7 +296,7 @@ void UEnemyStateMachine::ChangeState(EEnemyState NewState)
     
     if (!CanTransitionTo(NewState))
     {
-        UE_LOG(LogTemp, Warning, TEXT("%s: Cannot transition from %s to %s"),
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Cannot transition from %s to %s"),
             *OwnerEnemy->GetName(),
             *UEnum::GetValueAsString(CurrentState),
             *UEnum::GetValueAsString(NewState));
@@ -279,8 +323,9 @@ void UEnemyStateMachine::ChangeState(EEnemyState NewState)
         
         // Clear target reference
         Target = nullptr;
+        UnregisterPerception();
         
-        UE_LOG(LogTemp, Warning, TEXT("%s: Entered Dead state - all functionality disabled"), *OwnerEnemy->GetName());
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Entered Dead state - all functionality disabled"), *OwnerEnemy->GetName());
     }
     else
     {
@@ -309,14 +354,14 @@ void UEnemyStateMachine::EnterState(EEnemyState NewState)
         CurrentStateObject = *StatePtr;
         CurrentStateObject->Enter(OwnerEnemy, this);
         
-        // UE_LOG(LogTemp, Verbose, TEXT("%s: Entered state %s - CurrentStateObject set to %s"),
+        // UE_LOG(LogBlackholeAI, Verbose, TEXT("%s: Entered state %s - CurrentStateObject set to %s"),
         //     OwnerEnemy ? *OwnerEnemy->GetName() : TEXT("NoOwner"),
         //     *UEnum::GetValueAsString(NewState),
         //     *CurrentStateObject->GetName());
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: No state object for %s! Available states: %d"),
+        UE_LOG(LogBlackholeAI, Error, TEXT("%s: No state object for %s! Available states: %d"),
             OwnerEnemy ? *OwnerEnemy->GetName() : TEXT("NoOwner"),
             *UEnum::GetValueAsString(NewState),
             States.Num());
@@ -347,7 +392,7 @@ void UEnemyStateMachine::SetTarget(AActor* NewTarget)
     if (Target)
     {
         UpdateLastKnownTargetLocation();
-        // UE_LOG(LogTemp, Warning, TEXT("%s StateMachine: Target set to %s"), 
+        // UE_LOG(LogBlackholeAI, Warning, TEXT("%s StateMachine: Target set to %s"), 
         //     OwnerEnemy ? *OwnerEnemy->GetName() : TEXT("NoOwner"), 
         //     *Target->GetName());
             
@@ -355,14 +400,14 @@ void UEnemyStateMachine::SetTarget(AActor* NewTarget)
         // Force a state update
         if (CurrentStateObject && CurrentState == EEnemyState::Idle)
         {
-            // UE_LOG(LogTemp, Warning, TEXT("%s StateMachine: Forcing idle state update after target set"), 
+            // UE_LOG(LogBlackholeAI, Warning, TEXT("%s StateMachine: Forcing idle state update after target set"), 
             //     *OwnerEnemy->GetName());
             // No need to change state, just let the next update handle it
         }
     }
     else
     {
-        // UE_LOG(LogTemp, Warning, TEXT("%s StateMachine: Target cleared"), 
+        // UE_LOG(LogBlackholeAI, Warning, TEXT("%s StateMachine: Target cleared"), 
         //     OwnerEnemy ? *OwnerEnemy->GetName() : TEXT("NoOwner"));
     }
 }
@@ -375,12 +420,39 @@ void UEnemyStateMachine::UpdateLastKnownTargetLocation()
     }
 }
 
+const FEnemyPerception* UEnemyStateMachine::GetPerception() const
+{
+    if (!PerceptionSubsystem || !Target)
+    {
+        return nullptr;
+    }
+    
+    // Results are relative to the player; other targets go through the direct queries
+    if (Target != PerceptionSubsystem->GetPlayer())
+    {
+        return nullptr;
+    }
+    
+    return PerceptionSubsystem->GetPerception(PerceptionHandle);
+}
+
+void UEnemyStateMachine::UnregisterPerception()
+{
+    if (PerceptionSubsystem && PerceptionHandle != INDEX_NONE)
+    {
+        PerceptionSubsystem->UnregisterEnemy(PerceptionHandle);
+    }
+    PerceptionHandle = INDEX_NONE;
+}
+
 void UEnemyStateMachine::CheckLineOfSight()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Enemy LOS Check", STAT_Blackhole_EnemyLOSCheck, BlackholeAIChannel);
+
     if (!OwnerEnemy || !Target) 
     {
         bHasLineOfSight = false;
-        UE_LOG(LogTemp, VeryVerbose, TEXT("%s: CheckLineOfSight - No owner or target"),
+        UE_LOG(LogBlackholeAI, VeryVerbose, TEXT("%s: CheckLineOfSight - No owner or target"),
             OwnerEnemy ? *OwnerEnemy->GetName() : TEXT("NoOwner"));
         return;
     }
@@ -407,6 +479,7 @@ void UEnemyStateMachine::CheckLineOfSight()
     
     for (const FVector& End : TargetPositions)
     {
+        BLACKHOLE_COUNT_QUERY(LOSTraces);
         bool bHit = GetWorld()->LineTraceSingleByChannel(
             HitResult,
             Start,
@@ -427,13 +500,13 @@ void UEnemyStateMachine::CheckLineOfSight()
     if (GetWorld())
     {
         FColor LineColor = bHasLineOfSight ? FColor::Green : FColor::Red;
-        DrawDebugLine(GetWorld(), Start, SuccessfulTargetPos, LineColor, false, 0.2f, 0, 1.0f);
+        BLACKHOLE_DEBUG_DRAW(AI_LOS, DrawDebugLine(GetWorld(), Start, SuccessfulTargetPos, LineColor, false, 0.2f, 0, 1.0f));
         
         // Always log line of sight status
         static int LOSCounter = 0;
         if (LOSCounter++ % 5 == 0) // Log every second (5 * 0.2s)
         {
-            // UE_LOG(LogTemp, Warning, TEXT("%s: Line of sight to %s: %s (Distance: %.0f)"),
+            // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Line of sight to %s: %s (Distance: %.0f)"),
             //     *OwnerEnemy->GetName(), 
             //     *Target->GetName(),
             //     bHasLineOfSight ? TEXT("YES") : TEXT("NO"),
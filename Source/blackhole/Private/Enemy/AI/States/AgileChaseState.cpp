@@ -1,4 +1,5 @@
 #include "Enemy/AI/States/AgileChaseState.h"
+#include "blackhole.h"
 #include "Enemy/AgileEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "AIController.h"
@@ -10,7 +11,7 @@ void UAgileChaseState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine
     // Don't call parent - we handle everything custom
     TimeInState = 0.0f;
     
-    // UE_LOG(LogTemp, Warning, TEXT("Agile Enemy: Entering CUSTOM chase state - will maintain distance"));
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Enemy: Entering CUSTOM chase state - will maintain distance"));
 }
 
 void UAgileChaseState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, float DeltaTime)
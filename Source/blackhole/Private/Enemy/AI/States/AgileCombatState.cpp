@@ -1,8 +1,10 @@
 #include "Enemy/AI/States/AgileCombatState.h"
+#include "blackhole.h"
 #include "Enemy/AgileEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Components/Abilities/Enemy/SmashAbilityComponent.h"
 #include "Components/Abilities/Enemy/DodgeComponent.h"
+#include "Components/Movement/ForcedMovement.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AIController.h"
 #include "Engine/World.h"
@@ -11,6 +13,7 @@
 #include "Engine/Engine.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "Player/BlackholePlayerCharacter.h"
+#include "Systems/EnemyPerceptionSubsystem.h"
 
 void UAgileCombatState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
@@ -21,7 +24,7 @@ void UAgileCombatState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachin
     bHasExecutedBackstab = false;
     TimeInCurrentPhase = 0.0f;
     
-    // UE_LOG(LogTemp, Warning, TEXT("Agile Enemy: Entering combat - starting assassin approach"));
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Enemy: Entering combat - starting assassin approach"));
 }
 
 void UAgileCombatState::Exit(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
@@ -91,7 +94,7 @@ void UAgileCombatState::ExecuteDodgeManeuver(ABaseEnemy* Enemy, UEnemyStateMachi
         // After dodge, position for counter attack
         if (StateMachine && StateMachine->GetTarget())
         {
-            FVector ToTarget = (StateMachine->GetTarget()->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal();
+            FVector ToTarget = GetDirectionToPlayer(Enemy, StateMachine);
             FVector DodgeDirection = FVector::CrossProduct(ToTarget, FVector::UpVector);
             
             // Randomly dodge left or right
@@ -114,16 +117,27 @@ void UAgileCombatState::ExecuteDashAttack(ABaseEnemy* Enemy, UEnemyStateMachine*
     if (!StateMachine || !StateMachine->GetTarget()) return;
     
     AActor* Target = StateMachine->GetTarget();
-    FVector TargetLocation = Target->GetActorLocation();
-    FVector EnemyLocation = Enemy->GetActorLocation();
+    FVector TargetLocation;
+    FVector EnemyLocation;
     
     // Get target's velocity for prediction
     FVector TargetVelocity = FVector::ZeroVector;
-    if (APawn* TargetPawn = Cast<APawn>(Target))
+    if (const FEnemyPerception* Perception = StateMachine->GetPerception())
     {
-        if (UMovementComponent* MovComp = TargetPawn->GetMovementComponent())
+        TargetLocation = Perception->PlayerLocation;
+        EnemyLocation = Perception->EnemyLocation;
+        TargetVelocity = Perception->PlayerVelocity;
+    }
+    else
+    {
+        TargetLocation = Target->GetActorLocation();
+        EnemyLocation = Enemy->GetActorLocation();
+        if (APawn* TargetPawn = Cast<APawn>(Target))
         {
-            TargetVelocity = MovComp->Velocity;
+            if (UMovementComponent* MovComp = TargetPawn->GetMovementComponent())
+            {
+                TargetVelocity = MovComp->Velocity;
+            }
         }
     }
     
@@ -151,13 +165,13 @@ void UAgileCombatState::ExecuteDashAttack(ABaseEnemy* Enemy, UEnemyStateMachine*
         // Stop current movement first to ensure clean dash
         Movement->StopMovementImmediately();
         
-        // Calculate dash force based on distance
+        // Calculate dash speed based on distance
         float DashForce = FMath::Clamp(DashDistance * 10.0f, 3000.0f, 5000.0f);
         
-        // Fast dash through and past the player
-        Movement->AddImpulse(DirectionToTarget * DashForce, true);
+        // Fast dash through and past the player, run by CharacterMovement so it ends at DashTarget
+        FForcedMovement::ApplyDash(Enemy, DashTarget, DashDistance / DashForce);
         
-        // UE_LOG(LogTemp, Warning, TEXT("Assassin Approach: Dashing %.0f units to get behind player"), DashDistance);
+        // UE_LOG(LogBlackholeAI, Warning, TEXT("Assassin Approach: Dashing %.0f units to get behind player"), DashDistance);
         
         // Schedule attack at end of dash
         if (Enemy->GetWorld())
@@ -205,10 +219,10 @@ void UAgileCombatState::ExecuteDashAttack(ABaseEnemy* Enemy, UEnemyStateMachine*
                         {
                             float StaggerDuration = AgileEnemy ? AgileEnemy->BackstabStaggerDuration : 1.5f;
                             Player->ApplyStagger(StaggerDuration);
-                            // UE_LOG(LogTemp, Warning, TEXT("Agile Backstab: Applied %.1fs stagger to player"), StaggerDuration);
+                            // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Backstab: Applied %.1fs stagger to player"), StaggerDuration);
                         }
                         
-                        // UE_LOG(LogTemp, Warning, TEXT("Agile DashAttack: Executed backstab! Base: %.0f -> Backstab: %.0f damage (x%.1f)"), OriginalDamage, OriginalDamage * DamageMultiplier, DamageMultiplier);
+                        // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile DashAttack: Executed backstab! Base: %.0f -> Backstab: %.0f damage (x%.1f)"), OriginalDamage, OriginalDamage * DamageMultiplier, DamageMultiplier);
                     }
                 }
             }, 0.3f, false);
@@ -234,7 +248,8 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
     if (!Enemy || !StateMachine || !StateMachine->GetTarget()) return;
     
     AActor* Target = StateMachine->GetTarget();
-    float DistanceToTarget = FVector::Dist(Enemy->GetActorLocation(), Target->GetActorLocation());
+    const FEnemyPerception* Perception = StateMachine->GetPerception();
+    float DistanceToTarget = GetDistanceToPlayer(Enemy);
     bool bDashOnCooldown = IsAbilityOnCooldown(Enemy, TEXT("DashAttack"));
     
     // Update phase based on current state
@@ -253,7 +268,7 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
                 float DashCD = Agile ? Agile->DashCooldown : 3.0f;
                 StartAbilityCooldown(Enemy, TEXT("DashAttack"), DashCD);
                 
-                // UE_LOG(LogTemp, Warning, TEXT("Agile Assassin: Executing Assassin Approach from %.0f units!"), DistanceToTarget);
+                // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Assassin: Executing Assassin Approach from %.0f units!"), DistanceToTarget);
             }
             else if (!bDashOnCooldown && DistanceToTarget > 600.0f)
             {
@@ -290,7 +305,7 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
                 }
                 
                 // Always face the target
-                FVector ToTarget = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal();
+                FVector ToTarget = GetDirectionToPlayer(Enemy, StateMachine);
                 FRotator LookAtRotation = ToTarget.Rotation();
                 Enemy->SetActorRotation(FRotator(0.0f, LookAtRotation.Yaw, 0.0f));
             }
@@ -306,7 +321,7 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
                 TimeInCurrentPhase = 0.0f;
                 bHasExecutedBackstab = true;
                 
-                // UE_LOG(LogTemp, Warning, TEXT("Agile Assassin: Backstab complete, retreating!"));
+                // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Assassin: Backstab complete, retreating!"));
             }
             break;
         }
@@ -329,13 +344,13 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
                     Enemy->GetCharacterMovement()->MaxWalkSpeed = Agile->MovementSpeed;
                 }
                 
-                // UE_LOG(LogTemp, Warning, TEXT("Agile Assassin: %.1f second retreat complete, maintaining position"), RetreatTime);
+                // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Assassin: %.1f second retreat complete, maintaining position"), RetreatTime);
             }
             else
             {
                 // Always move away from player during retreat
-                FVector DirectionAway = (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal();
-                FVector RetreatPos = Enemy->GetActorLocation() + (DirectionAway * 300.0f);
+                FVector ToTarget = GetDirectionToPlayer(Enemy, StateMachine);
+                FVector RetreatPos = Enemy->GetActorLocation() - (ToTarget * 300.0f);
                 
                 if (AAIController* AIController = Cast<AAIController>(Enemy->GetController()))
                 {
@@ -349,7 +364,6 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
                 }
                 
                 // Face the player while retreating
-                FVector ToTarget = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal();
                 FRotator LookAtRotation = ToTarget.Rotation();
                 Enemy->SetActorRotation(FRotator(0.0f, LookAtRotation.Yaw, 0.0f));
             }
@@ -374,11 +388,11 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
                 
                 if (bForceAttack)
                 {
-                    // UE_LOG(LogTemp, Warning, TEXT("Agile Assassin: Forcing attack after %.1f seconds!"), MaxMaintainTime);
+                    // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Assassin: Forcing attack after %.1f seconds!"), MaxMaintainTime);
                 }
                 else
                 {
-                    // UE_LOG(LogTemp, Warning, TEXT("Agile Assassin: Dash ready, beginning new approach"));
+                    // UE_LOG(LogBlackholeAI, Warning, TEXT("Agile Assassin: Dash ready, beginning new approach"));
                 }
             }
             else
@@ -415,9 +429,9 @@ void UAgileCombatState::UpdateAssassinBehavior(ABaseEnemy* Enemy, UEnemyStateMac
                 if (FMath::RandRange(0.0f, 1.0f) < 0.4f && !IsAbilityOnCooldown(Enemy, TEXT("Dodge")))
                 {
                     // Check if player is aiming at us
-                    FVector PlayerForward = Target->GetActorForwardVector();
-                    FVector ToEnemy = (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal();
-                    float DotProduct = FVector::DotProduct(PlayerForward, ToEnemy);
+                    float DotProduct = Perception
+                        ? Perception->PlayerFacingDot
+                        : FVector::DotProduct(Target->GetActorForwardVector(), (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal());
                     
                     if (DotProduct > 0.7f) // Player looking at us
                     {
@@ -454,8 +468,7 @@ FVector UAgileCombatState::GetRetreatPosition(ABaseEnemy* Enemy, UEnemyStateMach
     if (!Enemy || !StateMachine || !StateMachine->GetTarget()) 
         return Enemy->GetActorLocation();
     
-    AActor* Target = StateMachine->GetTarget();
-    FVector DirectionAway = (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal();
+    FVector DirectionAway = -GetDirectionToPlayer(Enemy, StateMachine);
     FVector RetreatPos = Enemy->GetActorLocation() + (DirectionAway * 200.0f); // Move 200 units away
     
     // Make sure the retreat position is navigable
@@ -482,8 +495,7 @@ void UAgileCombatState::UpdateCircleStrafe(ABaseEnemy* Enemy, UEnemyStateMachine
     if (!Enemy || !StateMachine || !StateMachine->GetTarget())
         return;
         
-    AActor* Target = StateMachine->GetTarget();
-    FVector ToTarget = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal();
+    FVector ToTarget = GetDirectionToPlayer(Enemy, StateMachine);
     
     // Calculate strafe direction (perpendicular to target direction)
     FVector StrafeDirection = FVector::CrossProduct(ToTarget, FVector::UpVector) * CircleStrafeDirection;
@@ -519,5 +531,5 @@ void UAgileCombatState::UpdateCircleStrafe(ABaseEnemy* Enemy, UEnemyStateMachine
         Enemy->SetActorRotation(FMath::RInterpTo(Enemy->GetActorRotation(), LookAtRotation, DeltaTime, 5.0f));
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("Agile Enemy: Circle strafing %s"), CircleStrafeDirection > 0 ? TEXT("Right") : TEXT("Left"));
+    UE_LOG(LogBlackholeAI, VeryVerbose, TEXT("Agile Enemy: Circle strafing %s"), CircleStrafeDirection > 0 ? TEXT("Right") : TEXT("Left"));
 }
\ No newline at end of file
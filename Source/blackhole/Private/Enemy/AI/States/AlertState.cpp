@@ -4,7 +4,7 @@
 #include "NavigationSystem.h"
 #include "AIController.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 
 void UAlertState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
@@ -91,7 +91,7 @@ void UAlertState::SearchBehavior(ABaseEnemy* Enemy, UEnemyStateMachine* StateMac
         
         // Debug visualization
         #if WITH_EDITOR
-        DrawDebugSphere(Enemy->GetWorld(), SearchPoint.Location, 50.0f, 12, FColor::Yellow, false, 2.0f);
+        BLACKHOLE_DEBUG_DRAW(AI_State, DrawDebugSphere(Enemy->GetWorld(), SearchPoint.Location, 50.0f, 12, FColor::Yellow, false, 2.0f));
         #endif
         
         SearchPointsVisited++;
@@ -1,9 +1,10 @@
 #include "Enemy/AI/States/ChannelingState.h"
+#include "blackhole.h"
 #include "Enemy/HackerEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Components/Abilities/Enemy/MindmeldComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 
 void UChannelingState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
@@ -77,7 +78,7 @@ void UChannelingState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachin
     {
         FVector Start = Enemy->GetActorLocation() + FVector(0, 0, 50);
         FVector End = StateMachine->GetTarget()->GetActorLocation();
-        DrawDebugLine(Enemy->GetWorld(), Start, End, FColor::Purple, false, 0.1f, 0, 2.0f);
+        BLACKHOLE_DEBUG_DRAW(AI_State, DrawDebugLine(Enemy->GetWorld(), Start, End, FColor::Purple, false, 0.1f, 0, 2.0f));
     }
     #endif
 }
@@ -90,7 +91,7 @@ void UChannelingState::StartChanneling(ABaseEnemy* Enemy)
     if (UMindmeldComponent* Mindmeld = Hacker->FindComponentByClass<UMindmeldComponent>())
     {
         Mindmeld->Execute();
-        UE_LOG(LogTemp, Warning, TEXT("%s: Started channeling Mindmeld"), *Enemy->GetName());
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Started channeling Mindmeld"), *Enemy->GetName());
     }
 }
 
@@ -103,7 +104,7 @@ void UChannelingState::StopChanneling(ABaseEnemy* Enemy)
     {
         // Stop the channel - this would need to be implemented in MindmeldAbility
         // For now, just log it
-        UE_LOG(LogTemp, Warning, TEXT("%s: Stopped channeling Mindmeld (Duration: %.2fs)"), 
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Stopped channeling Mindmeld (Duration: %.2fs)"), 
             *Enemy->GetName(), ChannelDuration);
     }
 }
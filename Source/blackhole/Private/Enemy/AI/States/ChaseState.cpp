@@ -1,6 +1,8 @@
 #include "Enemy/AI/States/ChaseState.h"
+#include "blackhole.h"
 #include "Enemy/BaseEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
+#include "Systems/EnemyPerceptionSubsystem.h"
 #include "AIController.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "AITypes.h"
@@ -43,8 +45,7 @@ void UChaseState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, fl
     
     if (!Enemy || !StateMachine || !StateMachine->GetTarget()) return;
     
-    const FEnemyAIParameters& Params = StateMachine->GetAIParameters();
-    float Distance = GetDistanceToPlayer(Enemy);
+    const EEnemyRangeBand RangeBand = GetRangeBand(Enemy, StateMachine);
     
     // Check if we should retreat
     if (ShouldRetreat(Enemy, StateMachine))
@@ -54,14 +55,14 @@ void UChaseState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, fl
     }
     
     // Check if in combat range
-    if (Distance <= Params.AttackRange)
+    if (RangeBand == EEnemyRangeBand::Attack)
     {
         StateMachine->ChangeState(EEnemyState::Combat);
         return;
     }
     
     // Check if lost sight and out of chase range
-    if (!HasLineOfSightToPlayer(Enemy) || Distance > Params.ChaseRange * 1.5f)
+    if (!HasLineOfSightToPlayer(Enemy) || RangeBand > EEnemyRangeBand::Chase)
     {
         // Lost target - go to alert state
         StateMachine->ChangeState(EEnemyState::Alert);
@@ -80,7 +81,7 @@ void UChaseState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, fl
         FVector CurrentVelocity = Enemy->GetCharacterMovement()->Velocity;
         if (CurrentVelocity.IsNearlyZero())
         {
-            // UE_LOG(LogTemp, Warning, TEXT("%s: WARNING - Velocity is zero in chase state!"), *Enemy->GetName());
+            // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: WARNING - Velocity is zero in chase state!"), *Enemy->GetName());
         }
     }
 }
@@ -94,13 +95,13 @@ void UChaseState::UpdateChaseMovement(ABaseEnemy* Enemy, UEnemyStateMachine* Sta
     
     if (!AIController)
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: No AIController in UpdateChaseMovement!"), *Enemy->GetName());
+        UE_LOG(LogBlackholeAI, Error, TEXT("%s: No AIController in UpdateChaseMovement!"), *Enemy->GetName());
         return;
     }
     
     if (!Target)
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: No Target in UpdateChaseMovement!"), *Enemy->GetName());
+        UE_LOG(LogBlackholeAI, Error, TEXT("%s: No Target in UpdateChaseMovement!"), *Enemy->GetName());
         return;
     }
     
@@ -108,13 +109,23 @@ void UChaseState::UpdateChaseMovement(ABaseEnemy* Enemy, UEnemyStateMachine* Sta
     const FEnemyAIParameters& Params = StateMachine->GetAIParameters();
     
     // Predict player movement for smarter chasing
-    FVector TargetLocation = Target->GetActorLocation();
-    if (ACharacter* PlayerChar = Cast<ACharacter>(Target))
+    FVector TargetLocation;
+    FVector TargetVelocity = FVector::ZeroVector;
+    if (const FEnemyPerception* Perception = StateMachine->GetPerception())
+    {
+        TargetLocation = Perception->PlayerLocation;
+        TargetVelocity = Perception->PlayerVelocity;
+    }
+    else
     {
-        FVector Velocity = PlayerChar->GetVelocity();
-        float PredictionTime = FMath::Min(0.5f, GetDistanceToPlayer(Enemy) / 1000.0f);
-        TargetLocation += Velocity * PredictionTime * Params.AggressionLevel;
+        TargetLocation = Target->GetActorLocation();
+        if (ACharacter* PlayerChar = Cast<ACharacter>(Target))
+        {
+            TargetVelocity = PlayerChar->GetVelocity();
+        }
     }
+    float PredictionTime = FMath::Min(0.5f, GetDistanceToPlayer(Enemy) / 1000.0f);
+    TargetLocation += TargetVelocity * PredictionTime * Params.AggressionLevel;
     
     // Move to predicted location
     FAIMoveRequest MoveRequest;
@@ -122,7 +133,7 @@ void UChaseState::UpdateChaseMovement(ABaseEnemy* Enemy, UEnemyStateMachine* Sta
     MoveRequest.SetAcceptanceRadius(Params.AttackRange * 0.8f);
     MoveRequest.SetUsePathfinding(true);
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s: MoveTo called - Target: %s, Location: %s, AcceptRadius: %.0f"),
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: MoveTo called - Target: %s, Location: %s, AcceptRadius: %.0f"),
     //     *Enemy->GetName(),
     //     *Target->GetName(),
     //     *TargetLocation.ToString(),
@@ -130,7 +141,7 @@ void UChaseState::UpdateChaseMovement(ABaseEnemy* Enemy, UEnemyStateMachine* Sta
     
     FPathFollowingRequestResult Result = AIController->MoveTo(MoveRequest);
     
-    // UE_LOG(LogTemp, Warning, TEXT("%s: MoveTo result: %s"),
+    // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: MoveTo result: %s"),
     //     *Enemy->GetName(),
     //     Result.Code == EPathFollowingRequestResult::RequestSuccessful ? TEXT("Success") :
     //     Result.Code == EPathFollowingRequestResult::AlreadyAtGoal ? TEXT("Already at goal") :
@@ -143,7 +154,7 @@ void UChaseState::UpdateChaseMovement(ABaseEnemy* Enemy, UEnemyStateMachine* Sta
         UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(Enemy->GetWorld());
         if (!NavSystem)
         {
-            UE_LOG(LogTemp, Error, TEXT("%s: No navigation system found!"), *Enemy->GetName());
+            UE_LOG(LogBlackholeAI, Error, TEXT("%s: No navigation system found!"), *Enemy->GetName());
         }
         else
         {
@@ -155,7 +166,7 @@ void UChaseState::UpdateChaseMovement(ABaseEnemy* Enemy, UEnemyStateMachine* Sta
                 FVector(500.0f, 500.0f, 500.0f) // Search extent
             );
             
-            // UE_LOG(LogTemp, Warning, TEXT("%s: Target on NavMesh: %s"), 
+            // UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Target on NavMesh: %s"), 
             //     *Enemy->GetName(), 
             //     bOnNavMesh ? TEXT("Yes") : TEXT("No"));
         }
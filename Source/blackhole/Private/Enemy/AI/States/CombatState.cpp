@@ -1,9 +1,10 @@
 #include "Enemy/AI/States/CombatState.h"
+#include "blackhole.h"
 #include "Enemy/BaseEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
+#include "Systems/EnemyPerceptionSubsystem.h"
 #include "AIController.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "DrawDebugHelpers.h"
 
 void UCombatState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
@@ -40,7 +41,7 @@ void UCombatState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, f
         return;
     }
     
-    if (Distance > Params.AttackRange * 1.5f)
+    if (GetRangeBand(Enemy, StateMachine) > EEnemyRangeBand::Engage)
     {
         StateMachine->ChangeState(EEnemyState::Chase);
         return;
@@ -66,7 +67,7 @@ void UCombatState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, f
         FString SelectedAction = SelectCombatAction(Enemy, StateMachine);
         if (!SelectedAction.IsEmpty())
         {
-            UE_LOG(LogTemp, Warning, TEXT("%s CombatState: Executing action %s at distance %.0f"), 
+            UE_LOG(LogBlackholeAI, Warning, TEXT("%s CombatState: Executing action %s at distance %.0f"), 
                 *Enemy->GetName(), *SelectedAction, Distance);
                 
             bIsExecutingAction = true;
@@ -82,7 +83,7 @@ void UCombatState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, f
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("%s CombatState: No valid action at distance %.0f"), 
+            UE_LOG(LogBlackholeAI, Warning, TEXT("%s CombatState: No valid action at distance %.0f"), 
                 *Enemy->GetName(), Distance);
         }
         
@@ -163,7 +164,9 @@ void UCombatState::UpdateCombatPosition(ABaseEnemy* Enemy, UEnemyStateMachine* S
     
     const FEnemyAIParameters& Params = StateMachine->GetAIParameters();
     float Distance = GetDistanceToPlayer(Enemy);
-    FVector ToPlayer = (StateMachine->GetTarget()->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal();
+    const FEnemyPerception* Perception = StateMachine->GetPerception();
+    const FVector TargetLocation = Perception ? Perception->PlayerLocation : StateMachine->GetTarget()->GetActorLocation();
+    FVector ToPlayer = GetDirectionToPlayer(Enemy, StateMachine);
     
     FVector DesiredLocation;
     
@@ -179,7 +182,7 @@ void UCombatState::UpdateCombatPosition(ABaseEnemy* Enemy, UEnemyStateMachine* S
     else if (Distance > Params.AttackRange * 0.8f)  // Close in if outside attack range
     {
         // Too far - move to optimal attack position
-        DesiredLocation = StateMachine->GetTarget()->GetActorLocation() - ToPlayer * MinDistance;
+        DesiredLocation = TargetLocation - ToPlayer * MinDistance;
         
         // Move directly to target with higher acceptance radius for faster approach
         AIController->MoveToLocation(DesiredLocation, 30.0f);
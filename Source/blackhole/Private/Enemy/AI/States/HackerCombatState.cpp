@@ -1,4 +1,5 @@
 #include "Enemy/AI/States/HackerCombatState.h"
+#include "blackhole.h"
 #include "Enemy/HackerEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Components/Abilities/Enemy/MindmeldComponent.h"
@@ -73,7 +74,7 @@ void UHackerCombatState::ExecutePulseHack(ABaseEnemy* Enemy)
         SmashAbility->SetDamage(OriginalDamage);
         
         // TODO: Apply slow effect to hit targets
-        UE_LOG(LogTemp, Warning, TEXT("%s: Executed Pulse Hack (AoE slow)"), *Enemy->GetName());
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Executed Pulse Hack (AoE slow)"), *Enemy->GetName());
     }
 }
 
@@ -1,10 +1,11 @@
 #include "Enemy/AI/States/IdleState.h"
+#include "blackhole.h"
 #include "Enemy/BaseEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "NavigationSystem.h"
 #include "AIController.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 
 void UIdleState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
@@ -32,7 +33,7 @@ void UIdleState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, flo
     static int UpdateCounter = 0;
     if (UpdateCounter++ % 30 == 0) // Every 3 seconds
     {
-        UE_LOG(LogTemp, Warning, TEXT("%s IdleState: Update called - TimeInState: %.1f"),
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s IdleState: Update called - TimeInState: %.1f"),
             *Enemy->GetName(), TimeInState);
     }
     
@@ -48,19 +49,19 @@ void UIdleState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, flo
     // Check for player in sight range
     if (Target && IsPlayerInRange(Enemy, Params.SightRange))
     {
-        UE_LOG(LogTemp, Warning, TEXT("%s IdleState: Player in range! Checking LOS..."), *Enemy->GetName());
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s IdleState: Player in range! Checking LOS..."), *Enemy->GetName());
         
         if (HasLineOfSightToPlayer(Enemy))
         {
             // Player spotted - transition to alert
-            UE_LOG(LogTemp, Warning, TEXT("%s: Player spotted! Transitioning to Alert state"), *Enemy->GetName());
+            UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Player spotted! Transitioning to Alert state"), *Enemy->GetName());
             StateMachine->UpdateLastKnownTargetLocation();
             StateMachine->ChangeState(EEnemyState::Alert);
             return;
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("%s IdleState: Player in range but NO line of sight"), *Enemy->GetName());
+            UE_LOG(LogBlackholeAI, Warning, TEXT("%s IdleState: Player in range but NO line of sight"), *Enemy->GetName());
             // Debug message removed - no line of sight
         }
     }
@@ -69,7 +70,7 @@ void UIdleState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, flo
         static int NoTargetCounter = 0;
         if (NoTargetCounter++ % 30 == 0) // Every 3 seconds
         {
-            UE_LOG(LogTemp, Warning, TEXT("%s IdleState: No target in range (Target: %s, SightRange: %.0f)"),
+            UE_LOG(LogBlackholeAI, Warning, TEXT("%s IdleState: No target in range (Target: %s, SightRange: %.0f)"),
                 *Enemy->GetName(), 
                 Target ? *Target->GetName() : TEXT("NULL"),
                 Params.SightRange);
@@ -79,7 +80,7 @@ void UIdleState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine, flo
     // Debug: Draw detection sphere
     if (Enemy->GetWorld())
     {
-        DrawDebugSphere(Enemy->GetWorld(), Enemy->GetActorLocation(), Params.SightRange, 24, FColor::Blue, false, 0.1f, 0, 1.0f);
+        BLACKHOLE_DEBUG_DRAW(AI_State, DrawDebugSphere(Enemy->GetWorld(), Enemy->GetActorLocation(), Params.SightRange, 24, FColor::Blue, false, 0.1f, 0, 1.0f));
     }
     
     // Idle wander behavior
@@ -1,4 +1,5 @@
 #include "Enemy/AI/States/MindMelderCombatState.h"
+#include "blackhole.h"
 #include "Enemy/MindMelderEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Components/Abilities/Enemy/PowerfulMindmeldComponent.h"
@@ -87,11 +88,11 @@ void UMindMelderCombatState::ExecutePowerfulMindmeld(ABaseEnemy* Enemy, UEnemySt
         if (Mindmeld->IsChanneling())
         {
             StateMachine->ChangeState(EEnemyState::Channeling);
-            UE_LOG(LogTemp, Warning, TEXT("MindMelder: Started PowerfulMindmeld channel!"));
+            UE_LOG(LogBlackholeAI, Warning, TEXT("MindMelder: Started PowerfulMindmeld channel!"));
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("MindMelder: Failed to start PowerfulMindmeld"));
+            UE_LOG(LogBlackholeAI, Warning, TEXT("MindMelder: Failed to start PowerfulMindmeld"));
         }
     }
 }
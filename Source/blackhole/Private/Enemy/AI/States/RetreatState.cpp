@@ -1,11 +1,12 @@
 #include "Enemy/AI/States/RetreatState.h"
+#include "blackhole.h"
 #include "Enemy/BaseEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "AIController.h"
 #include "NavigationSystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "EngineUtils.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 
 void URetreatState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine)
 {
@@ -120,7 +121,7 @@ void URetreatState::FindRetreatLocation(ABaseEnemy* Enemy, UEnemyStateMachine* S
         bRetreatTargetSet = true;
         
         #if WITH_EDITOR
-        DrawDebugSphere(Enemy->GetWorld(), RetreatTarget, 100.0f, 12, FColor::Red, false, 5.0f);
+        BLACKHOLE_DEBUG_DRAW(AI_State, DrawDebugSphere(Enemy->GetWorld(), RetreatTarget, 100.0f, 12, FColor::Red, false, 5.0f));
         #endif
     }
     else
@@ -162,7 +163,7 @@ void URetreatState::CallForBackup(ABaseEnemy* Enemy, UEnemyStateMachine* StateMa
                     AllyStateMachine->UpdateLastKnownTargetLocation();
                     AllyStateMachine->ChangeState(EEnemyState::Alert);
                     
-                    UE_LOG(LogTemp, Warning, TEXT("%s called for backup from %s"), 
+                    UE_LOG(LogBlackholeAI, Warning, TEXT("%s called for backup from %s"), 
                         *Enemy->GetName(), *Ally->GetName());
                 }
             }
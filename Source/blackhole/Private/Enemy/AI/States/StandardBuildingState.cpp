@@ -1,10 +1,11 @@
 #include "Enemy/AI/States/StandardBuildingState.h"
+#include "blackhole.h"
 #include "Enemy/StandardEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Components/Abilities/Enemy/BuilderComponent.h"
 #include "AIController.h"
 #include "Navigation/PathFollowingComponent.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 
 UStandardBuildingState::UStandardBuildingState()
 {
@@ -33,7 +34,7 @@ void UStandardBuildingState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateM
                 AIController->StopMovement();
             }
             
-            UE_LOG(LogTemp, Warning, TEXT("%s: Entering building state at location %s"), 
+            UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Entering building state at location %s"), 
                 *Enemy->GetName(), *BuildLocation.ToString());
         }
         else
@@ -53,7 +54,7 @@ void UStandardBuildingState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* State
     // Check if still building
     if (!CachedBuilderComponent->IsBuilding())
     {
-        UE_LOG(LogTemp, Warning, TEXT("%s: Building complete or cancelled, returning to idle"), 
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Building complete or cancelled, returning to idle"), 
             *Enemy->GetName());
         StateMachine->ChangeState(EEnemyState::Idle);
         return;
@@ -63,7 +64,7 @@ void UStandardBuildingState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* State
     if (CachedBuilderComponent->IsBuildPaused())
     {
         // Building is paused, we can return to combat/chase
-        UE_LOG(LogTemp, Warning, TEXT("%s: Building paused, returning to combat"), 
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Building paused, returning to combat"), 
             *Enemy->GetName());
         StateMachine->ChangeState(EEnemyState::Combat);
         return;
@@ -103,8 +104,8 @@ void UStandardBuildingState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* State
     // Visual feedback
     #if WITH_EDITOR
     FVector EnemyLoc = Enemy->GetActorLocation();
-    DrawDebugLine(GetWorld(), EnemyLoc, BuildLocation, FColor::Blue, false, -1.0f, 0, 2.0f);
-    DrawDebugCircle(GetWorld(), BuildLocation, StayInRangeDistance, 32, FColor::Blue, false, -1.0f, 0, 2.0f);
+    BLACKHOLE_DEBUG_DRAW(AI_State, DrawDebugLine(GetWorld(), EnemyLoc, BuildLocation, FColor::Blue, false, -1.0f, 0, 2.0f));
+    BLACKHOLE_DEBUG_DRAW(AI_State, DrawDebugCircle(GetWorld(), BuildLocation, StayInRangeDistance, 32, FColor::Blue, false, -1.0f, 0, 2.0f));
     #endif
 }
 
@@ -114,7 +115,7 @@ void UStandardBuildingState::Exit(ABaseEnemy* Enemy, UEnemyStateMachine* StateMa
     
     CachedBuilderComponent = nullptr;
     
-    UE_LOG(LogTemp, Warning, TEXT("%s: Exiting building state"), 
+    UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Exiting building state"), 
         Enemy ? *Enemy->GetName() : TEXT("NULL"));
 }
 
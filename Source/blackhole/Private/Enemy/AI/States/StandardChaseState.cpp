@@ -1,4 +1,5 @@
 #include "Enemy/AI/States/StandardChaseState.h"
+#include "blackhole.h"
 #include "Enemy/StandardEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Components/Abilities/Enemy/BuilderComponent.h"
@@ -11,7 +12,7 @@ void UStandardChaseState::Enter(ABaseEnemy* Enemy, UEnemyStateMachine* StateMach
     TimeSinceChaseStart = 0.0f;
     bHasTriggeredBuilding = false;
     
-    UE_LOG(LogTemp, Warning, TEXT("%s: Entering chase state, will build after %.1f seconds if can't reach player"), 
+    UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Entering chase state, will build after %.1f seconds if can't reach player"), 
         *Enemy->GetName(), BuildAfterChaseTime);
 }
 
@@ -27,7 +28,7 @@ void UStandardChaseState::Update(ABaseEnemy* Enemy, UEnemyStateMachine* StateMac
     // Check if we should start building
     if (!bHasTriggeredBuilding && TimeSinceChaseStart >= BuildAfterChaseTime)
     {
-        UE_LOG(LogTemp, Warning, TEXT("%s: Can't reach player after %.1f seconds of chasing, checking building opportunity!"), 
+        UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Can't reach player after %.1f seconds of chasing, checking building opportunity!"), 
             *Enemy->GetName(), BuildAfterChaseTime);
         
         CheckBuildingOpportunity(Enemy);
@@ -45,7 +46,7 @@ void UStandardChaseState::CheckBuildingOpportunity(ABaseEnemy* Enemy)
     {
         if (!BuilderComp->IsBuilding())
         {
-            UE_LOG(LogTemp, Warning, TEXT("%s: Initiating Psi-Disruptor build after chase timeout!"), *Enemy->GetName());
+            UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Initiating Psi-Disruptor build after chase timeout!"), *Enemy->GetName());
             
             // Call the standard enemy's building check which coordinates with nearby builders
             StandardEnemy->OnAlerted();
@@ -1,4 +1,5 @@
 #include "Enemy/AI/States/TankCombatState.h"
+#include "blackhole.h"
 #include "Enemy/TankEnemy.h"
 #include "Enemy/AI/EnemyStateMachine.h"
 #include "Components/Abilities/Enemy/BlockComponent.h"
@@ -91,7 +92,7 @@ void UTankCombatState::ExecuteGroundSlam(ABaseEnemy* Enemy)
         StartAbilityCooldown(Enemy, TEXT("Smash"), 2.0f);  // Block other attacks during stagger
         StartAbilityCooldown(Enemy, TEXT("Block"), 2.0f);
         
-        UE_LOG(LogTemp, Warning, TEXT("Tank GroundSlam: Executed area damage attack - Staggered for 1.5s"));
+        UE_LOG(LogBlackholeAI, Warning, TEXT("Tank GroundSlam: Executed area damage attack - Staggered for 1.5s"));
     }
 }
 
@@ -109,6 +110,6 @@ void UTankCombatState::ExecuteCharge(ABaseEnemy* Enemy)
         StartAbilityCooldown(Enemy, TEXT("Block"), 3.0f);
         StartAbilityCooldown(Enemy, TEXT("GroundSlam"), 3.0f);
         
-        UE_LOG(LogTemp, Warning, TEXT("Tank Charge: Initiating charge towards player!"));
+        UE_LOG(LogBlackholeAI, Warning, TEXT("Tank Charge: Initiating charge towards player!"));
     }
 }
\ No newline at end of file
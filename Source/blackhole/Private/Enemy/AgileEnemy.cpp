@@ -1,4 +1,6 @@
 #include "Enemy/AgileEnemy.h"
+#include "Debug/BlackholeStats.h"
+#include "Data/EnemyStatsData.h"
 #include "Components/Abilities/Enemy/StabAttackComponent.h"
 #include "Components/Abilities/Enemy/AssassinApproachComponent.h"
 #include "Components/Abilities/Enemy/DodgeComponent.h"
@@ -50,8 +52,55 @@ void AAgileEnemy::BeginPlay()
 	// Attack speed multiplier is handled in the combat state's cooldowns
 }
 
+void AAgileEnemy::ResetForRestart(const FTransform& SpawnTransform)
+{
+	Super::ResetForRestart(SpawnTransform);
+	
+	// BeginPlay takes the walk speed from the editor value rather than the stats row
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->MaxWalkSpeed = MovementSpeed;
+	}
+}
+
+void AAgileEnemy::ApplyArchetype(const FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields)
+{
+	Super::ApplyArchetype(Archetype, Fields);
+	
+	const FEnemyStatsData& Stats = Archetype.Stats;
+	
+	if (EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Movement))
+	{
+		MovementSpeed = Stats.MovementSpeed;
+	}
+	
+	if (EnumHasAnyFlags(Fields, EEnemyArchetypeFields::AI))
+	{
+		AttackRange = Stats.AttackRange;
+		ChaseRange = Stats.ChaseRange;
+		DodgeChance = Stats.DodgeChance;
+	}
+	
+	if (!EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Abilities))
+	{
+		return;
+	}
+	
+	if (DodgeAbility)
+	{
+		DodgeAbility->SetCooldown(Stats.DodgeCooldown);
+		DodgeAbility->DodgeDistance = Stats.DodgeDistance;
+	}
+	
+	AttackSpeedMultiplier = Stats.AttackSpeedMultiplier;
+	DashCooldown = Stats.DashCooldown;
+	DashBehindDistance = Stats.DashBehindDistance;
+}
+
 void AAgileEnemy::UpdateAIBehavior(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("AgileEnemy AI Update", STAT_Blackhole_AgileEnemyAIUpdate, BlackholeAIChannel);
+
 	// Call parent implementation first to handle combat detection
 	Super::UpdateAIBehavior(DeltaTime);
 	
@@ -1,12 +1,19 @@
 #include "Enemy/BaseEnemy.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/StatusEffectComponent.h"
 #include "Components/GravityDirectionComponent.h"
+#include "Components/Abilities/AbilityComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Systems/ThresholdManager.h"
 #include "Systems/ResourceManager.h"
+#include "Systems/EnemyTrackingManager.h"
+#include "Systems/EnemyArchetypeCache.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 #include "Config/GameplayConfig.h"
@@ -18,6 +25,8 @@
 
 ABaseEnemy::ABaseEnemy()
 {
+	BLACKHOLE_LLM_SCOPE(Enemies);
+
 	PrimaryActorTick.bCanEverTick = true;
 
 	// Initialize WP values (will be overridden by data table if configured)
@@ -88,6 +97,8 @@ void ABaseEnemy::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	BLACKHOLE_LLM_SCOPE(Enemies);
+
 	// Load stats from data table if configured
 	if (EnemyStatsDataTable && !StatsRowName.IsNone())
 	{
@@ -98,11 +109,11 @@ void ABaseEnemy::BeginPlay()
 	if (GetCharacterMovement())
 	{
 		DefaultWalkSpeed = GetCharacterMovement()->MaxWalkSpeed;
-		// UE_LOG(LogTemp, Warning, TEXT("%s: Default walk speed set to %.0f"), *GetName(), DefaultWalkSpeed);
+		// UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Default walk speed set to %.0f"), *GetName(), DefaultWalkSpeed);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("%s: No CharacterMovement component found!"), *GetName());
+		UE_LOG(LogBlackholeAI, Error, TEXT("%s: No CharacterMovement component found!"), *GetName());
 	}
 	
 	// Verify AI Controller
@@ -110,16 +121,16 @@ void ABaseEnemy::BeginPlay()
 	{
 		if (AAIController* AIController = Cast<AAIController>(GetController()))
 		{
-			// UE_LOG(LogTemp, Warning, TEXT("%s: AIController present: %s"), *GetName(), *AIController->GetName());
+			// UE_LOG(LogBlackholeAI, Warning, TEXT("%s: AIController present: %s"), *GetName(), *AIController->GetName());
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("%s: Controller is not an AIController!"), *GetName());
+			UE_LOG(LogBlackholeAI, Error, TEXT("%s: Controller is not an AIController!"), *GetName());
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("%s: No controller found! AutoPossessAI: %d"), *GetName(), (int32)AutoPossessAI);
+		UE_LOG(LogBlackholeAI, Error, TEXT("%s: No controller found! AutoPossessAI: %d"), *GetName(), (int32)AutoPossessAI);
 	}
 	
 	// Try to find player if no target set
@@ -130,7 +141,7 @@ void ABaseEnemy::BeginPlay()
 			TargetActor = UGameplayStatics::GetPlayerCharacter(World, 0);
 			if (TargetActor)
 			{
-				UE_LOG(LogTemp, Log, TEXT("%s: Found player target in BeginPlay"), *GetName());
+				UE_LOG(LogBlackholeAI, Log, TEXT("%s: Found player target in BeginPlay"), *GetName());
 			}
 		}
 	}
@@ -141,26 +152,34 @@ void ABaseEnemy::BeginPlay()
 		if (TargetActor)
 		{
 			StateMachine->SetTarget(TargetActor);
-			// UE_LOG(LogTemp, Warning, TEXT("%s: Target set for state machine in BeginPlay - %s"), *GetName(), *TargetActor->GetName());
+			// UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Target set for state machine in BeginPlay - %s"), *GetName(), *TargetActor->GetName());
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("%s: No target actor to set for state machine!"), *GetName());
+			UE_LOG(LogBlackholeAI, Error, TEXT("%s: No target actor to set for state machine!"), *GetName());
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("%s: No state machine component found after CreateStateMachine()!"), *GetName());
+		UE_LOG(LogBlackholeAI, Error, TEXT("%s: No state machine component found after CreateStateMachine()!"), *GetName());
 	}
 	
 	// Death is now handled by checking WP in TakeDamage
 	
 	// State machine handles AI updates now - no need for timer
 	// Legacy AI timer disabled in favor of state machine
+	
+	// Make this enemy visible to HUD/system consumers of the enemy list
+	if (UEnemyTrackingManager* TrackingManager = GetWorld()->GetSubsystem<UEnemyTrackingManager>())
+	{
+		TrackingManager->RegisterEnemy(this);
+	}
 }
 
 void ABaseEnemy::Tick(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Enemy Tick", STAT_Blackhole_EnemyTick, BlackholeAIChannel);
+
 	Super::Tick(DeltaTime);
 	
 	// AI updates are now handled by timer
@@ -189,7 +208,7 @@ void ABaseEnemy::UpdateAIBehavior(float DeltaTime)
 						if (!ThresholdMgr->IsInCombat())
 						{
 							ThresholdMgr->StartCombat();
-							// UE_LOG(LogTemp, Warning, TEXT("Combat Started - %s detected player!"), *GetName());
+							// UE_LOG(LogBlackholeAI, Warning, TEXT("Combat Started - %s detected player!"), *GetName());
 							
 							// Show on screen message
 							if (GEngine)
@@ -223,7 +242,7 @@ float ABaseEnemy::TakeDamage(float DamageAmount, struct FDamageEvent const& Dama
 	float OldWP = CurrentWP;
 	CurrentWP = FMath::Clamp(CurrentWP - DamageAmount, 0.0f, MaxWP);
 	
-	// UE_LOG(LogTemp, Warning, TEXT("%s took %.1f damage, WP: %.1f/%.1f"), 
+	// UE_LOG(LogBlackholeAI, Warning, TEXT("%s took %.1f damage, WP: %.1f/%.1f"), 
 	//	*GetName(), DamageAmount, CurrentWP, MaxWP);
 	
 	// Check for death
@@ -253,7 +272,7 @@ void ABaseEnemy::OnDeath()
 			if (UResourceManager* ResourceMgr = GameInstance->GetSubsystem<UResourceManager>())
 			{
 				ResourceMgr->AddWillPower(WPRewardOnKill);
-				// UE_LOG(LogTemp, Warning, TEXT("%s killed: Player gained +%.1f WP"), *GetName(), WPRewardOnKill);
+				// UE_LOG(LogBlackholeAI, Warning, TEXT("%s killed: Player gained +%.1f WP"), *GetName(), WPRewardOnKill);
 			}
 		}
 	}
@@ -287,8 +306,101 @@ void ABaseEnemy::OnDeath()
 	ImpulseDirection.Z = GameplayConfig::Enemy::DEATH_IMPULSE_Z; // Add some upward force
 	GetMesh()->AddImpulse(ImpulseDirection * GameplayConfig::Enemy::DEATH_IMPULSE_MAGNITUDE, NAME_None, true);
 	
-	// Destroy actor after delay
-	SetLifeSpan(GameplayConfig::Enemy::CORPSE_LIFESPAN);
+	// Destroy actor after delay; recorded enemies are kept for a soft restart instead
+	if (bRetainedForRestart)
+	{
+		GetWorldTimerManager().SetTimer(CorpseTimerHandle, this, &ABaseEnemy::ParkCorpse, GameplayConfig::Enemy::CORPSE_LIFESPAN, false);
+	}
+	else
+	{
+		SetLifeSpan(GameplayConfig::Enemy::CORPSE_LIFESPAN);
+	}
+}
+
+void ABaseEnemy::ParkCorpse()
+{
+	// Auras and channels would otherwise keep running on the hidden corpse
+	TArray<UActorComponent*> AllComponents = GetComponents().Array();
+	for (UActorComponent* Component : AllComponents)
+	{
+		if (UAbilityComponent* Ability = Cast<UAbilityComponent>(Component))
+		{
+			Ability->Deactivate();
+		}
+	}
+	
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetActorHiddenInGame(true);
+	SetActorTickEnabled(false);
+}
+
+void ABaseEnemy::ResetForRestart(const FTransform& SpawnTransform)
+{
+	const bool bWasDead = bIsDead;
+	bIsDead = false;
+	bHasStartedCombat = false;
+	
+	// Stop anything in flight (charges, channels, auras) before clearing timers and state
+	TArray<UActorComponent*> AllComponents = GetComponents().Array();
+	for (UActorComponent* Component : AllComponents)
+	{
+		if (UAbilityComponent* Ability = Cast<UAbilityComponent>(Component))
+		{
+			Ability->Deactivate();
+			Ability->ResetCooldownForRestart();
+			Ability->SetComponentTickEnabled(Ability->PrimaryComponentTick.bStartWithTickEnabled);
+			GetWorldTimerManager().ClearAllTimersForObject(Ability);
+		}
+	}
+	
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	GetWorldTimerManager().ClearTimer(SpeedResetTimerHandle);
+	
+	// Put the ragdolled mesh back on the capsule
+	const ABaseEnemy* Defaults = GetClass()->GetDefaultObject<ABaseEnemy>();
+	if (bWasDead)
+	{
+		GetMesh()->SetSimulatePhysics(false);
+		GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+		GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+		GetMesh()->SetCollisionEnabled(Defaults->GetMesh()->GetCollisionEnabled());
+		GetCapsuleComponent()->SetCollisionEnabled(Defaults->GetCapsuleComponent()->GetCollisionEnabled());
+	}
+	SetActorHiddenInGame(false);
+	SetActorTickEnabled(PrimaryActorTick.bStartWithTickEnabled);
+	
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->SetDefaultMovementMode();
+		Movement->MaxWalkSpeed = DefaultWalkSpeed;
+	}
+	
+	if (StatusEffectComponent)
+	{
+		StatusEffectComponent->ClearAllStatusEffects();
+	}
+	
+	if (GravityDirectionComponent)
+	{
+		GravityDirectionComponent->SetGravityDirection(FVector(0, 0, -1));
+	}
+	
+	// Full health and authored stats (reapplies any hot reloaded row)
+	CurrentWP = MaxWP;
+	if (EnemyStatsDataTable && !StatsRowName.IsNone())
+	{
+		LoadStatsFromDataTable();
+	}
+	
+	TargetActor = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+	if (StateMachine)
+	{
+		StateMachine->ResetForRestart(TargetActor);
+	}
 }
 
 void ABaseEnemy::TimerUpdateAI()
@@ -312,6 +424,11 @@ void ABaseEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		GetWorld()->GetTimerManager().ClearTimer(AIUpdateTimer);
 		GetWorld()->GetTimerManager().ClearTimer(SpeedResetTimerHandle);
+		
+		if (UEnemyTrackingManager* TrackingManager = GetWorld()->GetSubsystem<UEnemyTrackingManager>())
+		{
+			TrackingManager->UnregisterEnemy(this);
+		}
 	}
 	
 	Super::EndPlay(EndPlayReason);
@@ -371,12 +488,73 @@ void ABaseEnemy::LoadStatsFromDataTable()
 {
 	if (!EnemyStatsDataTable || StatsRowName.IsNone())
 	{
-		// UE_LOG(LogTemp, Warning, TEXT("%s: No data table or row name configured"), *GetName());
+		// UE_LOG(LogBlackholeAI, Warning, TEXT("%s: No data table or row name configured"), *GetName());
+		return;
+	}
+	
+	BLACKHOLE_LLM_SCOPE(Data);
+
+	// Rows are resolved once per table and shared by every enemy using them
+	UGameInstance* GameInstance = GetGameInstance();
+	UEnemyArchetypeCache* ArchetypeCache = GameInstance ? GameInstance->GetSubsystem<UEnemyArchetypeCache>() : nullptr;
+	if (!ArchetypeCache)
+	{
+		UEnemyStatsManager::ApplyStatsToEnemy(this, UEnemyStatsManager::GetEnemyStats(this, EnemyStatsDataTable, StatsRowName));
+		return;
+	}
+	
+	const FEnemyArchetype* Archetype = ArchetypeCache->FindArchetype(EnemyStatsDataTable, StatsRowName);
+	if (!Archetype)
+	{
+		UE_LOG(LogBlackholeAI, Error, TEXT("%s: Could not find row %s in data table"), *GetName(), *StatsRowName.ToString());
 		return;
 	}
 	
-	FEnemyStatsData Stats = UEnemyStatsManager::GetEnemyStats(this, EnemyStatsDataTable, StatsRowName);
-	UEnemyStatsManager::ApplyStatsToEnemy(this, Stats);
+	ApplyArchetype(*Archetype, EEnemyArchetypeFields::All | EEnemyArchetypeFields::Spawn);
 	
-	UE_LOG(LogTemp, Log, TEXT("%s: Loaded stats from data table row '%s'"), *GetName(), *StatsRowName.ToString());
+	UE_LOG(LogBlackholeAI, Log, TEXT("%s: Loaded stats from data table row '%s'"), *GetName(), *StatsRowName.ToString());
+}
+
+void ABaseEnemy::ApplyArchetype(const FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields)
+{
+	const FEnemyStatsData& Stats = Archetype.Stats;
+	const bool bSpawn = EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Spawn);
+	
+	// Apply health as WP
+	if (EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Health))
+	{
+		const float HealthFraction = (!bSpawn && MaxWP > 0.0f) ? CurrentWP / MaxWP : 1.0f;
+		SetMaxWP(Stats.MaxHealth);
+		SetCurrentWP(Stats.MaxHealth * HealthFraction);
+	}
+	
+	// Apply movement stats
+	UCharacterMovementComponent* Movement = GetCharacterMovement();
+	if (Movement && EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Movement))
+	{
+		// Keep a slow or haste that is running on a live enemy
+		const float SpeedScale = (!bSpawn && DefaultWalkSpeed > 0.0f) ? Movement->MaxWalkSpeed / DefaultWalkSpeed : 1.0f;
+		Movement->MaxWalkSpeed = Stats.MovementSpeed * SpeedScale;
+		Movement->MaxAcceleration = Stats.Acceleration;
+		Movement->BrakingDecelerationWalking = Stats.BrakingDeceleration;
+		Movement->RotationRate = FRotator(0.0f, Stats.RotationRate, 0.0f);
+		Movement->Mass = Stats.Mass;
+		
+		if (!bSpawn)
+		{
+			DefaultWalkSpeed = Stats.MovementSpeed;
+		}
+	}
+	
+	if (EnumHasAnyFlags(Fields, EEnemyArchetypeFields::AI))
+	{
+		// Apply combat range stats
+		MinimumEngagementDistance = Stats.MinimumEngagementDistance;
+		
+		// Apply AI parameters through state machine
+		if (StateMachine)
+		{
+			StateMachine->SetAIParameters(Archetype.AIParameters);
+		}
+	}
 }
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "Enemy/CombatEnemy.h"
+#include "Debug/BlackholeStats.h"
+#include "Data/EnemyStatsData.h"
 #include "Components/Abilities/Enemy/SmashAbilityComponent.h"
 #include "Components/Abilities/Enemy/BlockComponent.h"
 #include "Components/Abilities/Enemy/DodgeComponent.h"
@@ -58,8 +60,57 @@ void ACombatEnemy::BeginPlay()
 	}
 }
 
+void ACombatEnemy::ApplyArchetype(const FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields)
+{
+	Super::ApplyArchetype(Archetype, Fields);
+	
+	const FEnemyStatsData& Stats = Archetype.Stats;
+	
+	if (EnumHasAnyFlags(Fields, EEnemyArchetypeFields::AI))
+	{
+		AttackRange = Stats.AttackRange;
+		ChaseRange = Stats.ChaseRange;
+		DodgeChance = Stats.DodgeChance;
+		BlockChance = Stats.BlockChance;
+	}
+	
+	if (!EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Abilities))
+	{
+		return;
+	}
+	
+	if (SmashAbility)
+	{
+		SmashAbility->SetDamage(Stats.SmashDamage);
+		SmashAbility->SetCooldownTime(Archetype.SmashCooldown);
+		SmashAbility->SetRange(Stats.SmashRange);
+		SmashAbility->SetKnockbackForce(Stats.SmashKnockbackForce);
+		
+		// Area damage for ground slam
+		if (Stats.bHasAreaDamage)
+		{
+			SmashAbility->SetAreaDamage(true);
+			SmashAbility->SetAreaRadius(Stats.GroundSlamRadius);
+		}
+	}
+	
+	if (BlockAbility)
+	{
+		BlockAbility->BlockDuration = Stats.BlockDuration;
+		BlockAbility->SetCooldown(Stats.BlockCooldown);
+	}
+	
+	if (DodgeAbility)
+	{
+		DodgeAbility->SetCooldown(Stats.DodgeCooldown);
+		DodgeAbility->DodgeDistance = Stats.DodgeDistance;
+	}
+}
+
 void ACombatEnemy::UpdateAIBehavior(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("CombatEnemy AI Update", STAT_Blackhole_CombatEnemyAIUpdate, BlackholeAIChannel);
+
 	// Call parent implementation first to handle combat detection
 	Super::UpdateAIBehavior(DeltaTime);
 	
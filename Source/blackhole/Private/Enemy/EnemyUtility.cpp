@@ -1,4 +1,6 @@
 #include "Enemy/EnemyUtility.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Enemy/BaseEnemy.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Components/CapsuleComponent.h"
@@ -79,7 +81,7 @@ bool UEnemyUtility::TryBasicAttack(ABaseEnemy* Enemy, float AttackRange, float D
 	FPointDamageEvent DamageEvent(Damage, FHitResult(), Enemy->GetActorLocation(), nullptr);
 	Player->TakeDamage(Damage, DamageEvent, Enemy->GetController(), Enemy);
 	
-	UE_LOG(LogTemp, Verbose, TEXT("%s attacked player for %.1f damage"), *Enemy->GetName(), Damage);
+	UE_LOG(LogBlackholeAI, Verbose, TEXT("%s attacked player for %.1f damage"), *Enemy->GetName(), Damage);
 	
 	return true;
 }
@@ -121,6 +123,7 @@ bool UEnemyUtility::HasLineOfSightToPlayer(const ABaseEnemy* Enemy)
 	QueryParams.AddIgnoredActor(Enemy);
 	QueryParams.AddIgnoredActor(Player);
 	
+	BLACKHOLE_COUNT_QUERY(LOSTraces);
 	return !Enemy->GetWorld()->LineTraceSingleByChannel(
 		HitResult,
 		StartLocation,
@@ -183,7 +186,7 @@ void UEnemyUtility::StartCombatState(ABaseEnemy* Enemy)
 		Enemy->SetCombatStarted(true);
 		Enemy->OnCombatStart();
 		
-		UE_LOG(LogTemp, Log, TEXT("%s entered combat"), *Enemy->GetName());
+		UE_LOG(LogBlackholeAI, Log, TEXT("%s entered combat"), *Enemy->GetName());
 	}
 }
 
@@ -199,6 +202,6 @@ void UEnemyUtility::EndCombatState(ABaseEnemy* Enemy)
 		Enemy->SetCombatStarted(false);
 		Enemy->OnCombatEnd();
 		
-		UE_LOG(LogTemp, Log, TEXT("%s left combat"), *Enemy->GetName());
+		UE_LOG(LogBlackholeAI, Log, TEXT("%s left combat"), *Enemy->GetName());
 	}
 }
\ No newline at end of file
@@ -1,10 +1,14 @@
 #include "Enemy/HackerEnemy.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Data/EnemyStatsData.h"
 #include "Components/Abilities/Enemy/MindmeldComponent.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Systems/ResourceManager.h"
+#include "Systems/MindmeldChannelSubsystem.h"
 #include "Enemy/AI/HackerEnemyStateMachine.h"
 
 AHackerEnemy::AHackerEnemy()
@@ -45,8 +49,23 @@ void AHackerEnemy::BeginPlay()
 	}
 }
 
+void AHackerEnemy::ApplyArchetype(const FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields)
+{
+	Super::ApplyArchetype(Archetype, Fields);
+	
+	if (!EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Abilities))
+	{
+		return;
+	}
+	
+	MindmeldRange = Archetype.Stats.RangedAttackRange;
+	SafeDistance = Archetype.Stats.SafeDistance;
+}
+
 void AHackerEnemy::UpdateAIBehavior(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HackerEnemy AI Update", STAT_Blackhole_HackerEnemyAIUpdate, BlackholeAIChannel);
+
 	// Call parent implementation first to handle combat detection
 	Super::UpdateAIBehavior(DeltaTime);
 	
@@ -118,6 +137,13 @@ bool AHackerEnemy::HasLineOfSightToTarget() const
 		return false;
 	}
 
+	// Reuse the state machine's periodic check when it is tracking the same target
+	bool bCachedLineOfSight = false;
+	if (UMindmeldChannelSubsystem::GetCachedLineOfSight(this, TargetActor, bCachedLineOfSight))
+	{
+		return bCachedLineOfSight;
+	}
+
 	FHitResult HitResult;
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(this);
@@ -126,6 +152,7 @@ bool AHackerEnemy::HasLineOfSightToTarget() const
 	FVector Start = GetActorLocation() + FVector(0, 0, 50);
 	FVector End = TargetActor->GetActorLocation() + FVector(0, 0, 50);
 
+	BLACKHOLE_COUNT_QUERY(LOSTraces);
 	bool bHit = GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
 
 	// If nothing was hit between us and target, we have line of sight
@@ -159,7 +186,7 @@ void AHackerEnemy::OnDeath()
 			float WPReduction = 10.0f;
 			ResourceMgr->AddWillPower(-WPReduction);
 			
-			UE_LOG(LogTemp, Log, TEXT("HackerEnemy killed: Reduced player WP by %.0f"), WPReduction);
+			UE_LOG(LogBlackholeAI, Log, TEXT("HackerEnemy killed: Reduced player WP by %.0f"), WPReduction);
 		}
 	}
 	
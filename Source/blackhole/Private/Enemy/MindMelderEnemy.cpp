@@ -1,4 +1,7 @@
 #include "Enemy/MindMelderEnemy.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Data/EnemyStatsData.h"
 #include "Components/Abilities/Enemy/PowerfulMindmeldComponent.h"
 #include "Components/Abilities/Enemy/DodgeComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -69,8 +72,26 @@ void AMindMelderEnemy::BeginPlay()
 	CurrentWP = MaxWP;
 }
 
+void AMindMelderEnemy::ApplyArchetype(const FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields)
+{
+	Super::ApplyArchetype(Archetype, Fields);
+	
+	if (!EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Abilities))
+	{
+		return;
+	}
+	
+	if (DodgeAbility)
+	{
+		DodgeAbility->SetCooldown(Archetype.Stats.DodgeCooldown);
+		DodgeAbility->DodgeDistance = Archetype.Stats.DodgeDistance;
+	}
+}
+
 void AMindMelderEnemy::UpdateAIBehavior(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("MindMelderEnemy AI Update", STAT_Blackhole_MindMelderEnemyAIUpdate, BlackholeAIChannel);
+
 	// State machine handles all AI behavior now
 	Super::UpdateAIBehavior(DeltaTime);
 }
@@ -131,7 +152,7 @@ void AMindMelderEnemy::OnMindmeldStarted(float CastTime)
 		StateMachine->ChangeState(EEnemyState::Channeling);
 	}
 	
-	UE_LOG(LogTemp, Error, TEXT("%s: Beginning %.0f second mindmeld channel!"), *GetName(), CastTime);
+	UE_LOG(LogBlackholeAI, Error, TEXT("%s: Beginning %.0f second mindmeld channel!"), *GetName(), CastTime);
 }
 
 void AMindMelderEnemy::OnMindmeldComplete()
@@ -150,7 +171,7 @@ void AMindMelderEnemy::OnMindmeldComplete()
 		StateMachine->ChangeState(EEnemyState::Alert);
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("%s: Mindmeld complete!"), *GetName());
+	UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Mindmeld complete!"), *GetName());
 }
 
 void AMindMelderEnemy::OnMindmeldInterrupted()
@@ -169,7 +190,7 @@ void AMindMelderEnemy::OnMindmeldInterrupted()
 		StateMachine->ChangeState(EEnemyState::Retreat);
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("%s: Mindmeld interrupted!"), *GetName());
+	UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Mindmeld interrupted!"), *GetName());
 }
 
 void AMindMelderEnemy::MaintainSafeDistance(float DeltaTime)
@@ -198,6 +219,7 @@ bool AMindMelderEnemy::HasLineOfSightToTarget() const
 	FVector Start = GetActorLocation() + FVector(0, 0, 50);
 	FVector End = TargetActor->GetActorLocation() + FVector(0, 0, 50);
 	
+	BLACKHOLE_COUNT_QUERY(LOSTraces);
 	return !GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
 }
 
@@ -1,4 +1,7 @@
 #include "Enemy/StandardEnemy.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Data/EnemyStatsData.h"
 #include "Components/Abilities/Enemy/SwordAttackComponent.h"
 #include "Components/Abilities/Enemy/BuilderComponent.h"
 #include "Components/Abilities/Enemy/BlockComponent.h"
@@ -7,7 +10,7 @@
 #include "Engine/World.h"
 #include "Enemy/EnemyUtility.h"
 #include "Enemy/AI/StandardEnemyStateMachine.h"
-#include "Actors/PsiDisruptor.h"
+#include "Systems/BuildCoordinationSubsystem.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Components/Movement/WallRunComponent.h"
 
@@ -74,14 +77,54 @@ void AStandardEnemy::BeginPlay()
 	// Disable builder component if this enemy doesn't have builder ability
 	if (BuilderComponent && !bHasBuilderAbility)
 	{
-		BuilderComponent->SetComponentTickEnabled(false);
 		BuilderComponent->DestroyComponent();
 		BuilderComponent = nullptr;
 	}
 }
 
+void AStandardEnemy::OnDeath()
+{
+	// Corpses don't build; a dead leader cancels its build
+	if (BuilderComponent)
+	{
+		BuilderComponent->OnOwnerDied();
+	}
+	
+	Super::OnDeath();
+}
+
+void AStandardEnemy::ResetForRestart(const FTransform& SpawnTransform)
+{
+	Super::ResetForRestart(SpawnTransform);
+	
+	// OnDeath took the builder out of the coordination pool
+	if (BuilderComponent)
+	{
+		BuilderComponent->OnOwnerRevived();
+	}
+	PlayerAirWallRunTime = 0.0f;
+}
+
+void AStandardEnemy::ApplyArchetype(const FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields)
+{
+	Super::ApplyArchetype(Archetype, Fields);
+	
+	if (!EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Abilities))
+	{
+		return;
+	}
+	
+	if (BlockAbility)
+	{
+		BlockAbility->BlockDuration = Archetype.Stats.BlockDuration;
+		BlockAbility->SetCooldown(Archetype.Stats.BlockCooldown);
+	}
+}
+
 void AStandardEnemy::UpdateAIBehavior(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("StandardEnemy AI Update", STAT_Blackhole_StandardEnemyAIUpdate, BlackholeAIChannel);
+
 	// State machine handles all AI behavior now
 	Super::UpdateAIBehavior(DeltaTime);
 	
@@ -113,7 +156,7 @@ void AStandardEnemy::UpdateAIBehavior(float DeltaTime)
 				// Check if we should build due to excessive air/wall time
 				if (PlayerAirWallRunTime >= AirWallRunBuildThreshold && BuilderComponent && bHasBuilderAbility)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("%s: Player has been in air/wall run for %.1f seconds, initiating build!"), 
+					UE_LOG(LogBlackholeAI, Warning, TEXT("%s: Player has been in air/wall run for %.1f seconds, initiating build!"), 
 						*GetName(), PlayerAirWallRunTime);
 					CheckForBuildOpportunity();
 					PlayerAirWallRunTime = 0.0f; // Reset timer
@@ -180,37 +223,23 @@ void AStandardEnemy::CheckForBuildOpportunity()
 {
 	if (!BuilderComponent || BuilderComponent->IsBuilding()) return;
 	
+	UBuildCoordinationSubsystem* Coordination = GetWorld()->GetSubsystem<UBuildCoordinationSubsystem>();
+	if (!Coordination) return;
+	
 	// Check if we should join an existing build
-	if (UBuilderComponent* NearbyLeader = UBuilderComponent::FindNearestBuildLeader(this, BuilderComponent->BuildRadius))
+	if (UBuilderComponent* NearbyLeader = Coordination->FindNearestBuildLeader(GetActorLocation(), BuilderComponent->BuildRadius))
 	{
 		BuilderComponent->JoinBuild(NearbyLeader);
-		UE_LOG(LogTemp, Warning, TEXT("%s joining existing build"), *GetName());
+		UE_LOG(LogBlackholeAI, Warning, TEXT("%s joining existing build"), *GetName());
 		return;
 	}
 	
 	// Check if we should start a new build
 	if (ShouldStartBuilding())
 	{
-		// Find a good build location (between enemies)
-		TArray<AStandardEnemy*> NearbyStandardEnemies;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), AStandardEnemy::StaticClass(), 
-			reinterpret_cast<TArray<AActor*>&>(NearbyStandardEnemies));
-		
+		// Find a good build location (between builders)
 		FVector BuildLocation = GetActorLocation();
-		int32 BuilderCount = 0;
-		
-		for (AStandardEnemy* Enemy : NearbyStandardEnemies)
-		{
-			if (Enemy && Enemy != this && Enemy->BuilderComponent && Enemy->bHasBuilderAbility)
-			{
-				float Distance = FVector::Dist(GetActorLocation(), Enemy->GetActorLocation());
-				if (Distance <= BuilderComponent->BuildRadius)
-				{
-					BuildLocation += Enemy->GetActorLocation();
-					BuilderCount++;
-				}
-			}
-		}
+		const int32 BuilderCount = Coordination->GatherBuildersInRadius(GetActorLocation(), BuilderComponent->BuildRadius, BuilderComponent, BuildLocation);
 		
 		if (BuilderCount > 0)
 		{
@@ -218,7 +247,7 @@ void AStandardEnemy::CheckForBuildOpportunity()
 			BuildLocation.Z = GetActorLocation().Z; // Keep at ground level
 			
 			BuilderComponent->InitiateBuild(BuildLocation);
-			UE_LOG(LogTemp, Warning, TEXT("%s initiating build at %s"), *GetName(), *BuildLocation.ToString());
+			UE_LOG(LogBlackholeAI, Warning, TEXT("%s initiating build at %s"), *GetName(), *BuildLocation.ToString());
 		}
 	}
 }
@@ -228,28 +257,15 @@ bool AStandardEnemy::ShouldStartBuilding() const
 	// Don't build if already building or no builder component
 	if (!BuilderComponent || BuilderComponent->IsBuilding()) return false;
 	
+	const UBuildCoordinationSubsystem* Coordination = GetWorld()->GetSubsystem<UBuildCoordinationSubsystem>();
+	if (!Coordination) return false;
+	
 	// Check if there's already a psi-disruptor
-	TArray<AActor*> Disruptors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APsiDisruptor::StaticClass(), Disruptors);
-	if (Disruptors.Num() > 0) return false;
+	if (Coordination->HasActiveDisruptor()) return false;
 	
 	// Check if enough builders are nearby
-	int32 NearbyBuilders = 0;
-	TArray<AStandardEnemy*> AllStandardEnemies;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AStandardEnemy::StaticClass(), 
-		reinterpret_cast<TArray<AActor*>&>(AllStandardEnemies));
-	
-	for (AStandardEnemy* Enemy : AllStandardEnemies)
-	{
-		if (Enemy && Enemy != this && Enemy->BuilderComponent && Enemy->bHasBuilderAbility)
-		{
-			float Distance = FVector::Dist(GetActorLocation(), Enemy->GetActorLocation());
-			if (Distance <= BuilderComponent->BuildRadius)
-			{
-				NearbyBuilders++;
-			}
-		}
-	}
+	FVector LocationSum = FVector::ZeroVector;
+	const int32 NearbyBuilders = Coordination->GatherBuildersInRadius(GetActorLocation(), BuilderComponent->BuildRadius, BuilderComponent, LocationSum);
 	
 	// Always return true if triggered by air/wall run timer (player spent too much time in air)
 	if (PlayerAirWallRunTime >= AirWallRunBuildThreshold)
@@ -1,4 +1,6 @@
 #include "Enemy/TankEnemy.h"
+#include "Debug/BlackholeStats.h"
+#include "Data/EnemyStatsData.h"
 #include "Components/Abilities/Enemy/AreaDamageAbilityComponent.h"
 #include "Components/Abilities/Enemy/BlockComponent.h"
 #include "Components/Abilities/Enemy/HeatAuraComponent.h"
@@ -47,7 +49,6 @@ ATankEnemy::ATankEnemy()
 	{
 		HeatAuraAbility->DamagePerSecond = 5.0f;
 		HeatAuraAbility->AuraRadius = 300.0f;
-		HeatAuraAbility->TickInterval = 1.0f;
 		HeatAuraAbility->bAffectsEnemies = true; // Tank's heat affects other enemies too
 	}
 	
@@ -105,8 +106,60 @@ void ATankEnemy::BeginPlay()
 	CurrentWP = MaxWP;
 }
 
+void ATankEnemy::ResetForRestart(const FTransform& SpawnTransform)
+{
+	Super::ResetForRestart(SpawnTransform);
+	
+	// Same overrides as BeginPlay
+	MaxWP = 150.0f;
+	CurrentWP = MaxWP;
+	SetShieldVisible(false);
+	
+	// The reset deactivated the aura; it runs for as long as the tank is alive
+	if (HeatAuraAbility)
+	{
+		HeatAuraAbility->Execute();
+	}
+}
+
+void ATankEnemy::ApplyArchetype(const FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields)
+{
+	Super::ApplyArchetype(Archetype, Fields);
+	
+	const FEnemyStatsData& Stats = Archetype.Stats;
+	
+	if (EnumHasAnyFlags(Fields, EEnemyArchetypeFields::AI))
+	{
+		AttackRange = Stats.AttackRange;
+		ChaseRange = Stats.ChaseRange;
+		BlockChance = Stats.BlockChance;
+	}
+	
+	if (!EnumHasAnyFlags(Fields, EEnemyArchetypeFields::Abilities))
+	{
+		return;
+	}
+	
+	// Ground slam comes from the area damage ability
+	if (AreaDamageAbility)
+	{
+		AreaDamageAbility->DamageRadius = Stats.GroundSlamRadius;
+		AreaDamageAbility->BaseDamage = Archetype.GroundSlamDamage;
+		AreaDamageAbility->KnockbackForce = Stats.GroundSlamKnockbackForce;
+		AreaDamageAbility->SetCooldown(Stats.GroundSlamCooldown);
+	}
+	
+	if (BlockAbility)
+	{
+		BlockAbility->BlockDuration = Stats.BlockDuration;
+		BlockAbility->SetCooldown(Stats.BlockCooldown);
+	}
+}
+
 void ATankEnemy::UpdateAIBehavior(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("TankEnemy AI Update", STAT_Blackhole_TankEnemyAIUpdate, BlackholeAIChannel);
+
 	// State machine handles all AI behavior now
 	// This method only exists for compatibility
 	Super::UpdateAIBehavior(DeltaTime);
@@ -1,4 +1,6 @@
 #include "Player/BlackholePlayerCharacter.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/InputComponent.h"
@@ -15,6 +17,7 @@
 #include "Systems/ThresholdManager.h"
 #include "Systems/GameStateManager.h"
 #include "Systems/ComboDetectionSubsystem.h"
+#include "Systems/PlayerActionEventBus.h"
 #include "UI/BlackholeHUD.h"
 #include "Components/Abilities/Player/Basic/SlashAbilityComponent.h"
 // #include "Components/Abilities/Player/SystemFreezeAbilityComponent.h" // Removed
@@ -37,6 +40,7 @@
 #include "Components/GravityDirectionComponent.h"
 #include "Config/GameplayConfig.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 
 ABlackholePlayerCharacter::ABlackholePlayerCharacter()
 {
@@ -123,6 +127,7 @@ ABlackholePlayerCharacter::ABlackholePlayerCharacter()
 
 	bIsFirstPerson = false;
 	FirstPersonCameraOffset = GameplayConfig::Movement::FIRST_PERSON_OFFSET;
+	AbilityInputBufferWindow = GameplayConfig::Abilities::InputBuffer::WINDOW;
 	HeadBoneName = "head"; // Default head bone name - adjust in Blueprint if different
 	WeaponSocketName = "weaponsocket"; // Default socket name - adjust in Blueprint if different
 	
@@ -215,6 +220,8 @@ void ABlackholePlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason
 		SetHeadVisibility(true);
 	}
 	
+	ClearBufferedAbilityInput();
+	
 	// Unbind from all events to prevent dangling references
 	
 	if (UWorld* World = GetWorld())
@@ -240,8 +247,15 @@ void ABlackholePlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason
 
 void ABlackholePlayerCharacter::Tick(float DeltaTime)
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Player Tick", STAT_Blackhole_PlayerTick, BlackholeMovementChannel);
+
 	Super::Tick(DeltaTime);
 	
+	if (BufferedInput != EBufferedAbilityInput::None)
+	{
+		ProcessBufferedAbilityInput(DeltaTime);
+	}
+	
 	// Continuously update camera position during gravity transitions
 	if (SpringArmComponent && !bIsFirstPerson && GetCharacterMovement())
 	{
@@ -279,14 +293,14 @@ bool ABlackholePlayerCharacter::HasResources_Implementation(float StaminaCost, f
 		// If WP > 0, always allow ability use (to trigger critical state)
 		if (CurrentWP > 0.0f)
 		{
-			UE_LOG(LogTemp, VeryVerbose, TEXT("HasResources: WP > 0 (%.1f) - allowing ability use"), CurrentWP);
+			UE_LOG(LogBlackhole, VeryVerbose, TEXT("HasResources: WP > 0 (%.1f) - allowing ability use"), CurrentWP);
 			return true;
 		}
 		
 		// If WP = 0, block (ultimate mode will bypass this)
 		if (CurrentWP <= 0.0f)
 		{
-			UE_LOG(LogTemp, VeryVerbose, TEXT("HasResources: WP at 0 - blocking unless in ultimate mode"));
+			UE_LOG(LogBlackhole, VeryVerbose, TEXT("HasResources: WP at 0 - blocking unless in ultimate mode"));
 			return false;
 		}
 	}
@@ -307,7 +321,7 @@ bool ABlackholePlayerCharacter::ConsumeResources_Implementation(float StaminaCos
 		{
 			if (!ResourceManager->ConsumeWillPower(WPCost))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Player: Not enough WP to use ability (need %.1f)"), WPCost);
+				UE_LOG(LogBlackhole, Warning, TEXT("Player: Not enough WP to use ability (need %.1f)"), WPCost);
 				return false;
 			}
 		}
@@ -451,10 +465,7 @@ void ABlackholePlayerCharacter::Look(const FInputActionValue& Value)
 
 void ABlackholePlayerCharacter::UseKill()
 {
-	if (KillAbility && KillAbility->CanExecute())
-	{
-		KillAbility->Execute();
-	}
+	HandleAbilityInput(EBufferedAbilityInput::Kill);
 }
 
 
@@ -463,14 +474,14 @@ void ABlackholePlayerCharacter::ToggleCamera()
 	// Safety checks - don't switch camera if character is invalid or dead
 	if (!IsValid(this) || bIsDead)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PlayerCharacter: Cannot toggle camera - character is invalid or dead"));
+		UE_LOG(LogBlackhole, Warning, TEXT("PlayerCharacter: Cannot toggle camera - character is invalid or dead"));
 		return;
 	}
 	
 	// Check if all required components are valid
 	if (!IsValid(CameraComponent) || !IsValid(SpringArmComponent) || !IsValid(GetMesh()) || !IsValid(GetCharacterMovement()))
 	{
-		UE_LOG(LogTemp, Error, TEXT("PlayerCharacter: Cannot toggle camera - required components are invalid"));
+		UE_LOG(LogBlackhole, Error, TEXT("PlayerCharacter: Cannot toggle camera - required components are invalid"));
 		return;
 	}
 	
@@ -480,7 +491,7 @@ void ABlackholePlayerCharacter::ToggleCamera()
 		EMovementMode CurrentMovementMode = GetCharacterMovement()->MovementMode;
 		if (CurrentMovementMode != MOVE_Walking && CurrentMovementMode != MOVE_Falling)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("PlayerCharacter: Cannot toggle camera during movement mode %d - wait until walking or falling"), (int32)CurrentMovementMode);
+			UE_LOG(LogBlackhole, Warning, TEXT("PlayerCharacter: Cannot toggle camera during movement mode %d - wait until walking or falling"), (int32)CurrentMovementMode);
 			return;
 		}
 	}
@@ -517,7 +528,7 @@ void ABlackholePlayerCharacter::ToggleCamera()
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("PlayerCharacter: Cannot attach camera - mesh or camera component is invalid"));
+				UE_LOG(LogBlackhole, Error, TEXT("PlayerCharacter: Cannot attach camera - mesh or camera component is invalid"));
 				return;
 			}
 		}
@@ -611,21 +622,21 @@ void ABlackholePlayerCharacter::SetHeadVisibility(bool bVisible)
 	// Safety checks - don't manipulate bones if character is invalid or dead
 	if (!IsValid(this) || bIsDead)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PlayerCharacter: Cannot set head visibility - character is invalid or dead"));
+		UE_LOG(LogBlackhole, Warning, TEXT("PlayerCharacter: Cannot set head visibility - character is invalid or dead"));
 		return;
 	}
 	
 	// Check if mesh is valid and head bone name is set
 	if (!IsValid(GetMesh()) || HeadBoneName.IsNone() || HeadBoneName.ToString().IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PlayerCharacter: Cannot set head visibility - invalid mesh or head bone name"));
+		UE_LOG(LogBlackhole, Warning, TEXT("PlayerCharacter: Cannot set head visibility - invalid mesh or head bone name"));
 		return;
 	}
 	
 	// Additional safety check - ensure the mesh has the bone
 	if (!GetMesh()->GetSkeletalMeshAsset())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PlayerCharacter: Cannot set head visibility - no skeletal mesh asset"));
+		UE_LOG(LogBlackhole, Warning, TEXT("PlayerCharacter: Cannot set head visibility - no skeletal mesh asset"));
 		return;
 	}
 	
@@ -635,17 +646,22 @@ void ABlackholePlayerCharacter::SetHeadVisibility(bool bVisible)
 
 
 void ABlackholePlayerCharacter::UseDash()
+{
+	HandleAbilityInput(EBufferedAbilityInput::Dash);
+}
+
+bool ABlackholePlayerCharacter::TryUseDash()
 {
 	// Safety check
 	if (!IsValid(this) || bIsDead)
 	{
-		return;
+		return false;
 	}
 	
 	// Check if status effects allow movement/dashing
 	if (StatusEffectComponent && !StatusEffectComponent->CanMove())
 	{
-		return; // Movement/dashing blocked by status effects
+		return false; // Movement/dashing blocked by status effects
 	}
 	
 	// Only register input if ability can execute
@@ -663,7 +679,9 @@ void ABlackholePlayerCharacter::UseDash()
 		{
 			ComboSystem->RegisterInput(this, EComboInput::Dash, GetActorLocation());
 		}
+		return true;
 	}
+	return false;
 }
 
 void ABlackholePlayerCharacter::UseUtilityJump()
@@ -681,14 +699,14 @@ void ABlackholePlayerCharacter::UseUtilityJump()
 	}
 	
 	// Debug: Show that jump input was received
-	UE_LOG(LogTemp, Warning, TEXT("UseUtilityJump() called!"));
+	UE_LOG(LogBlackhole, Warning, TEXT("UseUtilityJump() called!"));
 	// Debug message removed - space pressed
 	
 	// Check wall running first - wall run takes priority for jump input
 	if (IsValid(WallRunComponent))
 	{
 		bool bIsWallRunning = WallRunComponent->IsWallRunning();
-		UE_LOG(LogTemp, Warning, TEXT("UseUtilityJump: WallRunComponent valid, IsWallRunning = %s"), 
+		UE_LOG(LogBlackhole, Warning, TEXT("UseUtilityJump: WallRunComponent valid, IsWallRunning = %s"), 
 			bIsWallRunning ? TEXT("TRUE") : TEXT("FALSE"));
 		
 		if (bIsWallRunning)
@@ -718,7 +736,7 @@ void ABlackholePlayerCharacter::UseUtilityJump()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UseUtilityJump: WallRunComponent is NULL or invalid!"));
+		UE_LOG(LogBlackhole, Warning, TEXT("UseUtilityJump: WallRunComponent is NULL or invalid!"));
 	}
 	
 	// Check if wall run can be started
@@ -766,11 +784,16 @@ void ABlackholePlayerCharacter::ToggleMenu()
 
 
 void ABlackholePlayerCharacter::UseAbilitySlot1()
+{
+	HandleAbilityInput(EBufferedAbilityInput::Slot1);
+}
+
+bool ABlackholePlayerCharacter::TryUseSlash()
 {
 	// Safety check
 	if (!IsValid(this) || bIsDead)
 	{
-		return;
+		return false;
 	}
 	
 	// Left Mouse Button - Basic attack
@@ -786,7 +809,7 @@ void ABlackholePlayerCharacter::UseAbilitySlot1()
 			GetCharacterMovement()->MovementMode != MOVE_Falling)
 		{
 			bCanSlash = false;
-			UE_LOG(LogTemp, Warning, TEXT("PlayerCharacter: Cannot slash during movement mode %d"), 
+			UE_LOG(LogBlackhole, Verbose, TEXT("PlayerCharacter: Cannot slash during movement mode %d"), 
 				(int32)GetCharacterMovement()->MovementMode);
 		}
 	}
@@ -811,24 +834,24 @@ void ABlackholePlayerCharacter::UseAbilitySlot1()
 			if (LastAbilityUsed == ELastAbilityUsed::Dash && IsValid(DashSlashCombo) && DashSlashCombo->CanExecute())
 			{
 				// Execute Dash + Slash combo (Phantom Strike)
-				UE_LOG(LogTemp, Log, TEXT("Executing DashSlashCombo (Phantom Strike)"));
+				UE_LOG(LogBlackhole, Log, TEXT("Executing DashSlashCombo (Phantom Strike)"));
 				DashSlashCombo->Execute();
 				
 				// Reset combo tracking
 				LastAbilityUsed = ELastAbilityUsed::None;
 				LastAbilityTime = 0.0f;
-				return; // Don't execute normal slash
+				return true; // Don't execute normal slash
 			}
 			else if (LastAbilityUsed == ELastAbilityUsed::Jump && IsValid(JumpSlashCombo) && JumpSlashCombo->CanExecute())
 			{
 				// Execute Jump + Slash combo (Aerial Rave)
-				UE_LOG(LogTemp, Log, TEXT("Executing JumpSlashCombo (Aerial Rave)"));
+				UE_LOG(LogBlackhole, Log, TEXT("Executing JumpSlashCombo (Aerial Rave)"));
 				JumpSlashCombo->Execute();
 				
 				// Reset combo tracking
 				LastAbilityUsed = ELastAbilityUsed::None;
 				LastAbilityTime = 0.0f;
-				return; // Don't execute normal slash
+				return true; // Don't execute normal slash
 			}
 		}
 		
@@ -838,60 +861,170 @@ void ABlackholePlayerCharacter::UseAbilitySlot1()
 		// Reset combo tracking since we used slash
 		LastAbilityUsed = ELastAbilityUsed::None;
 		LastAbilityTime = 0.0f;
+		return true;
 	}
+	return false;
 }
 
 void ABlackholePlayerCharacter::UseAbilitySlot2()
 {
 	// Right Mouse Button - Firewall Breach
-	if (IsValid(FirewallBreachAbility) && FirewallBreachAbility->CanExecute())
-	{
-		FirewallBreachAbility->Execute();
-	}
+	HandleAbilityInput(EBufferedAbilityInput::Slot2);
 }
 
 void ABlackholePlayerCharacter::UseAbilitySlot3()
 {
 	// Q key - Pulse Hack
-	if (IsValid(PulseHackAbility) && PulseHackAbility->CanExecute())
-	{
-		PulseHackAbility->Execute();
-	}
+	HandleAbilityInput(EBufferedAbilityInput::Slot3);
 }
 
 void ABlackholePlayerCharacter::UseAbilitySlot4()
 {
 	// E key - Gravity Pull
-	if (IsValid(GravityPullAbility) && GravityPullAbility->CanExecute())
-	{
-		GravityPullAbility->Execute();
-	}
+	HandleAbilityInput(EBufferedAbilityInput::Slot4);
 }
 
 void ABlackholePlayerCharacter::UseAbilitySlot5()
 {
 	// R key - Data Spike
-	if (IsValid(DataSpikeAbility) && DataSpikeAbility->CanExecute())
-	{
-		DataSpikeAbility->Execute();
-	}
+	HandleAbilityInput(EBufferedAbilityInput::Slot5);
 }
 
 void ABlackholePlayerCharacter::UseAbilitySlot6()
 {
 	// F key - System Override
-	if (IsValid(SystemOverrideAbility) && SystemOverrideAbility->CanExecute())
-	{
-		SystemOverrideAbility->Execute();
-	}
+	HandleAbilityInput(EBufferedAbilityInput::Slot6);
 }
 
 void ABlackholePlayerCharacter::UseAbilitySlot7()
 {
 	// G key - Gravity Shift
-	if (IsValid(GravityShiftAbility) && GravityShiftAbility->CanExecute())
+	HandleAbilityInput(EBufferedAbilityInput::Slot7);
+}
+
+bool ABlackholePlayerCharacter::TryExecuteAbility(UAbilityComponent* Ability)
+{
+	if (IsValid(Ability) && Ability->CanExecute())
+	{
+		Ability->Execute();
+		return true;
+	}
+	return false;
+}
+
+UAbilityComponent* ABlackholePlayerCharacter::GetAbilityForInput(EBufferedAbilityInput Input) const
+{
+	switch (Input)
+	{
+		case EBufferedAbilityInput::Kill:  return KillAbility;
+		case EBufferedAbilityInput::Dash:  return HackerDashAbility;
+		case EBufferedAbilityInput::Slot1: return SlashAbility;
+		case EBufferedAbilityInput::Slot2: return FirewallBreachAbility;
+		case EBufferedAbilityInput::Slot3: return PulseHackAbility;
+		case EBufferedAbilityInput::Slot4: return GravityPullAbility;
+		case EBufferedAbilityInput::Slot5: return DataSpikeAbility;
+		case EBufferedAbilityInput::Slot6: return SystemOverrideAbility;
+		case EBufferedAbilityInput::Slot7: return GravityShiftAbility;
+		default: return nullptr;
+	}
+}
+
+bool ABlackholePlayerCharacter::TryAbilityInput(EBufferedAbilityInput Input)
+{
+	// Classify before executing - Execute drops the ability out of ultimate mode
+	EPlayerActionType ActionType = EPlayerActionType::Attack;
+	const UAbilityComponent* Ability = GetAbilityForInput(Input);
+	if (IsValid(Ability) && Ability->IsInUltimateMode() && !Ability->IsBasicAbility())
+	{
+		ActionType = EPlayerActionType::Ultimate;
+	}
+	else if (Input == EBufferedAbilityInput::Dash)
+	{
+		ActionType = EPlayerActionType::Dash;
+	}
+	
+	bool bExecuted = false;
+	switch (Input)
+	{
+		case EBufferedAbilityInput::Dash:  bExecuted = TryUseDash(); break;
+		case EBufferedAbilityInput::Slot1: bExecuted = TryUseSlash(); break;
+		case EBufferedAbilityInput::None:  return false;
+		default: bExecuted = TryExecuteAbility(GetAbilityForInput(Input)); break;
+	}
+	
+	if (bExecuted)
+	{
+		PublishPlayerAction(ActionType);
+	}
+	return bExecuted;
+}
+
+void ABlackholePlayerCharacter::PublishPlayerAction(EPlayerActionType ActionType)
+{
+	UPlayerActionEventBus* ActionBus = GetWorld()->GetSubsystem<UPlayerActionEventBus>();
+	if (!ActionBus)
+	{
+		return;
+	}
+	
+	// Abilities aim with the camera, so use its yaw rather than the body's
+	const FVector Facing = Controller ? FRotator(0.0f, Controller->GetControlRotation().Yaw, 0.0f).Vector() : GetActorForwardVector();
+	ActionBus->Publish(ActionType, this, GetActorLocation(), Facing);
+}
+
+void ABlackholePlayerCharacter::HandleAbilityInput(EBufferedAbilityInput Input)
+{
+	if (TryAbilityInput(Input))
+	{
+		// A fresh press that fires immediately supersedes anything still queued
+		ClearBufferedAbilityInput();
+		return;
+	}
+	
+	if (bIsDead || AbilityInputBufferWindow <= 0.0f)
+	{
+		return;
+	}
+	
+	// Only queue presses that can become legal inside the window
+	UAbilityComponent* Ability = GetAbilityForInput(Input);
+	if (!IsValid(Ability) || Ability->IsDisabled() || Ability->GetCooldownRemaining() > AbilityInputBufferWindow)
+	{
+		return;
+	}
+	
+	// Latest press wins
+	BufferedInput = Input;
+	BufferedInputExpiryTime = GetWorld()->GetTimeSeconds() + AbilityInputBufferWindow;
+	bBufferedInputWarmed = false;
+}
+
+void ABlackholePlayerCharacter::ProcessBufferedAbilityInput(float DeltaTime)
+{
+	const EBufferedAbilityInput Input = BufferedInput;
+	
+	// Cooldowns are timestamps, so this fires on the first frame the ability is legal
+	if (TryAbilityInput(Input))
+	{
+		UE_LOG(LogBlackhole, Verbose, TEXT("PlayerCharacter: Fired buffered ability input %d"), (int32)Input);
+		ClearBufferedAbilityInput();
+		return;
+	}
+	
+	if (GetWorld()->GetTimeSeconds() >= BufferedInputExpiryTime)
+	{
+		ClearBufferedAbilityInput();
+		return;
+	}
+	
+	// Expected to become legal next frame - let the ability warm up its queries now, once per
+	// press, and only if nothing but the cooldown is holding it back
+	UAbilityComponent* Ability = GetAbilityForInput(Input);
+	if (!bBufferedInputWarmed && IsValid(Ability) && Ability->GetCooldownRemaining() <= DeltaTime
+		&& Ability->CanExecuteIgnoringCooldown())
 	{
-		GravityShiftAbility->Execute();
+		Ability->PrepareExecution();
+		bBufferedInputWarmed = true;
 	}
 }
 
@@ -932,7 +1065,7 @@ void ABlackholePlayerCharacter::UpdateMovementSettings()
 		Movement->MaxAcceleration = 1200.0f;
 		Movement->MinAnalogWalkSpeed = 20.0f;
 		
-		UE_LOG(LogTemp, Warning, TEXT("Movement settings updated - Friction: %.2f, Deceleration: %.2f, MaxSpeed: %.2f"), 
+		UE_LOG(LogBlackhole, Warning, TEXT("Movement settings updated - Friction: %.2f, Deceleration: %.2f, MaxSpeed: %.2f"), 
 			GroundFriction, BrakingDeceleration, MaxWalkSpeed);
 	}
 }
@@ -953,6 +1086,7 @@ bool ABlackholePlayerCharacter::GetCrosshairTarget(FHitResult& OutHit, float Max
 	QueryParams.bTraceComplex = false;
 	
 	// Trace from camera through crosshair
+	BLACKHOLE_COUNT_QUERY(HitQueries);
 	return GetWorld()->LineTraceSingleByChannel(
 		OutHit,
 		CameraLocation,
@@ -985,8 +1119,9 @@ void ABlackholePlayerCharacter::Die()
 	}
 	
 	bIsDead = true;
+	ClearBufferedAbilityInput();
 	
-	UE_LOG(LogTemp, Error, TEXT("=== PLAYER DEATH TRIGGERED ==="));
+	UE_LOG(LogBlackhole, Error, TEXT("=== PLAYER DEATH TRIGGERED ==="));
 	
 	// Check if critical timer is active - we should NOT interfere with it
 	if (UWorld* World = GetWorld())
@@ -995,7 +1130,7 @@ void ABlackholePlayerCharacter::Die()
 		{
 			if (ThresholdMgr->IsCriticalTimerActive())
 			{
-				UE_LOG(LogTemp, Error, TEXT("WARNING: Player died while critical timer active! Timer should continue running."));
+				UE_LOG(LogBlackhole, Error, TEXT("WARNING: Player died while critical timer active! Timer should continue running."));
 			}
 		}
 	}
@@ -1094,17 +1229,90 @@ void ABlackholePlayerCharacter::Die()
 	}
 }
 
+void ABlackholePlayerCharacter::ResetForRestart(const FTransform& SpawnTransform)
+{
+	const bool bWasDead = bIsDead;
+	bIsDead = false;
+	ClearBufferedAbilityInput();
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	// Die() unbinds these; AddUnique keeps a living player from binding twice
+	if (UResourceManager* ResourceMgr = GetGameInstance()->GetSubsystem<UResourceManager>())
+	{
+		ResourceMgr->OnWPDepleted.AddUniqueDynamic(this, &ABlackholePlayerCharacter::OnWPDepleted);
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UThresholdManager* ThresholdMgr = World->GetSubsystem<UThresholdManager>())
+		{
+			ThresholdMgr->OnPlayerDeath.AddUniqueDynamic(this, &ABlackholePlayerCharacter::OnThresholdDeath);
+		}
+	}
+
+	// Put the ragdolled mesh back on the capsule
+	if (bWasDead && IsValid(GetMesh()))
+	{
+		GetMesh()->SetSimulatePhysics(false);
+		GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+		GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+		GetMesh()->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	}
+
+	// Death and game-over cleanup stop every ability from ticking
+	TArray<UActorComponent*> AllComponents = GetComponents().Array();
+	for (UActorComponent* Component : AllComponents)
+	{
+		if (UAbilityComponent* Ability = Cast<UAbilityComponent>(Component))
+		{
+			Ability->ResetCooldownForRestart();
+			Ability->SetComponentTickEnabled(Ability->PrimaryComponentTick.bStartWithTickEnabled);
+		}
+	}
+
+	if (StatusEffectComponent)
+	{
+		StatusEffectComponent->ClearAllStatusEffects();
+	}
+
+	if (GravityDirectionComponent)
+	{
+		GravityDirectionComponent->SetGravityDirection(FVector(0, 0, -1));
+	}
+
+	if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
+	{
+		MovementComp->StopMovementImmediately();
+		MovementComp->SetMovementMode(MOVE_Walking);
+	}
+	UpdateMovementSettings();
+
+	TeleportTo(SpawnTransform.GetLocation(), SpawnTransform.Rotator(), false, true);
+
+	if (APlayerController* PC = Cast<APlayerController>(GetController()))
+	{
+		PC->SetControlRotation(SpawnTransform.Rotator());
+		EnableInput(PC);
+	}
+
+	UE_LOG(LogBlackhole, Log, TEXT("Player reset for restart at %s"), *SpawnTransform.GetLocation().ToString());
+}
+
 // Removed CheckIntegrity - now using event-driven system
 
 void ABlackholePlayerCharacter::OnThresholdDeath()
 {
-	UE_LOG(LogTemp, Error, TEXT("Player death triggered by ThresholdManager!"));
+	UE_LOG(LogBlackhole, Error, TEXT("Player death triggered by ThresholdManager!"));
 	Die();
 }
 
 void ABlackholePlayerCharacter::OnWPDepleted()
 {
-	UE_LOG(LogTemp, Warning, TEXT("Player: WP reached 0 - Starting critical timer!"));
+	UE_LOG(LogBlackhole, Warning, TEXT("Player: WP reached 0 - Starting critical timer!"));
 	
 	// Start critical timer and activate ultimate mode
 	if (UWorld* World = GetWorld())
@@ -1128,7 +1336,7 @@ float ABlackholePlayerCharacter::TakeDamage(float DamageAmount, struct FDamageEv
 		// If WP is at 0 (critical state), no damage
 		if (ResourceMgr->GetCurrentWillPower() <= 0.0f)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Player immune to damage - WP at 0 (critical state)!"));
+			UE_LOG(LogBlackhole, Warning, TEXT("Player immune to damage - WP at 0 (critical state)!"));
 			return 0.0f;
 		}
 		
@@ -1139,7 +1347,7 @@ float ABlackholePlayerCharacter::TakeDamage(float DamageAmount, struct FDamageEv
 			{
 				if (ThresholdMgr->IsCriticalTimerActive())
 				{
-					UE_LOG(LogTemp, Warning, TEXT("Player immune to damage during critical timer!"));
+					UE_LOG(LogBlackhole, Warning, TEXT("Player immune to damage during critical timer!"));
 					return 0.0f;
 				}
 			}
@@ -1148,7 +1356,7 @@ float ABlackholePlayerCharacter::TakeDamage(float DamageAmount, struct FDamageEv
 		// Route damage to WP
 		ResourceMgr->TakeDamage(DamageAmount);
 		
-		UE_LOG(LogTemp, Warning, TEXT("Player took %.1f damage, WP reduced"), DamageAmount);
+		UE_LOG(LogBlackhole, Warning, TEXT("Player took %.1f damage, WP reduced"), DamageAmount);
 		
 		// Return the actual damage dealt
 		return DamageAmount;
@@ -1219,11 +1427,11 @@ void ABlackholePlayerCharacter::OnGravityDirectionChanged(FVector NewGravityDire
 		SpringArmComponent->SocketOffset = NewSocketOffset;
 		SpringArmComponent->TargetOffset = NewTargetOffset;
 		
-		UE_LOG(LogTemp, Log, TEXT("Camera spring arm adjusted for gravity: SocketOffset=%s, TargetOffset=%s"), 
+		UE_LOG(LogBlackhole, Log, TEXT("Camera spring arm adjusted for gravity: SocketOffset=%s, TargetOffset=%s"), 
 			*NewSocketOffset.ToString(), *NewTargetOffset.ToString());
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Gravity direction changed to: %s"), *NewGravityDirection.ToString());
+	UE_LOG(LogBlackhole, Log, TEXT("Gravity direction changed to: %s"), *NewGravityDirection.ToString());
 }
 
 
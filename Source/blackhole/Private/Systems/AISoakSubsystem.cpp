@@ -0,0 +1,426 @@
+#include "Systems/AISoakSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
+#include "Config/GameplayConfig.h"
+#include "Systems/ComboDetectionSubsystem.h"
+#include "Systems/BuildCoordinationSubsystem.h"
+#include "Systems/EnemyTrackingManager.h"
+#include "Player/BlackholePlayerCharacter.h"
+#include "Enemy/BaseEnemy.h"
+#include "Enemy/AI/EnemyStateBase.h"
+#include "Components/StatusEffectComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/DamageEvents.h"
+#include "GameFramework/DamageType.h"
+#include "GameFramework/WorldSettings.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "UObject/UObjectIterator.h"
+
+bool UAISoakSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && FParse::Param(FCommandLine::Get(), TEXT("AISoak"));
+}
+
+void UAISoakSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ParseCommandLine();
+
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UAISoakSubsystem::OnPostGarbageCollect);
+	BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UAISoakSubsystem::OnBeginFrame);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UAISoakSubsystem::OnEndFrame);
+}
+
+void UAISoakSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+	FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	if (IsRunning())
+	{
+		UE_LOG(LogBlackhole, Warning, TEXT("AISoak: World torn down after %.1f game minutes, %d samples written"), GameTime / 60.0f, SamplesWritten);
+		RestoreTimeSettings();
+		Phase = EPhase::Done;
+	}
+
+	Super::Deinitialize();
+}
+
+void UAISoakSubsystem::ParseCommandLine()
+{
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	float Hours = GameplayConfig::Soak::DURATION_HOURS;
+	StepHz = GameplayConfig::Soak::STEP_HZ;
+	TimeScale = GameplayConfig::Soak::TIME_SCALE;
+	WaveSize = GameplayConfig::Soak::WAVE_SIZE;
+	WaveInterval = GameplayConfig::Soak::WAVE_INTERVAL;
+	WaveLifetime = GameplayConfig::Soak::WAVE_LIFETIME;
+	MaxAlive = GameplayConfig::Soak::MAX_ALIVE;
+	SampleInterval = GameplayConfig::Soak::SAMPLE_INTERVAL;
+
+	FParse::Value(CommandLine, TEXT("SoakHours="), Hours);
+	FParse::Value(CommandLine, TEXT("SoakStepHz="), StepHz);
+	FParse::Value(CommandLine, TEXT("SoakTimeScale="), TimeScale);
+	FParse::Value(CommandLine, TEXT("SoakWaveSize="), WaveSize);
+	FParse::Value(CommandLine, TEXT("SoakWaveInterval="), WaveInterval);
+	FParse::Value(CommandLine, TEXT("SoakWaveLifetime="), WaveLifetime);
+	FParse::Value(CommandLine, TEXT("SoakMaxAlive="), MaxAlive);
+	FParse::Value(CommandLine, TEXT("SoakSampleInterval="), SampleInterval);
+
+	DurationSeconds = FMath::Max(Hours, 0.01f) * 3600.0f;
+	StepHz = FMath::Clamp(StepHz, 10.0f, 120.0f);
+	TimeScale = FMath::Max(TimeScale, 1.0f);
+	WaveSize = FMath::Max(WaveSize, 1);
+	WaveInterval = FMath::Max(WaveInterval, 1.0f);
+	WaveLifetime = FMath::Max(WaveLifetime, 1.0f);
+	MaxAlive = FMath::Max(MaxAlive, WaveSize);
+	SampleInterval = FMath::Max(SampleInterval, 1.0f);
+
+	EnemyMix.ParseCommandLine(CommandLine, TEXT("SoakMix="));
+
+	int32 Seed = 1337;
+	FParse::Value(CommandLine, TEXT("SoakSeed="), Seed);
+	Random.Initialize(Seed);
+
+	if (!FParse::Value(CommandLine, TEXT("SoakOut="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("Soak") /
+			FString::Printf(TEXT("AISoak_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	}
+}
+
+void UAISoakSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	ApplyTimeSettings();
+
+	FString Header = TEXT("GameMinutes,WallMinutes,Waves,Spawned,Expired,EnemyActors,EnemiesAlive,TrackedEnemies,")
+		TEXT("StateObjects,RootedStateObjects,ActiveBuilders,ActiveCombos,InputHistories,StatusEffectComponents,")
+		TEXT("UObjects,FrameMsAvg,FrameMsMax,UsedPhysicalMB");
+	for (int32 Index = 0; Index < FBlackholeMemoryReport::NumCategories; Index++)
+	{
+		Header += FString::Printf(TEXT(",%sKB"), FBlackholeMemoryReport::GetCategoryName((EBlackholeMemoryCategory)Index));
+	}
+	Header += TEXT("\n");
+
+	if (!FFileHelper::SaveStringToFile(Header, *OutputPath))
+	{
+		UE_LOG(LogBlackhole, Error, TEXT("AISoak: Failed to create %s"), *OutputPath);
+	}
+
+	UE_LOG(LogBlackhole, Log, TEXT("AISoak: %.1f game hours, fixed %.0f Hz x%.1f dilation, waves of %d every %.0fs (mix %s), output %s"),
+		DurationSeconds / 3600.0f, StepHz, TimeScale, WaveSize, WaveInterval, *EnemyMix.Describe(), *OutputPath);
+
+	ArenaSimulation::PreloadEnemyMix(&InWorld, EnemyMix);
+
+	Phase = EPhase::WaitingForPlayer;
+}
+
+void UAISoakSubsystem::ApplyTimeSettings()
+{
+	bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+
+	// A fixed step is not throttled to real time, so the engine ticks as fast as the game thread allows
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / StepHz);
+
+	if (AWorldSettings* WorldSettings = GetWorld()->GetWorldSettings())
+	{
+		WorldSettings->MaxGlobalTimeDilation = FMath::Max(WorldSettings->MaxGlobalTimeDilation, TimeScale);
+		WorldSettings->SetTimeDilation(TimeScale);
+	}
+}
+
+void UAISoakSubsystem::RestoreTimeSettings()
+{
+	FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+
+	if (AWorldSettings* WorldSettings = GetWorld() ? GetWorld()->GetWorldSettings() : nullptr)
+	{
+		WorldSettings->SetTimeDilation(1.0f);
+	}
+}
+
+TStatId UAISoakSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAISoakSubsystem, STATGROUP_Blackhole);
+}
+
+void UAISoakSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Phase == EPhase::WaitingForPlayer)
+	{
+		ABlackholePlayerCharacter* PlayerCharacter = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+		if (!PlayerCharacter)
+		{
+			return;
+		}
+
+		Bot.Setup(PlayerCharacter, PlayerCharacter->GetActorLocation());
+		GameTime = 0.0f;
+		NextWaveTime = 0.0f;
+		NextSampleTime = 0.0f;
+		WallStartSeconds = FPlatformTime::Seconds();
+		Phase = EPhase::Running;
+	}
+
+	if (Phase != EPhase::Running)
+	{
+		return;
+	}
+
+	// DeltaTime is already dilated, so this is game time
+	GameTime += DeltaTime;
+
+	// A sample waits for the forced GC, so counts only include objects that are really alive
+	if (bSampleRequested)
+	{
+		if (bGarbageCollected)
+		{
+			WriteSample();
+			if (GameTime >= DurationSeconds)
+			{
+				FinishSoak();
+				return;
+			}
+		}
+	}
+	else if (GameTime >= NextSampleTime || GameTime >= DurationSeconds)
+	{
+		RequestSample();
+	}
+
+	Bot.Tick(DeltaTime);
+	ExpireWaves();
+
+	if (GameTime >= NextWaveTime && GameTime < DurationSeconds)
+	{
+		SpawnWave();
+		NextWaveTime = GameTime + WaveInterval;
+	}
+}
+
+void UAISoakSubsystem::SpawnWave()
+{
+	const int32 Count = FMath::Min(WaveSize, MaxAlive - CountAliveEnemies());
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	TArray<ABaseEnemy*> Spawned;
+	ArenaSimulation::SpawnEnemies(GetWorld(), Bot.GetCenter(), Count, EnemyMix, Random, Spawned);
+
+	FWave& Wave = Waves.AddDefaulted_GetRef();
+	Wave.SpawnTime = GameTime;
+	for (ABaseEnemy* Enemy : Spawned)
+	{
+		Wave.Enemies.Add(Enemy);
+	}
+
+	WavesSpawned++;
+	EnemiesSpawned += Spawned.Num();
+}
+
+void UAISoakSubsystem::ExpireWaves()
+{
+	for (int32 WaveIndex = Waves.Num() - 1; WaveIndex >= 0; WaveIndex--)
+	{
+		FWave& Wave = Waves[WaveIndex];
+		if (GameTime - Wave.SpawnTime < WaveLifetime)
+		{
+			continue;
+		}
+
+		// Kill through the damage path so death, corpse lifespan and unregistering all run
+		for (const TWeakObjectPtr<ABaseEnemy>& EnemyPtr : Wave.Enemies)
+		{
+			ABaseEnemy* Enemy = EnemyPtr.Get();
+			if (Enemy && !Enemy->IsDead())
+			{
+				Enemy->TakeDamage(Enemy->GetMaxWP() + 1.0f, FDamageEvent(UDamageType::StaticClass()), nullptr, nullptr);
+				EnemiesExpired++;
+			}
+		}
+		Waves.RemoveAtSwap(WaveIndex);
+	}
+}
+
+int32 UAISoakSubsystem::CountAliveEnemies() const
+{
+	int32 Alive = 0;
+	for (const FWave& Wave : Waves)
+	{
+		for (const TWeakObjectPtr<ABaseEnemy>& EnemyPtr : Wave.Enemies)
+		{
+			const ABaseEnemy* Enemy = EnemyPtr.Get();
+			if (Enemy && !Enemy->IsDead())
+			{
+				Alive++;
+			}
+		}
+	}
+	return Alive;
+}
+
+void UAISoakSubsystem::RequestSample()
+{
+	bSampleRequested = true;
+	bGarbageCollected = false;
+	NextSampleTime = GameTime + SampleInterval;
+
+	// Runs at the end of this frame; OnPostGarbageCollect picks it up
+	GEngine->ForceGarbageCollection(true);
+}
+
+void UAISoakSubsystem::OnPostGarbageCollect()
+{
+	if (bSampleRequested)
+	{
+		bGarbageCollected = true;
+	}
+}
+
+void UAISoakSubsystem::WriteSample()
+{
+	bSampleRequested = false;
+	bGarbageCollected = false;
+
+	UWorld* World = GetWorld();
+
+	int32 EnemyActors = 0;
+	int32 EnemiesAlive = 0;
+	for (TActorIterator<ABaseEnemy> It(World); It; ++It)
+	{
+		EnemyActors++;
+		if (!It->IsDead())
+		{
+			EnemiesAlive++;
+		}
+	}
+
+	// State objects are rooted while their machine is alive, so these two should track each other
+	int32 StateObjects = 0;
+	int32 RootedStateObjects = 0;
+	for (TObjectIterator<UEnemyStateBase> It; It; ++It)
+	{
+		StateObjects++;
+		if (It->IsRooted())
+		{
+			RootedStateObjects++;
+		}
+	}
+
+	int32 StatusEffectComponents = 0;
+	for (TObjectIterator<UStatusEffectComponent> It; It; ++It)
+	{
+		if (It->GetWorld() == World)
+		{
+			StatusEffectComponents++;
+		}
+	}
+
+	const UEnemyTrackingManager* TrackingManager = World->GetSubsystem<UEnemyTrackingManager>();
+	const UComboDetectionSubsystem* ComboDetection = World->GetSubsystem<UComboDetectionSubsystem>();
+	const UBuildCoordinationSubsystem* BuildCoordination = World->GetSubsystem<UBuildCoordinationSubsystem>();
+	const int32 UObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	if (SamplesWritten == 0)
+	{
+		FirstSampleObjects = UObjects;
+	}
+
+	FBlackholeMemorySample MemorySamples[FBlackholeMemoryReport::NumCategories];
+	FBlackholeMemoryReport::Sample(World, MemorySamples);
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	const double WallMinutes = (FPlatformTime::Seconds() - WallStartSeconds) / 60.0;
+
+	FString Row = FString::Printf(TEXT("%.2f,%.2f,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%.3f,%.3f,%llu"),
+		GameTime / 60.0f, WallMinutes, WavesSpawned, EnemiesSpawned, EnemiesExpired,
+		EnemyActors, EnemiesAlive, TrackingManager ? TrackingManager->GetTrackedEnemies().Num() : 0,
+		StateObjects, RootedStateObjects, BuildCoordination ? BuildCoordination->GetBuilderCount() : 0,
+		ComboDetection ? ComboDetection->GetActiveComboCount() : 0,
+		ComboDetection ? ComboDetection->GetInputHistoryCount() : 0,
+		StatusEffectComponents, UObjects,
+		FramesSinceSample > 0 ? FrameMsTotal / FramesSinceSample : 0.0, FrameMsMax,
+		MemoryStats.UsedPhysical / (1024 * 1024));
+	for (const FBlackholeMemorySample& Sample : MemorySamples)
+	{
+		Row += FString::Printf(TEXT(",%.1f"), Sample.Bytes / 1024.0);
+	}
+	Row += TEXT("\n");
+
+	FFileHelper::SaveStringToFile(Row, *OutputPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	SamplesWritten++;
+
+	UE_LOG(LogBlackhole, Log, TEXT("AISoak: %.0f game min (%.1f wall min) - %d enemy actors, %d state objects (%d rooted), %d UObjects, %.2fms avg frame"),
+		GameTime / 60.0f, WallMinutes, EnemyActors, StateObjects, RootedStateObjects, UObjects,
+		FramesSinceSample > 0 ? FrameMsTotal / FramesSinceSample : 0.0);
+
+	FrameMsTotal = 0.0;
+	FrameMsMax = 0.0f;
+	FramesSinceSample = 0;
+}
+
+void UAISoakSubsystem::FinishSoak()
+{
+	Phase = EPhase::Done;
+
+	const double WallMinutes = (FPlatformTime::Seconds() - WallStartSeconds) / 60.0;
+	UE_LOG(LogBlackhole, Log, TEXT("AISoak: Finished %.1f game hours in %.1f wall minutes (x%.1f). %d waves, %d enemies spawned, %d expired. UObjects %d -> %d"),
+		GameTime / 3600.0f, WallMinutes, WallMinutes > 0.0 ? (GameTime / 60.0) / WallMinutes : 0.0,
+		WavesSpawned, EnemiesSpawned, EnemiesExpired, FirstSampleObjects, GUObjectArray.GetObjectArrayNumMinusAvailable());
+	FBlackholeMemoryReport::Dump(GetWorld(), *GLog);
+
+	RestoreTimeSettings();
+
+	if (!FParse::Param(FCommandLine::Get(), TEXT("SoakNoExit")))
+	{
+		FPlatformMisc::RequestExit(false, TEXT("AISoak"));
+	}
+}
+
+void UAISoakSubsystem::OnBeginFrame()
+{
+	FrameStartCycles = FPlatformTime::Cycles64();
+}
+
+void UAISoakSubsystem::OnEndFrame()
+{
+	if (Phase != EPhase::Running || FrameStartCycles == 0)
+	{
+		return;
+	}
+
+	const float FrameMs = (float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles);
+	FrameMsTotal += FrameMs;
+	FrameMsMax = FMath::Max(FrameMsMax, FrameMs);
+	FramesSinceSample++;
+}
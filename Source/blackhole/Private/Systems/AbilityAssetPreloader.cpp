@@ -0,0 +1,212 @@
+#include "Systems/AbilityAssetPreloader.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Config/GameplayConfig.h"
+#include "Components/Abilities/AbilityComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Kismet/GameplayStatics.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Sound/SoundCue.h"
+#include "Sound/SoundNodeWavePlayer.h"
+#include "Sound/SoundWave.h"
+#include "AudioDevice.h"
+
+bool UAbilityAssetPreloader::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UAbilityAssetPreloader::Deinitialize()
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : LoadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	LoadHandles.Empty();
+
+	RequestedAssets.Empty();
+	RequestedClasses.Empty();
+	PendingLoad.Empty();
+	PendingWarm.Empty();
+	WarmingEmitters.Empty();
+	WarmedCount = 0;
+	UpdateStat();
+
+	Super::Deinitialize();
+}
+
+TStatId UAbilityAssetPreloader::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAbilityAssetPreloader, STATGROUP_Blackhole);
+}
+
+void UAbilityAssetPreloader::RequestAbilityAssets(const UAbilityComponent* Ability)
+{
+	if (!Ability)
+	{
+		return;
+	}
+
+	FAbilityAssetManifest Manifest;
+	Ability->GatherAssetManifest(Manifest);
+
+	for (const FSoftObjectPath& Path : Manifest.Assets)
+	{
+		bool bAlreadyRequested = false;
+		RequestedAssets.Add(Path, &bAlreadyRequested);
+		if (!bAlreadyRequested)
+		{
+			PendingLoad.Add(Path);
+		}
+	}
+
+	UpdateStat();
+}
+
+void UAbilityAssetPreloader::RequestActorClassAssets(TSubclassOf<AActor> ActorClass)
+{
+	if (!ActorClass)
+	{
+		return;
+	}
+
+	bool bAlreadyRequested = false;
+	RequestedClasses.Add(ActorClass.Get(), &bAlreadyRequested);
+	if (bAlreadyRequested)
+	{
+		return;
+	}
+
+	AActor::ForEachComponentOfActorClassDefault<UAbilityComponent>(ActorClass, [this](const UAbilityComponent* Ability)
+	{
+		RequestAbilityAssets(Ability);
+		return true;
+	});
+}
+
+void UAbilityAssetPreloader::Tick(float DeltaTime)
+{
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Ability Asset Preload", STAT_Blackhole_AbilityAssetPreload, BlackholeAbilitiesChannel);
+
+	for (const TWeakObjectPtr<UParticleSystemComponent>& Emitter : WarmingEmitters)
+	{
+		if (UParticleSystemComponent* Component = Emitter.Get())
+		{
+			Component->DeactivateImmediate();
+		}
+	}
+	WarmingEmitters.Reset();
+
+	if (PendingLoad.Num() > 0)
+	{
+		StartPendingLoad();
+	}
+
+	const int32 WarmCount = FMath::Min(PendingWarm.Num(), GameplayConfig::Abilities::Preload::WARMS_PER_FRAME);
+	if (WarmCount == 0)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < WarmCount; i++)
+	{
+		// Already resident - the handle that loaded it holds the reference
+		WarmAsset(PendingWarm[i].ResolveObject());
+	}
+	PendingWarm.RemoveAt(0, WarmCount, EAllowShrinking::No);
+	WarmedCount += WarmCount;
+
+	if (GetUnwarmedAssetCount() == 0)
+	{
+		UE_LOG(LogBlackholeAbilities, Log, TEXT("AbilityAssetPreloader: All %d ability assets warm"), WarmedCount);
+	}
+
+	UpdateStat();
+}
+
+void UAbilityAssetPreloader::StartPendingLoad()
+{
+	TArray<FSoftObjectPath> Batch = MoveTemp(PendingLoad);
+	PendingLoad.Reset();
+
+	UE_LOG(LogBlackholeAbilities, Verbose, TEXT("AbilityAssetPreloader: Streaming %d ability assets"), Batch.Num());
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+		Batch,
+		FStreamableDelegate::CreateUObject(this, &UAbilityAssetPreloader::HandleBatchLoaded, Batch),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (Handle.IsValid())
+	{
+		LoadHandles.Add(Handle);
+	}
+}
+
+void UAbilityAssetPreloader::HandleBatchLoaded(TArray<FSoftObjectPath> Batch)
+{
+	// Also runs synchronously from RequestAsyncLoad when everything was already in memory
+	PendingWarm.Append(MoveTemp(Batch));
+}
+
+void UAbilityAssetPreloader::WarmAsset(UObject* Asset)
+{
+	UWorld* World = GetWorld();
+	if (!Asset || !World)
+	{
+		return;
+	}
+
+	if (UParticleSystem* ParticleSystem = Cast<UParticleSystem>(Asset))
+	{
+		// One spawn below the level creates the emitter instances and render state the first
+		// real spawn would otherwise pay for
+		const FVector WarmLocation(0.0f, 0.0f, GameplayConfig::Abilities::Preload::WARM_DEPTH);
+		if (UParticleSystemComponent* Emitter = UGameplayStatics::SpawnEmitterAtLocation(World, ParticleSystem, WarmLocation))
+		{
+			WarmingEmitters.Add(Emitter);
+		}
+		return;
+	}
+
+	FAudioDevice* AudioDevice = World->GetAudioDeviceRaw();
+	if (!AudioDevice)
+	{
+		return;
+	}
+
+	if (USoundWave* Wave = Cast<USoundWave>(Asset))
+	{
+		AudioDevice->Precache(Wave);
+	}
+	else if (USoundCue* Cue = Cast<USoundCue>(Asset))
+	{
+		TArray<USoundNodeWavePlayer*> WavePlayers;
+		Cue->RecursiveFindNode<USoundNodeWavePlayer>(Cue->FirstNode, WavePlayers);
+		for (USoundNodeWavePlayer* WavePlayer : WavePlayers)
+		{
+			if (USoundWave* CueWave = WavePlayer->GetSoundWave())
+			{
+				AudioDevice->Precache(CueWave);
+			}
+		}
+	}
+}
+
+void UAbilityAssetPreloader::UpdateStat() const
+{
+	SET_DWORD_STAT(STAT_Blackhole_UnwarmedAbilityAssets, GetUnwarmedAssetCount());
+}
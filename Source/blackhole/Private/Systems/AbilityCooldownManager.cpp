@@ -0,0 +1,208 @@
+#include "Systems/AbilityCooldownManager.h"
+#include "Debug/BlackholeStats.h"
+#include "Components/Abilities/AbilityComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+void UAbilityCooldownManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Entries.Empty();
+	DeadlineHeap.Empty();
+	ArmedDeadline = 0.0;
+	ActiveCooldownCount = 0;
+}
+
+void UAbilityCooldownManager::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DispatchTimerHandle);
+	}
+
+	Entries.Empty();
+	DeadlineHeap.Empty();
+	ArmedDeadline = 0.0;
+	ActiveCooldownCount = 0;
+
+	OnAbilityCooldownReady.Clear();
+
+	Super::Deinitialize();
+}
+
+int32 UAbilityCooldownManager::RegisterAbility(UAbilityComponent* Ability)
+{
+	if (!IsValid(Ability))
+	{
+		return INDEX_NONE;
+	}
+
+	FAbilityCooldownEntry Entry;
+	Entry.Ability = Ability;
+	Entry.Generation = NextGeneration++;
+	return Entries.Add(Entry);
+}
+
+void UAbilityCooldownManager::UnregisterAbility(int32 EntryIndex)
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	// Any deadline still in the heap for this row is skipped: the index is either invalid or
+	// reused by a row whose generation never matches an older one
+	ClearCooldown(EntryIndex);
+	Entries.RemoveAt(EntryIndex);
+}
+
+void UAbilityCooldownManager::StartCooldown(int32 EntryIndex, float Duration)
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	FAbilityCooldownEntry& Entry = Entries[EntryIndex];
+	const double Now = GetNow();
+
+	if (Entry.ExpiryTime <= Now)
+	{
+		ActiveCooldownCount++;
+	}
+
+	Entry.Generation = NextGeneration++;
+	Entry.StartTime = Now;
+	Entry.ExpiryTime = Now + FMath::Max(0.0f, Duration);
+
+	FAbilityCooldownDeadline Deadline;
+	Deadline.ExpiryTime = Entry.ExpiryTime;
+	Deadline.EntryIndex = EntryIndex;
+	Deadline.Generation = Entry.Generation;
+	DeadlineHeap.HeapPush(Deadline);
+
+	ArmDispatchTimer();
+}
+
+void UAbilityCooldownManager::ClearCooldown(int32 EntryIndex)
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	FAbilityCooldownEntry& Entry = Entries[EntryIndex];
+	if (Entry.ExpiryTime > GetNow())
+	{
+		ActiveCooldownCount = FMath::Max(0, ActiveCooldownCount - 1);
+	}
+
+	// Invalidate the pending deadline; it is discarded lazily when it reaches the top of the heap
+	Entry.Generation = NextGeneration++;
+	Entry.StartTime = 0.0;
+	Entry.ExpiryTime = 0.0;
+}
+
+float UAbilityCooldownManager::GetCooldownRemaining(int32 EntryIndex) const
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return 0.0f;
+	}
+
+	return (float)FMath::Max(0.0, Entries[EntryIndex].ExpiryTime - GetNow());
+}
+
+float UAbilityCooldownManager::GetCooldownDuration(int32 EntryIndex) const
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return 0.0f;
+	}
+
+	const FAbilityCooldownEntry& Entry = Entries[EntryIndex];
+	return (float)(Entry.ExpiryTime - Entry.StartTime);
+}
+
+double UAbilityCooldownManager::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UAbilityCooldownManager::DispatchExpiredCooldowns()
+{
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Cooldown Dispatch", STAT_Blackhole_CooldownDispatch, BlackholeSystemsChannel);
+
+	ArmedDeadline = 0.0;
+	const double Now = GetNow();
+
+	while (DeadlineHeap.Num() > 0 && DeadlineHeap.HeapTop().ExpiryTime <= Now)
+	{
+		FAbilityCooldownDeadline Deadline;
+		DeadlineHeap.HeapPop(Deadline, EAllowShrinking::No);
+
+		if (!Entries.IsValidIndex(Deadline.EntryIndex))
+		{
+			continue;
+		}
+
+		FAbilityCooldownEntry& Entry = Entries[Deadline.EntryIndex];
+		if (Entry.Generation != Deadline.Generation)
+		{
+			continue; // Restarted or cleared since this deadline was queued
+		}
+
+		ActiveCooldownCount = FMath::Max(0, ActiveCooldownCount - 1);
+
+		if (UAbilityComponent* Ability = Entry.Ability.Get())
+		{
+			Ability->OnCooldownReady();
+			OnAbilityCooldownReady.Broadcast(Ability);
+		}
+	}
+
+	ArmDispatchTimer();
+}
+
+void UAbilityCooldownManager::ArmDispatchTimer()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Drop stale deadlines so the timer isn't armed for a cooldown that no longer exists
+	while (DeadlineHeap.Num() > 0)
+	{
+		const FAbilityCooldownDeadline& Top = DeadlineHeap.HeapTop();
+		if (Entries.IsValidIndex(Top.EntryIndex) && Entries[Top.EntryIndex].Generation == Top.Generation)
+		{
+			break;
+		}
+
+		FAbilityCooldownDeadline Discarded;
+		DeadlineHeap.HeapPop(Discarded, EAllowShrinking::No);
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+
+	if (DeadlineHeap.Num() == 0)
+	{
+		TimerManager.ClearTimer(DispatchTimerHandle);
+		ArmedDeadline = 0.0;
+		return;
+	}
+
+	const double NextDeadline = DeadlineHeap.HeapTop().ExpiryTime;
+	if (ArmedDeadline > 0.0 && ArmedDeadline <= NextDeadline && TimerManager.IsTimerActive(DispatchTimerHandle))
+	{
+		return; // Already armed for an earlier or equal deadline
+	}
+
+	ArmedDeadline = NextDeadline;
+	const float Delay = FMath::Max((float)(NextDeadline - GetNow()), KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(DispatchTimerHandle, this, &UAbilityCooldownManager::DispatchExpiredCooldowns, Delay, false);
+}
@@ -0,0 +1,305 @@
+#include "Systems/ArenaBenchmarkSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
+#include "Config/GameplayConfig.h"
+#include "Player/BlackholePlayerCharacter.h"
+#include "Enemy/BaseEnemy.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+	float Percentile(const TArray<float>& SortedValues, float Fraction)
+	{
+		if (SortedValues.Num() == 0)
+		{
+			return 0.0f;
+		}
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+		return SortedValues[Index];
+	}
+
+	uint64 BytesToMB(uint64 Bytes)
+	{
+		return Bytes / (1024 * 1024);
+	}
+}
+
+bool UArenaBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && FParse::Param(FCommandLine::Get(), TEXT("ArenaBenchmark"));
+}
+
+void UArenaBenchmarkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ParseCommandLine();
+
+	BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UArenaBenchmarkSubsystem::OnBeginFrame);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UArenaBenchmarkSubsystem::OnEndFrame);
+}
+
+void UArenaBenchmarkSubsystem::Deinitialize()
+{
+	FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	// Leaving the world mid-run still produces whatever was measured; the world owns the enemies now
+	if (IsRunning() && Results.Num() > 0)
+	{
+		SpawnedEnemies.Reset();
+		FinishBenchmark();
+	}
+
+	Super::Deinitialize();
+}
+
+void UArenaBenchmarkSubsystem::ParseCommandLine()
+{
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	FString CountsValue = TEXT("10,50,100,200");
+	FParse::Value(CommandLine, TEXT("BenchEnemies="), CountsValue, false);
+	TArray<FString> CountTokens;
+	CountsValue.ParseIntoArray(CountTokens, TEXT(","));
+	for (const FString& Token : CountTokens)
+	{
+		const int32 Count = FCString::Atoi(*Token);
+		if (Count > 0)
+		{
+			EnemyCounts.Add(Count);
+		}
+	}
+
+	EnemyMix.ParseCommandLine(CommandLine, TEXT("BenchMix="));
+
+	WarmupFrames = GameplayConfig::Benchmark::WARMUP_FRAMES;
+	MeasureFrames = GameplayConfig::Benchmark::MEASURE_FRAMES;
+	FParse::Value(CommandLine, TEXT("BenchWarmup="), WarmupFrames);
+	FParse::Value(CommandLine, TEXT("BenchFrames="), MeasureFrames);
+	WarmupFrames = FMath::Max(WarmupFrames, 0);
+	MeasureFrames = FMath::Max(MeasureFrames, 1);
+
+	int32 Seed = 1337;
+	FParse::Value(CommandLine, TEXT("BenchSeed="), Seed);
+	Random.Initialize(Seed);
+
+	if (!FParse::Value(CommandLine, TEXT("BenchOut="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+			FString::Printf(TEXT("ArenaBenchmark_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	}
+
+	bExitWhenDone = !FParse::Param(CommandLine, TEXT("BenchNoExit"));
+}
+
+void UArenaBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (EnemyCounts.Num() == 0)
+	{
+		UE_LOG(LogBlackhole, Error, TEXT("ArenaBenchmark: No enemy counts to run"));
+		Phase = EPhase::Done;
+		return;
+	}
+
+	UE_LOG(LogBlackhole, Log, TEXT("ArenaBenchmark: %d stages, %d warmup + %d measured frames each, output %s"),
+		EnemyCounts.Num(), WarmupFrames, MeasureFrames, *OutputPath);
+
+	ArenaSimulation::PreloadEnemyMix(&InWorld, EnemyMix);
+
+	Phase = EPhase::WaitingForPlayer;
+}
+
+TStatId UArenaBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UArenaBenchmarkSubsystem, STATGROUP_Blackhole);
+}
+
+void UArenaBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	switch (Phase)
+	{
+	case EPhase::WaitingForPlayer:
+	{
+		ABlackholePlayerCharacter* PlayerCharacter = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+		if (!PlayerCharacter)
+		{
+			return;
+		}
+
+		Bot.Setup(PlayerCharacter, PlayerCharacter->GetActorLocation());
+		StartStage(0);
+		break;
+	}
+
+	case EPhase::Warmup:
+		Bot.Tick(DeltaTime);
+		if (++PhaseFrames >= WarmupFrames)
+		{
+			Phase = EPhase::Measure;
+			PhaseFrames = 0;
+			FrameTimesMs.Reset(MeasureFrames);
+			LOSTraceTotal = 0;
+			HitQueryTotal = 0;
+			MovementTraceTotal = 0;
+		}
+		break;
+
+	case EPhase::Measure:
+		Bot.Tick(DeltaTime);
+		if (FrameTimesMs.Num() >= MeasureFrames)
+		{
+			FinishStage();
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UArenaBenchmarkSubsystem::StartStage(int32 StageIndex)
+{
+	CurrentStage = StageIndex;
+	DestroySpawnedEnemies();
+
+	TArray<ABaseEnemy*> Spawned;
+	ArenaSimulation::SpawnEnemies(GetWorld(), Bot.GetCenter(), EnemyCounts[StageIndex], EnemyMix, Random, Spawned);
+	SpawnedEnemies.Append(Spawned);
+
+	Phase = EPhase::Warmup;
+	PhaseFrames = 0;
+
+	UE_LOG(LogBlackhole, Log, TEXT("ArenaBenchmark: Stage %d/%d - %d enemies requested, %d spawned"),
+		StageIndex + 1, EnemyCounts.Num(), EnemyCounts[StageIndex], SpawnedEnemies.Num());
+}
+
+void UArenaBenchmarkSubsystem::FinishStage()
+{
+	TArray<float> Sorted = FrameTimesMs;
+	Sorted.Sort();
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	const float FrameCount = (float)FMath::Max(FrameTimesMs.Num(), 1);
+
+	FStageResult& Result = Results.AddDefaulted_GetRef();
+	Result.EnemyCount = EnemyCounts[CurrentStage];
+	Result.SpawnedCount = SpawnedEnemies.Num();
+	Result.Frames = FrameTimesMs.Num();
+	Result.P50Ms = Percentile(Sorted, 0.50f);
+	Result.P95Ms = Percentile(Sorted, 0.95f);
+	Result.P99Ms = Percentile(Sorted, 0.99f);
+	Result.MaxMs = Sorted.Num() > 0 ? Sorted.Last() : 0.0f;
+	Result.LOSTracesPerFrame = LOSTraceTotal / FrameCount;
+	Result.HitQueriesPerFrame = HitQueryTotal / FrameCount;
+	Result.MovementTracesPerFrame = MovementTraceTotal / FrameCount;
+	Result.UsedPhysicalMB = BytesToMB(MemoryStats.UsedPhysical);
+	Result.PeakUsedPhysicalMB = BytesToMB(MemoryStats.PeakUsedPhysical);
+
+	UE_LOG(LogBlackhole, Log, TEXT("ArenaBenchmark: %d enemies - game thread p50 %.2fms p95 %.2fms p99 %.2fms, %.1f LOS traces/frame, %.1f hit queries/frame"),
+		Result.EnemyCount, Result.P50Ms, Result.P95Ms, Result.P99Ms, Result.LOSTracesPerFrame, Result.HitQueriesPerFrame);
+
+	// Outside the measured window; raises the per-system high-water marks reported at the end
+	FBlackholeMemorySample MemorySamples[FBlackholeMemoryReport::NumCategories];
+	FBlackholeMemoryReport::Sample(GetWorld(), MemorySamples);
+
+	if (CurrentStage + 1 < EnemyCounts.Num())
+	{
+		StartStage(CurrentStage + 1);
+	}
+	else
+	{
+		FinishBenchmark();
+	}
+}
+
+void UArenaBenchmarkSubsystem::FinishBenchmark()
+{
+	Phase = EPhase::Done;
+	FBlackholeMemoryReport::Dump(GetWorld(), *GLog);
+	DestroySpawnedEnemies();
+
+	if (FFileHelper::SaveStringToFile(BuildCsv(), *OutputPath))
+	{
+		UE_LOG(LogBlackhole, Log, TEXT("ArenaBenchmark: Wrote %d rows to %s"), Results.Num(), *OutputPath);
+	}
+	else
+	{
+		UE_LOG(LogBlackhole, Error, TEXT("ArenaBenchmark: Failed to write %s"), *OutputPath);
+	}
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("ArenaBenchmark"));
+	}
+}
+
+FString UArenaBenchmarkSubsystem::BuildCsv() const
+{
+	const FString MixDescription = EnemyMix.Describe();
+
+	FString Csv = TEXT("Mix,Enemies,Spawned,Frames,GameThreadP50Ms,GameThreadP95Ms,GameThreadP99Ms,GameThreadMaxMs,")
+		TEXT("LOSTracesPerFrame,HitQueriesPerFrame,MovementTracesPerFrame,UsedPhysicalMB,PeakUsedPhysicalMB\n");
+
+	for (const FStageResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%.2f,%llu,%llu\n"),
+			*MixDescription, Result.EnemyCount, Result.SpawnedCount, Result.Frames,
+			Result.P50Ms, Result.P95Ms, Result.P99Ms, Result.MaxMs,
+			Result.LOSTracesPerFrame, Result.HitQueriesPerFrame, Result.MovementTracesPerFrame,
+			Result.UsedPhysicalMB, Result.PeakUsedPhysicalMB);
+	}
+	return Csv;
+}
+
+void UArenaBenchmarkSubsystem::DestroySpawnedEnemies()
+{
+	for (ABaseEnemy* Enemy : SpawnedEnemies)
+	{
+		if (IsValid(Enemy))
+		{
+			Enemy->Destroy();
+		}
+	}
+	SpawnedEnemies.Reset();
+}
+
+void UArenaBenchmarkSubsystem::OnBeginFrame()
+{
+	FrameStartCycles = FPlatformTime::Cycles64();
+	FBlackholeFrameCounters::Reset();
+}
+
+void UArenaBenchmarkSubsystem::OnEndFrame()
+{
+	if (Phase != EPhase::Measure || FrameStartCycles == 0)
+	{
+		return;
+	}
+
+	// Under -NullRHI the begin/end frame span is almost entirely game thread work
+	FrameTimesMs.Add((float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles));
+	LOSTraceTotal += FBlackholeFrameCounters::LOSTraces;
+	HitQueryTotal += FBlackholeFrameCounters::HitQueries;
+	MovementTraceTotal += FBlackholeFrameCounters::MovementTraces;
+}
@@ -0,0 +1,404 @@
+#include "Systems/ArenaSimulation.h"
+#include "blackhole.h"
+#include "Debug/BlackholeMemory.h"
+#include "Config/GameplayConfig.h"
+#include "Systems/EnemyTrackingManager.h"
+#include "Systems/ResourceManager.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Player/BlackholePlayerCharacter.h"
+#include "Enemy/BaseEnemy.h"
+#include "Enemy/TankEnemy.h"
+#include "Enemy/AgileEnemy.h"
+#include "Enemy/CombatEnemy.h"
+#include "Enemy/HackerEnemy.h"
+#include "Enemy/StandardEnemy.h"
+#include "Enemy/MindMelderEnemy.h"
+#include "Components/Abilities/Player/Basic/SlashAbilityComponent.h"
+#include "Components/Abilities/Player/Basic/KillAbilityComponent.h"
+#include "Components/Abilities/Player/Utility/HackerDashAbility.h"
+#include "Components/Abilities/Player/Utility/HackerJumpAbility.h"
+#include "Components/Abilities/Player/Hacker/PulseHackAbility.h"
+#include "Components/Abilities/Player/Hacker/GravityPullAbilityComponent.h"
+#include "Components/Abilities/Player/Hacker/FirewallBreachAbility.h"
+#include "Components/Abilities/Player/Hacker/DataSpikeAbility.h"
+#include "Components/Movement/WallRunComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "NavigationSystem.h"
+#include "Misc/Parse.h"
+
+void FArenaEnemyMix::ParseCommandLine(const TCHAR* CommandLine, const TCHAR* Key)
+{
+	struct FKnownEnemy
+	{
+		const TCHAR* Name;
+		UClass* Class;
+	};
+	const FKnownEnemy KnownEnemies[] = {
+		{ TEXT("Tank"), ATankEnemy::StaticClass() },
+		{ TEXT("Agile"), AAgileEnemy::StaticClass() },
+		{ TEXT("Combat"), ACombatEnemy::StaticClass() },
+		{ TEXT("Hacker"), AHackerEnemy::StaticClass() },
+		{ TEXT("Standard"), AStandardEnemy::StaticClass() },
+		{ TEXT("MindMelder"), AMindMelderEnemy::StaticClass() }
+	};
+
+	Entries.Reset();
+
+	// Name:Weight pairs, anything not listed is left out
+	FString MixValue;
+	if (FParse::Value(CommandLine, Key, MixValue, false))
+	{
+		TArray<FString> MixTokens;
+		MixValue.ParseIntoArray(MixTokens, TEXT(","));
+		for (const FString& Token : MixTokens)
+		{
+			FString Name, WeightString;
+			if (!Token.Split(TEXT(":"), &Name, &WeightString))
+			{
+				Name = Token;
+				WeightString = TEXT("1");
+			}
+
+			const FKnownEnemy* Known = nullptr;
+			for (const FKnownEnemy& Candidate : KnownEnemies)
+			{
+				if (Name.Equals(Candidate.Name, ESearchCase::IgnoreCase))
+				{
+					Known = &Candidate;
+					break;
+				}
+			}
+
+			const int32 Weight = FCString::Atoi(*WeightString);
+			if (!Known || Weight <= 0)
+			{
+				UE_LOG(LogBlackhole, Warning, TEXT("ArenaSimulation: Ignoring %s entry '%s'"), Key, *Token);
+				continue;
+			}
+			Entries.Add({ Known->Name, Known->Class, Weight });
+		}
+	}
+	if (Entries.Num() == 0)
+	{
+		for (const FKnownEnemy& Known : KnownEnemies)
+		{
+			Entries.Add({ Known.Name, Known.Class, 1 });
+		}
+	}
+
+	TotalWeight = 0;
+	for (const FEntry& Entry : Entries)
+	{
+		TotalWeight += Entry.Weight;
+	}
+}
+
+TSubclassOf<ABaseEnemy> FArenaEnemyMix::Pick(FRandomStream& Random) const
+{
+	if (Entries.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	int32 Roll = Random.RandRange(0, TotalWeight - 1);
+	for (const FEntry& Entry : Entries)
+	{
+		if (Roll < Entry.Weight)
+		{
+			return Entry.Class;
+		}
+		Roll -= Entry.Weight;
+	}
+	return Entries.Last().Class;
+}
+
+void FArenaEnemyMix::GetClasses(TArray<TSubclassOf<ABaseEnemy>>& OutClasses) const
+{
+	for (const FEntry& Entry : Entries)
+	{
+		OutClasses.AddUnique(Entry.Class);
+	}
+}
+
+FString FArenaEnemyMix::Describe() const
+{
+	FString Description;
+	for (const FEntry& Entry : Entries)
+	{
+		Description += FString::Printf(TEXT("%s%s:%d"), Description.IsEmpty() ? TEXT("") : TEXT(" "), *Entry.Name, Entry.Weight);
+	}
+	return Description;
+}
+
+void ArenaSimulation::PreloadEnemyMix(UWorld* World, const FArenaEnemyMix& Mix)
+{
+	UAbilityAssetPreloader* Preloader = World ? World->GetSubsystem<UAbilityAssetPreloader>() : nullptr;
+	if (!Preloader)
+	{
+		return;
+	}
+
+	TArray<TSubclassOf<ABaseEnemy>> Classes;
+	Mix.GetClasses(Classes);
+	for (const TSubclassOf<ABaseEnemy>& EnemyClass : Classes)
+	{
+		Preloader->RequestActorClassAssets(EnemyClass);
+	}
+}
+
+void ArenaSimulation::SpawnEnemies(UWorld* World, const FVector& Center, int32 Count, const FArenaEnemyMix& Mix,
+	FRandomStream& Random, TArray<ABaseEnemy*>& OutSpawned)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent<UNavigationSystemV1>(World);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	BLACKHOLE_LLM_SCOPE(Enemies);
+
+	OutSpawned.Reserve(OutSpawned.Num() + Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		const float Angle = Random.FRandRange(0.0f, 2.0f * PI);
+		const float Radius = Random.FRandRange(GameplayConfig::Benchmark::SPAWN_RADIUS_MIN, GameplayConfig::Benchmark::SPAWN_RADIUS_MAX);
+		FVector Location = Center + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f);
+
+		FNavLocation NavLocation;
+		if (NavSystem && NavSystem->ProjectPointToNavigation(Location, NavLocation, FVector(500.0f, 500.0f, 1000.0f)))
+		{
+			Location = NavLocation.Location;
+		}
+		Location.Z += 100.0f;
+
+		const FRotator Facing = (Center - Location).GetSafeNormal2D().Rotation();
+		if (ABaseEnemy* Enemy = World->SpawnActor<ABaseEnemy>(Mix.Pick(Random), Location, Facing, SpawnParams))
+		{
+			OutSpawned.Add(Enemy);
+		}
+	}
+}
+
+void FArenaBot::Setup(ABlackholePlayerCharacter* InPlayer, const FVector& InCenter)
+{
+	Player = InPlayer;
+	Center = InCenter;
+	NextAbility = 0;
+	PatrolAngle = 0.0f;
+	ActionTimer = 0.0f;
+	WallRunCooldown = GameplayConfig::Benchmark::BOT_WALLRUN_INTERVAL;
+	WallRunTimeLeft = 0.0f;
+	JumpAbility.Reset();
+
+	// Fixed rotation through the player's movement and combat abilities
+	Abilities.Reset();
+	if (!InPlayer)
+	{
+		return;
+	}
+
+	UAbilityComponent* Rotation[] = {
+		InPlayer->FindComponentByClass<UHackerDashAbility>(),
+		InPlayer->FindComponentByClass<USlashAbilityComponent>(),
+		InPlayer->FindComponentByClass<UHackerJumpAbility>(),
+		InPlayer->FindComponentByClass<UPulseHackAbility>(),
+		InPlayer->FindComponentByClass<USlashAbilityComponent>(),
+		InPlayer->FindComponentByClass<UGravityPullAbilityComponent>(),
+		InPlayer->FindComponentByClass<UHackerDashAbility>(),
+		InPlayer->FindComponentByClass<UFirewallBreachAbility>(),
+		InPlayer->FindComponentByClass<UDataSpikeAbility>(),
+		InPlayer->FindComponentByClass<UKillAbilityComponent>()
+	};
+	for (UAbilityComponent* Ability : Rotation)
+	{
+		if (Ability)
+		{
+			Abilities.Add(Ability);
+		}
+	}
+
+	JumpAbility = InPlayer->FindComponentByClass<UHackerJumpAbility>();
+}
+
+void FArenaBot::Tick(float DeltaTime)
+{
+	ABlackholePlayerCharacter* PlayerCharacter = Player.Get();
+	if (!PlayerCharacter || PlayerCharacter->IsDead())
+	{
+		return;
+	}
+
+	UWorld* World = PlayerCharacter->GetWorld();
+
+	// Keep the bot alive so the script runs for the whole session
+	if (UResourceManager* ResourceManager = World->GetGameInstance()->GetSubsystem<UResourceManager>())
+	{
+		if (ResourceManager->GetWillPowerPercent() < GameplayConfig::Benchmark::BOT_WP_REFILL_PERCENT)
+		{
+			ResourceManager->ResetResources();
+		}
+	}
+
+	// Abilities would knock the player off the wall, so the rotation waits for the attempt to end
+	if (TickWallRun(PlayerCharacter, DeltaTime))
+	{
+		return;
+	}
+
+	// Circle the arena centre
+	PatrolAngle += DeltaTime * 0.5f;
+	const float PatrolRadius = GameplayConfig::Benchmark::BOT_PATROL_RADIUS;
+	const FVector Waypoint = Center + FVector(FMath::Cos(PatrolAngle) * PatrolRadius, FMath::Sin(PatrolAngle) * PatrolRadius, 0.0f);
+	PlayerCharacter->AddMovementInput((Waypoint - PlayerCharacter->GetActorLocation()).GetSafeNormal2D());
+
+	// Face the nearest enemy so targeted abilities have something to hit
+	if (APlayerController* PC = Cast<APlayerController>(PlayerCharacter->GetController()))
+	{
+		const FVector PlayerLocation = PlayerCharacter->GetActorLocation();
+		const ABaseEnemy* Nearest = nullptr;
+		float NearestDistSq = TNumericLimits<float>::Max();
+		if (const UEnemyTrackingManager* TrackingManager = World->GetSubsystem<UEnemyTrackingManager>())
+		{
+			for (const FTrackedEnemy& Tracked : TrackingManager->GetTrackedEnemies())
+			{
+				const ABaseEnemy* Enemy = Tracked.Enemy.Get();
+				if (!Enemy || Enemy->IsDead())
+				{
+					continue;
+				}
+				const float DistSq = FVector::DistSquared(PlayerLocation, Enemy->GetActorLocation());
+				if (DistSq < NearestDistSq)
+				{
+					NearestDistSq = DistSq;
+					Nearest = Enemy;
+				}
+			}
+		}
+
+		if (Nearest)
+		{
+			PC->SetControlRotation((Nearest->GetActorLocation() - PlayerLocation).Rotation());
+		}
+	}
+
+	// Next ability in the rotation; skip (not retry) anything that is cooling down
+	ActionTimer -= DeltaTime;
+	if (ActionTimer > 0.0f || Abilities.Num() == 0)
+	{
+		return;
+	}
+	ActionTimer = GameplayConfig::Benchmark::BOT_ACTION_INTERVAL;
+
+	UAbilityComponent* Ability = Abilities[NextAbility].Get();
+	NextAbility = (NextAbility + 1) % Abilities.Num();
+	if (Ability && Ability->CanExecute())
+	{
+		Ability->Execute();
+	}
+}
+
+bool FArenaBot::TickWallRun(ABlackholePlayerCharacter* PlayerCharacter, float DeltaTime)
+{
+	using namespace GameplayConfig::Benchmark;
+
+	UWallRunComponent* WallRun = PlayerCharacter->GetWallRunComponent();
+	UCharacterMovementComponent* Movement = PlayerCharacter->GetCharacterMovement();
+	if (!WallRun || !Movement)
+	{
+		return false;
+	}
+
+	if (WallRunTimeLeft <= 0.0f)
+	{
+		WallRunCooldown -= DeltaTime;
+		if (WallRunCooldown > 0.0f || !Movement->IsMovingOnGround())
+		{
+			return false;
+		}
+		WallRunCooldown = BOT_WALLRUN_INTERVAL;
+
+		// Arenas without walls in reach just keep patrolling
+		if (!FindWall(PlayerCharacter))
+		{
+			return false;
+		}
+		WallRunTimeLeft = BOT_WALLRUN_MAX_TIME;
+		bWallRunJumped = false;
+	}
+
+	WallRunTimeLeft -= DeltaTime;
+	if (WallRunTimeLeft <= 0.0f || (bWallRunJumped && Movement->IsMovingOnGround() && !WallRun->IsWallRunning()))
+	{
+		WallRunTimeLeft = 0.0f;
+		return false;
+	}
+
+	// Run along the wall angled into it: the wall ends up beside the player, and the camera
+	// (aimed down the run) faces it enough for the wall run to start
+	const FVector Along = FVector::CrossProduct(FVector::UpVector, WallNormal).GetSafeNormal2D();
+	const float Angle = FMath::DegreesToRadians(BOT_WALLRUN_APPROACH_ANGLE);
+	const FVector Steer = (Along * FMath::Cos(Angle) - WallNormal * FMath::Sin(Angle)).GetSafeNormal2D();
+
+	PlayerCharacter->AddMovementInput(Steer);
+	if (APlayerController* PC = Cast<APlayerController>(PlayerCharacter->GetController()))
+	{
+		PC->SetControlRotation(Steer.Rotation());
+	}
+
+	const float WallDistance = FVector::DotProduct(PlayerCharacter->GetActorLocation() - WallPoint, WallNormal);
+	if (!bWallRunJumped && WallDistance <= BOT_WALLRUN_JUMP_DISTANCE)
+	{
+		// The high jump clears the wall run's minimum height; a plain jump may not
+		UAbilityComponent* Jump = JumpAbility.Get();
+		if (Jump && Jump->CanExecute())
+		{
+			Jump->Execute();
+		}
+		else
+		{
+			PlayerCharacter->Jump();
+		}
+		bWallRunJumped = true;
+	}
+
+	return true;
+}
+
+bool FArenaBot::FindWall(const ABlackholePlayerCharacter* PlayerCharacter)
+{
+	constexpr int32 NumDirections = 8;
+	const FVector Start = PlayerCharacter->GetActorLocation();
+
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(PlayerCharacter);
+
+	float NearestDistance = TNumericLimits<float>::Max();
+	for (int32 i = 0; i < NumDirections; i++)
+	{
+		const float Yaw = 360.0f * i / NumDirections;
+		const FVector End = Start + FRotator(0.0f, Yaw, 0.0f).Vector() * GameplayConfig::Benchmark::BOT_WALLRUN_SEEK_DISTANCE;
+
+		FHitResult Hit;
+		if (!PlayerCharacter->GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_WorldStatic, QueryParams))
+		{
+			continue;
+		}
+
+		// Only near-vertical surfaces can be run on
+		if (FMath::Abs(Hit.ImpactNormal.Z) < 0.3f && Hit.Distance < NearestDistance)
+		{
+			NearestDistance = Hit.Distance;
+			WallPoint = Hit.ImpactPoint;
+			WallNormal = Hit.ImpactNormal.GetSafeNormal2D();
+		}
+	}
+
+	return NearestDistance < TNumericLimits<float>::Max();
+}
@@ -0,0 +1,248 @@
+#include "Systems/AuraFieldSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeDebugDraw.h"
+#include "Utils/ErrorHandling.h"
+#include "Config/GameplayConfig.h"
+#include "Components/Attributes/WillPowerComponent.h"
+#include "Enemy/BaseEnemy.h"
+#include "Player/BlackholePlayerCharacter.h"
+#include "Engine/World.h"
+
+void UAuraFieldSubsystem::Deinitialize()
+{
+	EmitterTable.Empty();
+	EmitterOwners.Empty();
+	EmitterLocations.Empty();
+	EmitterRadiiSq.Empty();
+	EmitterDrainPerSecond.Empty();
+	EmitterPulseIntervals.Empty();
+	EmitterTimeToPulse.Empty();
+	EmitterPulseDrain.Empty();
+	EmitterAffectsEnemies.Empty();
+
+	ReceiverComponents.Empty();
+	ReceiverOwners.Empty();
+	ReceiverLocations.Empty();
+	ReceiverIsEnemy.Empty();
+	ReceiverDrain.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAuraFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraFieldSubsystem, STATGROUP_Blackhole);
+}
+
+int32 UAuraFieldSubsystem::RegisterEmitter(AActor* Owner, float Radius, float DrainPerSecond, float PulseInterval, bool bAffectsEnemies)
+{
+	if (!Owner)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Handle = EmitterTable.Add();
+	EmitterOwners.Add(Owner);
+	EmitterLocations.Add(Owner->GetActorLocation());
+	EmitterRadiiSq.Add(FMath::Square(Radius));
+	EmitterDrainPerSecond.Add(DrainPerSecond);
+	EmitterPulseIntervals.Add(FMath::Max(PulseInterval, UE_KINDA_SMALL_NUMBER));
+	EmitterPulseDrain.Add(0.0f);
+	EmitterAffectsEnemies.Add(bAffectsEnemies);
+
+	// Due on the next pass: that pass subtracts the whole time since the previous one, so
+	// starting here leaves only the time since registration
+	EmitterTimeToPulse.Add(TimeSinceLastPass);
+	bPulsePending = true;
+
+	return Handle;
+}
+
+void UAuraFieldSubsystem::UpdateEmitter(int32 Handle, float Radius, float DrainPerSecond, float PulseInterval, bool bAffectsEnemies)
+{
+	const int32 Index = EmitterTable.Find(Handle);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	EmitterRadiiSq[Index] = FMath::Square(Radius);
+	EmitterDrainPerSecond[Index] = DrainPerSecond;
+	EmitterPulseIntervals[Index] = FMath::Max(PulseInterval, UE_KINDA_SMALL_NUMBER);
+	EmitterAffectsEnemies[Index] = bAffectsEnemies;
+}
+
+void UAuraFieldSubsystem::UnregisterEmitter(int32 Handle)
+{
+	const int32 Index = EmitterTable.Find(Handle);
+	if (Index != INDEX_NONE)
+	{
+		RemoveEmitterAt(Index);
+	}
+}
+
+void UAuraFieldSubsystem::RemoveEmitterAt(int32 Index)
+{
+	EmitterTable.RemoveAtSwap(Index, EmitterOwners, EmitterLocations, EmitterRadiiSq, EmitterDrainPerSecond,
+		EmitterPulseIntervals, EmitterTimeToPulse, EmitterPulseDrain, EmitterAffectsEnemies);
+}
+
+void UAuraFieldSubsystem::RegisterReceiver(UWillPowerComponent* WillPower)
+{
+	AActor* Owner = WillPower ? WillPower->GetOwner() : nullptr;
+	if (!Owner || ReceiverComponents.Contains(WillPower))
+	{
+		return;
+	}
+
+	const bool bIsEnemy = Owner->IsA<ABaseEnemy>();
+	if (!bIsEnemy && !Owner->IsA<ABlackholePlayerCharacter>())
+	{
+		return;
+	}
+
+	ReceiverComponents.Add(WillPower);
+	ReceiverOwners.Add(Owner);
+	ReceiverLocations.Add(Owner->GetActorLocation());
+	ReceiverIsEnemy.Add(bIsEnemy);
+	ReceiverDrain.Add(0.0f);
+}
+
+void UAuraFieldSubsystem::UnregisterReceiver(UWillPowerComponent* WillPower)
+{
+	const int32 Index = ReceiverComponents.IndexOfByKey(WillPower);
+	if (Index != INDEX_NONE)
+	{
+		RemoveReceiverAt(Index);
+	}
+}
+
+void UAuraFieldSubsystem::RemoveReceiverAt(int32 Index)
+{
+	ReceiverComponents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ReceiverOwners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ReceiverLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ReceiverIsEnemy.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ReceiverDrain.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UAuraFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (EmitterOwners.Num() == 0)
+	{
+		TimeSinceLastPass = 0.0f;
+		bPulsePending = false;
+		return;
+	}
+
+	// Pulse timers keep running with no receivers around, like the per-aura timers did
+	TimeSinceLastPass += DeltaTime;
+	if (!bPulsePending && TimeSinceLastPass < GameplayConfig::Abilities::AuraField::TICK_INTERVAL)
+	{
+		return;
+	}
+
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Aura Field Pass", STAT_Blackhole_AuraFieldPass, BlackholeAbilitiesChannel);
+
+	const float PassSeconds = TimeSinceLastPass;
+	TimeSinceLastPass = 0.0f;
+	bPulsePending = false;
+
+	// Refresh positions; owners that went away without unregistering are dropped here
+	for (int32 Index = EmitterOwners.Num() - 1; Index >= 0; Index--)
+	{
+		if (const AActor* Owner = EmitterOwners[Index].Get())
+		{
+			EmitterLocations[Index] = Owner->GetActorLocation();
+
+			// Several pulses can fall in one pass when the interval is shorter than TICK_INTERVAL
+			float& TimeToPulse = EmitterTimeToPulse[Index];
+			TimeToPulse -= PassSeconds;
+			EmitterPulseDrain[Index] = 0.0f;
+			if (TimeToPulse <= 0.0f)
+			{
+				const float Interval = EmitterPulseIntervals[Index];
+				const int32 Pulses = 1 + FMath::FloorToInt(-TimeToPulse / Interval);
+				TimeToPulse += Pulses * Interval;
+				EmitterPulseDrain[Index] = EmitterDrainPerSecond[Index] * Interval * Pulses;
+			}
+		}
+		else
+		{
+			RemoveEmitterAt(Index);
+		}
+	}
+	for (int32 Index = ReceiverComponents.Num() - 1; Index >= 0; Index--)
+	{
+		const AActor* Owner = ReceiverOwners[Index].Get();
+		if (Owner && ReceiverComponents[Index].IsValid())
+		{
+			ReceiverLocations[Index] = Owner->GetActorLocation();
+			ReceiverDrain[Index] = 0.0f;
+		}
+		else
+		{
+			RemoveReceiverAt(Index);
+		}
+	}
+
+	// Receivers are few (the player, plus any enemy with WillPower), emitters can be many
+	const int32 NumEmitters = EmitterOwners.Num();
+	for (int32 ReceiverIndex = 0; ReceiverIndex < ReceiverComponents.Num(); ReceiverIndex++)
+	{
+		const FVector ReceiverLocation = ReceiverLocations[ReceiverIndex];
+		const bool bIsEnemy = ReceiverIsEnemy[ReceiverIndex];
+		float Drain = 0.0f;
+
+		for (int32 EmitterIndex = 0; EmitterIndex < NumEmitters; EmitterIndex++)
+		{
+			if (EmitterPulseDrain[EmitterIndex] <= 0.0f || (bIsEnemy && !EmitterAffectsEnemies[EmitterIndex]))
+			{
+				continue;
+			}
+			if (FVector::DistSquared(ReceiverLocation, EmitterLocations[EmitterIndex]) > EmitterRadiiSq[EmitterIndex])
+			{
+				continue;
+			}
+
+			// An aura never drains its own owner; only checked for the rare hit
+			if (EmitterOwners[EmitterIndex] == ReceiverOwners[ReceiverIndex])
+			{
+				continue;
+			}
+			Drain += EmitterPulseDrain[EmitterIndex];
+		}
+
+		ReceiverDrain[ReceiverIndex] = Drain;
+	}
+
+	// Apply after evaluation so drain callbacks can't disturb the packed arrays mid-pass
+	for (int32 ReceiverIndex = 0; ReceiverIndex < ReceiverComponents.Num(); ReceiverIndex++)
+	{
+		const float Drain = ReceiverDrain[ReceiverIndex];
+		if (Drain <= 0.0f)
+		{
+			continue;
+		}
+
+		if (UWillPowerComponent* WillPower = ReceiverComponents[ReceiverIndex].Get())
+		{
+			WillPower->DrainWillPower(Drain);
+			if (!ReceiverIsEnemy[ReceiverIndex])
+			{
+				BLACKHOLE_LOG_RATE_LIMITED(LogBlackholeAbilities, Verbose, 1.0, TEXT("AuraField: Draining %.1f WP from player"), Drain);
+			}
+		}
+	}
+
+	for (int32 EmitterIndex = 0; EmitterIndex < NumEmitters; EmitterIndex++)
+	{
+		if (EmitterPulseDrain[EmitterIndex] > 0.0f)
+		{
+			BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugSphere(GetWorld(), EmitterLocations[EmitterIndex], FMath::Sqrt(EmitterRadiiSq[EmitterIndex]), 16, FColor::Orange, false, EmitterPulseIntervals[EmitterIndex]));
+		}
+	}
+}
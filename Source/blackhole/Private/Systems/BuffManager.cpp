@@ -1,126 +1,354 @@
 #include "Systems/BuffManager.h"
 #include "Engine/World.h"
 
+const FName UBuffManager::WPThresholdSource(TEXT("WPThreshold"));
+const FName UBuffManager::LostAbilitiesSource(TEXT("LostAbilities"));
+
+namespace
+{
+    constexpr float MAX_COOLDOWN_REDUCTION = 0.9f; // Cap at 90% CDR
+}
+
 void UBuffManager::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
-    
+
     // Initialize with empty buffs
-    CombinedBuffs.Reset();
-    ActiveBuffs.Empty();
+    ActiveModifiers.Empty();
+    SourceModifiers.Empty();
+    ResetAggregates();
 }
 
 void UBuffManager::Deinitialize()
 {
-    ClearAllBuffs();
+    ActiveModifiers.Empty();
+    SourceModifiers.Empty();
+    ResetAggregates();
+
+    OnBuffsChanged.Clear();
+    OnAttributeChanged.Clear();
+
     Super::Deinitialize();
 }
 
-void UBuffManager::AddBuff(const FString& BuffID, const FCombatBuff& Buff)
+FBuffModifierHandle UBuffManager::AddModifier(FName SourceId, EBuffAttribute Attribute, EBuffModifierOp Op, float Magnitude)
+{
+    FScopedBuffBatch Batch(*this);
+    return AddModifierInternal(SourceId, Attribute, Op, Magnitude);
+}
+
+FBuffModifierHandle UBuffManager::AddModifierInternal(FName SourceId, EBuffAttribute Attribute, EBuffModifierOp Op, float Magnitude)
+{
+    FBuffModifierHandle Handle;
+
+    if (SourceId.IsNone() || Attribute == EBuffAttribute::Count)
+    {
+        return Handle;
+    }
+
+    FBuffModifier Modifier;
+    Modifier.SourceId = SourceId;
+    Modifier.Attribute = Attribute;
+    Modifier.Op = Op;
+    Modifier.Magnitude = Magnitude;
+
+    Handle.Id = NextModifierId++;
+    ActiveModifiers.Add(Handle.Id, Modifier);
+    SourceModifiers.FindOrAdd(SourceId).Add(Handle.Id);
+
+    ApplyModifierToAggregate(Modifier, true);
+
+    return Handle;
+}
+
+bool UBuffManager::RemoveModifier(FBuffModifierHandle& Handle)
 {
-    if (BuffID.IsEmpty())
+    if (!Handle.IsValid())
+    {
+        return false;
+    }
+
+    FBuffModifier Modifier;
+    if (!ActiveModifiers.RemoveAndCopyValue(Handle.Id, Modifier))
+    {
+        Handle.Invalidate();
+        return false;
+    }
+
+    FScopedBuffBatch Batch(*this);
+
+    if (TArray<int32>* SourceHandles = SourceModifiers.Find(Modifier.SourceId))
+    {
+        SourceHandles->RemoveSingleSwap(Handle.Id);
+        if (SourceHandles->Num() == 0)
+        {
+            SourceModifiers.Remove(Modifier.SourceId);
+        }
+    }
+
+    ApplyModifierToAggregate(Modifier, false);
+    Handle.Invalidate();
+
+    return true;
+}
+
+void UBuffManager::RemoveModifiersFromSource(FName SourceId)
+{
+    TArray<int32> SourceHandles;
+    if (!SourceModifiers.RemoveAndCopyValue(SourceId, SourceHandles))
     {
         return;
     }
-    
-    ActiveBuffs.Add(BuffID, Buff);
-    RecalculateBuffs();
+
+    FScopedBuffBatch Batch(*this);
+
+    for (int32 HandleId : SourceHandles)
+    {
+        FBuffModifier Modifier;
+        if (ActiveModifiers.RemoveAndCopyValue(HandleId, Modifier))
+        {
+            ApplyModifierToAggregate(Modifier, false);
+        }
+    }
 }
 
-void UBuffManager::RemoveBuff(const FString& BuffID)
+void UBuffManager::AddBuff(FName BuffID, const FCombatBuff& Buff)
 {
-    if (ActiveBuffs.Remove(BuffID) > 0)
+    if (BuffID.IsNone())
     {
-        RecalculateBuffs();
+        return;
+    }
+
+    FScopedBuffBatch Batch(*this);
+
+    // A buff bundle replaces whatever its source contributed before
+    RemoveModifiersFromSource(BuffID);
+
+    // Multipliers stack multiplicatively, reductions additively (same as the old CombineWith)
+    if (!FMath::IsNearlyEqual(Buff.DamageMultiplier, 1.0f))
+    {
+        AddModifierInternal(BuffID, EBuffAttribute::Damage, EBuffModifierOp::Multiplicative, Buff.DamageMultiplier);
+    }
+    if (!FMath::IsNearlyZero(Buff.CooldownReduction))
+    {
+        AddModifierInternal(BuffID, EBuffAttribute::CooldownReduction, EBuffModifierOp::Additive, Buff.CooldownReduction);
+    }
+    if (!FMath::IsNearlyEqual(Buff.AttackSpeedMultiplier, 1.0f))
+    {
+        AddModifierInternal(BuffID, EBuffAttribute::AttackSpeed, EBuffModifierOp::Multiplicative, Buff.AttackSpeedMultiplier);
+    }
+    if (!FMath::IsNearlyEqual(Buff.MovementSpeedMultiplier, 1.0f))
+    {
+        AddModifierInternal(BuffID, EBuffAttribute::MovementSpeed, EBuffModifierOp::Multiplicative, Buff.MovementSpeedMultiplier);
     }
 }
 
 void UBuffManager::ClearAllBuffs()
 {
-    ActiveBuffs.Empty();
-    CombinedBuffs.Reset();
-    OnBuffsChanged.Broadcast(CombinedBuffs);
+    if (ActiveModifiers.Num() == 0)
+    {
+        return;
+    }
+
+    FScopedBuffBatch Batch(*this);
+
+    ActiveModifiers.Empty();
+    SourceModifiers.Empty();
+    CurrentLostAbilityCount = 0;
+
+    for (int32 i = 0; i < (int32)EBuffAttribute::Count; ++i)
+    {
+        FBuffAttributeAggregate& Aggregate = Aggregates[i];
+        Aggregate.AdditiveSum = 0.0f;
+        Aggregate.MultiplicativeProduct = 1.0f;
+        Aggregate.AdditiveCount = 0;
+        Aggregate.MultiplicativeCount = 0;
+        Aggregate.ZeroFactorCount = 0;
+        Aggregate.bDirty = true;
+    }
+}
+
+float UBuffManager::GetAttributeValue(EBuffAttribute Attribute) const
+{
+    if (Attribute == EBuffAttribute::Count)
+    {
+        return 0.0f;
+    }
+
+    return Aggregates[(int32)Attribute].CachedFinalValue;
 }
 
 float UBuffManager::CalculateFinalDamage(float BaseDamage) const
 {
-    return BaseDamage * CombinedBuffs.DamageMultiplier;
+    return BaseDamage * GetAttributeValue(EBuffAttribute::Damage);
 }
 
 float UBuffManager::CalculateFinalCooldown(float BaseCooldown) const
 {
-    return BaseCooldown * (1.0f - CombinedBuffs.CooldownReduction);
+    return BaseCooldown * (1.0f - GetAttributeValue(EBuffAttribute::CooldownReduction));
 }
 
-void UBuffManager::UpdateWPThresholdBuffs(float WPPercentage)
+void UBuffManager::SetWPThresholdBuffActive(bool bActive)
 {
-    FCombatBuff WPBuff = CreateWPThresholdBuff(WPPercentage);
-    
-    if (WPPercentage >= 0.5f) // 50% or higher
+    if (bActive == HasModifiersFromSource(WPThresholdSource))
     {
-        AddBuff(TEXT("WPThreshold"), WPBuff);
+        return;
     }
-    else
+
+    FScopedBuffBatch Batch(*this);
+
+    RemoveModifiersFromSource(WPThresholdSource);
+
+    if (bActive)
     {
-        RemoveBuff(TEXT("WPThreshold"));
+        // Threshold buff adds onto the base multipliers so it stacks linearly with survivor buffs
+        AddModifierInternal(WPThresholdSource, EBuffAttribute::Damage, EBuffModifierOp::Additive,
+            GameplayConfig::Thresholds::BUFFED_DAMAGE_MULT - 1.0f);
+        AddModifierInternal(WPThresholdSource, EBuffAttribute::CooldownReduction, EBuffModifierOp::Additive,
+            GameplayConfig::Thresholds::BUFFED_COOLDOWN_REDUCTION);
+        AddModifierInternal(WPThresholdSource, EBuffAttribute::AttackSpeed, EBuffModifierOp::Additive,
+            GameplayConfig::Thresholds::BUFFED_ATTACK_SPEED - 1.0f);
     }
 }
 
 void UBuffManager::UpdateLostAbilityBuffs(int32 AbilitiesLost)
 {
+    AbilitiesLost = FMath::Max(0, AbilitiesLost);
+    if (AbilitiesLost == CurrentLostAbilityCount)
+    {
+        return;
+    }
+
+    FScopedBuffBatch Batch(*this);
+
+    RemoveModifiersFromSource(LostAbilitiesSource);
+    CurrentLostAbilityCount = AbilitiesLost;
+
     if (AbilitiesLost > 0)
     {
-        FCombatBuff LostAbilityBuff = CreateLostAbilityBuff(AbilitiesLost);
-        AddBuff(TEXT("LostAbilities"), LostAbilityBuff);
+        // Scaling buffs per ability lost
+        AddModifierInternal(LostAbilitiesSource, EBuffAttribute::Damage, EBuffModifierOp::Additive,
+            GameplayConfig::Thresholds::DAMAGE_PER_LOST_ABILITY * AbilitiesLost);
+        AddModifierInternal(LostAbilitiesSource, EBuffAttribute::CooldownReduction, EBuffModifierOp::Additive,
+            GameplayConfig::Thresholds::CDR_PER_LOST_ABILITY * AbilitiesLost);
+        AddModifierInternal(LostAbilitiesSource, EBuffAttribute::AttackSpeed, EBuffModifierOp::Additive,
+            GameplayConfig::Thresholds::SPEED_PER_LOST_ABILITY * AbilitiesLost);
+    }
+}
+
+void UBuffManager::ApplyModifierToAggregate(const FBuffModifier& Modifier, bool bAdding)
+{
+    FBuffAttributeAggregate& Aggregate = Aggregates[(int32)Modifier.Attribute];
+
+    if (Modifier.Op == EBuffModifierOp::Additive)
+    {
+        Aggregate.AdditiveCount += bAdding ? 1 : -1;
+        Aggregate.AdditiveSum = Aggregate.AdditiveCount > 0
+            ? Aggregate.AdditiveSum + (bAdding ? Modifier.Magnitude : -Modifier.Magnitude)
+            : 0.0f; // Snap back to identity to avoid float drift
     }
     else
     {
-        RemoveBuff(TEXT("LostAbilities"));
+        const bool bZeroFactor = FMath::IsNearlyZero(Modifier.Magnitude);
+        Aggregate.MultiplicativeCount += bAdding ? 1 : -1;
+
+        if (Aggregate.MultiplicativeCount <= 0)
+        {
+            Aggregate.MultiplicativeCount = 0;
+            Aggregate.MultiplicativeProduct = 1.0f;
+            Aggregate.ZeroFactorCount = 0;
+        }
+        else if (bZeroFactor)
+        {
+            // Zero factors are counted instead of folded in so they can be removed again
+            Aggregate.ZeroFactorCount += bAdding ? 1 : -1;
+        }
+        else
+        {
+            Aggregate.MultiplicativeProduct = bAdding
+                ? Aggregate.MultiplicativeProduct * Modifier.Magnitude
+                : Aggregate.MultiplicativeProduct / Modifier.Magnitude;
+        }
     }
+
+    Aggregate.bDirty = true;
 }
 
-void UBuffManager::RecalculateBuffs()
+float UBuffManager::FinalizeAttribute(EBuffAttribute Attribute) const
 {
-    // Reset to base values
-    CombinedBuffs.Reset();
-    
-    // Combine all active buffs
-    for (const auto& BuffPair : ActiveBuffs)
+    const FBuffAttributeAggregate& Aggregate = Aggregates[(int32)Attribute];
+    const float Product = Aggregate.ZeroFactorCount > 0 ? 0.0f : Aggregate.MultiplicativeProduct;
+    const float Value = (Aggregate.BaseValue + Aggregate.AdditiveSum) * Product;
+
+    if (Attribute == EBuffAttribute::CooldownReduction)
     {
-        CombinedBuffs.CombineWith(BuffPair.Value);
+        return FMath::Clamp(Value, 0.0f, MAX_COOLDOWN_REDUCTION);
     }
-    
-    // Notify listeners
-    OnBuffsChanged.Broadcast(CombinedBuffs);
+
+    return FMath::Max(0.0f, Value);
 }
 
-FCombatBuff UBuffManager::CreateWPThresholdBuff(float WPPercentage) const
+void UBuffManager::FlushDirtyAttributes()
 {
-    FCombatBuff Buff;
-    
-    if (WPPercentage >= 0.5f && WPPercentage < 1.0f) // 50-99%
+    bool bAnyChanged = false;
+
+    for (int32 i = 0; i < (int32)EBuffAttribute::Count; ++i)
     {
-        Buff.DamageMultiplier = 1.2f; // +20% damage
-        Buff.CooldownReduction = 0.15f; // -15% cooldowns
-        Buff.AttackSpeedMultiplier = 1.25f; // +25% attack speed
-        Buff.BuffSource = TEXT("WP Threshold (Buffed)");
+        FBuffAttributeAggregate& Aggregate = Aggregates[i];
+        if (!Aggregate.bDirty)
+        {
+            continue;
+        }
+
+        Aggregate.bDirty = false;
+
+        const EBuffAttribute Attribute = (EBuffAttribute)i;
+        const float NewValue = FinalizeAttribute(Attribute);
+        if (FMath::IsNearlyEqual(NewValue, Aggregate.CachedFinalValue))
+        {
+            continue;
+        }
+
+        Aggregate.CachedFinalValue = NewValue;
+        bAnyChanged = true;
+
+        switch (Attribute)
+        {
+            case EBuffAttribute::Damage:            CombinedBuffs.DamageMultiplier = NewValue; break;
+            case EBuffAttribute::CooldownReduction: CombinedBuffs.CooldownReduction = NewValue; break;
+            case EBuffAttribute::AttackSpeed:       CombinedBuffs.AttackSpeedMultiplier = NewValue; break;
+            case EBuffAttribute::MovementSpeed:     CombinedBuffs.MovementSpeedMultiplier = NewValue; break;
+            default: break;
+        }
+
+        OnAttributeChanged.Broadcast(Attribute, NewValue);
+    }
+
+    // Notify listeners
+    if (bAnyChanged)
+    {
+        OnBuffsChanged.Broadcast(CombinedBuffs);
     }
-    
-    return Buff;
 }
 
-FCombatBuff UBuffManager::CreateLostAbilityBuff(int32 AbilitiesLost) const
+void UBuffManager::ResetAggregates()
 {
-    FCombatBuff Buff;
-    
-    if (AbilitiesLost > 0)
+    CombinedBuffs.Reset();
+    CurrentLostAbilityCount = 0;
+
+    for (int32 i = 0; i < (int32)EBuffAttribute::Count; ++i)
     {
-        // Scaling buffs per ability lost
-        Buff.DamageMultiplier = 1.0f + (0.1f * AbilitiesLost); // +10% per ability
-        Buff.CooldownReduction = 0.05f * AbilitiesLost; // -5% per ability
-        Buff.AttackSpeedMultiplier = 1.0f + (0.1f * AbilitiesLost); // +10% per ability
-        Buff.BuffSource = FString::Printf(TEXT("Survivor (%d abilities lost)"), AbilitiesLost);
-    }
-    
-    return Buff;
-}
\ No newline at end of file
+        Aggregates[i] = FBuffAttributeAggregate();
+    }
+
+    // Base values match the neutral FCombatBuff
+    Aggregates[(int32)EBuffAttribute::Damage].BaseValue = 1.0f;
+    Aggregates[(int32)EBuffAttribute::CooldownReduction].BaseValue = 0.0f;
+    Aggregates[(int32)EBuffAttribute::AttackSpeed].BaseValue = 1.0f;
+    Aggregates[(int32)EBuffAttribute::MovementSpeed].BaseValue = 1.0f;
+
+    for (int32 i = 0; i < (int32)EBuffAttribute::Count; ++i)
+    {
+        Aggregates[i].CachedFinalValue = FinalizeAttribute((EBuffAttribute)i);
+    }
+}
@@ -0,0 +1,416 @@
+#include "Systems/BuildCoordinationSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeDebugDraw.h"
+#include "Config/GameplayConfig.h"
+#include "Components/Abilities/Enemy/BuilderComponent.h"
+#include "Engine/World.h"
+
+void UBuildCoordinationSubsystem::Deinitialize()
+{
+	Builders.Empty();
+	Disruptors.Empty();
+
+	GroupTable.Empty();
+	GroupLeaders.Empty();
+	GroupLocations.Empty();
+	GroupLeaveRadiiSq.Empty();
+	GroupMinBuilders.Empty();
+	GroupMemberCounts.Empty();
+	GroupTimeSpent.Empty();
+	GroupBuildTime.Empty();
+	GroupPaused.Empty();
+
+	MemberBuilders.Empty();
+	MemberOwners.Empty();
+	MemberGroups.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UBuildCoordinationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBuildCoordinationSubsystem, STATGROUP_Blackhole);
+}
+
+void UBuildCoordinationSubsystem::RegisterBuilder(UBuilderComponent* Builder)
+{
+	if (Builder)
+	{
+		Builders.AddUnique(Builder);
+	}
+}
+
+void UBuildCoordinationSubsystem::UnregisterBuilder(UBuilderComponent* Builder)
+{
+	Builders.RemoveSwap(Builder, EAllowShrinking::No);
+	LeaveGroup(Builder);
+}
+
+void UBuildCoordinationSubsystem::RegisterDisruptor(AActor* Disruptor)
+{
+	if (Disruptor)
+	{
+		Disruptors.AddUnique(Disruptor);
+	}
+}
+
+void UBuildCoordinationSubsystem::UnregisterDisruptor(AActor* Disruptor)
+{
+	Disruptors.RemoveSwap(Disruptor, EAllowShrinking::No);
+}
+
+int32 UBuildCoordinationSubsystem::StartGroup(UBuilderComponent* Leader, const FVector& Location)
+{
+	if (!Leader || Leader->IsBuilding())
+	{
+		return INDEX_NONE;
+	}
+
+	// Count the crew before touching anyone, so a build that can't start leaves no trace
+	TArray<UBuilderComponent*, TInlineAllocator<8>> Recruits;
+	Recruits.Add(Leader);
+
+	const float RecruitRadiusSq = FMath::Square(Leader->BuildRadius);
+	for (const TWeakObjectPtr<UBuilderComponent>& WeakBuilder : Builders)
+	{
+		UBuilderComponent* Builder = WeakBuilder.Get();
+		const AActor* Owner = Builder ? Builder->GetOwner() : nullptr;
+		if (!Owner || Builder == Leader || Builder->IsBuilding())
+		{
+			continue;
+		}
+
+		if (FVector::DistSquared(Owner->GetActorLocation(), Location) <= RecruitRadiusSq)
+		{
+			Recruits.Add(Builder);
+		}
+	}
+
+	if (Recruits.Num() < Leader->MinBuildersRequired)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Group = GroupTable.Add();
+	GroupLeaders.Add(Leader);
+	GroupLocations.Add(Location);
+	GroupLeaveRadiiSq.Add(FMath::Square(Leader->BuildRadius * GameplayConfig::Enemy::Building::LEAVE_RADIUS_SCALE));
+	GroupMinBuilders.Add(Leader->MinBuildersRequired);
+	GroupMemberCounts.Add(0);
+	GroupTimeSpent.Add(0.0f);
+	GroupBuildTime.Add(FMath::Max(Leader->BuildTime, UE_KINDA_SMALL_NUMBER));
+	GroupPaused.Add(false);
+
+	for (UBuilderComponent* Builder : Recruits)
+	{
+		AddMember(Group, Builder);
+	}
+
+	// Callbacks last; they change AI state and may re-enter the subsystem
+	Leader->EnterBuild(Group, Location, true);
+	Leader->HandleBuildStarted();
+	for (int32 i = 1; i < Recruits.Num(); i++)
+	{
+		Recruits[i]->EnterBuild(Group, Location, false);
+	}
+
+	return Group;
+}
+
+bool UBuildCoordinationSubsystem::JoinGroup(int32 Group, UBuilderComponent* Builder)
+{
+	const int32 GroupIndex = GroupTable.Find(Group);
+	if (GroupIndex == INDEX_NONE || !Builder || Builder->IsBuilding())
+	{
+		return false;
+	}
+
+	AddMember(Group, Builder);
+	Builder->EnterBuild(Group, GroupLocations[GroupIndex], false);
+	return true;
+}
+
+void UBuildCoordinationSubsystem::AddMember(int32 Group, UBuilderComponent* Builder)
+{
+	MemberBuilders.Add(Builder);
+	MemberOwners.Add(Builder->GetOwner());
+	MemberGroups.Add(Group);
+	GroupMemberCounts[GroupTable.Find(Group)]++;
+}
+
+void UBuildCoordinationSubsystem::LeaveGroup(UBuilderComponent* Builder)
+{
+	const int32 MemberIndex = MemberBuilders.IndexOfByKey(Builder);
+	if (MemberIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Losing the leader ends the build
+	const int32 GroupIndex = GroupTable.Find(MemberGroups[MemberIndex]);
+	if (GroupIndex != INDEX_NONE && GroupLeaders[GroupIndex] == Builder)
+	{
+		FinishGroupAt(GroupIndex, false);
+		return;
+	}
+
+	RemoveMemberAt(MemberIndex, true);
+}
+
+void UBuildCoordinationSubsystem::RemoveMemberAt(int32 MemberIndex, bool bReleaseBuilder)
+{
+	UBuilderComponent* Builder = MemberBuilders[MemberIndex].Get();
+	const int32 GroupIndex = GroupTable.Find(MemberGroups[MemberIndex]);
+
+	MemberBuilders.RemoveAtSwap(MemberIndex, 1, EAllowShrinking::No);
+	MemberOwners.RemoveAtSwap(MemberIndex, 1, EAllowShrinking::No);
+	MemberGroups.RemoveAtSwap(MemberIndex, 1, EAllowShrinking::No);
+
+	if (GroupIndex != INDEX_NONE)
+	{
+		GroupMemberCounts[GroupIndex]--;
+
+		// Every lost builder stretches the time still remaining
+		const float TimeRemaining = GroupBuildTime[GroupIndex] - GroupTimeSpent[GroupIndex];
+		GroupBuildTime[GroupIndex] = GroupTimeSpent[GroupIndex] + TimeRemaining * GameplayConfig::Enemy::Building::LOST_BUILDER_TIME_SCALE;
+	}
+
+	if (bReleaseBuilder && Builder)
+	{
+		Builder->ExitBuild();
+	}
+}
+
+void UBuildCoordinationSubsystem::CancelGroup(int32 Group)
+{
+	const int32 GroupIndex = GroupTable.Find(Group);
+	if (GroupIndex != INDEX_NONE)
+	{
+		FinishGroupAt(GroupIndex, false);
+	}
+}
+
+void UBuildCoordinationSubsystem::FinishGroupAt(int32 GroupIndex, bool bCompleted)
+{
+	const int32 Group = GroupTable.GetHandle(GroupIndex);
+	UBuilderComponent* Leader = GroupLeaders[GroupIndex].Get();
+
+	TArray<UBuilderComponent*, TInlineAllocator<8>> Released;
+	for (int32 i = MemberGroups.Num() - 1; i >= 0; i--)
+	{
+		if (MemberGroups[i] == Group)
+		{
+			if (UBuilderComponent* Builder = MemberBuilders[i].Get())
+			{
+				Released.Add(Builder);
+			}
+			MemberBuilders.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			MemberOwners.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			MemberGroups.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+
+	RemoveGroupAt(GroupIndex);
+
+	// The leader still knows the build location here; ExitBuild clears it
+	if (Leader)
+	{
+		if (bCompleted)
+		{
+			Leader->HandleBuildCompleted();
+		}
+		else
+		{
+			Leader->HandleBuildCancelled();
+		}
+	}
+
+	for (UBuilderComponent* Builder : Released)
+	{
+		Builder->ExitBuild();
+	}
+}
+
+void UBuildCoordinationSubsystem::RemoveGroupAt(int32 GroupIndex)
+{
+	GroupTable.RemoveAtSwap(GroupIndex, GroupLeaders, GroupLocations, GroupLeaveRadiiSq, GroupMinBuilders,
+		GroupMemberCounts, GroupTimeSpent, GroupBuildTime, GroupPaused);
+}
+
+void UBuildCoordinationSubsystem::SetGroupPaused(int32 Group, bool bPaused)
+{
+	const int32 GroupIndex = GroupTable.Find(Group);
+	if (GroupIndex == INDEX_NONE || GroupPaused[GroupIndex] == bPaused)
+	{
+		return;
+	}
+
+	GroupPaused[GroupIndex] = bPaused;
+
+	if (bPaused)
+	{
+		TArray<UBuilderComponent*, TInlineAllocator<8>> Paused;
+		for (int32 i = 0; i < MemberGroups.Num(); i++)
+		{
+			if (MemberGroups[i] == Group && MemberBuilders[i].IsValid())
+			{
+				Paused.Add(MemberBuilders[i].Get());
+			}
+		}
+		for (UBuilderComponent* Builder : Paused)
+		{
+			Builder->HandleBuildPaused();
+		}
+	}
+}
+
+bool UBuildCoordinationSubsystem::IsGroupPaused(int32 Group) const
+{
+	const int32 GroupIndex = GroupTable.Find(Group);
+	return GroupIndex != INDEX_NONE && GroupPaused[GroupIndex];
+}
+
+float UBuildCoordinationSubsystem::GetGroupProgress(int32 Group) const
+{
+	const int32 GroupIndex = GroupTable.Find(Group);
+	if (GroupIndex == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+	return FMath::Min(GroupTimeSpent[GroupIndex] / GroupBuildTime[GroupIndex], 1.0f);
+}
+
+UBuilderComponent* UBuildCoordinationSubsystem::FindNearestBuildLeader(const FVector& Origin, float MaxRange) const
+{
+	UBuilderComponent* NearestLeader = nullptr;
+	float NearestDistanceSq = FMath::Square(MaxRange);
+
+	for (int32 GroupIndex = 0; GroupIndex < GroupLeaders.Num(); GroupIndex++)
+	{
+		const float DistanceSq = FVector::DistSquared(Origin, GroupLocations[GroupIndex]);
+		if (DistanceSq < NearestDistanceSq && GroupLeaders[GroupIndex].IsValid())
+		{
+			NearestDistanceSq = DistanceSq;
+			NearestLeader = GroupLeaders[GroupIndex].Get();
+		}
+	}
+
+	return NearestLeader;
+}
+
+int32 UBuildCoordinationSubsystem::GatherBuildersInRadius(const FVector& Origin, float Radius, const UBuilderComponent* Exclude, FVector& OutLocationSum) const
+{
+	const float RadiusSq = FMath::Square(Radius);
+	int32 Count = 0;
+
+	for (const TWeakObjectPtr<UBuilderComponent>& WeakBuilder : Builders)
+	{
+		const UBuilderComponent* Builder = WeakBuilder.Get();
+		const AActor* Owner = Builder ? Builder->GetOwner() : nullptr;
+		if (!Owner || Builder == Exclude)
+		{
+			continue;
+		}
+
+		const FVector Location = Owner->GetActorLocation();
+		if (FVector::DistSquared(Origin, Location) <= RadiusSq)
+		{
+			OutLocationSum += Location;
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+void UBuildCoordinationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (GroupLeaders.Num() == 0)
+	{
+		TimeSinceLastUpdate = 0.0f;
+		return;
+	}
+
+	TimeSinceLastUpdate += DeltaTime;
+	if (TimeSinceLastUpdate < GameplayConfig::Enemy::Building::UPDATE_INTERVAL)
+	{
+		return;
+	}
+
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Build Coordination Update", STAT_Blackhole_BuildCoordinationUpdate, BlackholeAIChannel);
+
+	const float StepSeconds = TimeSinceLastUpdate;
+	TimeSinceLastUpdate = 0.0f;
+
+	// Members: drop the destroyed, release those that wandered off. Releasing changes AI state,
+	// so it waits until the arrays are settled.
+	TArray<UBuilderComponent*, TInlineAllocator<8>> Released;
+	for (int32 i = MemberBuilders.Num() - 1; i >= 0; i--)
+	{
+		const AActor* Owner = MemberOwners[i].Get();
+		const int32 GroupIndex = GroupTable.Find(MemberGroups[i]);
+		if (!Owner || !MemberBuilders[i].IsValid() || GroupIndex == INDEX_NONE)
+		{
+			RemoveMemberAt(i, false);
+			continue;
+		}
+
+		// Paused crews are off fighting
+		if (GroupPaused[GroupIndex])
+		{
+			continue;
+		}
+
+		if (FVector::DistSquared(Owner->GetActorLocation(), GroupLocations[GroupIndex]) > GroupLeaveRadiiSq[GroupIndex]
+			&& GroupLeaders[GroupIndex] != MemberBuilders[i])
+		{
+			Released.Add(MemberBuilders[i].Get());
+			RemoveMemberAt(i, false);
+		}
+	}
+
+	// Groups: advance, then collect the ones that finished or fell apart
+	TArray<TPair<int32, bool>, TInlineAllocator<4>> Finished;
+	for (int32 GroupIndex = 0; GroupIndex < GroupLeaders.Num(); GroupIndex++)
+	{
+		if (!GroupLeaders[GroupIndex].IsValid() || GroupMemberCounts[GroupIndex] < GroupMinBuilders[GroupIndex])
+		{
+			Finished.Emplace(GroupTable.GetHandle(GroupIndex), false);
+			continue;
+		}
+
+		if (GroupPaused[GroupIndex])
+		{
+			continue;
+		}
+
+		GroupTimeSpent[GroupIndex] += StepSeconds;
+		if (GroupTimeSpent[GroupIndex] >= GroupBuildTime[GroupIndex])
+		{
+			Finished.Emplace(GroupTable.GetHandle(GroupIndex), true);
+			continue;
+		}
+
+		// Progress ring; the draw and its arguments compile out with the facade
+		BLACKHOLE_DEBUG_DRAW(Abilities_AoE, DrawDebugCircle(GetWorld(), GroupLocations[GroupIndex],
+			100.0f * GroupTimeSpent[GroupIndex] / GroupBuildTime[GroupIndex], 32, FColor::Blue,
+			false, GameplayConfig::Enemy::Building::UPDATE_INTERVAL, 0, 2.0f));
+	}
+
+	for (const TPair<int32, bool>& Group : Finished)
+	{
+		const int32 GroupIndex = GroupTable.Find(Group.Key);
+		if (GroupIndex != INDEX_NONE)
+		{
+			FinishGroupAt(GroupIndex, Group.Value);
+		}
+	}
+
+	for (UBuilderComponent* Builder : Released)
+	{
+		Builder->ExitBuild();
+	}
+}
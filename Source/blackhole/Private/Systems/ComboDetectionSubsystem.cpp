@@ -1,4 +1,7 @@
 #include "Systems/ComboDetectionSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Player/BlackholePlayerCharacter.h"
@@ -28,6 +31,18 @@ void UComboDetectionSubsystem::Deinitialize()
     Super::Deinitialize();
 }
 
+void UComboDetectionSubsystem::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    SIZE_T HistoryBytes = InputHistories.GetAllocatedSize();
+    for (const TPair<AActor*, TArray<FComboInputRecord>>& History : InputHistories)
+    {
+        HistoryBytes += History.Value.GetAllocatedSize();
+    }
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(HistoryBytes);
+}
+
 void UComboDetectionSubsystem::RegisterInput(AActor* InputOwner, EComboInput Input, FVector InputLocation)
 {
     if (!InputOwner || Input == EComboInput::None)
@@ -35,6 +50,8 @@ void UComboDetectionSubsystem::RegisterInput(AActor* InputOwner, EComboInput Inp
         return;
     }
     
+    BLACKHOLE_LLM_SCOPE(Combos);
+
     // Record input
     FComboInputRecord NewInput;
     NewInput.Input = Input;
@@ -63,6 +80,8 @@ void UComboDetectionSubsystem::RegisterInput(AActor* InputOwner, EComboInput Inp
 
 void UComboDetectionSubsystem::UpdateComboStates()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Combo Detection Update", STAT_Blackhole_ComboDetectionUpdate, BlackholeSystemsChannel);
+
     float CurrentTime = GetWorld()->GetTimeSeconds();
     
     // Check all active combos for timeout
@@ -281,7 +300,7 @@ void UComboDetectionSubsystem::CleanupActor(AActor* Actor)
     // Remove from input histories
     InputHistories.Remove(Actor);
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("ComboDetectionSubsystem: Cleaned up actor %s"), *Actor->GetName());
+    UE_LOG(LogBlackholeAbilities, VeryVerbose, TEXT("ComboDetectionSubsystem: Cleaned up actor %s"), *Actor->GetName());
 }
 
 bool UComboDetectionSubsystem::IsInputWithinWindow(float InputTime, float WindowStart, float WindowEnd) const
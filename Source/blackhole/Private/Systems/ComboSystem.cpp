@@ -1,9 +1,12 @@
 #include "Systems/ComboSystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Systems/ResourceManager.h"
 #include "Components/Abilities/AbilityComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/BlackholeDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 #include "Config/GameplayConfig.h"
 #include "Utils/ErrorHandling.h"
@@ -37,6 +40,8 @@ void UComboSystem::BeginPlay()
 
 void UComboSystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Combo System Tick", STAT_Blackhole_ComboSystemTick, BlackholeSystemsChannel);
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
     // Update input history
@@ -70,7 +75,7 @@ void UComboSystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorCom
             (ActiveCombo.Pattern.TimingWindows.IsValidIndex(ActiveCombo.CurrentInputIndex) ? 
              ActiveCombo.Pattern.TimingWindows[ActiveCombo.CurrentInputIndex] : 1.0f);
         
-        DrawDebugSphere(
+        BLACKHOLE_DEBUG_DRAW(Abilities_Combos, DrawDebugSphere(
             GetWorld(),
             OwnerCharacter->GetActorLocation() + FVector(0, 0, 100),
             50.0f * WindowPercent,
@@ -78,12 +83,14 @@ void UComboSystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorCom
             FColor::Cyan,
             false,
             0.1f
-        );
+        ));
     }
 }
 
 void UComboSystem::RegisterInput(EComboInputType InputType, FVector InputLocation)
 {
+    BLACKHOLE_LLM_SCOPE(Combos);
+
     // Create input record
     FComboInput NewInput(InputType);
     NewInput.InputLocation = InputLocation.IsZero() ? OwnerCharacter->GetActorLocation() : InputLocation;
@@ -243,7 +250,7 @@ void UComboSystem::ExecuteComboEffects(const FComboPattern& Combo, bool bPerfect
     ShowComboUI(Combo, bPerfectTiming);
 
     // Log for debug
-    UE_LOG(LogTemp, Log, TEXT("Combo Executed: %s (Perfect: %s)"), 
+    UE_LOG(LogBlackholeAbilities, Log, TEXT("Combo Executed: %s (Perfect: %s)"), 
            *Combo.ComboName.ToString(), 
            bPerfectTiming ? TEXT("Yes") : TEXT("No"));
 }
@@ -1,4 +1,5 @@
 #include "Systems/DeathManager.h"
+#include "blackhole.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Systems/ResourceManager.h"
 #include "Engine/World.h"
@@ -170,7 +171,7 @@ void UDeathManager::ExecuteDeath(EDeathReason Reason)
             break;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("Player Death: %s"), *ReasonString);
+    UE_LOG(LogBlackhole, Warning, TEXT("Player Death: %s"), *ReasonString);
     
     // Broadcast death event
     OnPlayerDeath.Broadcast(Reason);
@@ -0,0 +1,171 @@
+#include "Systems/EnemyArchetypeCache.h"
+#include "blackhole.h"
+#include "Debug/BlackholeMemory.h"
+#include "Systems/EnemyTrackingManager.h"
+#include "Enemy/BaseEnemy.h"
+#include "Engine/DataTable.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+void UEnemyArchetypeCache::Deinitialize()
+{
+	for (TPair<TObjectKey<UDataTable>, TUniquePtr<FTableArchetypes>>& Entry : Tables)
+	{
+		StopWatching(*Entry.Value);
+	}
+	Tables.Empty();
+
+	Super::Deinitialize();
+}
+
+TUniquePtr<UEnemyArchetypeCache::FTableArchetypes> UEnemyArchetypeCache::BuildTable(UDataTable* Table)
+{
+	if (Table->GetRowStruct() != FEnemyStatsData::StaticStruct())
+	{
+		UE_LOG(LogBlackholeAI, Error, TEXT("EnemyArchetypeCache: Table %s does not use FEnemyStatsData rows"), *Table->GetName());
+		return nullptr;
+	}
+
+	BLACKHOLE_LLM_SCOPE(Data);
+
+	TUniquePtr<FTableArchetypes> Built = MakeUnique<FTableArchetypes>();
+	Built->Table = Table;
+
+	const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+	Built->Archetypes.SetNum(RowMap.Num());
+	Built->RowToIndex.Reserve(RowMap.Num());
+
+	int32 Index = 0;
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		UEnemyStatsManager::BuildArchetype(Row.Key, *reinterpret_cast<const FEnemyStatsData*>(Row.Value), Built->Archetypes[Index]);
+
+		Built->RowToIndex.Add(Row.Key, Index);
+		Index++;
+	}
+
+	return Built;
+}
+
+const UEnemyArchetypeCache::FTableArchetypes* UEnemyArchetypeCache::GetOrBuild(UDataTable* Table)
+{
+	if (!Table)
+	{
+		return nullptr;
+	}
+
+	if (const TUniquePtr<FTableArchetypes>* Found = Tables.Find(Table))
+	{
+		return Found->Get();
+	}
+
+	TUniquePtr<FTableArchetypes> Built = BuildTable(Table);
+	if (!Built)
+	{
+		return nullptr;
+	}
+
+	// Reimports and editor edits broadcast this
+	Built->ChangedHandle = Table->OnDataTableChanged().AddUObject(this, &UEnemyArchetypeCache::HandleTableChanged, TWeakObjectPtr<UDataTable>(Table));
+
+	UE_LOG(LogBlackholeAI, Log, TEXT("EnemyArchetypeCache: Resolved %d archetypes from %s"), Built->Archetypes.Num(), *Table->GetName());
+
+	return Tables.Add(Table, MoveTemp(Built)).Get();
+}
+
+void UEnemyArchetypeCache::StopWatching(FTableArchetypes& Resolved)
+{
+	if (UDataTable* Table = Resolved.Table.Get())
+	{
+		Table->OnDataTableChanged().Remove(Resolved.ChangedHandle);
+	}
+	Resolved.ChangedHandle.Reset();
+}
+
+const FEnemyArchetype* UEnemyArchetypeCache::FindArchetype(UDataTable* Table, FName RowName)
+{
+	const FTableArchetypes* Resolved = GetOrBuild(Table);
+	const int32* Index = Resolved ? Resolved->RowToIndex.Find(RowName) : nullptr;
+	return Index ? &Resolved->Archetypes[*Index] : nullptr;
+}
+
+void UEnemyArchetypeCache::Invalidate(UDataTable* Table)
+{
+	TUniquePtr<FTableArchetypes> Removed;
+	if (Tables.RemoveAndCopyValue(Table, Removed) && Removed)
+	{
+		StopWatching(*Removed);
+	}
+}
+
+void UEnemyArchetypeCache::HandleTableChanged(TWeakObjectPtr<UDataTable> WeakTable)
+{
+	UDataTable* Table = WeakTable.Get();
+	TUniquePtr<FTableArchetypes>* Existing = Table ? Tables.Find(Table) : nullptr;
+	if (!Existing)
+	{
+		return;
+	}
+
+	TUniquePtr<FTableArchetypes> Rebuilt = BuildTable(Table);
+	if (!Rebuilt)
+	{
+		// Row struct changed under us - forget the table
+		Invalidate(Table);
+		return;
+	}
+
+	// Swap the new rows in; the old ones are only needed for the diff
+	Rebuilt->ChangedHandle = (*Existing)->ChangedHandle;
+	TUniquePtr<FTableArchetypes> Previous = MoveTemp(*Existing);
+	*Existing = MoveTemp(Rebuilt);
+	const FTableArchetypes& Current = **Existing;
+
+	TMap<FName, EEnemyArchetypeFields> RowChanges;
+	for (const TPair<FName, int32>& Row : Current.RowToIndex)
+	{
+		const int32* OldIndex = Previous->RowToIndex.Find(Row.Key);
+		const EEnemyArchetypeFields Changes = OldIndex
+			? UEnemyStatsManager::DiffArchetypes(Previous->Archetypes[*OldIndex], Current.Archetypes[Row.Value])
+			: EEnemyArchetypeFields::All;
+
+		if (Changes != EEnemyArchetypeFields::None)
+		{
+			RowChanges.Add(Row.Key, Changes);
+		}
+	}
+
+	if (RowChanges.Num() == 0)
+	{
+		return;
+	}
+
+	// Push the changed groups to live enemies built from this table
+	const UWorld* World = GetGameInstance()->GetWorld();
+	const UEnemyTrackingManager* TrackingManager = World ? World->GetSubsystem<UEnemyTrackingManager>() : nullptr;
+	int32 EnemiesUpdated = 0;
+
+	if (TrackingManager)
+	{
+		for (const FTrackedEnemy& Tracked : TrackingManager->GetTrackedEnemies())
+		{
+			ABaseEnemy* Enemy = Tracked.Enemy.Get();
+			if (!Enemy || Enemy->IsDead() || Enemy->EnemyStatsDataTable != Table)
+			{
+				continue;
+			}
+
+			const EEnemyArchetypeFields* Changes = RowChanges.Find(Enemy->StatsRowName);
+			if (!Changes)
+			{
+				continue;
+			}
+
+			Enemy->ApplyArchetype(Current.Archetypes[Current.RowToIndex[Enemy->StatsRowName]], *Changes);
+			EnemiesUpdated++;
+		}
+	}
+
+	UE_LOG(LogBlackholeAI, Log, TEXT("EnemyArchetypeCache: %s changed (%d rows), re-applied to %d live enemies"),
+		*Table->GetName(), RowChanges.Num(), EnemiesUpdated);
+}
@@ -0,0 +1,185 @@
+#include "Systems/EnemyPerceptionSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Config/GameplayConfig.h"
+#include "Enemy/BaseEnemy.h"
+#include "Enemy/AI/EnemyStateMachine.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+
+bool UEnemyPerceptionSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UEnemyPerceptionSubsystem::Deinitialize()
+{
+	Player.Reset();
+	bHasPlayer = false;
+
+	EnemyTable.Empty();
+	EnemyOwners.Empty();
+	EnemyStateMachines.Empty();
+	EnemyLocations.Empty();
+	EnemyForwards.Empty();
+	EnemyRanges.Empty();
+	Results.Empty();
+
+	Super::Deinitialize();
+}
+
+int32 UEnemyPerceptionSubsystem::RegisterEnemy(UEnemyStateMachine* StateMachine)
+{
+	ABaseEnemy* Enemy = StateMachine ? Cast<ABaseEnemy>(StateMachine->GetOwner()) : nullptr;
+	if (!Enemy)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Handle = EnemyTable.Add();
+	EnemyOwners.Add(Enemy);
+	EnemyStateMachines.Add(StateMachine);
+	EnemyLocations.Add(Enemy->GetActorLocation());
+	EnemyForwards.Add(Enemy->GetActorForwardVector());
+	EnemyRanges.AddZeroed();
+	Results.AddDefaulted();
+
+	// Give the newcomer a row on the next request instead of a default one
+	LastStepFrame = MAX_uint64;
+
+	return Handle;
+}
+
+void UEnemyPerceptionSubsystem::UnregisterEnemy(int32 Handle)
+{
+	const int32 Index = EnemyTable.Find(Handle);
+	if (Index != INDEX_NONE)
+	{
+		EnemyTable.RemoveAtSwap(Index, EnemyOwners, EnemyStateMachines, EnemyLocations, EnemyForwards, EnemyRanges, Results);
+	}
+}
+
+const FEnemyPerception* UEnemyPerceptionSubsystem::GetPerception(int32 Handle)
+{
+	const int32 Index = EnemyTable.Find(Handle);
+	if (Index == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	// The step never adds or removes rows, so Index stays valid
+	RefreshIfStale();
+	return bHasPlayer ? &Results[Index] : nullptr;
+}
+
+ACharacter* UEnemyPerceptionSubsystem::GetPlayer()
+{
+	RefreshIfStale();
+	return Player.Get();
+}
+
+EEnemyRangeBand UEnemyPerceptionSubsystem::ClassifyRange(float Distance, float AttackRange, float ChaseRange, float SightRange)
+{
+	using namespace GameplayConfig::Enemy::Perception;
+
+	if (Distance <= AttackRange)
+	{
+		return EEnemyRangeBand::Attack;
+	}
+	if (Distance <= AttackRange * ENGAGE_RANGE_SCALE)
+	{
+		return EEnemyRangeBand::Engage;
+	}
+	if (Distance <= ChaseRange * CHASE_LEASH_SCALE)
+	{
+		return EEnemyRangeBand::Chase;
+	}
+	return Distance <= SightRange ? EEnemyRangeBand::Sight : EEnemyRangeBand::Beyond;
+}
+
+void UEnemyPerceptionSubsystem::RefreshIfStale()
+{
+	if (LastStepFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastStepFrame = GFrameCounter;
+
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Enemy Perception Step", STAT_Blackhole_EnemyPerceptionStep, BlackholeAIChannel);
+
+	// One player lookup per step, shared by every enemy
+	ACharacter* PlayerCharacter = Player.Get();
+	if (!PlayerCharacter)
+	{
+		PlayerCharacter = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+		Player = PlayerCharacter;
+	}
+
+	bHasPlayer = PlayerCharacter != nullptr;
+	if (!bHasPlayer)
+	{
+		return;
+	}
+
+	const FVector PlayerLocation = PlayerCharacter->GetActorLocation();
+	const FVector PlayerForward = PlayerCharacter->GetActorForwardVector();
+	const FVector PlayerForward2D = PlayerForward.GetSafeNormal2D();
+	const FVector PlayerVelocity = PlayerCharacter->GetVelocity();
+
+	// Snapshot on the game thread; the parallel pass only touches the packed arrays
+	for (int32 i = 0; i < EnemyOwners.Num(); i++)
+	{
+		const ABaseEnemy* Enemy = EnemyOwners[i].Get();
+		const UEnemyStateMachine* StateMachine = EnemyStateMachines[i].Get();
+		if (!Enemy || !StateMachine)
+		{
+			EnemyRanges[i] = FVector(-1.0f);
+			continue;
+		}
+
+		EnemyLocations[i] = Enemy->GetActorLocation();
+		EnemyForwards[i] = Enemy->GetActorForwardVector();
+
+		const FEnemyAIParameters& Params = StateMachine->GetAIParameters();
+		EnemyRanges[i] = FVector(Params.AttackRange, Params.ChaseRange, Params.SightRange);
+	}
+
+	const int32 Count = EnemyOwners.Num();
+	ParallelFor(Count, [&](int32 i)
+	{
+		FEnemyPerception& Result = Results[i];
+		Result.PlayerLocation = PlayerLocation;
+		Result.PlayerVelocity = PlayerVelocity;
+
+		const FVector& Ranges = EnemyRanges[i];
+		if (Ranges.X < 0.0f)
+		{
+			// Owner is being torn down; its state machine unregisters on EndPlay
+			Result.Distance = MAX_FLT;
+			Result.RangeBand = EEnemyRangeBand::Beyond;
+			return;
+		}
+
+		const FVector EnemyLocation = EnemyLocations[i];
+		const FVector Offset = PlayerLocation - EnemyLocation;
+
+		Result.EnemyLocation = EnemyLocation;
+		Result.Distance = Offset.Size();
+		Result.ToPlayer = Offset.GetSafeNormal();
+		Result.FacingDot = FVector::DotProduct(EnemyForwards[i], Result.ToPlayer);
+		Result.PlayerFacingDot = FVector::DotProduct(PlayerForward, -Result.ToPlayer);
+
+		const float FlankCos = FVector::DotProduct(PlayerForward2D, (-Offset).GetSafeNormal2D());
+		Result.FlankAngle = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FlankCos, -1.0f, 1.0f)));
+
+		Result.RangeBand = ClassifyRange(Result.Distance, Ranges.X, Ranges.Y, Ranges.Z);
+	}, Count < GameplayConfig::Enemy::Perception::MIN_PARALLEL_ENEMIES ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
@@ -0,0 +1,65 @@
+#include "Systems/EnemyTrackingManager.h"
+#include "Debug/BlackholeStats.h"
+#include "Enemy/BaseEnemy.h"
+#include "Enemy/AI/EnemyStateMachine.h"
+#include "Components/Abilities/Enemy/BuilderComponent.h"
+#include "Components/Abilities/Enemy/PowerfulMindmeldComponent.h"
+
+void UEnemyTrackingManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TrackedEnemies.Reset();
+}
+
+void UEnemyTrackingManager::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_Blackhole_ActiveEnemies, TrackedEnemies.Num());
+	TrackedEnemies.Empty();
+
+	Super::Deinitialize();
+}
+
+void UEnemyTrackingManager::RegisterEnemy(ABaseEnemy* Enemy)
+{
+	if (!IsValid(Enemy))
+	{
+		return;
+	}
+
+	for (const FTrackedEnemy& Tracked : TrackedEnemies)
+	{
+		if (Tracked.Enemy.Get() == Enemy)
+		{
+			return;
+		}
+	}
+
+	FTrackedEnemy& Tracked = TrackedEnemies.AddDefaulted_GetRef();
+	Tracked.Enemy = Enemy;
+	Tracked.StateMachine = Enemy->GetStateMachine();
+	Tracked.Builder = Enemy->FindComponentByClass<UBuilderComponent>();
+	Tracked.Mindmeld = Enemy->FindComponentByClass<UPowerfulMindmeldComponent>();
+
+	INC_DWORD_STAT(STAT_Blackhole_ActiveEnemies);
+}
+
+void UEnemyTrackingManager::UnregisterEnemy(ABaseEnemy* Enemy)
+{
+	// Also sweeps out entries whose actor has already been collected
+	for (int32 i = TrackedEnemies.Num() - 1; i >= 0; i--)
+	{
+		ABaseEnemy* TrackedEnemy = TrackedEnemies[i].Enemy.Get();
+		if (!TrackedEnemy || TrackedEnemy == Enemy)
+		{
+			TrackedEnemies.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			DEC_DWORD_STAT(STAT_Blackhole_ActiveEnemies);
+		}
+	}
+}
+
+bool UEnemyTrackingManager::IsVisibleToPlayer(const FTrackedEnemy& Tracked)
+{
+	const UEnemyStateMachine* StateMachine = Tracked.StateMachine.Get();
+	return StateMachine && StateMachine->HasLineOfSight();
+}
@@ -1,4 +1,5 @@
 #include "Systems/GameStateManager.h"
+#include "blackhole.h"
 #include "Systems/ResourceManager.h"
 #include "Systems/ThresholdManager.h"
 #include "Player/BlackholePlayerCharacter.h"
@@ -12,6 +13,16 @@
 #include "Engine/Engine.h"
 #include "Blueprint/UserWidget.h"
 #include "Debug/CrashLogger.h"
+#include "Systems/LevelRestartSubsystem.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarSoftRestart(
+		TEXT("blackhole.restart.soft"),
+		true,
+		TEXT("Restart levels in place instead of reloading the map (falls back to a reload if it fails)."));
+}
 
 void UGameStateManager::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -20,7 +31,7 @@ void UGameStateManager::Initialize(FSubsystemCollectionBase& Collection)
 	CurrentState = EGameState::None;
 	PreviousState = EGameState::None;
 	
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Initialized"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Initialized"));
 	
 	// Start with main menu
 	// Note: This will be called after level load, so we check the level name
@@ -59,11 +70,11 @@ void UGameStateManager::StartGame()
 {
 	if (CurrentState == EGameState::Playing)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameStateManager: Already playing"));
+		UE_LOG(LogBlackhole, Warning, TEXT("GameStateManager: Already playing"));
 		return;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Starting game"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Starting game"));
 	
 	// Reset systems before starting
 	ResetPlayerState();
@@ -73,7 +84,7 @@ void UGameStateManager::StartGame()
 	if (UResourceManager* ResourceMgr = GetGameInstance()->GetSubsystem<UResourceManager>())
 	{
 		// ResourceManager initializes itself, we don't need to call Initialize
-		UE_LOG(LogTemp, Log, TEXT("GameStateManager: ResourceManager ready"));
+		UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: ResourceManager ready"));
 	}
 	
 	// Start threshold manager
@@ -95,7 +106,7 @@ void UGameStateManager::PauseGame()
 		return;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Pausing game"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Pausing game"));
 	
 	// The pause menu will handle actual pausing
 	SetGameState(EGameState::Paused);
@@ -108,7 +119,7 @@ void UGameStateManager::ResumeGame()
 		return;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Resuming game"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Resuming game"));
 	
 	// The pause menu will handle actual unpausing
 	SetGameState(EGameState::Playing);
@@ -121,7 +132,7 @@ void UGameStateManager::EndGame(bool bPlayerDied)
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("GameStateManager: Ending game (PlayerDied: %s)"), 
+	UE_LOG(LogBlackhole, Warning, TEXT("GameStateManager: Ending game (PlayerDied: %s)"), 
 		bPlayerDied ? TEXT("true") : TEXT("false"));
 	
 	// Clean up game systems
@@ -141,7 +152,7 @@ void UGameStateManager::EndGame(bool bPlayerDied)
 
 void UGameStateManager::ResetGame()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Resetting game"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Resetting game"));
 	
 	// Set transitioning state to prevent issues during reset
 	SetGameState(EGameState::Transitioning);
@@ -166,12 +177,12 @@ void UGameStateManager::ResetGame()
 	// For restart, we want to go directly to Playing state, not MainMenu
 	// SetGameState(EGameState::MainMenu);  // Removed - don't go to main menu
 	
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Game reset complete"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Game reset complete"));
 }
 
 void UGameStateManager::QuitGame()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Quitting game"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Quitting game"));
 	
 	// Clean up everything before quitting
 	CleanupGameSystems();
@@ -201,7 +212,7 @@ void UGameStateManager::SetGameState(EGameState NewState)
 	PreviousState = CurrentState;
 	CurrentState = NewState;
 	
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: State changed from %s to %s"),
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: State changed from %s to %s"),
 		*UEnum::GetValueAsString(PreviousState),
 		*UEnum::GetValueAsString(CurrentState));
 	
@@ -231,7 +242,7 @@ void UGameStateManager::PerformStateTransition(EGameState FromState, EGameState
 
 void UGameStateManager::CleanupGameSystems()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Cleaning up game systems"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Cleaning up game systems"));
 	
 	// Clean up timers first
 	CleanupTimers();
@@ -266,7 +277,7 @@ void UGameStateManager::CleanupGameSystems()
 
 void UGameStateManager::CleanupTimers()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Cleaning up all timers"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Cleaning up all timers"));
 	
 	// Clear all timers in the world
 	if (UWorld* World = GetWorld())
@@ -285,7 +296,7 @@ void UGameStateManager::CleanupTimers()
 
 void UGameStateManager::CleanupDelegates()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Cleaning up delegates"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Cleaning up delegates"));
 	
 	// This is handled by individual systems in their EndPlay/Deinitialize
 	// But we ensure our own delegates are clean
@@ -297,68 +308,87 @@ void UGameStateManager::CleanupDelegates()
 void UGameStateManager::RestartGame()
 {
 	CRASH_CHECKPOINT_MSG("RestartGame Start");
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Restarting game"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Restarting game"));
 	
 	// Set transitioning state
 	CRASH_CHECKPOINT_MSG("Setting transitioning state");
 	SetGameState(EGameState::Transitioning);
 	
 	CRASH_CHECKPOINT_MSG("Getting World");
-	if (UWorld* World = GetWorld())
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		// Clean up game systems
-		CRASH_CHECKPOINT_MSG("Cleaning up game systems");
-		CleanupGameSystems();
-		
-		// Reset resource manager
-		CRASH_CHECKPOINT_MSG("Resetting resource manager");
-		if (UResourceManager* ResourceMgr = GetGameInstance()->GetSubsystem<UResourceManager>())
-		{
-			ResourceMgr->ResetResources();
-		}
-		
-		// Get current level name
-		CRASH_CHECKPOINT_MSG("Getting current level name");
-		FString CurrentLevelName = World->GetMapName();
-		// Remove PIE prefix if in editor
-		CurrentLevelName.RemoveFromStart("UEDPIE_0_");
-		
-		UE_LOG(LogTemp, Log, TEXT("GameStateManager: Reloading level %s"), *CurrentLevelName);
-		
-		// Use ServerTravel for more reliable level reload
-		CRASH_CHECKPOINT_MSG("Getting PlayerController");
-		if (APlayerController* PC = World->GetFirstPlayerController())
+		CRASH_LOG_ERROR("No World found");
+		return;
+	}
+	
+	// Clean up game systems
+	CRASH_CHECKPOINT_MSG("Cleaning up game systems");
+	CleanupGameSystems();
+	
+	CRASH_CHECKPOINT_MSG("Getting PlayerController");
+	APlayerController* PC = World->GetFirstPlayerController();
+	if (!PC)
+	{
+		CRASH_LOG_ERROR("No PlayerController found");
+		return;
+	}
+	
+	// Ensure we're not paused
+	CRASH_CHECKPOINT_MSG("Unpausing");
+	UGameplayStatics::SetGamePaused(World, false);
+	
+	// Clean up input state
+	CRASH_CHECKPOINT_MSG("Setting input mode");
+	FInputModeGameOnly InputMode;
+	PC->SetInputMode(InputMode);
+	PC->bShowMouseCursor = false;
+	
+	// Reset the level in place; a map reload is only the fallback
+	if (CVarSoftRestart.GetValueOnGameThread())
+	{
+		CRASH_CHECKPOINT_MSG("Soft restart");
+		ULevelRestartSubsystem* LevelRestart = World->GetSubsystem<ULevelRestartSubsystem>();
+		if (LevelRestart && LevelRestart->SoftRestart())
 		{
-			// Ensure we're not paused
-			CRASH_CHECKPOINT_MSG("Unpausing");
-			UGameplayStatics::SetGamePaused(World, false);
-			
-			// Clean up input state
-			CRASH_CHECKPOINT_MSG("Setting input mode");
-			FInputModeGameOnly InputMode;
-			PC->SetInputMode(InputMode);
-			PC->bShowMouseCursor = false;
-			
-			// Use ClientTravel for single player
-			CRASH_CHECKPOINT_MSG(FString::Printf(TEXT("Calling ClientTravel to %s"), *CurrentLevelName));
-			PC->ClientTravel(CurrentLevelName, ETravelType::TRAVEL_Absolute, false);
-			
+			OnGameReset.Broadcast();
+			SetGameState(EGameState::Playing);
 			CRASH_CHECKPOINT_MSG("RestartGame End");
+			return;
 		}
-		else
-		{
-			CRASH_LOG_ERROR("No PlayerController found");
-		}
+		
+		UE_LOG(LogBlackhole, Warning, TEXT("GameStateManager: Soft restart failed, reloading level"));
 	}
-	else
+	
+	TravelRestart(PC);
+	CRASH_CHECKPOINT_MSG("RestartGame End");
+}
+
+void UGameStateManager::TravelRestart(APlayerController* PC)
+{
+	// Reset resource manager
+	CRASH_CHECKPOINT_MSG("Resetting resource manager");
+	if (UResourceManager* ResourceMgr = GetGameInstance()->GetSubsystem<UResourceManager>())
 	{
-		CRASH_LOG_ERROR("No World found");
+		ResourceMgr->ResetResources();
 	}
+	
+	// Get current level name
+	CRASH_CHECKPOINT_MSG("Getting current level name");
+	FString CurrentLevelName = PC->GetWorld()->GetMapName();
+	// Remove PIE prefix if in editor
+	CurrentLevelName.RemoveFromStart("UEDPIE_0_");
+	
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Reloading level %s"), *CurrentLevelName);
+	
+	// Use ClientTravel for single player
+	CRASH_CHECKPOINT_MSG(FString::Printf(TEXT("Calling ClientTravel to %s"), *CurrentLevelName));
+	PC->ClientTravel(CurrentLevelName, ETravelType::TRAVEL_Absolute, false);
 }
 
 void UGameStateManager::ResetPlayerState()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameStateManager: Resetting player state"));
+	UE_LOG(LogBlackhole, Log, TEXT("GameStateManager: Resetting player state"));
 	
 	if (UWorld* World = GetWorld())
 	{
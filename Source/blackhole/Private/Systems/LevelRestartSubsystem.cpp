@@ -0,0 +1,264 @@
+#include "Systems/LevelRestartSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Systems/ThresholdManager.h"
+#include "Systems/DeathManager.h"
+#include "Systems/ResourceManager.h"
+#include "Systems/ObjectPoolSubsystem.h"
+#include "Systems/AbilityAssetPreloader.h"
+#include "Enemy/BaseEnemy.h"
+#include "Player/BlackholePlayerCharacter.h"
+#include "Actors/ResourcePickup.h"
+#include "Actors/AutomaticDoor.h"
+#include "Actors/PsiDisruptor.h"
+#include "GameFramework/GameModeBase.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "EngineUtils.h"
+#include "UObject/UnrealType.h"
+#include "Kismet/GameplayStatics.h"
+
+bool ULevelRestartSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void ULevelRestartSubsystem::Deinitialize()
+{
+	EnemySpawns.Empty();
+	bRecorded = false;
+
+	Super::Deinitialize();
+}
+
+void ULevelRestartSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Placed enemies exist by now but haven't begun play, so this is the level as authored
+	for (TActorIterator<ABaseEnemy> It(&InWorld); It; ++It)
+	{
+		RecordEnemy(*It);
+	}
+	bRecorded = true;
+
+	UE_LOG(LogBlackhole, Log, TEXT("LevelRestart: Recorded %d enemy spawns"), EnemySpawns.Num());
+
+	// Start streaming the roster's ability assets now rather than as each enemy begins play
+	if (UAbilityAssetPreloader* Preloader = InWorld.GetSubsystem<UAbilityAssetPreloader>())
+	{
+		for (const FEnemySpawnRecord& Record : EnemySpawns)
+		{
+			Preloader->RequestActorClassAssets(Record.EnemyClass);
+		}
+	}
+}
+
+bool ULevelRestartSubsystem::SoftRestart()
+{
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Soft Level Restart", STAT_Blackhole_SoftRestart, BlackholeSystemsChannel);
+
+	UWorld* World = GetWorld();
+	ABlackholePlayerCharacter* Player = World ? Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0)) : nullptr;
+	if (!bRecorded || !Player)
+	{
+		UE_LOG(LogBlackhole, Warning, TEXT("LevelRestart: Nothing to restore in place (recorded: %s, player: %s)"),
+			bRecorded ? TEXT("yes") : TEXT("no"), Player ? TEXT("yes") : TEXT("no"));
+		return false;
+	}
+
+	// Resolve the player start before touching anything, so a failure leaves the world as it was
+	FTransform PlayerTransform;
+	if (!FindPlayerRestartTransform(Player, PlayerTransform))
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Managers first: the threshold reset clears the critical state that would block the WP reset
+	ResetManagers();
+	ResetEnemies();
+	Player->ResetForRestart(PlayerTransform);
+
+	// After the player has moved, so door triggers don't reopen on stale overlaps
+	ResetLevelActors();
+
+	UE_LOG(LogBlackhole, Log, TEXT("LevelRestart: Soft restart complete in %.2f ms (%d enemies)"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0, EnemySpawns.Num());
+	return true;
+}
+
+void ULevelRestartSubsystem::RecordEnemy(ABaseEnemy* Enemy)
+{
+	FEnemySpawnRecord& Record = EnemySpawns.AddDefaulted_GetRef();
+	Record.EnemyClass = Enemy->GetClass();
+	Record.Transform = Enemy->GetActorTransform();
+	Record.Enemy = Enemy;
+
+	// Designer edits on this instance (stats table and row, tuning), for a respawn to reapply.
+	// Instanced references would point at the old actor's subobjects, so those are left out.
+	const ABaseEnemy* Defaults = Record.EnemyClass->GetDefaultObject<ABaseEnemy>();
+	for (TFieldIterator<FProperty> It(Record.EnemyClass); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (!Property->HasAnyPropertyFlags(CPF_Edit)
+			|| Property->HasAnyPropertyFlags(CPF_Transient | CPF_InstancedReference | CPF_ContainsInstancedReference)
+			|| !Property->GetOwnerClass()->IsChildOf(ABaseEnemy::StaticClass()))
+		{
+			continue;
+		}
+
+		if (!Property->Identical_InContainer(Enemy, Defaults))
+		{
+			FEnemyPropertyOverride& Override = Record.PropertyOverrides.AddDefaulted_GetRef();
+			Override.Property = Property;
+			Property->ExportText_InContainer(0, Override.Value, Enemy, nullptr, Enemy, PPF_None);
+		}
+	}
+
+	Enemy->SetRetainedForRestart(true);
+}
+
+ABaseEnemy* ULevelRestartSubsystem::SpawnFromRecord(const FEnemySpawnRecord& Record) const
+{
+	if (!Record.EnemyClass)
+	{
+		return nullptr;
+	}
+
+	ABaseEnemy* Enemy = GetWorld()->SpawnActorDeferred<ABaseEnemy>(Record.EnemyClass, Record.Transform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (!Enemy)
+	{
+		UE_LOG(LogBlackhole, Warning, TEXT("LevelRestart: Failed to respawn %s at %s"),
+			*Record.EnemyClass->GetName(), *Record.Transform.GetLocation().ToString());
+		return nullptr;
+	}
+
+	// Before FinishSpawning, so the construction script and BeginPlay see the placed values
+	for (const FEnemyPropertyOverride& Override : Record.PropertyOverrides)
+	{
+		Override.Property->ImportText_InContainer(*Override.Value, Enemy, Enemy, PPF_None);
+	}
+
+	Enemy->SetRetainedForRestart(true);
+	Enemy->FinishSpawning(Record.Transform);
+	return Enemy;
+}
+
+void ULevelRestartSubsystem::ResetManagers()
+{
+	UWorld* World = GetWorld();
+
+	if (UThresholdManager* ThresholdMgr = World->GetSubsystem<UThresholdManager>())
+	{
+		ThresholdMgr->ResetForRestart();
+	}
+
+	if (UDeathManager* DeathMgr = World->GetSubsystem<UDeathManager>())
+	{
+		DeathMgr->ResetDeathState();
+	}
+
+	if (UResourceManager* ResourceMgr = World->GetGameInstance()->GetSubsystem<UResourceManager>())
+	{
+		ResourceMgr->ResetResources();
+	}
+}
+
+void ULevelRestartSubsystem::ResetEnemies()
+{
+	UWorld* World = GetWorld();
+
+	TSet<ABaseEnemy*> RecordedEnemies;
+	for (const FEnemySpawnRecord& Record : EnemySpawns)
+	{
+		if (ABaseEnemy* Enemy = Record.Enemy.Get())
+		{
+			RecordedEnemies.Add(Enemy);
+		}
+	}
+
+	// Runtime spawns and disruptors go; builders cancel their builds on EndPlay and
+	// disruptors unregister themselves
+	TArray<AActor*> ToDestroy;
+	for (TActorIterator<ABaseEnemy> It(World); It; ++It)
+	{
+		if (!RecordedEnemies.Contains(*It))
+		{
+			ToDestroy.Add(*It);
+		}
+	}
+	for (TActorIterator<APsiDisruptor> It(World); It; ++It)
+	{
+		ToDestroy.Add(*It);
+	}
+	for (AActor* Actor : ToDestroy)
+	{
+		Actor->Destroy();
+	}
+
+	// Projectiles and effects in flight go back to their pools
+	if (UObjectPoolSubsystem* ObjectPool = World->GetSubsystem<UObjectPoolSubsystem>())
+	{
+		TArray<AActor*> PooledObjects;
+		ObjectPool->GetPooledObjects(PooledObjects);
+		for (AActor* PooledObject : PooledObjects)
+		{
+			ObjectPool->ReturnToPool(PooledObject);
+		}
+	}
+
+	// Live enemies and parked corpses are revived where they were placed
+	for (FEnemySpawnRecord& Record : EnemySpawns)
+	{
+		if (ABaseEnemy* Enemy = Record.Enemy.Get())
+		{
+			Enemy->ResetForRestart(Record.Transform);
+		}
+		else
+		{
+			Record.Enemy = SpawnFromRecord(Record);
+		}
+	}
+}
+
+void ULevelRestartSubsystem::ResetLevelActors()
+{
+	UWorld* World = GetWorld();
+
+	for (TActorIterator<AResourcePickup> It(World); It; ++It)
+	{
+		It->ResetPickup();
+	}
+
+	for (TActorIterator<AAutomaticDoor> It(World); It; ++It)
+	{
+		It->ResetDoor();
+	}
+}
+
+bool ULevelRestartSubsystem::FindPlayerRestartTransform(ABlackholePlayerCharacter* Player, FTransform& OutTransform) const
+{
+	AController* Controller = Player->GetController();
+	AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
+	AActor* PlayerStart = (GameMode && Controller) ? GameMode->FindPlayerStart(Controller) : nullptr;
+	if (!PlayerStart)
+	{
+		UE_LOG(LogBlackhole, Warning, TEXT("LevelRestart: No player start found"));
+		return false;
+	}
+
+	// Starts can be rotated in any axis; the player only takes the yaw
+	OutTransform = PlayerStart->GetActorTransform();
+	OutTransform.SetRotation(FRotator(0.0f, PlayerStart->GetActorRotation().Yaw, 0.0f).Quaternion());
+	OutTransform.SetScale3D(FVector::OneVector);
+	return true;
+}
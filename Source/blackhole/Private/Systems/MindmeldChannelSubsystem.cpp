@@ -0,0 +1,173 @@
+#include "Systems/MindmeldChannelSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeDebugDraw.h"
+#include "Utils/ErrorHandling.h"
+#include "Components/Abilities/Enemy/MindmeldComponent.h"
+#include "Components/Abilities/Enemy/PowerfulMindmeldComponent.h"
+#include "Enemy/BaseEnemy.h"
+#include "Enemy/AI/EnemyStateMachine.h"
+#include "Systems/ResourceManager.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+void UMindmeldChannelSubsystem::Deinitialize()
+{
+	CorruptionChannels.Empty();
+	TimedChannels.Empty();
+	CachedResourceManager.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UMindmeldChannelSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMindmeldChannelSubsystem, STATGROUP_Blackhole);
+}
+
+void UMindmeldChannelSubsystem::StartCorruption(UMindmeldComponent* Mindmeld, AActor* Target)
+{
+	if (!Mindmeld || !Mindmeld->GetOwner() || !Target)
+	{
+		return;
+	}
+
+	for (FCorruptionChannel& Channel : CorruptionChannels)
+	{
+		if (Channel.Mindmeld.Get() == Mindmeld)
+		{
+			Channel.Target = Target;
+			return;
+		}
+	}
+
+	FCorruptionChannel& Channel = CorruptionChannels.AddDefaulted_GetRef();
+	Channel.Mindmeld = Mindmeld;
+	Channel.Caster = Mindmeld->GetOwner();
+	Channel.Target = Target;
+}
+
+void UMindmeldChannelSubsystem::StopCorruption(UMindmeldComponent* Mindmeld)
+{
+	for (int32 i = CorruptionChannels.Num() - 1; i >= 0; i--)
+	{
+		if (CorruptionChannels[i].Mindmeld.Get() == Mindmeld)
+		{
+			CorruptionChannels.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			return;
+		}
+	}
+}
+
+void UMindmeldChannelSubsystem::StartTimedChannel(UPowerfulMindmeldComponent* Mindmeld)
+{
+	if (Mindmeld)
+	{
+		TimedChannels.AddUnique(Mindmeld);
+	}
+}
+
+void UMindmeldChannelSubsystem::StopTimedChannel(UPowerfulMindmeldComponent* Mindmeld)
+{
+	TimedChannels.RemoveSwap(Mindmeld, EAllowShrinking::No);
+}
+
+bool UMindmeldChannelSubsystem::GetCachedLineOfSight(const AActor* Caster, const AActor* Target, bool& bOutHasLineOfSight)
+{
+	const ABaseEnemy* Enemy = Cast<ABaseEnemy>(Caster);
+	const UEnemyStateMachine* StateMachine = Enemy ? Enemy->GetStateMachine() : nullptr;
+	if (!StateMachine || !Target || StateMachine->GetTarget() != Target)
+	{
+		return false;
+	}
+
+	bOutHasLineOfSight = StateMachine->HasLineOfSight();
+	return true;
+}
+
+UResourceManager* UMindmeldChannelSubsystem::GetResourceManager()
+{
+	if (!CachedResourceManager.IsValid())
+	{
+		if (UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+		{
+			CachedResourceManager = GameInstance->GetSubsystem<UResourceManager>();
+		}
+	}
+	return CachedResourceManager.Get();
+}
+
+void UMindmeldChannelSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (CorruptionChannels.Num() == 0 && TimedChannels.Num() == 0)
+	{
+		return;
+	}
+
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Mindmeld Channels", STAT_Blackhole_MindmeldChannels, BlackholeAbilitiesChannel);
+
+	// Sustained channels. Stopping a channel swap-removes it, so walk backwards.
+	float Corruption = 0.0f;
+	for (int32 i = CorruptionChannels.Num() - 1; i >= 0; i--)
+	{
+		const FCorruptionChannel& Channel = CorruptionChannels[i];
+		UMindmeldComponent* Mindmeld = Channel.Mindmeld.Get();
+		const AActor* Caster = Channel.Caster.Get();
+		const AActor* Target = Channel.Target.Get();
+		if (!Mindmeld || !Caster || !Target)
+		{
+			CorruptionChannels.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			if (Mindmeld)
+			{
+				Mindmeld->StopMindmeld();
+			}
+			continue;
+		}
+
+		bool bHasLineOfSight = false;
+		if (!GetCachedLineOfSight(Caster, Target, bHasLineOfSight))
+		{
+			bHasLineOfSight = Mindmeld->HasLineOfSight();
+		}
+
+		if (!bHasLineOfSight)
+		{
+			// Unregisters the channel
+			Mindmeld->StopMindmeld();
+			continue;
+		}
+
+		Corruption += Mindmeld->DrainRate * DeltaTime;
+
+		BLACKHOLE_DEBUG_DRAW(Abilities_Hits, DrawDebugLine(GetWorld(), Caster->GetActorLocation() + FVector(0, 0, 50),
+			Target->GetActorLocation() + FVector(0, 0, 50), FColor::Purple, false, 0.0f, 0, 2.0f));
+	}
+
+	// One commit for all sustained channels (positive value increases corruption)
+	if (Corruption > 0.0f)
+	{
+		if (UResourceManager* ResourceManager = GetResourceManager())
+		{
+			ResourceManager->AddWillPower(Corruption);
+		}
+		else
+		{
+			BLACKHOLE_LOG_RATE_LIMITED(LogBlackholeAbilities, Warning, 10.0, TEXT("MindmeldChannels: ResourceManager not found!"));
+		}
+	}
+
+	// Timed channels complete on their own timer; the update only checks interrupts and draws
+	for (int32 i = TimedChannels.Num() - 1; i >= 0; i--)
+	{
+		if (UPowerfulMindmeldComponent* Mindmeld = TimedChannels[i].Get())
+		{
+			Mindmeld->UpdateChannel();
+		}
+		else
+		{
+			TimedChannels.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+}
@@ -1,4 +1,7 @@
 #include "Systems/ObjectPoolSubsystem.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Components/SceneComponent.h"
@@ -41,14 +44,14 @@ void UObjectPoolSubsystem::RegisterPool(FName PoolName, TSubclassOf<AActor> Obje
 {
     if (PoolName.IsNone() || !ObjectClass)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ObjectPool: Invalid pool registration - name or class is null"));
+        UE_LOG(LogBlackhole, Warning, TEXT("ObjectPool: Invalid pool registration - name or class is null"));
         return;
     }
     
     // Check if pool already exists
     if (ObjectPools.Contains(PoolName))
     {
-        UE_LOG(LogTemp, Warning, TEXT("ObjectPool: Pool '%s' already exists"), *PoolName.ToString());
+        UE_LOG(LogBlackhole, Warning, TEXT("ObjectPool: Pool '%s' already exists"), *PoolName.ToString());
         return;
     }
     
@@ -67,10 +70,12 @@ void UObjectPoolSubsystem::RegisterPool(FName PoolName, TSubclassOf<AActor> Obje
 
 AActor* UObjectPoolSubsystem::GetPooledObject(FName PoolName, const FTransform& SpawnTransform, bool bForceSpawn)
 {
+    BLACKHOLE_LLM_SCOPE(ObjectPools);
+
     FObjectPool* Pool = ObjectPools.Find(PoolName);
     if (!Pool)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ObjectPool: Pool '%s' not found"), *PoolName.ToString());
+        UE_LOG(LogBlackhole, Warning, TEXT("ObjectPool: Pool '%s' not found"), *PoolName.ToString());
         return nullptr;
     }
     
@@ -117,7 +122,7 @@ bool UObjectPoolSubsystem::ReturnToPool(AActor* PooledObject)
     FName* PoolNamePtr = ObjectToPoolMap.Find(PooledObject);
     if (!PoolNamePtr)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ObjectPool: Object not found in any pool"));
+        UE_LOG(LogBlackhole, Warning, TEXT("ObjectPool: Object not found in any pool"));
         return false;
     }
     
@@ -157,8 +162,19 @@ void UObjectPoolSubsystem::GetPoolStats(FName PoolName, int32& OutAvailable, int
     }
 }
 
+void UObjectPoolSubsystem::GetPooledObjects(TArray<AActor*>& OutObjects) const
+{
+    for (const TPair<FName, FObjectPool>& PoolPair : ObjectPools)
+    {
+        OutObjects.Append(PoolPair.Value.AvailableObjects);
+        OutObjects.Append(PoolPair.Value.ActiveObjects);
+    }
+}
+
 void UObjectPoolSubsystem::PrewarmPool(FName PoolName, int32 Count)
 {
+    BLACKHOLE_LLM_SCOPE(ObjectPools);
+
     FObjectPool* Pool = ObjectPools.Find(PoolName);
     if (!Pool)
     {
@@ -299,6 +315,8 @@ void UObjectPoolSubsystem::PrepareObjectForReturn(AActor* PooledObject)
 
 void UObjectPoolSubsystem::CheckInactiveObjects()
 {
+    BLACKHOLE_SCOPE_CYCLE_COUNTER("Object Pool Inactive Check", STAT_Blackhole_ObjectPoolCheck, BlackholeSystemsChannel);
+
     // This would check for objects that should be returned to the pool
     // For now, this is a placeholder for future implementation
     // Could check things like:
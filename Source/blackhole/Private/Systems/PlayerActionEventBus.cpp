@@ -0,0 +1,132 @@
+#include "Systems/PlayerActionEventBus.h"
+#include "Debug/BlackholeStats.h"
+#include "Config/GameplayConfig.h"
+#include "Systems/EnemyTrackingManager.h"
+#include "Enemy/BaseEnemy.h"
+#include "Enemy/AI/EnemyStateMachine.h"
+#include "Engine/World.h"
+
+namespace
+{
+	float GetActionRadiusSq(EPlayerActionType Type)
+	{
+		using namespace GameplayConfig::Enemy::PlayerActions;
+
+		switch (Type)
+		{
+			case EPlayerActionType::Dash:     return FMath::Square(DASH_RADIUS);
+			case EPlayerActionType::Ultimate: return FMath::Square(ULTIMATE_RADIUS);
+			default:                          return FMath::Square(ATTACK_RADIUS);
+		}
+	}
+
+	void DeliverAction(UEnemyStateMachine* StateMachine, EPlayerActionType Type)
+	{
+		switch (Type)
+		{
+			case EPlayerActionType::Dash:     StateMachine->NotifyPlayerDashed(); break;
+			case EPlayerActionType::Attack:   StateMachine->NotifyPlayerAttacking(); break;
+			case EPlayerActionType::Ultimate: StateMachine->NotifyPlayerUltimateUsed(); break;
+		}
+	}
+}
+
+void UPlayerActionEventBus::Deinitialize()
+{
+	PendingEvents.Empty();
+	DispatchEvents.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UPlayerActionEventBus::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPlayerActionEventBus, STATGROUP_Blackhole);
+}
+
+void UPlayerActionEventBus::Publish(EPlayerActionType Type, AActor* Instigator, const FVector& Location, const FVector& Facing)
+{
+	if (!Instigator)
+	{
+		return;
+	}
+
+	FPlayerActionEvent& Event = PendingEvents.AddDefaulted_GetRef();
+	Event.Type = Type;
+	Event.Instigator = Instigator;
+	Event.Location = Location;
+	Event.Facing = Facing.GetSafeNormal2D(UE_SMALL_NUMBER, FVector::ForwardVector);
+}
+
+void UPlayerActionEventBus::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingEvents.Num() == 0)
+	{
+		return;
+	}
+
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Player Action Dispatch", STAT_Blackhole_PlayerActionDispatch, BlackholeAIChannel);
+
+	Swap(PendingEvents, DispatchEvents);
+
+	const UEnemyTrackingManager* TrackingManager = GetWorld()->GetSubsystem<UEnemyTrackingManager>();
+	if (!TrackingManager)
+	{
+		DispatchEvents.Reset();
+		return;
+	}
+
+	// Radii are resolved once per event, not per enemy
+	TArray<float, TInlineAllocator<8>> RadiiSq;
+	RadiiSq.SetNumUninitialized(DispatchEvents.Num());
+	for (int32 EventIndex = 0; EventIndex < DispatchEvents.Num(); EventIndex++)
+	{
+		RadiiSq[EventIndex] = GetActionRadiusSq(DispatchEvents[EventIndex].Type);
+	}
+
+	// Reactions may change state, but never register or unregister enemies, so the
+	// registry can be walked directly
+	for (const FTrackedEnemy& Tracked : TrackingManager->GetTrackedEnemies())
+	{
+		const ABaseEnemy* Enemy = Tracked.Enemy.Get();
+		UEnemyStateMachine* StateMachine = Tracked.StateMachine.Get();
+		if (!Enemy || !StateMachine || Enemy->IsDead())
+		{
+			continue;
+		}
+
+		const AActor* Target = StateMachine->GetTarget();
+		if (!Target)
+		{
+			continue;
+		}
+
+		const FVector EnemyLocation = Enemy->GetActorLocation();
+		for (int32 EventIndex = 0; EventIndex < DispatchEvents.Num(); EventIndex++)
+		{
+			const FPlayerActionEvent& Event = DispatchEvents[EventIndex];
+			if (Event.Instigator.Get() != Target)
+			{
+				continue;
+			}
+
+			const FVector ToEnemy = EnemyLocation - Event.Location;
+			if (ToEnemy.SizeSquared() > RadiiSq[EventIndex])
+			{
+				continue;
+			}
+
+			if (Event.Type == EPlayerActionType::Attack
+				&& FVector::DotProduct(ToEnemy.GetSafeNormal2D(), Event.Facing) < GameplayConfig::Enemy::PlayerActions::ATTACK_CONE_COS)
+			{
+				continue;
+			}
+
+			DeliverAction(StateMachine, Event.Type);
+		}
+	}
+
+	DispatchEvents.Reset();
+}
@@ -1,4 +1,5 @@
 #include "Systems/ResourceManager.h"
+#include "blackhole.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Config/GameplayConfig.h"
@@ -16,11 +17,19 @@ void UResourceManager::Initialize(FSubsystemCollectionBase& Collection)
 	PreviousWPThreshold = EResourceThreshold::Normal; // Starting at 100% WP = Normal state
 	CurrentPath = ECharacterPath::Hacker; // Default to Hacker
 	WPMaxReachedCount = 0; // Track how many times WP reached 100%
+	CommittedWP = CurrentWP;
+	
+	// Commit coalesced WP changes once per frame, after every actor has ticked
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UResourceManager::HandleWorldPostActorTick);
 }
 
 void UResourceManager::Deinitialize()
 {
-	// Clear any active timers
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+	CachedWillPowerComponent.Reset();
+	bWPChangePending = false;
+	bWPDepletedPending = false;
 	
 	// Clear all delegate bindings to prevent crashes
 	OnWillPowerChanged.Clear();
@@ -35,7 +44,7 @@ bool UResourceManager::ConsumeWillPower(float Amount)
 {
 	if (Amount < 0.0f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ConsumeWillPower called with negative amount: %f"), Amount);
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ConsumeWillPower called with negative amount: %f"), Amount);
 		return false;
 	}
 	
@@ -45,22 +54,11 @@ bool UResourceManager::ConsumeWillPower(float Amount)
 	// Consume the WP, clamping at 0 (never go negative)
 	CurrentWP = FMath::Max(0.0f, CurrentWP - Amount);
 	
-	UE_LOG(LogTemp, Warning, TEXT("ResourceManager::ConsumeWillPower: WP changed from %.1f to %.1f (consumed %.1f)"), 
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager::ConsumeWillPower: WP changed from %.1f to %.1f (consumed %.1f)"), 
 		OldWP, CurrentWP, Amount);
 	
-	// Broadcast the change
-	OnWillPowerChanged.Broadcast(CurrentWP, MaxWP);
-	SyncWillPowerComponent();
-	
-	// Check for threshold changes
-	CheckWPThreshold();
-	
-	// Check for ultimate activation (WP reached 0)
-	if (CurrentWP <= 0.0f && OldWP > 0.0f)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: WP reached 0 - ACTIVATING ULTIMATE MODE"));
-		OnWPDepleted.Broadcast(); // This now triggers ultimate mode, not death
-	}
+	// Listeners, thresholds and depletion are handled in the frame commit
+	MarkWillPowerChanged(OldWP);
 	
 	return true;
 }
@@ -71,7 +69,7 @@ void UResourceManager::AddWillPower(float Amount)
 	// Player must use ultimate to exit critical state
 	if (CurrentWP <= 0.0f && !bWPResetAuthorized)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: Cannot add WP during critical state (WP at 0)"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager: Cannot add WP during critical state (WP at 0)"));
 		return;
 	}
 	
@@ -82,20 +80,18 @@ void UResourceManager::AddWillPower(float Amount)
 	// Log significant WP changes
 	if (FMath::Abs(CurrentWP - OldWP) > 0.1f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: WP restored from %.1f to %.1f (delta: +%.1f)"), 
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager: WP restored from %.1f to %.1f (delta: +%.1f)"), 
 			OldWP, CurrentWP, CurrentWP - OldWP);
 	}
 	
 	if (CurrentWP != OldWP)
 	{
-		OnWillPowerChanged.Broadcast(CurrentWP, MaxWP);
-		SyncWillPowerComponent(); // Keep player's WillPowerComponent in sync
-		CheckWPThreshold();
+		MarkWillPowerChanged(OldWP);
 		
 		// No special behavior at 100% - it's just full energy
 		if (CurrentWP >= MaxWP && OldWP < MaxWP)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ResourceManager: WP fully restored to 100%%"));
+			UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager: WP fully restored to 100%%"));
 		}
 	}
 }
@@ -121,25 +117,29 @@ EResourceThreshold UResourceManager::GetCurrentWPThreshold() const
 
 void UResourceManager::ResetResources()
 {
-	UE_LOG(LogTemp, Error, TEXT("ResourceManager::ResetResources called! WP was %.1f, resetting to 100"), CurrentWP);
+	UE_LOG(LogBlackholeResources, Error, TEXT("ResourceManager::ResetResources called! WP was %.1f, resetting to 100"), CurrentWP);
 	
 	// CRITICAL: Block resets during critical timer state
 	if (bInCriticalState)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ResourceManager::ResetResources BLOCKED - Player is in critical timer state!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ResourceManager::ResetResources BLOCKED - Player is in critical timer state!"));
 		const FString CallStack = FFrame::GetScriptCallstack();
-		UE_LOG(LogTemp, Error, TEXT("Blocked reset call stack:\n%s"), *CallStack);
+		UE_LOG(LogBlackholeResources, Error, TEXT("Blocked reset call stack:\n%s"), *CallStack);
 		return;
 	}
 	
 	// Print call stack for debugging
 	const FString CallStack = FFrame::GetScriptCallstack();
-	UE_LOG(LogTemp, Error, TEXT("ResetResources call stack:\n%s"), *CallStack);
+	UE_LOG(LogBlackholeResources, Error, TEXT("ResetResources call stack:\n%s"), *CallStack);
 	
 	CurrentWP = 100.0f; // Reset to full energy
 	WPMaxReachedCount = 0; // Reset the counter
 	
-	// Clear overheat timer if active
+	// A reset supersedes anything still waiting for the frame commit
+	CommittedWP = CurrentWP;
+	bWPChangePending = false;
+	bWPDepletedPending = false;
+	PendingWPChangeCount = 0;
 	
 	// Sync player's WillPowerComponent
 	SyncWillPowerComponent();
@@ -153,38 +153,40 @@ void UResourceManager::ResetResources()
 
 void UResourceManager::ResetWPAfterMax()
 {
-	UE_LOG(LogTemp, Error, TEXT("!!! ResourceManager::ResetWPAfterMax CALLED !!!"));
+	UE_LOG(LogBlackholeResources, Error, TEXT("!!! ResourceManager::ResetWPAfterMax CALLED !!!"));
 	
 	// Authorization check - prevent unwanted resets
 	if (!bWPResetAuthorized)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ResourceManager::ResetWPAfterMax called WITHOUT AUTHORIZATION - BLOCKING RESET!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ResourceManager::ResetWPAfterMax called WITHOUT AUTHORIZATION - BLOCKING RESET!"));
 		const FString CallStack = FFrame::GetScriptCallstack();
-		UE_LOG(LogTemp, Error, TEXT("Unauthorized reset call stack:\n%s"), *CallStack);
+		UE_LOG(LogBlackholeResources, Error, TEXT("Unauthorized reset call stack:\n%s"), *CallStack);
 		return;
 	}
 	
 	// In energy system, we reset WP to 100 after using ultimate at 0% WP
 	// No need to check if we're at max - we should be near 0 when ultimate is used
 	
-	UE_LOG(LogTemp, Error, TEXT("ResourceManager::ResetWPAfterMax - WP was %.1f, resetting to 100 (full energy)"), CurrentWP);
+	UE_LOG(LogBlackholeResources, Error, TEXT("ResourceManager::ResetWPAfterMax - WP was %.1f, resetting to 100 (full energy)"), CurrentWP);
 	
 	// Print call stack for debugging
 	const FString CallStack = FFrame::GetScriptCallstack();
-	UE_LOG(LogTemp, Error, TEXT("Call stack:\n%s"), *CallStack);
+	UE_LOG(LogBlackholeResources, Error, TEXT("Call stack:\n%s"), *CallStack);
 	
+	const float OldWP = CurrentWP;
 	CurrentWP = 100.0f; // Reset to full energy
-	SyncWillPowerComponent(); // Keep player's WillPowerComponent in sync
-	OnWillPowerChanged.Broadcast(CurrentWP, MaxWP);
 	
 	// Reset threshold to normal (since we're at 100%)
 	PreviousWPThreshold = EResourceThreshold::Normal;
-	CheckWPThreshold();
+	
+	// ThresholdManager relies on this being visible immediately, so commit now
+	MarkWillPowerChanged(OldWP);
+	FlushWillPowerChanges();
 	
 	// Clear authorization flag
 	bWPResetAuthorized = false;
 	
-	UE_LOG(LogTemp, Error, TEXT("!!! ResourceManager: WP RESET TO 100 - This should only happen after respawn !!!"));
+	UE_LOG(LogBlackholeResources, Error, TEXT("!!! ResourceManager: WP RESET TO 100 - This should only happen after respawn !!!"));
 }
 
 void UResourceManager::CheckWPThreshold()
@@ -211,37 +213,116 @@ bool UResourceManager::WouldAddingWPCauseOverflow(float Amount) const
 void UResourceManager::SyncWillPowerComponent()
 {
 	// Keep player's WillPowerComponent synchronized with ResourceManager's CurrentWP
+	if (UWillPowerComponent* WPComponent = ResolveWillPowerComponent())
+	{
+		// Update the component's value to match ResourceManager
+		WPComponent->SetCurrentValue(CurrentWP);
+		
+		UE_LOG(LogBlackholeResources, VeryVerbose, TEXT("ResourceManager: Synced WillPowerComponent to %.1f"), CurrentWP);
+	}
+}
+
+UWillPowerComponent* UResourceManager::ResolveWillPowerComponent()
+{
+	if (UWillPowerComponent* Cached = CachedWillPowerComponent.Get())
+	{
+		return Cached;
+	}
+	
+	// Cache is empty or the player was destroyed (respawn/level change) - look it up once
 	if (UWorld* World = GetWorld())
 	{
 		if (ABlackholePlayerCharacter* Player = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0)))
 		{
 			if (UWillPowerComponent* WPComponent = Player->FindComponentByClass<UWillPowerComponent>())
 			{
-				// Update the component's value to match ResourceManager
-				WPComponent->SetCurrentValue(CurrentWP);
-				
-				UE_LOG(LogTemp, VeryVerbose, TEXT("ResourceManager: Synced WillPowerComponent to %.1f"), CurrentWP);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("ResourceManager: Player has no WillPowerComponent to sync!"));
+				CachedWillPowerComponent = WPComponent;
+				return WPComponent;
 			}
+			
+			UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager: Player has no WillPowerComponent to sync!"));
 		}
 	}
+	
+	return nullptr;
+}
+
+void UResourceManager::MarkWillPowerChanged(float OldWP)
+{
+	if (CurrentWP == OldWP)
+	{
+		return;
+	}
+	
+	bWPChangePending = true;
+	PendingWPChangeCount++;
+	
+	// Remember the crossing even if WP is restored again before the commit
+	if (CurrentWP <= 0.0f && OldWP > 0.0f)
+	{
+		bWPDepletedPending = true;
+	}
+	
+	// Without a ticking world there is no end-of-frame commit to wait for
+	if (!GetWorld())
+	{
+		FlushWillPowerChanges();
+	}
+}
+
+void UResourceManager::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		FlushWillPowerChanges();
+	}
+}
+
+void UResourceManager::FlushWillPowerChanges()
+{
+	if (!bWPChangePending)
+	{
+		return;
+	}
+	
+	// Clear first so changes made by listeners queue up for the next commit
+	const bool bDepleted = bWPDepletedPending;
+	bWPChangePending = false;
+	bWPDepletedPending = false;
+	
+	UE_LOG(LogBlackholeResources, Verbose, TEXT("ResourceManager: Committing WP %.1f -> %.1f (%d changes coalesced)"), 
+		CommittedWP, CurrentWP, PendingWPChangeCount);
+	
+	CommittedWP = CurrentWP;
+	PendingWPChangeCount = 0;
+	
+	// Single broadcast for everything that happened this frame
+	SyncWillPowerComponent();
+	OnWillPowerChanged.Broadcast(CurrentWP, MaxWP);
+	
+	// Threshold crossing computed once from the committed value
+	CheckWPThreshold();
+	
+	// Check for ultimate activation - on the latched crossing, even if WP was restored later in the frame
+	if (bDepleted)
+	{
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager: WP reached 0 - ACTIVATING ULTIMATE MODE (now %.1f)"), CurrentWP);
+		OnWPDepleted.Broadcast(); // This now triggers ultimate mode, not death
+	}
 }
 
 void UResourceManager::TakeDamage(float DamageAmount)
 {
 	if (DamageAmount <= 0.0f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("TakeDamage called with non-positive amount: %f"), DamageAmount);
+		UE_LOG(LogBlackholeResources, Warning, TEXT("TakeDamage called with non-positive amount: %f"), DamageAmount);
 		return;
 	}
 	
 	// If already at 0 WP (critical state), no damage can be taken
 	if (CurrentWP <= 0.0f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ResourceManager::TakeDamage: WP already at 0, damage blocked"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager::TakeDamage: WP already at 0, damage blocked"));
 		return;
 	}
 	
@@ -250,20 +331,9 @@ void UResourceManager::TakeDamage(float DamageAmount)
 	// Damage reduces WP, clamping at 0 (never negative)
 	CurrentWP = FMath::Max(0.0f, CurrentWP - DamageAmount);
 	
-	UE_LOG(LogTemp, Warning, TEXT("ResourceManager::TakeDamage: WP changed from %.1f to %.1f (damage: %.1f)"), 
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ResourceManager::TakeDamage: WP changed from %.1f to %.1f (damage: %.1f)"), 
 		OldWP, CurrentWP, DamageAmount);
 	
-	// Broadcast the change
-	OnWillPowerChanged.Broadcast(CurrentWP, MaxWP);
-	SyncWillPowerComponent();
-	
-	// Check for threshold changes
-	CheckWPThreshold();
-	
-	// Check for ultimate activation (WP reached 0)
-	if (CurrentWP <= 0.0f && OldWP > 0.0f)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: WP reached 0 - ACTIVATING ULTIMATE MODE"));
-		OnWPDepleted.Broadcast(); // This now triggers ultimate mode, not death
-	}
+	// Listeners, thresholds and depletion are handled in the frame commit
+	MarkWillPowerChanged(OldWP);
 }
@@ -1,5 +1,8 @@
 #include "Systems/ThresholdManager.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
 #include "Systems/ResourceManager.h"
+#include "Systems/BuffManager.h"
 #include "Components/Abilities/AbilityComponent.h"
 #include "Components/Abilities/UtilityAbility.h"
 #include "Player/BlackholePlayerCharacter.h"
@@ -12,6 +15,13 @@ void UThresholdManager::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	
+	// Survivor buffs live in the BuffManager modifier stack
+	BuffManager = Collection.InitializeDependency<UBuffManager>();
+	if (BuffManager)
+	{
+		BuffManager->OnBuffsChanged.AddDynamic(this, &UThresholdManager::OnBuffsChanged);
+	}
+	
 	// Get player character
 	PlayerCharacter = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
 	
@@ -36,6 +46,13 @@ void UThresholdManager::Deinitialize()
 		// No longer need OnWPMaxReached since ultimates trigger at 0 WP now
 	}
 	
+	if (IsValid(BuffManager))
+	{
+		BuffManager->OnBuffsChanged.RemoveDynamic(this, &UThresholdManager::OnBuffsChanged);
+		BuffManager->RemoveBuff(UBuffManager::WPThresholdSource);
+		BuffManager->RemoveBuff(UBuffManager::LostAbilitiesSource);
+	}
+	
 	// No critical timer needed in new system
 	
 	// Clear all delegate bindings to prevent crashes
@@ -48,9 +65,18 @@ void UThresholdManager::Deinitialize()
 	OnCriticalTimer.Clear();
 	OnCriticalTimerExpired.Clear();
 	
-	// Clear ability arrays
-	AllPlayerAbilities.Empty();
-	DisabledAbilities.Empty();
+	// Release registry slots
+	for (uint64 Mask = RegisteredSlotMask; Mask; Mask &= Mask - 1)
+	{
+		if (UAbilityComponent* Ability = AbilitySlots[(int32)FMath::CountTrailingZeros64(Mask)])
+		{
+			Ability->SetRegistrySlot(INDEX_NONE);
+		}
+	}
+	AbilitySlots.Empty();
+	RegisteredSlotMask = 0;
+	DisabledSlotMask = 0;
+	BasicSlotMask = 0;
 	
 	Super::Deinitialize();
 }
@@ -59,7 +85,7 @@ void UThresholdManager::StartCombat()
 {
 	if (bIsInCombat)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: StartCombat called but already in combat"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: StartCombat called but already in combat"));
 		return;
 	}
 	
@@ -67,24 +93,26 @@ void UThresholdManager::StartCombat()
 	
 	// Reset threshold state for new combat
 	ThresholdState.Reset();
-	// DO NOT clear DisabledAbilities here - they should persist through combat
-	// DisabledAbilities.Empty(); // REMOVED - disabled abilities should stay disabled
-	CurrentBuff = FSurvivorBuff();
+	// DO NOT clear the disabled ability bits here - they should persist through combat
+	ResetSurvivorBuffs();
 	
 	// Try to get player character if we don't have it yet
 	if (!PlayerCharacter)
 	{
 		PlayerCharacter = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: StartCombat - Getting player character: %s"), 
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: StartCombat - Getting player character: %s"), 
 			PlayerCharacter ? TEXT("Found") : TEXT("Not Found"));
 	}
 	
-	// Cache player abilities
-	CachePlayerAbilities();
+	// Abilities register themselves at BeginPlay; only scan if none made it in
+	if (RegisteredSlotMask == 0)
+	{
+		CachePlayerAbilities();
+	}
 	
 	OnCombatStarted.Broadcast();
 	
-	UE_LOG(LogTemp, Log, TEXT("ThresholdManager: Combat started"));
+	UE_LOG(LogBlackholeResources, Log, TEXT("ThresholdManager: Combat started"));
 }
 
 void UThresholdManager::EndCombat()
@@ -96,7 +124,7 @@ void UThresholdManager::EndCombat()
 	
 	// DEBUG: Log call stack to find what's ending combat (which clears critical timer)
 	const FString CallStack = FFrame::GetScriptCallstack();
-	UE_LOG(LogTemp, Error, TEXT("!!! ENDCOMBAT CALLED (WILL CLEAR CRITICAL TIMER) !!! Call stack:\n%s"), *CallStack);
+	UE_LOG(LogBlackholeResources, Error, TEXT("!!! ENDCOMBAT CALLED (WILL CLEAR CRITICAL TIMER) !!! Call stack:\n%s"), *CallStack);
 	
 	bIsInCombat = false;
 	bUltimateModeActive = false;
@@ -114,35 +142,22 @@ void UThresholdManager::EndCombat()
 	// DO NOT re-enable abilities that were disabled by ultimate sacrifice
 	// Those should remain permanently disabled
 	// Just clear the tracking arrays
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Combat ended, keeping %d abilities disabled from ultimate sacrifice"), DisabledAbilities.Num());
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Combat ended, keeping %d abilities disabled from ultimate sacrifice"), GetDisabledAbilityCount());
 	
 	// Reset ultimate mode for all abilities
-	for (int32 i = AllPlayerAbilities.Num() - 1; i >= 0; i--)
-	{
-		UAbilityComponent* Ability = AllPlayerAbilities[i];
-		if (IsValid(Ability))
-		{
-			Ability->SetUltimateMode(false);
-		}
-		else
-		{
-			AllPlayerAbilities.RemoveAt(i);
-		}
-	}
+	ApplyUltimateModeToAbilities(false);
 	
-	// DO NOT clear DisabledAbilities - we need to track which abilities were sacrificed
-	// DisabledAbilities.Empty(); // REMOVED - keep tracking sacrificed abilities
-	AllPlayerAbilities.Empty(); // Clear the array to prevent stale references
-	CurrentBuff = FSurvivorBuff();
+	// DO NOT clear the disabled bits - we need to track which abilities were sacrificed
+	ResetSurvivorBuffs();
 	
 	OnCombatEnded.Broadcast();
 	
-	UE_LOG(LogTemp, Log, TEXT("ThresholdManager: Combat ended, all abilities restored"));
+	UE_LOG(LogBlackholeResources, Log, TEXT("ThresholdManager: Combat ended, all abilities restored"));
 }
 
 bool UThresholdManager::IsAbilityDisabled(UAbilityComponent* Ability) const
 {
-	return DisabledAbilities.Contains(Ability);
+	return (DisabledSlotMask & GetSlotMask(Ability)) != 0;
 }
 
 void UThresholdManager::OnWPThresholdChanged(EResourceThreshold NewThreshold)
@@ -164,7 +179,7 @@ void UThresholdManager::OnWPThresholdChanged(EResourceThreshold NewThreshold)
 			{
 				CurrentBuff.bIsBuffed = false;
 				UpdateSurvivorBuffs();
-				UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical low energy - buffs removed"));
+				UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical low energy - buffs removed"));
 			}
 			break;
 			
@@ -183,7 +198,7 @@ void UThresholdManager::OnWPThresholdChanged(EResourceThreshold NewThreshold)
 			{
 				CurrentBuff.bIsBuffed = true;
 				UpdateSurvivorBuffs();
-				UE_LOG(LogTemp, Log, TEXT("ThresholdManager: Healthy energy (50%%+) - abilities buffed!"));
+				UE_LOG(LogBlackholeResources, Log, TEXT("ThresholdManager: Healthy energy (50%%+) - abilities buffed!"));
 			}
 			break;
 			
@@ -197,12 +212,12 @@ void UThresholdManager::OnWPThresholdChanged(EResourceThreshold NewThreshold)
 /*
 void UThresholdManager::OnWPMaxReachedHandler(int32 TimesReached)
 {
-	UE_LOG(LogTemp, Error, TEXT("=== ThresholdManager::OnWPMaxReachedHandler START ==="));
-	UE_LOG(LogTemp, Error, TEXT("WP reached 100%% - Count: %d, InCombat: %s"), TimesReached, bIsInCombat ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBlackholeResources, Error, TEXT("=== ThresholdManager::OnWPMaxReachedHandler START ==="));
+	UE_LOG(LogBlackholeResources, Error, TEXT("WP reached 100%% - Count: %d, InCombat: %s"), TimesReached, bIsInCombat ? TEXT("YES") : TEXT("NO"));
 	
 	if (!bIsInCombat)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Not in combat, starting combat now"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Not in combat, starting combat now"));
 		StartCombat();
 	}
 	
@@ -212,26 +227,26 @@ void UThresholdManager::OnWPMaxReachedHandler(int32 TimesReached)
 	// Ensure ResourceManager is valid
 	if (!IsValid(ResourceManager))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: ResourceManager is null in OnWPMaxReachedHandler!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: ResourceManager is null in OnWPMaxReachedHandler!"));
 		return;
 	}
 	
 	// Double-check current WP
 	float CurrentWP = ResourceManager->GetCurrentWillPower();
 	float MaxWP = ResourceManager->GetMaxWillPower();
-	UE_LOG(LogTemp, Error, TEXT("ThresholdManager: Current WP = %.1f/%.1f"), CurrentWP, MaxWP);
+	UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: Current WP = %.1f/%.1f"), CurrentWP, MaxWP);
 	
 	// Only apply ultimate mode for Hacker path
 	if (ResourceManager->GetCurrentPath() != ECharacterPath::Hacker)
 	{
-		UE_LOG(LogTemp, Log, TEXT("ThresholdManager: WP reached 100%% but player is on Forge path - ignoring"));
+		UE_LOG(LogBlackholeResources, Log, TEXT("ThresholdManager: WP reached 100%% but player is on Forge path - ignoring"));
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: WP reached 100%% (Count: %d) - PREPARING TO ACTIVATE ULTIMATE MODE!"), TimesReached);
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: WP reached 100%% (Count: %d) - PREPARING TO ACTIVATE ULTIMATE MODE!"), TimesReached);
 	
 	// Check death conditions - but NOT for immediate death, only for critical timer behavior
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Checking death conditions - DisabledAbilities: %d/%d, TimesReached: %d/%d"), 
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Checking death conditions - DisabledAbilities: %d/%d, TimesReached: %d/%d"), 
 		DisabledAbilities.Num(), GameplayConfig::Thresholds::MAX_DISABLED_ABILITIES,
 		TimesReached, GameplayConfig::Thresholds::MAX_WP_REACHES);
 		
@@ -242,7 +257,7 @@ void UThresholdManager::OnWPMaxReachedHandler(int32 TimesReached)
 		// Player has lost 3 abilities - any additional 100% WP reach is death
 		EndCombat();
 		OnPlayerDeath.Broadcast();
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: Player death triggered - WP reached 100%% after losing %d abilities!"), DisabledAbilities.Num());
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: Player death triggered - WP reached 100%% after losing %d abilities!"), DisabledAbilities.Num());
 		return;
 	}
 	
@@ -250,7 +265,7 @@ void UThresholdManager::OnWPMaxReachedHandler(int32 TimesReached)
 	// Instead, let critical timer handle it - player gets 5 seconds to use ultimate
 	if (TimesReached >= GameplayConfig::Thresholds::MAX_WP_REACHES)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: This is the %d time reaching 100%% WP - FINAL CHANCE via critical timer!"), TimesReached);
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: This is the %d time reaching 100%% WP - FINAL CHANCE via critical timer!"), TimesReached);
 		// Don't return - continue to critical timer
 	}
 	
@@ -259,17 +274,17 @@ void UThresholdManager::OnWPMaxReachedHandler(int32 TimesReached)
 	
 	// Double-check WP after starting timer
 	CurrentWP = ResourceManager->GetCurrentWillPower();
-	UE_LOG(LogTemp, Error, TEXT("=== ThresholdManager::OnWPMaxReachedHandler END - Critical Timer Started - WP = %.1f/%.1f ==="), CurrentWP, MaxWP);
+	UE_LOG(LogBlackholeResources, Error, TEXT("=== ThresholdManager::OnWPMaxReachedHandler END - Critical Timer Started - WP = %.1f/%.1f ==="), CurrentWP, MaxWP);
 }
 */
 
 void UThresholdManager::ActivateUltimateMode()
 {
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: ActivateUltimateMode called"));
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: ActivateUltimateMode called"));
 	
 	if (bUltimateModeActive)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Ultimate mode already active"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Ultimate mode already active"));
 		return;
 	}
 	
@@ -278,7 +293,7 @@ void UThresholdManager::ActivateUltimateMode()
 	{
 		float CurrentWP = ResourceManager->GetCurrentWillPower();
 		float MaxWP = ResourceManager->GetMaxWillPower();
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Activating ultimate mode with WP=%.1f/%.1f"), CurrentWP, MaxWP);
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Activating ultimate mode with WP=%.1f/%.1f"), CurrentWP, MaxWP);
 	}
 	
 	bUltimateModeActive = true;
@@ -287,100 +302,177 @@ void UThresholdManager::ActivateUltimateMode()
 	// Clean up invalid abilities before processing
 	CleanupInvalidAbilities();
 	
-	// CRITICAL FIX: Cache abilities if not already cached
-	if (AllPlayerAbilities.Num() == 0)
+	// CRITICAL FIX: Register abilities if none are registered yet
+	if (RegisteredSlotMask == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: No abilities cached - caching now!"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: No abilities registered - caching now!"));
 		CachePlayerAbilities();
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Activating ultimate mode, checking %d abilities"), AllPlayerAbilities.Num());
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Activating ultimate mode, checking %d abilities"), GetRegisteredAbilityCount());
 	
-	// Set all non-basic abilities to ultimate mode
-	int32 UltimateCount = 0;
-	for (int32 i = AllPlayerAbilities.Num() - 1; i >= 0; i--) // Iterate backwards for safe removal
-	{
-		UAbilityComponent* Ability = AllPlayerAbilities[i];
-		if (!IsValid(Ability))
-		{
-			AllPlayerAbilities.RemoveAt(i);
-			continue;
-		}
-		
-		if (!DisabledAbilities.Contains(Ability))
-		{
-			// Skip basic abilities - they don't have ultimate versions
-			if (!Ability->IsBasicAbility())
-			{
-				Ability->SetUltimateMode(true);
-				UltimateCount++;
-				UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Set %s to ultimate mode (IsBasic=%s)"), 
-					*Ability->GetName(), Ability->IsBasicAbility() ? TEXT("YES") : TEXT("NO"));
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Skipped %s - marked as basic ability"), 
-					*Ability->GetName());
-			}
-		}
-	}
+	// Set all enabled non-basic abilities to ultimate mode - basic abilities don't have ultimate versions
+	const int32 UltimateCount = ApplyUltimateModeToAbilities(true);
 	
 	OnUltimateModeActivated.Broadcast(true);
 	
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: ULTIMATE MODE ACTIVATED - %d abilities enhanced!"), UltimateCount);
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: ULTIMATE MODE ACTIVATED - %d abilities enhanced!"), UltimateCount);
 }
 
 void UThresholdManager::CleanupInvalidAbilities()
 {
-	// Remove invalid abilities from AllPlayerAbilities
-	for (int32 i = AllPlayerAbilities.Num() - 1; i >= 0; i--)
+	// Abilities unregister in EndPlay; this only catches ones destroyed without it
+	for (uint64 Mask = RegisteredSlotMask; Mask; Mask &= Mask - 1)
 	{
-		if (!IsValid(AllPlayerAbilities[i]))
+		const int32 Slot = (int32)FMath::CountTrailingZeros64(Mask);
+		if (!IsValid(AbilitySlots[Slot]))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Removing invalid ability at index %d"), i);
-			AllPlayerAbilities.RemoveAt(i);
+			UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Removing invalid ability at slot %d"), Slot);
+			
+			const uint64 Bit = 1ull << Slot;
+			RegisteredSlotMask &= ~Bit;
+			DisabledSlotMask &= ~Bit;
+			BasicSlotMask &= ~Bit;
+			AbilitySlots[Slot] = nullptr;
 		}
 	}
+}
+
+bool UThresholdManager::RegisterPlayerAbility(UAbilityComponent* Ability)
+{
+	if (!IsValid(Ability))
+	{
+		return false;
+	}
+	
+	if (Ability->GetRegistrySlot() != INDEX_NONE)
+	{
+		return true; // Already registered
+	}
+	
+	// Abilities can register before Initialize found the player pawn
+	if (!PlayerCharacter)
+	{
+		PlayerCharacter = Cast<ABlackholePlayerCharacter>(Ability->GetOwner());
+	}
+	
+	// Lowest free slot keeps slot indices stable and the masks dense
+	const uint64 FreeMask = ~RegisteredSlotMask;
+	if (FreeMask == 0)
+	{
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: Ability registry full (%d slots), cannot register %s"), 
+			MaxAbilitySlots, *Ability->GetName());
+		return false;
+	}
+	
+	const int32 Slot = (int32)FMath::CountTrailingZeros64(FreeMask);
+	if (AbilitySlots.Num() <= Slot)
+	{
+		AbilitySlots.SetNumZeroed(Slot + 1);
+	}
+	
+	const uint64 Bit = 1ull << Slot;
+	AbilitySlots[Slot] = Ability;
+	RegisteredSlotMask |= Bit;
+	DisabledSlotMask = Ability->IsDisabled() ? (DisabledSlotMask | Bit) : (DisabledSlotMask & ~Bit);
+	BasicSlotMask = Ability->IsBasicAbility() ? (BasicSlotMask | Bit) : (BasicSlotMask & ~Bit);
+	Ability->SetRegistrySlot(Slot);
+	
+	UE_LOG(LogBlackholeResources, VeryVerbose, TEXT("ThresholdManager: Registered ability %s in slot %d"), *Ability->GetName(), Slot);
+	return true;
+}
+
+void UThresholdManager::UnregisterPlayerAbility(UAbilityComponent* Ability)
+{
+	if (!Ability)
+	{
+		return;
+	}
+	
+	const int32 Slot = Ability->GetRegistrySlot();
+	if (!AbilitySlots.IsValidIndex(Slot) || AbilitySlots[Slot] != Ability)
+	{
+		return;
+	}
 	
-	// Remove invalid abilities from DisabledAbilities
-	for (int32 i = DisabledAbilities.Num() - 1; i >= 0; i--)
+	const uint64 Bit = 1ull << Slot;
+	RegisteredSlotMask &= ~Bit;
+	DisabledSlotMask &= ~Bit;
+	BasicSlotMask &= ~Bit;
+	AbilitySlots[Slot] = nullptr;
+	Ability->SetRegistrySlot(INDEX_NONE);
+}
+
+uint64 UThresholdManager::GetSlotMask(const UAbilityComponent* Ability) const
+{
+	if (!Ability)
 	{
-		if (!IsValid(DisabledAbilities[i]))
+		return 0;
+	}
+	
+	const int32 Slot = Ability->GetRegistrySlot();
+	if (!AbilitySlots.IsValidIndex(Slot) || AbilitySlots[Slot] != Ability)
+	{
+		return 0;
+	}
+	
+	return 1ull << Slot;
+}
+
+int32 UThresholdManager::ApplyUltimateModeToAbilities(bool bEnabled)
+{
+	const uint64 TargetMask = bEnabled ? (GetEnabledSlotMask() & ~BasicSlotMask) : RegisteredSlotMask;
+	int32 Count = 0;
+	
+	for (uint64 Mask = TargetMask; Mask; Mask &= Mask - 1)
+	{
+		const int32 Slot = (int32)FMath::CountTrailingZeros64(Mask);
+		UAbilityComponent* Ability = AbilitySlots[Slot];
+		if (!IsValid(Ability))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Removing invalid disabled ability at index %d"), i);
-			DisabledAbilities.RemoveAt(i);
+			continue;
+		}
+		
+		Ability->SetUltimateMode(bEnabled);
+		Count++;
+		
+		if (bEnabled)
+		{
+			UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Set %s to ultimate mode"), *Ability->GetName());
 		}
 	}
+	
+	return Count;
 }
 
 void UThresholdManager::DeactivateUltimateMode(UAbilityComponent* UsedAbility)
 {
 	if (!bUltimateModeActive)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: DeactivateUltimateMode called but ultimate mode is not active"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: DeactivateUltimateMode called but ultimate mode is not active"));
 		return;
 	}
 	
 	// DEBUG: Log call stack to find what's deactivating ultimate mode (which resets WP)
 	const FString CallStack = FFrame::GetScriptCallstack();
-	UE_LOG(LogTemp, Error, TEXT("!!! DEACTIVATE ULTIMATE MODE CALLED (WILL RESET WP) !!! Ability: %s\nCall stack:\n%s"), 
+	UE_LOG(LogBlackholeResources, Error, TEXT("!!! DEACTIVATE ULTIMATE MODE CALLED (WILL RESET WP) !!! Ability: %s\nCall stack:\n%s"), 
 		UsedAbility ? *UsedAbility->GetName() : TEXT("NULL"), *CallStack);
 	
 	// Prevent recursive calls
 	if (bIsDeactivatingUltimate)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Already deactivating ultimate mode, preventing recursion"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Already deactivating ultimate mode, preventing recursion"));
 		return;
 	}
 	
 	// Basic abilities don't trigger deactivation
 	if (IsValid(UsedAbility) && UsedAbility->IsBasicAbility())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Basic ability used during ultimate mode - no deactivation"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Basic ability used during ultimate mode - no deactivation"));
 		return;
 	}
 	
-	UE_LOG(LogTemp, Error, TEXT("ThresholdManager: DEACTIVATING ULTIMATE MODE - Used ability: %s"), 
+	UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: DEACTIVATING ULTIMATE MODE - Used ability: %s"), 
 		UsedAbility ? *UsedAbility->GetName() : TEXT("NULL"));
 	
 	bIsDeactivatingUltimate = true;
@@ -390,30 +482,20 @@ void UThresholdManager::DeactivateUltimateMode(UAbilityComponent* UsedAbility)
 	CleanupInvalidAbilities();
 	
 	// Deactivate ultimate mode for all abilities
-	for (int32 i = AllPlayerAbilities.Num() - 1; i >= 0; i--)
-	{
-		UAbilityComponent* Ability = AllPlayerAbilities[i];
-		if (IsValid(Ability))
-		{
-			Ability->SetUltimateMode(false);
-		}
-		else
-		{
-			AllPlayerAbilities.RemoveAt(i);
-		}
-	}
+	ApplyUltimateModeToAbilities(false);
 	
 	// Disable the ability that was used (if it's not basic)
-	if (IsValid(UsedAbility) && !DisabledAbilities.Contains(UsedAbility) && !UsedAbility->IsBasicAbility())
+	if (IsValid(UsedAbility) && !IsAbilityDisabled(UsedAbility) && !UsedAbility->IsBasicAbility())
 	{
 		// Properly disable the ability
 		UsedAbility->SetDisabled(true);
 		UsedAbility->SetComponentTickEnabled(false);
 		UsedAbility->SetAbilityState(EAbilityState::Disabled);
-		DisabledAbilities.Add(UsedAbility);
+		RegisterPlayerAbility(UsedAbility);
+		DisabledSlotMask |= GetSlotMask(UsedAbility);
 		
 		// Verify the ability is actually disabled
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: Disabling %s - IsDisabled=%s"), 
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: Disabling %s - IsDisabled=%s"), 
 			*UsedAbility->GetName(), 
 			UsedAbility->IsDisabled() ? TEXT("TRUE") : TEXT("FALSE"));
 		
@@ -421,10 +503,10 @@ void UThresholdManager::DeactivateUltimateMode(UAbilityComponent* UsedAbility)
 		UpdateSurvivorBuffs();
 		
 		// Broadcast event
-		OnAbilityDisabled.Broadcast(UsedAbility, DisabledAbilities.Num());
+		OnAbilityDisabled.Broadcast(UsedAbility, GetDisabledAbilityCount());
 		
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: PERMANENTLY DISABLED ability %s after ultimate use (Total disabled: %d)"), 
-			*UsedAbility->GetName(), DisabledAbilities.Num());
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: PERMANENTLY DISABLED ability %s after ultimate use (Total disabled: %d)"), 
+			*UsedAbility->GetName(), GetDisabledAbilityCount());
 	}
 	
 	// Reset WP to 100 (full energy) - ONLY when ultimate ability is actually used
@@ -436,16 +518,16 @@ void UThresholdManager::DeactivateUltimateMode(UAbilityComponent* UsedAbility)
 		// Authorize the reset - this is the ONLY legitimate place to reset WP
 		ResourceManager->AuthorizeWPReset();
 		ResourceManager->ResetWPAfterMax(); // This resets WP to 100 (full energy)
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: Authorized WP reset to 100 after ultimate ability use"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: Authorized WP reset to 100 after ultimate ability use"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: ResourceManager is null in DeactivateUltimateMode!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: ResourceManager is null in DeactivateUltimateMode!"));
 	}
 	
 	OnUltimateModeActivated.Broadcast(false);
 	
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Ultimate mode deactivated"));
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Ultimate mode deactivated"));
 	
 	// Clear the deactivation flag
 	bIsDeactivatingUltimate = false;
@@ -456,18 +538,18 @@ void UThresholdManager::OnAbilityExecuted(UAbilityComponent* Ability)
 	// Safety check
 	if (!Ability)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: OnAbilityExecuted called with NULL ability!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: OnAbilityExecuted called with NULL ability!"));
 		return;
 	}
 	
 	// CRITICAL FIX: Only process PLAYER abilities, ignore enemy abilities
 	if (!PlayerCharacter || Ability->GetOwner() != PlayerCharacter)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("ThresholdManager: Ignoring enemy ability %s"), *Ability->GetName());
+		UE_LOG(LogBlackholeResources, VeryVerbose, TEXT("ThresholdManager: Ignoring enemy ability %s"), *Ability->GetName());
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: OnAbilityExecuted called for %s (UltimateMode: %s, IsBasic: %s, TimeSince: %.2f)"), 
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: OnAbilityExecuted called for %s (UltimateMode: %s, IsBasic: %s, TimeSince: %.2f)"), 
 		*Ability->GetName(),
 		bUltimateModeActive ? TEXT("YES") : TEXT("NO"),
 		Ability->IsBasicAbility() ? TEXT("YES") : TEXT("NO"),
@@ -476,7 +558,7 @@ void UThresholdManager::OnAbilityExecuted(UAbilityComponent* Ability)
 	// Check if critical timer is active - any non-basic ability use should be treated as ultimate
 	if (bCriticalTimerActive && !Ability->IsBasicAbility())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical timer active, non-basic ability used - treating as ultimate ability"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical timer active, non-basic ability used - treating as ultimate ability"));
 		StopCriticalTimer();
 		
 		// If ultimate mode wasn't active yet, activate it first
@@ -486,7 +568,7 @@ void UThresholdManager::OnAbilityExecuted(UAbilityComponent* Ability)
 		}
 		
 		// Treat this ability use as an ultimate and deactivate
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Ultimate ability %s executed during critical timer - deactivating ultimate mode"), *Ability->GetName());
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Ultimate ability %s executed during critical timer - deactivating ultimate mode"), *Ability->GetName());
 		DeactivateUltimateMode(Ability);
 		return; // Don't continue with normal processing
 	}
@@ -494,14 +576,14 @@ void UThresholdManager::OnAbilityExecuted(UAbilityComponent* Ability)
 	// Only process if we're actually in ultimate mode
 	if (!bUltimateModeActive)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Not in ultimate mode, ignoring ability execution"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Not in ultimate mode, ignoring ability execution"));
 		return;
 	}
 	
 	// Basic abilities don't trigger deactivation
 	if (Ability->IsBasicAbility())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Basic ability used during ultimate mode - no deactivation"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Basic ability used during ultimate mode - no deactivation"));
 		return;
 	}
 	
@@ -509,13 +591,13 @@ void UThresholdManager::OnAbilityExecuted(UAbilityComponent* Ability)
 	if (Ability->IsInUltimateMode())
 	{
 		// This is an ultimate ability - deactivate ultimate mode after it's used
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Ultimate ability %s executed - deactivating ultimate mode"), *Ability->GetName());
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Ultimate ability %s executed - deactivating ultimate mode"), *Ability->GetName());
 		DeactivateUltimateMode(Ability);
 	}
 	else
 	{
 		// Non-ultimate ability during ultimate mode - should NOT deactivate
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Non-ultimate ability %s used during ultimate mode - IGNORING (not deactivating)"), *Ability->GetName());
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Non-ultimate ability %s used during ultimate mode - IGNORING (not deactivating)"), *Ability->GetName());
 		// Do NOT deactivate ultimate mode for non-ultimate abilities
 		// Players should be able to use basic abilities without losing ultimate mode
 	}
@@ -523,34 +605,38 @@ void UThresholdManager::OnAbilityExecuted(UAbilityComponent* Ability)
 
 void UThresholdManager::UpdateSurvivorBuffs()
 {
-	int32 DisabledCount = DisabledAbilities.Num();
-	
-	// Base buffs from 50% WP threshold
-	if (CurrentBuff.bIsBuffed)
+	if (!IsValid(BuffManager))
 	{
-		CurrentBuff.DamageMultiplier = GameplayConfig::Thresholds::BUFFED_DAMAGE_MULT; // Damage increase at 50% WP
-		CurrentBuff.CooldownReduction = GameplayConfig::Thresholds::BUFFED_COOLDOWN_REDUCTION; // Cooldown reduction at 50% WP
-		CurrentBuff.AttackSpeed = GameplayConfig::Thresholds::BUFFED_ATTACK_SPEED; // Faster attack speed at 50% WP
-	}
-	else
-	{
-		CurrentBuff.DamageMultiplier = 1.0f;
-		CurrentBuff.CooldownReduction = 0.0f;
-		CurrentBuff.AttackSpeed = 1.0f;
+		return;
 	}
 	
-	// Additional buffs for each lost ability
-	if (DisabledCount > 0)
+	// Both sources are additive on the same stack, so 50%+ WP and lost ability
+	// bonuses combine exactly once; OnBuffsChanged fires only if a value moved
+	BuffManager->SetWPThresholdBuffActive(CurrentBuff.bIsBuffed);
+	BuffManager->UpdateLostAbilityBuffs(GetDisabledAbilityCount());
+}
+
+void UThresholdManager::ResetSurvivorBuffs()
+{
+	CurrentBuff = FSurvivorBuff();
+	
+	if (IsValid(BuffManager))
 	{
-		CurrentBuff.DamageMultiplier += (GameplayConfig::Thresholds::DAMAGE_PER_LOST_ABILITY * DisabledCount); // Per lost ability
-		CurrentBuff.CooldownReduction += (GameplayConfig::Thresholds::CDR_PER_LOST_ABILITY * DisabledCount); // Per lost ability
-		CurrentBuff.AttackSpeed += (GameplayConfig::Thresholds::SPEED_PER_LOST_ABILITY * DisabledCount); // Per lost ability
+		BuffManager->SetWPThresholdBuffActive(false);
+		BuffManager->UpdateLostAbilityBuffs(0);
 	}
+}
+
+void UThresholdManager::OnBuffsChanged(const FCombatBuff& CombinedBuffs)
+{
+	CurrentBuff.DamageMultiplier = CombinedBuffs.DamageMultiplier;
+	CurrentBuff.CooldownReduction = CombinedBuffs.CooldownReduction;
+	CurrentBuff.AttackSpeed = CombinedBuffs.AttackSpeedMultiplier;
 	
 	// Broadcast buff update
 	OnSurvivorBuff.Broadcast(CurrentBuff);
 	
-	UE_LOG(LogTemp, Log, TEXT("ThresholdManager: Buffs - Damage: %.0f%%, Cooldown: -%.0f%%, Attack Speed: %.0f%%"), 
+	UE_LOG(LogBlackholeResources, Log, TEXT("ThresholdManager: Buffs - Damage: %.0f%%, Cooldown: -%.0f%%, Attack Speed: %.0f%%"), 
 		CurrentBuff.DamageMultiplier * 100.0f, 
 		CurrentBuff.CooldownReduction * 100.0f,
 		CurrentBuff.AttackSpeed * 100.0f);
@@ -558,91 +644,54 @@ void UThresholdManager::UpdateSurvivorBuffs()
 
 void UThresholdManager::CachePlayerAbilities()
 {
-	AllPlayerAbilities.Empty();
-	
 	// Try to get player character if we don't have it
 	if (!PlayerCharacter)
 	{
 		PlayerCharacter = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
 		if (!PlayerCharacter)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: No player character to cache abilities from"));
+			UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: No player character to cache abilities from"));
 			return;
 		}
 	}
 	
-	// Get all ability components on player
-	TArray<UActorComponent*> Components = PlayerCharacter->GetComponents().Array();
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Found %d total components on player"), Components.Num());
-	
-	for (UActorComponent* Component : Components)
+	// Registration is idempotent, so this only fills in abilities that missed BeginPlay
+	TInlineComponentArray<UAbilityComponent*> Abilities(PlayerCharacter);
+	for (UAbilityComponent* Ability : Abilities)
 	{
-		if (UAbilityComponent* Ability = Cast<UAbilityComponent>(Component))
-		{
-			// Include ALL abilities - basic abilities will be handled by checking bIsBasicAbility
-			AllPlayerAbilities.Add(Ability);
-			UE_LOG(LogTemp, VeryVerbose, TEXT("ThresholdManager: Added ability %s"), *Ability->GetName());
-		}
+		RegisterPlayerAbility(Ability);
 	}
 	
-	// If we didn't find any abilities, try again with a more thorough search
-	if (AllPlayerAbilities.Num() == 0)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: No abilities found with GetComponents, trying FindComponents"));
-		PlayerCharacter->GetComponents<UAbilityComponent>(AllPlayerAbilities);
-	}
-	
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Cached %d player abilities total"), AllPlayerAbilities.Num());
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Registered %d player abilities total"), GetRegisteredAbilityCount());
 }
 
-UAbilityComponent* UThresholdManager::GetRandomEnabledAbility() const
+UAbilityComponent* UThresholdManager::PickRandomAbility(uint64 CandidateMask) const
 {
-	TArray<UAbilityComponent*> EnabledAbilities;
-	
-	// Find all abilities that aren't disabled yet
-	for (UAbilityComponent* Ability : AllPlayerAbilities)
+	const int32 CandidateCount = FMath::CountBits(CandidateMask);
+	if (CandidateCount == 0)
 	{
-		if (IsValid(Ability) && !DisabledAbilities.Contains(Ability))
-		{
-			EnabledAbilities.Add(Ability);
-		}
+		return nullptr;
 	}
 	
-	if (EnabledAbilities.Num() == 0)
+	// Select the N-th set bit: drop the lowest N set bits, then take the next one
+	for (int32 Skip = FMath::RandRange(0, CandidateCount - 1); Skip > 0; --Skip)
 	{
-		return nullptr;
+		CandidateMask &= CandidateMask - 1;
 	}
 	
-	// Return random enabled ability
-	int32 RandomIndex = FMath::RandRange(0, EnabledAbilities.Num() - 1);
-	return EnabledAbilities[RandomIndex];
+	UAbilityComponent* Ability = AbilitySlots[(int32)FMath::CountTrailingZeros64(CandidateMask)];
+	return IsValid(Ability) ? Ability : nullptr;
+}
+
+UAbilityComponent* UThresholdManager::GetRandomEnabledAbility(const UAbilityComponent* ExcludedAbility) const
+{
+	return PickRandomAbility(GetEnabledSlotMask() & ~GetSlotMask(ExcludedAbility));
 }
 
 UAbilityComponent* UThresholdManager::GetRandomEnabledAbilityExcludingSlash() const
 {
-	TArray<UAbilityComponent*> EnabledAbilities;
-	
-	// Find all abilities that aren't disabled and aren't basic abilities
-	for (UAbilityComponent* Ability : AllPlayerAbilities)
-	{
-		if (IsValid(Ability) && !DisabledAbilities.Contains(Ability))
-		{
-			// Exclude all basic abilities (including slash)
-			if (!Ability->IsBasicAbility())
-			{
-				EnabledAbilities.Add(Ability);
-			}
-		}
-	}
-	
-	if (EnabledAbilities.Num() == 0)
-	{
-		return nullptr;
-	}
-	
-	// Return random enabled ability (excluding basic abilities)
-	int32 RandomIndex = FMath::RandRange(0, EnabledAbilities.Num() - 1);
-	return EnabledAbilities[RandomIndex];
+	// Exclude all basic abilities (including slash)
+	return PickRandomAbility(GetEnabledSlotMask() & ~BasicSlotMask);
 }
 
 // Critical Timer Functions
@@ -667,14 +716,14 @@ void UThresholdManager::StartCriticalTimer()
 	if (bCriticalTimerActive)
 	{
 		float TimeRemaining = GetCriticalTimeRemaining();
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical timer already active with %.1f seconds remaining"), TimeRemaining);
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical timer already active with %.1f seconds remaining"), TimeRemaining);
 		return;
 	}
 	
 	// Increment critical state entries used
 	CriticalStateEntriesUsed++;
 	int32 EntriesRemaining = FMath::Max(0, CriticalStateLimit - CriticalStateEntriesUsed);
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical state entry used (%d/%d)"), 
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical state entry used (%d/%d)"), 
 		CriticalStateEntriesUsed, CriticalStateLimit);
 	
 	// Broadcast event for HUD
@@ -683,7 +732,7 @@ void UThresholdManager::StartCriticalTimer()
 	// Check if player has exceeded critical state limit
 	if (CriticalStateEntriesUsed > CriticalStateLimit)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: Critical state limit exceeded - INSTANT DEATH!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: Critical state limit exceeded - INSTANT DEATH!"));
 		// Trigger instant death
 		OnPlayerDeath.Broadcast();
 		return;
@@ -692,7 +741,7 @@ void UThresholdManager::StartCriticalTimer()
 	// Ensure combat is started before critical timer
 	if (!bIsInCombat)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Starting combat for critical timer"));
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Starting combat for critical timer"));
 		StartCombat();
 	}
 	
@@ -708,7 +757,7 @@ void UThresholdManager::StartCriticalTimer()
 	// Ultimate mode will be activated separately to avoid circular dependency
 	
 	// Start the death timer
-	UE_LOG(LogTemp, Error, TEXT("ThresholdManager: Starting critical timer for %.1f seconds"), CriticalTimerDuration);
+	UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: Starting critical timer for %.1f seconds"), CriticalTimerDuration);
 	GetWorld()->GetTimerManager().SetTimer(
 		CriticalTimerHandle,
 		this,
@@ -726,7 +775,7 @@ void UThresholdManager::StartCriticalTimer()
 		true
 	);
 	
-	UE_LOG(LogTemp, Error, TEXT("ThresholdManager: CRITICAL ERROR - WP at 0! Player has %.1f seconds to use ultimate ability or DIE!"), CriticalTimerDuration);
+	UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: CRITICAL ERROR - WP at 0! Player has %.1f seconds to use ultimate ability or DIE!"), CriticalTimerDuration);
 	OnCriticalTimer.Broadcast(CriticalTimerDuration);
 }
 
@@ -739,7 +788,7 @@ void UThresholdManager::StopCriticalTimer()
 	
 	// DEBUG: Log call stack to find what's stopping the critical timer
 	const FString CallStack = FFrame::GetScriptCallstack();
-	UE_LOG(LogTemp, Error, TEXT("!!! CRITICAL TIMER STOPPED !!! Call stack:\n%s"), *CallStack);
+	UE_LOG(LogBlackholeResources, Error, TEXT("!!! CRITICAL TIMER STOPPED !!! Call stack:\n%s"), *CallStack);
 	
 	bCriticalTimerActive = false;
 	
@@ -759,12 +808,12 @@ void UThresholdManager::StopCriticalTimer()
 	// Notify UI that timer was stopped
 	OnCriticalTimer.Broadcast(0.0f); // Send 0 time remaining
 	
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical timer stopped - ultimate ability used in time!"));
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical timer stopped - ultimate ability used in time!"));
 }
 
 void UThresholdManager::OnCriticalTimerExpiredInternal()
 {
-	UE_LOG(LogTemp, Error, TEXT("ThresholdManager: OnCriticalTimerExpiredInternal called! Critical timer duration was %.1f seconds"), CriticalTimerDuration);
+	UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: OnCriticalTimerExpiredInternal called! Critical timer duration was %.1f seconds"), CriticalTimerDuration);
 	
 	bCriticalTimerActive = false;
 	
@@ -775,7 +824,7 @@ void UThresholdManager::OnCriticalTimerExpiredInternal()
 	}
 	
 	// Critical timer expired - player failed to use ultimate in time
-	UE_LOG(LogTemp, Error, TEXT("ThresholdManager: CRITICAL TIMER EXPIRED - PLAYER FAILED TO USE ULTIMATE AT 0 WP!"));
+	UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: CRITICAL TIMER EXPIRED - PLAYER FAILED TO USE ULTIMATE AT 0 WP!"));
 	
 	// Broadcast timer expired event
 	OnCriticalTimerExpired.Broadcast();
@@ -790,14 +839,14 @@ void UThresholdManager::OnCriticalTimerExpiredInternal()
 	if (CriticalStateEntriesUsed >= CriticalStateLimit)
 	{
 		// No more critical state entries - trigger death
-		UE_LOG(LogTemp, Error, TEXT("ThresholdManager: No critical state entries remaining - DEATH!"));
+		UE_LOG(LogBlackholeResources, Error, TEXT("ThresholdManager: No critical state entries remaining - DEATH!"));
 		OnPlayerDeath.Broadcast();
 	}
 	else
 	{
 		// Player survived critical state but failed to use ultimate
 		// They can continue playing but with consequences
-		UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Player survived critical state (%d/%d entries used)"), 
+		UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Player survived critical state (%d/%d entries used)"), 
 			CriticalStateEntriesUsed, CriticalStateLimit);
 		
 		// Reset WP to full (100%) to give player another chance
@@ -806,13 +855,15 @@ void UThresholdManager::OnCriticalTimerExpiredInternal()
 			float MaxWP = ResourceManager->GetMaxWillPower();
 			// Player is at 0 WP, so add full amount to reach 100%
 			ResourceManager->AddWillPower(MaxWP);
-			UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Restored WP to 100%% (full energy) - Entry used!"));
+			UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Restored WP to 100%% (full energy) - Entry used!"));
 		}
 	}
 }
 
 void UThresholdManager::UpdateCriticalTimer()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("Critical Timer Update", STAT_Blackhole_CriticalTimerUpdate, BlackholeSystemsChannel);
+
 	if (!bCriticalTimerActive)
 	{
 		return;
@@ -835,17 +886,65 @@ void UThresholdManager::UpdateCriticalTimer()
 void UThresholdManager::SetCriticalStateLimit(int32 NewLimit)
 {
 	CriticalStateLimit = FMath::Max(0, NewLimit);
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical state limit set to %d"), CriticalStateLimit);
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical state limit set to %d"), CriticalStateLimit);
 }
 
 void UThresholdManager::IncreaseCriticalStateLimit(int32 Amount)
 {
 	CriticalStateLimit = FMath::Max(0, CriticalStateLimit + Amount);
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical state limit increased to %d"), CriticalStateLimit);
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical state limit increased to %d"), CriticalStateLimit);
 }
 
 void UThresholdManager::ResetCriticalStateEntries()
 {
 	CriticalStateEntriesUsed = 0;
-	UE_LOG(LogTemp, Warning, TEXT("ThresholdManager: Critical state entries reset to 0"));
+	UE_LOG(LogBlackholeResources, Warning, TEXT("ThresholdManager: Critical state entries reset to 0"));
+}
+
+void UThresholdManager::ResetForRestart()
+{
+	if (bIsInCombat)
+	{
+		EndCombat();
+	}
+	
+	StopCriticalTimer();
+	if (IsValid(ResourceManager))
+	{
+		ResourceManager->SetCriticalState(false);
+	}
+	
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+	
+	const bool bWasUltimateModeActive = bUltimateModeActive;
+	bUltimateModeActive = false;
+	bIsDeactivatingUltimate = false;
+	ApplyUltimateModeToAbilities(false);
+	
+	// A new run gets its sacrificed abilities back
+	CleanupInvalidAbilities();
+	for (uint64 Mask = DisabledSlotMask; Mask; Mask &= Mask - 1)
+	{
+		if (UAbilityComponent* Ability = AbilitySlots[(int32)FMath::CountTrailingZeros64(Mask)])
+		{
+			Ability->SetDisabled(false);
+			Ability->SetAbilityState(EAbilityState::Ready);
+			Ability->SetComponentTickEnabled(Ability->PrimaryComponentTick.bStartWithTickEnabled);
+		}
+	}
+	DisabledSlotMask = 0;
+	
+	ThresholdState.Reset();
+	ResetSurvivorBuffs();
+	CriticalStateEntriesUsed = 0;
+	
+	if (bWasUltimateModeActive)
+	{
+		OnUltimateModeActivated.Broadcast(false);
+	}
+	
+	UE_LOG(LogBlackholeResources, Log, TEXT("ThresholdManager: Reset for restart"));
 }
\ No newline at end of file
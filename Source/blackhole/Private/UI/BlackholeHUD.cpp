@@ -1,4 +1,7 @@
 #include "UI/BlackholeHUD.h"
+#include "blackhole.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
 #include "Player/BlackholePlayerCharacter.h"
 #include "Components/Attributes/WillPowerComponent.h"
 #include "Systems/ResourceManager.h"
@@ -7,6 +10,7 @@
 #include "UI/PauseMenuWidget.h"
 #include "UI/GameOverWidget.h"
 #include "UI/SimplePauseMenu.h"
+#include "UI/BlackholeHUDWidget.h"
 #include "Components/Abilities/Player/Basic/SlashAbilityComponent.h"
 // #include "Components/Abilities/Player/SystemFreezeAbilityComponent.h" // Removed
 #include "Components/Abilities/Player/Basic/KillAbilityComponent.h"
@@ -22,6 +26,9 @@
 #include "Systems/ThresholdManager.h"
 #include "Components/Movement/WallRunComponent.h"
 #include "Enemy/BaseEnemy.h"
+#include "Systems/EnemyTrackingManager.h"
+#include "Components/Abilities/Enemy/BuilderComponent.h"
+#include "Components/Abilities/Enemy/PowerfulMindmeldComponent.h"
 #include "Engine/Canvas.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
@@ -34,6 +41,10 @@ ABlackholeHUD::ABlackholeHUD()
 	AttributeBarWidth = 200.0f;
 	AttributeBarHeight = 20.0f;
 	CooldownIconSize = 50.0f;
+	
+	MaxEnemyIndicators = GameplayConfig::UI::MAX_ENEMY_INDICATORS;
+	EnemyIndicatorRange = GameplayConfig::UI::ENEMY_INDICATOR_RANGE;
+	TargetSelectRadius = GameplayConfig::UI::TARGET_SELECT_RADIUS;
 
 	WillPowerColor = FColor::Blue;
 	
@@ -41,12 +52,16 @@ ABlackholeHUD::ABlackholeHUD()
 	CachedWP = 100.0f;
 	CachedMaxWP = 100.0f;
 	bUltimateModeActive = false;
+	HUDWidget = nullptr;
+	EnemyTrackingManager = nullptr;
 }
 
 void ABlackholeHUD::BeginPlay()
 {
 	Super::BeginPlay();
 
+	BLACKHOLE_LLM_SCOPE(UI);
+
 	PlayerCharacter = Cast<ABlackholePlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
 	
 	// Get GameStateManager and bind to state changes
@@ -72,7 +87,7 @@ void ABlackholeHUD::BeginPlay()
 		GameOverWidget = CreateWidget<UGameOverWidget>(PC, UGameOverWidget::StaticClass());
 		
 		// Log widget creation
-		UE_LOG(LogTemp, Log, TEXT("Created menu widgets - SimplePause: %s, MainMenu: %s, PauseMenu: %s, GameOver: %s"),
+		UE_LOG(LogBlackholeUI, Log, TEXT("Created menu widgets - SimplePause: %s, MainMenu: %s, PauseMenu: %s, GameOver: %s"),
 			SimplePauseMenu ? TEXT("Valid") : TEXT("NULL"),
 			MainMenuWidget ? TEXT("Valid") : TEXT("NULL"),
 			PauseMenuWidget ? TEXT("Valid") : TEXT("NULL"),
@@ -82,7 +97,7 @@ void ABlackholeHUD::BeginPlay()
 	// For prototyping: Start directly in Playing state instead of MainMenu
 	if (GameStateManager && GameStateManager->GetCurrentState() == EGameState::MainMenu)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Starting game directly in Playing state for prototyping"));
+		UE_LOG(LogBlackholeUI, Log, TEXT("Starting game directly in Playing state for prototyping"));
 		GameStateManager->StartGame();
 	}
 	
@@ -108,6 +123,21 @@ void ABlackholeHUD::BeginPlay()
 		CachedHackerDash = PlayerCharacter->FindComponentByClass<UHackerDashAbility>();
 		CachedHackerJump = PlayerCharacter->FindComponentByClass<UHackerJumpAbility>();
 		
+		BuildAbilityDisplayInfos();
+		
+		// Build the retained HUD once the abilities it displays are known
+		if (bUseRetainedHUD)
+		{
+			if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+			{
+				HUDWidget = UBlackholeHUDWidget::CreateHUDWidget(PC, PlayerCharacter);
+				if (HUDWidget)
+				{
+					// Below the menus, which use Z-order 1000
+					HUDWidget->AddToViewport(0);
+				}
+			}
+		}
 	}
 	
 	// Bind to ResourceManager events
@@ -126,6 +156,8 @@ void ABlackholeHUD::BeginPlay()
 		// Get ThresholdManager (it's a WorldSubsystem, not GameInstanceSubsystem)
 		if (UWorld* World = GetWorld())
 		{
+			EnemyTrackingManager = World->GetSubsystem<UEnemyTrackingManager>();
+			
 			ThresholdManager = World->GetSubsystem<UThresholdManager>();
 			if (ThresholdManager)
 			{
@@ -160,6 +192,12 @@ void ABlackholeHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		GameStateManager = nullptr;
 	}
 	
+	if (HUDWidget)
+	{
+		HUDWidget->RemoveFromParent();
+		HUDWidget = nullptr;
+	}
+	
 	// Clean up menu widgets
 	HideAllMenus();
 	if (MainMenuWidget) MainMenuWidget = nullptr;
@@ -167,6 +205,10 @@ void ABlackholeHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (SimplePauseMenu) SimplePauseMenu = nullptr;
 	if (GameOverWidget) GameOverWidget = nullptr;
 	
+	EnemyTrackingManager = nullptr;
+	TargetedEnemy = nullptr;
+	EnemyIndicators.Empty();
+	
 	// Clear all cached ability pointers
 	PlayerCharacter = nullptr;
 	CachedSlashAbility = nullptr;
@@ -184,6 +226,8 @@ void ABlackholeHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void ABlackholeHUD::DrawHUD()
 {
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HUD Draw", STAT_Blackhole_HUDDraw, BlackholeUIChannel);
+
 	Super::DrawHUD();
 
 	if (!PlayerCharacter || !Canvas)
@@ -191,6 +235,18 @@ void ABlackholeHUD::DrawHUD()
 		return;
 	}
 	
+	if (HUDWidget)
+	{
+		// Retained widget owns the static HUD - only enemy progress timers still tick here
+		UpdateNotifications(GetWorld()->GetDeltaSeconds());
+		
+		DrawWallRunTimer();
+		DrawEnemyAbilityProgress();
+		DrawEnemyIndicators();
+		DrawTargetInfo();
+		return;
+	}
+	
 	// Update cached values if needed
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 	if (CurrentTime - LastCacheUpdateTime >= CacheUpdateInterval)
@@ -248,7 +304,8 @@ void ABlackholeHUD::DrawHUD()
 		{
 			EntryColor = FColor::Yellow; // Warning color for last entry
 		}
-		FString CriticalText = FString::Printf(TEXT("Critical Entries: %d/%d"), EntriesRemaining, TotalEntries);
+		const int64 EntriesKey = ((int64)EntriesRemaining << 32) | (uint32)TotalEntries;
+		const FString& CriticalText = CriticalEntriesText.Get(EntriesKey, TEXT("Critical Entries: %d/%d"), EntriesRemaining, TotalEntries);
 		DrawText(CriticalText, EntryColor, StartX, StartY + VerticalSpacing * resourceBarIndex, nullptr, 1.0f, false);
 	}
 
@@ -272,6 +329,9 @@ void ABlackholeHUD::DrawHUD()
 	
 	// Draw enemy ability progress bars
 	DrawEnemyAbilityProgress();
+	
+	// Overhead indicators also pick the targeted enemy for DrawTargetInfo
+	DrawEnemyIndicators();
 
 	DrawTargetInfo();
 }
@@ -317,9 +377,9 @@ void ABlackholeHUD::DrawAttribute(const FString& Name, float Current, float Max,
 		DrawRect(Color, BarX, BarY, FilledWidth, AttributeBarHeight);
 	}
 
-	// Use pre-allocated buffer to avoid per-frame allocation
-	FCString::Sprintf(AttributeTextBuffer, TEXT("%.0f/%.0f"), Current, Max);
-	DrawText(AttributeTextBuffer, FColor::White, BarX + AttributeBarWidth + 10, Y, nullptr, 1.0f, false);
+	// Shared by the player and target bars, so format into a reused string instead of caching by value
+	FHUDText::Format(AttributeText, TEXT("%.0f/%.0f"), Current, Max);
+	DrawText(AttributeText, FColor::White, BarX + AttributeBarWidth + 10, Y, nullptr, 1.0f, false);
 }
 
 void ABlackholeHUD::DrawAbilityCooldown(const FString& Name, float CooldownPercent, float X, float Y)
@@ -356,7 +416,7 @@ void ABlackholeHUD::DrawCrosshair()
 
 void ABlackholeHUD::DrawTargetInfo()
 {
-	AActor* Target = GetTargetedActor();
+	ABaseEnemy* Target = TargetedEnemy.Get();
 	if (!Target)
 	{
 		return;
@@ -365,45 +425,149 @@ void ABlackholeHUD::DrawTargetInfo()
 	float InfoX = Canvas->SizeX * 0.5f - 100.0f;
 	float InfoY = 100.0f;
 
-	// Use pre-allocated buffer to avoid per-frame allocation
-	FCString::Sprintf(TargetTextBuffer, TEXT("Target: %s"), *Target->GetName());
-	DrawText(TargetTextBuffer, FColor::Yellow, InfoX, InfoY);
-
-	// Display enemy WP
-	if (ABaseEnemy* Enemy = Cast<ABaseEnemy>(Target))
+	// GetName() allocates, so only build it when the target changes
+	if (!TargetText.IsCurrent(Target->GetUniqueID()))
 	{
-		DrawAttribute("Enemy WP", Enemy->GetCurrentWP(), Enemy->GetMaxWP(),
-					  InfoX - 100.0f, InfoY + 20.0f, FColor::Red);
+		TargetText.Get(Target->GetUniqueID(), TEXT("Target: %s"), *Target->GetName());
 	}
+	DrawText(TargetText.GetCached(), FColor::Yellow, InfoX, InfoY);
+
+	// Display enemy WP
+	DrawAttribute("Enemy WP", Target->GetCurrentWP(), Target->GetMaxWP(),
+				  InfoX - 100.0f, InfoY + 20.0f, FColor::Red);
 }
 
-AActor* ABlackholeHUD::GetTargetedActor() const
+void ABlackholeHUD::DrawEnemyIndicators()
 {
-	if (!PlayerCharacter)
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HUD Enemy Indicators", STAT_Blackhole_HUDEnemyIndicators, BlackholeUIChannel);
+
+	TargetedEnemy = nullptr;
+	EnemyIndicators.Reset();
+	
+	if (!EnemyTrackingManager || !PlayerCharacter || !Canvas)
 	{
-		return nullptr;
+		return;
 	}
-
+	
 	APlayerController* PC = Cast<APlayerController>(PlayerCharacter->GetController());
 	if (!PC)
 	{
-		return nullptr;
+		return;
 	}
-
-	FVector Start = PlayerCharacter->GetActorLocation();
-	FVector Forward = PC->GetControlRotation().Vector();
-	FVector End = Start + (Forward * GameplayConfig::Abilities::Defaults::RANGE * 5.0f); // 5x default range for targeting
-
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(PlayerCharacter);
-
-	if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Pawn, QueryParams))
+	
+	const FVector PlayerLocation = PlayerCharacter->GetActorLocation();
+	const float MaxDistanceSq = FMath::Square(EnemyIndicatorRange);
+	const FVector2D ScreenCenter(Canvas->SizeX * 0.5f, Canvas->SizeY * 0.5f);
+	float BestTargetScreenDistSq = FMath::Square(TargetSelectRadius);
+	
+	// Gather - visibility is the AI's cached line-of-sight flag, so no traces here
+	for (const FTrackedEnemy& Tracked : EnemyTrackingManager->GetTrackedEnemies())
+	{
+		ABaseEnemy* Enemy = Tracked.Enemy.Get();
+		if (!Enemy || Enemy->IsDead())
+		{
+			continue;
+		}
+		
+		const UBuilderComponent* Builder = Tracked.Builder.Get();
+		const UPowerfulMindmeldComponent* Mindmeld = Tracked.Mindmeld.Get();
+		const bool bBuilding = Builder && Builder->IsBuilding();
+		const bool bChanneling = Mindmeld && Mindmeld->IsChanneling();
+		const bool bVisible = UEnemyTrackingManager::IsVisibleToPlayer(Tracked);
+		
+		// Occluded or distant enemies are culled unless they are channeling a Mindmeld
+		const FVector EnemyLocation = Enemy->GetActorLocation();
+		const float DistanceSq = FVector::DistSquared(PlayerLocation, EnemyLocation);
+		if (!bChanneling && (!bVisible || DistanceSq > MaxDistanceSq))
+		{
+			continue;
+		}
+		
+		FVector2D ScreenPosition;
+		if (!PC->ProjectWorldLocationToScreen(EnemyLocation, ScreenPosition, true))
+		{
+			continue;
+		}
+		
+		if (ScreenPosition.X < 0.0f || ScreenPosition.Y < 0.0f || ScreenPosition.X > Canvas->SizeX || ScreenPosition.Y > Canvas->SizeY)
+		{
+			continue;
+		}
+		
+		FEnemyIndicator& Indicator = EnemyIndicators.AddDefaulted_GetRef();
+		Indicator.Enemy = Enemy;
+		Indicator.ScreenPosition = ScreenPosition;
+		Indicator.DistanceSq = DistanceSq;
+		Indicator.WPPercent = Enemy->GetMaxWP() > 0.0f ? Enemy->GetCurrentWP() / Enemy->GetMaxWP() : 0.0f;
+		Indicator.BuildProgress = bBuilding ? Builder->GetBuildProgress() : -1.0f;
+		Indicator.CastProgress = bChanneling ? Mindmeld->GetChannelProgress() : -1.0f;
+		Indicator.bVisible = bVisible;
+		
+		// Crosshair targeting - nearest visible enemy to the screen centre
+		if (bVisible)
+		{
+			const float ScreenDistSq = FVector2D::DistSquared(ScreenPosition, ScreenCenter);
+			if (ScreenDistSq < BestTargetScreenDistSq)
+			{
+				BestTargetScreenDistSq = ScreenDistSq;
+				TargetedEnemy = Enemy;
+			}
+		}
+	}
+	
+	// Keep the draw cost bounded - casters first, then nearest
+	if (EnemyIndicators.Num() > MaxEnemyIndicators)
 	{
-		return HitResult.GetActor();
+		EnemyIndicators.Sort([](const FEnemyIndicator& A, const FEnemyIndicator& B)
+		{
+			const bool bACasting = A.CastProgress >= 0.0f;
+			const bool bBCasting = B.CastProgress >= 0.0f;
+			if (bACasting != bBCasting)
+			{
+				return bACasting;
+			}
+			return A.DistanceSq < B.DistanceSq;
+		});
+		EnemyIndicators.SetNum(MaxEnemyIndicators, EAllowShrinking::No);
+	}
+	
+	// Draw
+	static const FString BuildLabel = TEXT("BUILDING");
+	static const FString CastLabel = TEXT("MINDMELDER");
+	const float BarWidth = 60.0f;
+	const float BarHeight = 5.0f;
+	const float BarOffsetY = 70.0f;
+	
+	for (const FEnemyIndicator& Indicator : EnemyIndicators)
+	{
+		const float BarX = Indicator.ScreenPosition.X - BarWidth * 0.5f;
+		float BarY = Indicator.ScreenPosition.Y - BarOffsetY;
+		
+		// WP bar
+		const bool bIsTarget = Indicator.Enemy == TargetedEnemy.Get();
+		DrawRect(bIsTarget ? FColor::Yellow : FColor::Black, BarX - 1, BarY - 1, BarWidth + 2, BarHeight + 2);
+		DrawRect(FColor(50, 50, 50), BarX, BarY, BarWidth, BarHeight);
+		DrawRect(FColor::Red, BarX, BarY, BarWidth * Indicator.WPPercent, BarHeight);
+		
+		// Psi-Disruptor build progress
+		if (Indicator.BuildProgress >= 0.0f)
+		{
+			BarY -= BarHeight + 4.0f;
+			DrawRect(FColor(50, 50, 50), BarX, BarY, BarWidth, BarHeight);
+			DrawRect(FColor::MakeRedToGreenColorFromScalar(1.0f - Indicator.BuildProgress), BarX, BarY, BarWidth * Indicator.BuildProgress, BarHeight);
+			DrawText(BuildLabel, FColor::Orange, BarX, BarY - 14.0f, nullptr, 0.7f, false);
+		}
+		
+		// Mindmeld channel progress - shown through walls so the caster can be found
+		if (Indicator.CastProgress >= 0.0f)
+		{
+			BarY -= BarHeight + 4.0f;
+			const FColor CastColor = FColor(128 + (uint8)(127 * Indicator.CastProgress), 0, 255, Indicator.bVisible ? 255 : 150);
+			DrawRect(FColor(50, 50, 50), BarX, BarY, BarWidth, BarHeight);
+			DrawRect(CastColor, BarX, BarY, BarWidth * Indicator.CastProgress, BarHeight);
+			DrawText(CastLabel, FColor::Magenta, BarX, BarY - 14.0f, nullptr, 0.7f, false);
+		}
 	}
-
-	return nullptr;
 }
 
 void ABlackholeHUD::UpdateWPBar(float NewValue, float MaxValue)
@@ -434,8 +598,8 @@ void ABlackholeHUD::UpdateCachedValues()
 	}
 	
 	// Update ability cooldowns
-	CachedCooldownPercents.Empty();
-	TArray<FAbilityDisplayInfo> Abilities = GetCurrentAbilities();
+	CachedCooldownPercents.Reset();
+	const TArray<FAbilityDisplayInfo>& Abilities = GetCurrentAbilities();
 	for (const FAbilityDisplayInfo& AbilityInfo : Abilities)
 	{
 		if (AbilityInfo.Ability)
@@ -470,103 +634,58 @@ void ABlackholeHUD::UpdateCachedValues()
 }
 
 
-TArray<ABlackholeHUD::FAbilityDisplayInfo> ABlackholeHUD::GetCurrentAbilities() const
+void ABlackholeHUD::BuildAbilityDisplayInfos()
 {
-	TArray<FAbilityDisplayInfo> Abilities;
+	AbilityDisplayInfos.Reset();
 	
-	if (!PlayerCharacter)
+	auto AddAbility = [this](UAbilityComponent* Ability, const TCHAR* Name, const TCHAR* UltimateName, const TCHAR* Input)
 	{
-		return Abilities;
-	}
-	
-	bool bIsHacker = true; // Always Hacker path now
+		if (!Ability)
+		{
+			return;
+		}
+		
+		FAbilityDisplayInfo& Info = AbilityDisplayInfos.AddDefaulted_GetRef();
+		Info.Name = Name;
+		Info.UltimateName = UltimateName ? UltimateName : Name;
+		Info.Input = Input;
+		Info.InputLabel = FString::Printf(TEXT("[%s]"), Input);
+		Info.Ability = Ability;
+		Info.bIsActive = true;
+		Info.bIsDisabled = false;
+		Info.bIsInUltimateMode = false;
+		Info.bIsBasicAbility = Ability->IsBasicAbility();
+	};
 	
 	// Always available abilities
-	if (CachedSlashAbility)
-	{
-		bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedSlashAbility) : false;
-		bool bUltimate = CachedSlashAbility->IsInUltimateMode();
-		bool bBasic = CachedSlashAbility->IsBasicAbility();
-		Abilities.Add({TEXT("Slash"), TEXT("LMB"), CachedSlashAbility, true, bDisabled, bUltimate, bBasic});
-	}
+	AddAbility(CachedSlashAbility, TEXT("Slash"), nullptr, TEXT("LMB"));
+	AddAbility(CachedKillAbility, TEXT("Kill (Debug)"), nullptr, TEXT("K"));
 	
-	if (CachedKillAbility)
-	{
-		bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedKillAbility) : false;
-		bool bUltimate = CachedKillAbility->IsInUltimateMode();
-		bool bBasic = CachedKillAbility->IsBasicAbility();
-		Abilities.Add({TEXT("Kill (Debug)"), TEXT("K"), CachedKillAbility, true, bDisabled, bUltimate, bBasic});
-	}
+	// Hacker abilities (always Hacker path now)
+	AddAbility(CachedFirewallBreach, TEXT("Firewall Breach"), TEXT("TOTAL SYSTEM COMPROMISE"), TEXT("RMB"));
+	AddAbility(CachedPulseHack, TEXT("Pulse Hack"), TEXT("SYSTEM OVERLOAD"), TEXT("Q"));
+	AddAbility(CachedGravityPull, TEXT("Gravity Pull"), TEXT("SINGULARITY"), TEXT("E"));
+	AddAbility(CachedHackerDash, TEXT("Hacker Dash"), nullptr, TEXT("Shift"));
+	AddAbility(CachedHackerJump, TEXT("Hacker Jump"), nullptr, TEXT("Space"));
 	
-	// Path-specific abilities
-	if (bIsHacker)
-	{
-		// Hacker abilities
-		if (CachedFirewallBreach)
-		{
-			bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedFirewallBreach) : false;
-			bool bUltimate = CachedFirewallBreach->IsInUltimateMode();
-			bool bBasic = CachedFirewallBreach->IsBasicAbility();
-			FString Name = bUltimate ? TEXT("TOTAL SYSTEM COMPROMISE") : TEXT("Firewall Breach");
-			Abilities.Add({Name, TEXT("RMB"), CachedFirewallBreach, true, bDisabled, bUltimate, bBasic});
-		}
-		
-		if (CachedPulseHack)
-		{
-			bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedPulseHack) : false;
-			bool bUltimate = CachedPulseHack->IsInUltimateMode();
-			bool bBasic = CachedPulseHack->IsBasicAbility();
-			FString Name = bUltimate ? TEXT("SYSTEM OVERLOAD") : TEXT("Pulse Hack");
-			Abilities.Add({Name, TEXT("Q"), CachedPulseHack, true, bDisabled, bUltimate, bBasic});
-		}
-		
-		if (CachedGravityPull)
-		{
-			bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedGravityPull) : false;
-			bool bUltimate = CachedGravityPull->IsInUltimateMode();
-			bool bBasic = CachedGravityPull->IsBasicAbility();
-			FString Name = bUltimate ? TEXT("SINGULARITY") : TEXT("Gravity Pull");
-			Abilities.Add({Name, TEXT("E"), CachedGravityPull, true, bDisabled, bUltimate, bBasic});
-		}
-		
-		if (CachedHackerDash)
-		{
-			bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedHackerDash) : false;
-			bool bUltimate = CachedHackerDash->IsInUltimateMode();
-			bool bBasic = CachedHackerDash->IsBasicAbility();
-			Abilities.Add({TEXT("Hacker Dash"), TEXT("Shift"), CachedHackerDash, true, bDisabled, bUltimate, bBasic});
-		}
-		
-		if (CachedHackerJump)
-		{
-			bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedHackerJump) : false;
-			bool bUltimate = CachedHackerJump->IsInUltimateMode();
-			bool bBasic = CachedHackerJump->IsBasicAbility();
-			Abilities.Add({TEXT("Hacker Jump"), TEXT("Space"), CachedHackerJump, true, bDisabled, bUltimate, bBasic});
-		}
-		
-		// Data Spike ability (R key)
-		if (CachedDataSpike)
-		{
-			bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedDataSpike) : false;
-			bool bUltimate = CachedDataSpike->IsInUltimateMode();
-			bool bBasic = CachedDataSpike->IsBasicAbility();
-			FString Name = bUltimate ? TEXT("SYSTEM CORRUPTION") : TEXT("Data Spike");
-			Abilities.Add({Name, TEXT("R"), CachedDataSpike, true, bDisabled, bUltimate, bBasic});
-		}
-	}
+	// Data Spike ability (R key)
+	AddAbility(CachedDataSpike, TEXT("Data Spike"), TEXT("SYSTEM CORRUPTION"), TEXT("R"));
 	
 	// System Override ability (F key for Hacker)
-	if (CachedSystemOverride)
+	AddAbility(CachedSystemOverride, TEXT("System Override"), TEXT("TOTAL SYSTEM SHUTDOWN"), TEXT("F"));
+}
+
+TArray<ABlackholeHUD::FAbilityDisplayInfo>& ABlackholeHUD::GetCurrentAbilities()
+{
+	// Names and labels were built once - only refresh the state flags
+	for (FAbilityDisplayInfo& Info : AbilityDisplayInfos)
 	{
-		bool bDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(CachedSystemOverride) : false;
-		bool bUltimate = CachedSystemOverride->IsInUltimateMode();
-		bool bBasic = CachedSystemOverride->IsBasicAbility();
-		FString Name = bUltimate ? TEXT("TOTAL SYSTEM SHUTDOWN") : TEXT("System Override");
-		Abilities.Add({Name, TEXT("F"), CachedSystemOverride, true, bDisabled, bUltimate, bBasic});
+		Info.bIsDisabled = ThresholdManager ? ThresholdManager->IsAbilityDisabled(Info.Ability) : false;
+		Info.bIsInUltimateMode = Info.Ability->IsInUltimateMode();
+		Info.bIsBasicAbility = Info.Ability->IsBasicAbility();
 	}
 	
-	return Abilities;
+	return AbilityDisplayInfos;
 }
 
 void ABlackholeHUD::DrawVelocityIndicator()
@@ -625,7 +744,8 @@ void ABlackholeHUD::DrawVelocityIndicator()
 	}
 	
 	// Draw main speed value
-	FString SpeedText = FString::Printf(TEXT("%.0f"), CachedVelocity);
+	const int32 DisplaySpeed = FMath::RoundToInt(CachedVelocity);
+	const FString& SpeedText = VelocityText.Get(DisplaySpeed, TEXT("%d"), DisplaySpeed);
 	float TextScale = 1.8f;  // Smaller text
 	DrawText(SpeedText, SpeedColor, ScreenCenterX - 25.0f, BoxY + 5.0f, nullptr, TextScale, false);
 	
@@ -661,18 +781,7 @@ void ABlackholeHUD::DrawAbilityInfo()
 		return;
 	}
 	
-	// Use cached abilities if cache is fresh
-	TArray<FAbilityDisplayInfo> Abilities;
-	if (GetWorld()->GetTimeSeconds() - LastCacheUpdateTime < CacheUpdateInterval)
-	{
-		// Cache is fresh, reuse the abilities from cache
-		Abilities = GetCurrentAbilities();
-	}
-	else
-	{
-		// Cache is stale, get fresh data
-		Abilities = GetCurrentAbilities();
-	}
+	TArray<FAbilityDisplayInfo>& Abilities = GetCurrentAbilities();
 	
 	// Draw abilities in a grid at the bottom of the screen
 	float StartX = 50.0f;
@@ -692,7 +801,7 @@ void ABlackholeHUD::DrawAbilityInfo()
 	
 	for (int32 i = 0; i < Abilities.Num(); i++)
 	{
-		const FAbilityDisplayInfo& AbilityInfo = Abilities[i];
+		FAbilityDisplayInfo& AbilityInfo = Abilities[i];
 		
 		float X = StartX + (i % 6) * (BoxWidth + Spacing);
 		float Y = StartY + (i / 6) * (BoxHeight + Spacing);
@@ -727,7 +836,7 @@ void ABlackholeHUD::DrawAbilityInfo()
 		DrawRect(BoxColor, X, Y, BoxWidth, BoxHeight);
 		
 		// Draw ability name
-		DrawText(AbilityInfo.Name, NameColor, X + 5, Y + 5);
+		DrawText(AbilityInfo.GetDisplayName(), NameColor, X + 5, Y + 5);
 		
 		// Draw disabled overlay
 		if (AbilityInfo.bIsDisabled)
@@ -752,9 +861,7 @@ void ABlackholeHUD::DrawAbilityInfo()
 		
 		// Draw input key
 		FColor InputColor = AbilityInfo.bIsActive && !AbilityInfo.bIsDisabled ? FColor::Green : FColor(128, 128, 128);
-		// Use pre-allocated buffer to avoid per-frame allocation
-		FCString::Sprintf(CooldownTextBuffer, TEXT("[%s]"), *AbilityInfo.Input);
-		DrawText(CooldownTextBuffer, InputColor, X + 5, Y + 25);
+		DrawText(AbilityInfo.InputLabel, InputColor, X + 5, Y + 25);
 		
 		// Draw cooldown and resource cost if ability is active
 		if (AbilityInfo.bIsActive && AbilityInfo.Ability)
@@ -774,9 +881,10 @@ void ABlackholeHUD::DrawAbilityInfo()
 						float CooldownPercent = JumpCooldownRemaining / HackerJump->GetJumpCooldown();
 						DrawRect(FColor(64, 64, 64), X + 5, Y + 50, CooldownWidth, CooldownHeight);
 						DrawRect(FColor::Orange, X + 5, Y + 50, CooldownWidth * CooldownPercent, CooldownHeight);
-						// Use pre-allocated buffer to avoid per-frame allocation
-						FCString::Sprintf(CooldownTextBuffer, TEXT("Jump CD: %.1fs"), JumpCooldownRemaining);
-						DrawText(CooldownTextBuffer, FColor::Orange, X + 5, Y + 60);
+						// Jump cooldowns use the negative key range so they never collide with ability cooldowns
+						const int32 Tenths = FHUDText::ToTenths(JumpCooldownRemaining);
+						DrawText(AbilityInfo.CooldownText.Get(-1 - Tenths, TEXT("Jump CD: %.1fs"), FHUDText::FromTenths(Tenths)),
+							FColor::Orange, X + 5, Y + 60);
 					}
 					else
 					{
@@ -803,9 +911,9 @@ void ABlackholeHUD::DrawAbilityInfo()
 					
 					// Draw cooldown time
 					float TimeRemaining = AbilityInfo.Ability->GetCooldownRemaining();
-					// Use pre-allocated buffer to avoid per-frame allocation
-					FCString::Sprintf(CooldownTextBuffer, TEXT("%.1fs"), TimeRemaining);
-					DrawText(CooldownTextBuffer, FColor::Red, X + 5, Y + 60);
+					const int32 Tenths = FHUDText::ToTenths(TimeRemaining);
+					DrawText(AbilityInfo.CooldownText.Get(Tenths, TEXT("%.1fs"), FHUDText::FromTenths(Tenths)),
+						FColor::Red, X + 5, Y + 60);
 				}
 				else
 				{
@@ -839,8 +947,7 @@ void ABlackholeHUD::DrawDebugStatus()
 	// Ultimate mode status
 	const TCHAR* UltimateStatus = bUltimateModeActive ? TEXT("ACTIVE") : TEXT("INACTIVE");
 	FColor UltimateColor = bUltimateModeActive ? FColor::Red : FColor::White;
-	FCString::Sprintf(DebugTextBuffer, TEXT("Ultimate Mode: %s"), UltimateStatus);
-	DrawText(DebugTextBuffer, UltimateColor, X, Y);
+	DrawText(DebugUltimateText.Get(bUltimateModeActive, TEXT("Ultimate Mode: %s"), UltimateStatus), UltimateColor, X, Y);
 	Y += LineHeight;
 	
 	// Combat status
@@ -849,14 +956,12 @@ void ABlackholeHUD::DrawDebugStatus()
 		bool bInCombat = ThresholdManager->IsInCombat();
 		const TCHAR* CombatStatus = bInCombat ? TEXT("IN COMBAT") : TEXT("NOT IN COMBAT");
 		FColor CombatColor = bInCombat ? FColor::Orange : FColor(128, 128, 128);
-		FCString::Sprintf(DebugTextBuffer, TEXT("Combat: %s"), CombatStatus);
-		DrawText(DebugTextBuffer, CombatColor, X, Y);
+		DrawText(DebugCombatText.Get(bInCombat, TEXT("Combat: %s"), CombatStatus), CombatColor, X, Y);
 		Y += LineHeight;
 		
 		// Disabled abilities count
 		int32 DisabledCount = ThresholdManager->GetDisabledAbilityCount();
-		FCString::Sprintf(DebugTextBuffer, TEXT("Disabled Abilities: %d"), DisabledCount);
-		DrawText(DebugTextBuffer, FColor::Red, X, Y);
+		DrawText(DebugDisabledText.Get(DisabledCount, TEXT("Disabled Abilities: %d"), DisabledCount), FColor::Red, X, Y);
 		Y += LineHeight * 1.5f;
 	}
 	
@@ -864,12 +969,11 @@ void ABlackholeHUD::DrawDebugStatus()
 	DrawText(TEXT("Abilities:"), FColor::Cyan, X, Y);
 	Y += LineHeight;
 	
-	TArray<FAbilityDisplayInfo> Abilities = GetCurrentAbilities();
-	for (const FAbilityDisplayInfo& AbilityInfo : Abilities)
+	for (FAbilityDisplayInfo& AbilityInfo : GetCurrentAbilities())
 	{
 		if (AbilityInfo.Ability)
 		{
-			FString Status;
+			const TCHAR* Status = TEXT("NORMAL");
 			FColor StatusColor = FColor::White;
 			
 			if (AbilityInfo.bIsDisabled)
@@ -902,12 +1006,13 @@ void ABlackholeHUD::DrawDebugStatus()
 				}
 			}
 			
-			// Use pre-allocated buffer to avoid per-frame allocation
-			FCString::Sprintf(DebugTextBuffer, TEXT("[%s] %s - %s"), 
-				*AbilityInfo.Input, 
-				*AbilityInfo.Name, 
-				*Status);
-			DrawText(DebugTextBuffer, StatusColor, X + 10, Y);
+			// Status and name are the only parts that change - key on the status text and ultimate flag
+			const int64 StatusKey = ((int64)FCrc::StrCrc32(Status) << 1) | (AbilityInfo.bIsInUltimateMode ? 1 : 0);
+			const FString& StatusLine = AbilityInfo.DebugText.Get(StatusKey, TEXT("[%s] %s - %s"),
+				*AbilityInfo.Input,
+				*AbilityInfo.GetDisplayName(),
+				Status);
+			DrawText(StatusLine, StatusColor, X + 10, Y);
 			Y += LineHeight;
 		}
 	}
@@ -917,7 +1022,7 @@ void ABlackholeHUD::DrawDebugStatus()
 	if (ResourceManager)
 	{
 		int32 WPPercent = (int32)(ResourceManager->GetWillPowerPercent() * 100.0f);
-		DrawText(FString::Printf(TEXT("WP: %d%%"), WPPercent), WillPowerColor, X, Y);
+		DrawText(DebugWPText.Get(WPPercent, TEXT("WP: %d%%"), WPPercent), WillPowerColor, X, Y);
 		Y += LineHeight;
 		
 		if (WPPercent <= 0)
@@ -995,7 +1100,7 @@ void ABlackholeHUD::ShowMainMenu()
 	else
 	{
 		// If no menu widget exists, ensure game input is enabled
-		UE_LOG(LogTemp, Warning, TEXT("No MainMenuWidget available - enabling game input"));
+		UE_LOG(LogBlackholeUI, Warning, TEXT("No MainMenuWidget available - enabling game input"));
 		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
 		{
 			FInputModeGameOnly InputMode;
@@ -1009,23 +1114,23 @@ void ABlackholeHUD::ShowPauseMenu()
 {
 	HideAllMenus();
 	
-	UE_LOG(LogTemp, Log, TEXT("ShowPauseMenu called - SimplePauseMenu: %s"), 
+	UE_LOG(LogBlackholeUI, Log, TEXT("ShowPauseMenu called - SimplePauseMenu: %s"), 
 		SimplePauseMenu ? TEXT("Valid") : TEXT("NULL"));
 	
 	// Use simplified pause menu for prototyping
 	if (SimplePauseMenu)
 	{
 		SimplePauseMenu->ShowMenu();
-		UE_LOG(LogTemp, Log, TEXT("SimplePauseMenu->ShowMenu() called"));
+		UE_LOG(LogBlackholeUI, Log, TEXT("SimplePauseMenu->ShowMenu() called"));
 	}
 	else if (PauseMenuWidget)
 	{
 		PauseMenuWidget->ShowMenu();
-		UE_LOG(LogTemp, Log, TEXT("PauseMenuWidget->ShowMenu() called"));
+		UE_LOG(LogBlackholeUI, Log, TEXT("PauseMenuWidget->ShowMenu() called"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("No pause menu widget available!"));
+		UE_LOG(LogBlackholeUI, Error, TEXT("No pause menu widget available!"));
 	}
 }
 
@@ -1099,7 +1204,7 @@ void ABlackholeHUD::OnGameStateChanged(EGameState NewState)
 		// If no main menu widget, automatically start the game
 		if (!MainMenuWidget && GameStateManager)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("No MainMenuWidget - auto-starting game"));
+			UE_LOG(LogBlackholeUI, Warning, TEXT("No MainMenuWidget - auto-starting game"));
 			// Delay to next frame to avoid state change during state change
 			GetWorld()->GetTimerManager().SetTimerForNextTick([this]()
 			{
@@ -1127,7 +1232,7 @@ void ABlackholeHUD::OnGameStateChanged(EGameState NewState)
 					PC->SetInputMode(InputMode);
 					PC->bShowMouseCursor = false;
 					
-					UE_LOG(LogTemp, Log, TEXT("BlackholeHUD: Set input mode to GameOnly for Playing state"));
+					UE_LOG(LogBlackholeUI, Log, TEXT("BlackholeHUD: Set input mode to GameOnly for Playing state"));
 				}
 			});
 		}
@@ -1168,7 +1273,7 @@ void ABlackholeHUD::OnCriticalTimerExpired()
 {
 	bCriticalTimerActive = false;
 	CriticalTimeRemaining = 0.0f;
-	UE_LOG(LogTemp, Warning, TEXT("BlackholeHUD: Critical timer expired - hiding UI"));
+	UE_LOG(LogBlackholeUI, Warning, TEXT("BlackholeHUD: Critical timer expired - hiding UI"));
 }
 
 void ABlackholeHUD::DrawCriticalTimer()
@@ -1186,16 +1291,17 @@ void ABlackholeHUD::DrawCriticalTimer()
 	float FlashIntensity = FMath::Sin(GetWorld()->GetTimeSeconds() * 8.0f) * 0.5f + 0.5f; // Flash between 0.5 and 1.0
 	FColor CriticalColor = FColor(255, (uint8)(100 * FlashIntensity), 0, 255); // Orange to red flash
 	
-	FString CriticalText = TEXT("CRITICAL ERROR");
+	static const FString CriticalText = TEXT("CRITICAL ERROR");
 	DrawText(CriticalText, CriticalColor, ScreenCenterX - 150.0f, ScreenCenterY - 40.0f, nullptr, 2.0f, false);
 	
 	// Draw countdown timer
-	FString TimerText = FString::Printf(TEXT("USE ULTIMATE IN: %.1f"), CriticalTimeRemaining);
+	const int32 TimerTenths = FHUDText::ToTenths(CriticalTimeRemaining);
+	const FString& TimerText = CriticalTimerText.Get(TimerTenths, TEXT("USE ULTIMATE IN: %.1f"), FHUDText::FromTenths(TimerTenths));
 	FColor TimerColor = CriticalTimeRemaining <= 2.0f ? FColor::Red : FColor::Yellow;
 	DrawText(TimerText, TimerColor, ScreenCenterX - 120.0f, ScreenCenterY, nullptr, 1.5f, false);
 	
 	// Draw warning message
-	FString WarningText = TEXT("USE ANY ULTIMATE ABILITY OR DIE!");
+	static const FString WarningText = TEXT("USE ANY ULTIMATE ABILITY OR DIE!");
 	DrawText(WarningText, FColor::White, ScreenCenterX - 140.0f, ScreenCenterY + 30.0f, nullptr, 1.0f, false);
 	
 	// Draw critical state entries info
@@ -1203,13 +1309,13 @@ void ABlackholeHUD::DrawCriticalTimer()
 	{
 		int32 EntriesRemaining = ThresholdManager->GetCriticalStateEntriesRemaining();
 		FColor EntryColor = EntriesRemaining > 0 ? FColor::Yellow : FColor::Red;
-		FString EntryText = FString::Printf(TEXT("Critical Entries Remaining: %d"), EntriesRemaining);
+		const FString& EntryText = CriticalPanelEntriesText.Get(EntriesRemaining, TEXT("Critical Entries Remaining: %d"), EntriesRemaining);
 		DrawText(EntryText, EntryColor, ScreenCenterX - 120.0f, ScreenCenterY + 50.0f, nullptr, 1.2f, false);
 		
 		// Additional warning if this is the last entry
 		if (EntriesRemaining == 0)
 		{
-			FString LastChanceText = TEXT("LAST CHANCE - NO MORE RETRIES!");
+			static const FString LastChanceText = TEXT("LAST CHANCE - NO MORE RETRIES!");
 			DrawText(LastChanceText, FColor::Red, ScreenCenterX - 130.0f, ScreenCenterY + 70.0f, nullptr, 1.0f, false);
 		}
 	}
@@ -1270,31 +1376,31 @@ void ABlackholeHUD::DrawWallRunTimer()
 	DrawRect(FColor(0, 0, 0, 150), ScreenRightX - 10.0f, ScreenTopY - 10.0f, BoxWidth, BoxHeight);
 	
 	// Draw wall run indicator
-	FString WallRunText = TEXT("WALL RUNNING");
+	static const FString WallRunText = TEXT("WALL RUNNING");
 	FColor WallRunColor = FColor::Cyan;
 	DrawText(WallRunText, WallRunColor, ScreenRightX, ScreenTopY, nullptr, 1.5f, false);
 	
 	// Get wall side for display
-	FString SideText = "";
+	const TCHAR* SideText = TEXT("");
 	FColor SideColor = FColor::Blue;
 	
 	if (WallRunComp->GetCurrentWallSide() == EWallSide::Right)
 	{
-		SideText = " (RIGHT WALL)";
+		SideText = TEXT(" (RIGHT WALL)");
 		SideColor = FColor::Green;
 	}
 	else if (WallRunComp->GetCurrentWallSide() == EWallSide::Left)
 	{
-		SideText = " (LEFT WALL)";
+		SideText = TEXT(" (LEFT WALL)");
 		SideColor = FColor::Orange;
 	}
 	
 	// Draw wall side text
-	FString WallSideText = FString::Printf(TEXT("Running on%s"), *SideText);
+	const FString& WallSideText = WallRunSideText.Get((int64)WallRunComp->GetCurrentWallSide(), TEXT("Running on%s"), SideText);
 	DrawText(WallSideText, SideColor, ScreenRightX, ScreenTopY + 25.0f, nullptr, 1.2f, false);
 	
 	// Draw control hints
-	FString HintText = TEXT("Hold W: Continue | SPACE: Wall Jump (diagonal)");
+	static const FString HintText = TEXT("Hold W: Continue | SPACE: Wall Jump (diagonal)");
 	DrawText(HintText, FColor::Yellow, ScreenRightX, ScreenTopY + 50.0f, nullptr, 1.0f, false);
 	
 	// Draw screen edge effects for better visibility
@@ -1322,7 +1428,8 @@ void ABlackholeHUD::DrawWallRunTimer()
 	if (PlayerCharacter && PlayerCharacter->GetCharacterMovement())
 	{
 		float CurrentSpeed = PlayerCharacter->GetCharacterMovement()->Velocity.Size2D();
-		FString SpeedText = FString::Printf(TEXT("Speed: %.0f"), CurrentSpeed);
+		const int32 DisplaySpeed = FMath::RoundToInt(CurrentSpeed);
+		const FString& SpeedText = WallRunSpeedText.Get(DisplaySpeed, TEXT("Speed: %d"), DisplaySpeed);
 		DrawText(SpeedText, FColor::White, ScreenRightX, ScreenTopY + 75.0f, nullptr, 1.0f, false);
 	}
 }
@@ -1330,6 +1437,14 @@ void ABlackholeHUD::DrawWallRunTimer()
 // Notification System Implementation
 void ABlackholeHUD::AddNotification(const FString& Message, const FColor& Color, float Duration)
 {
+	if (HUDWidget)
+	{
+		HUDWidget->AddNotification(Message, Color, Duration);
+		return;
+	}
+	
+	BLACKHOLE_LLM_SCOPE(UI);
+
 	FNotification NewNotification;
 	NewNotification.Message = Message;
 	NewNotification.Color = Color;
@@ -1345,6 +1460,18 @@ void ABlackholeHUD::AddNotification(const FString& Message, const FColor& Color,
 	}
 }
 
+void ABlackholeHUD::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	SIZE_T Bytes = ActiveNotifications.GetAllocatedSize();
+	for (const FNotification& Notification : ActiveNotifications)
+	{
+		Bytes += Notification.Message.GetAllocatedSize();
+	}
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Bytes);
+}
+
 void ABlackholeHUD::UpdateNotifications(float DeltaTime)
 {
 	// Update notification timers and remove expired ones
@@ -1455,7 +1582,8 @@ void ABlackholeHUD::DrawEnemyAbilityProgress()
 		
 		// Draw text
 		float TimeRemaining = PsiDisruptorBuildTime - PsiDisruptorBuildProgress;
-		FString ProgressText = FString::Printf(TEXT("PSI-DISRUPTOR BUILDING: %.1fs"), TimeRemaining);
+		const int32 Tenths = FHUDText::ToTenths(TimeRemaining);
+		const FString& ProgressText = PsiDisruptorProgressText.Get(Tenths, TEXT("PSI-DISRUPTOR BUILDING: %.1fs"), FHUDText::FromTenths(Tenths));
 		DrawText(ProgressText, FColor::Yellow, ProgressBarX + 10, ProgressBarY + 5, nullptr, 1.2f, false);
 		
 		// Draw warning
@@ -1504,55 +1632,21 @@ void ABlackholeHUD::DrawEnemyAbilityProgress()
 		
 		// Draw text
 		float TimeRemaining = MindmeldCastTime - MindmeldProgress;
-		FString ProgressText = FString::Printf(TEXT("MINDMELD CASTING: %.1fs"), TimeRemaining);
+		const int32 Tenths = FHUDText::ToTenths(TimeRemaining);
+		const FString& ProgressText = MindmeldProgressText.Get(Tenths, TEXT("MINDMELD CASTING: %.1fs"), FHUDText::FromTenths(Tenths));
 		DrawText(ProgressText, FColor::Magenta, ProgressBarX + 10, MindmeldY + 5, nullptr, 1.2f, false);
 		
 		// Draw warning
 		DrawText(TEXT("KILL THE MINDMELDER TO INTERRUPT!"), FColor::Red, 
 				ProgressBarX + 20, MindmeldY + ProgressBarHeight + 10, nullptr, 1.0f, false);
 		
-		// Draw location indicator if we have a valid caster
-		if (MindmeldCaster && IsValid(MindmeldCaster))
-		{
-			// Project caster location to screen
-			FVector CasterLocation = MindmeldCaster->GetActorLocation();
-			FVector2D ScreenLocation;
-			
-			if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-			{
-				if (PC->ProjectWorldLocationToScreen(CasterLocation, ScreenLocation))
-				{
-					// Draw direction indicator
-					float IndicatorSize = 30.0f;
-					FColor IndicatorColor = FColor::Magenta;
-					
-					// Draw circle at enemy position
-					DrawRect(IndicatorColor, ScreenLocation.X - IndicatorSize/2, ScreenLocation.Y - IndicatorSize/2, 
-							IndicatorSize, IndicatorSize);
-					
-					// Draw text above the indicator
-					DrawText(TEXT("MINDMELDER"), IndicatorColor, ScreenLocation.X - 40, ScreenLocation.Y - IndicatorSize - 20, 
-							nullptr, 1.0f, false);
-					
-					// Draw distance to enemy
-					if (PlayerCharacter)
-					{
-						float Distance = FVector::Dist(PlayerCharacter->GetActorLocation(), CasterLocation);
-						FString DistanceText = FString::Printf(TEXT("%.0fm"), Distance / 100.0f);
-						DrawText(DistanceText, FColor::White, ScreenLocation.X - 20, ScreenLocation.Y + IndicatorSize + 5,
-								nullptr, 0.9f, false);
-					}
-				}
-			}
-		}
-		
 		// Critical flash when near completion
 		if (Progress > 0.9f)
 		{
 			float Flash = FMath::Sin(GetWorld()->GetTimeSeconds() * 15.0f) * 0.5f + 0.5f;
 			FColor FlashColor = FColor(255, 0, (uint8)(255 * Flash), 255);
 			// Draw skull icon or death warning
-			FString DeathWarning = TEXT("!!! INSTANT DEATH IMMINENT !!!");
+			static const FString DeathWarning = TEXT("!!! INSTANT DEATH IMMINENT !!!");
 			DrawText(DeathWarning, FlashColor, ProgressBarX + 50, MindmeldY - 25, nullptr, 1.5f, false);
 		}
 	}
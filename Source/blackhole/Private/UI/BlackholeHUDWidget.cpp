@@ -0,0 +1,1032 @@
+#include "UI/BlackholeHUDWidget.h"
+#include "Debug/BlackholeStats.h"
+#include "Debug/BlackholeMemory.h"
+#include "Player/BlackholePlayerCharacter.h"
+#include "Systems/ThresholdManager.h"
+#include "Components/Abilities/AbilityComponent.h"
+#include "Components/Abilities/Player/Basic/SlashAbilityComponent.h"
+#include "Components/Abilities/Player/Basic/KillAbilityComponent.h"
+#include "Components/Abilities/Player/Hacker/GravityPullAbilityComponent.h"
+#include "Components/Abilities/Player/Hacker/PulseHackAbility.h"
+#include "Components/Abilities/Player/Hacker/FirewallBreachAbility.h"
+#include "Components/Abilities/Player/Hacker/DataSpikeAbility.h"
+#include "Components/Abilities/Player/Hacker/SystemOverrideAbility.h"
+#include "Components/Abilities/Player/Utility/HackerDashAbility.h"
+#include "Components/Abilities/Player/Utility/HackerJumpAbility.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/Border.h"
+#include "Components/VerticalBox.h"
+#include "Components/VerticalBoxSlot.h"
+#include "Components/HorizontalBox.h"
+#include "Components/HorizontalBoxSlot.h"
+#include "Components/UniformGridPanel.h"
+#include "Components/UniformGridSlot.h"
+#include "Components/Overlay.h"
+#include "Components/OverlaySlot.h"
+#include "Components/SizeBox.h"
+#include "Components/TextBlock.h"
+#include "Components/ProgressBar.h"
+#include "Components/InvalidationBox.h"
+#include "Components/RetainerBox.h"
+#include "Blueprint/WidgetTree.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+namespace
+{
+	const FLinearColor HUDGray(FColor(128, 128, 128));
+	const FLinearColor HUDBasicBlue(FColor(100, 100, 255));
+	const FLinearColor BoxDefaultColor(FColor(32, 32, 32));
+	const FLinearColor BoxDisabledColor(FColor(16, 16, 16));
+}
+
+UBlackholeHUDWidget* UBlackholeHUDWidget::CreateHUDWidget(APlayerController* PlayerController, ABlackholePlayerCharacter* InPlayer)
+{
+	if (!PlayerController || !InPlayer)
+	{
+		return nullptr;
+	}
+
+	BLACKHOLE_LLM_SCOPE(UI);
+
+	UBlackholeHUDWidget* Widget = CreateWidget<UBlackholeHUDWidget>(PlayerController, UBlackholeHUDWidget::StaticClass());
+	if (Widget)
+	{
+		Widget->Player = InPlayer;
+		Widget->BuildHUD();
+	}
+	return Widget;
+}
+
+void UBlackholeHUDWidget::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	SIZE_T Bytes = AbilityRows.GetAllocatedSize() + NotificationEntries.GetAllocatedSize();
+	for (const FNotificationEntry& Entry : NotificationEntries)
+	{
+		Bytes += Entry.Message.ToString().GetAllocatedSize();
+	}
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Bytes);
+}
+
+void UBlackholeHUDWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	BindDelegates();
+}
+
+void UBlackholeHUDWidget::NativeDestruct()
+{
+	UnbindDelegates();
+
+	Super::NativeDestruct();
+}
+
+void UBlackholeHUDWidget::BindDelegates()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (UGameInstance* GameInstance = World->GetGameInstance())
+	{
+		ResourceManager = GameInstance->GetSubsystem<UResourceManager>();
+	}
+	ThresholdManager = World->GetSubsystem<UThresholdManager>();
+
+	if (UResourceManager* ResMgr = ResourceManager.Get())
+	{
+		ResMgr->OnWillPowerChanged.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleWillPowerChanged);
+		ResMgr->OnWillPowerThresholdReached.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleWillPowerThresholdReached);
+
+		// Seed from current state - the delegates only report changes
+		WPThreshold = ResMgr->GetCurrentWPThreshold();
+		HandleWillPowerChanged(ResMgr->GetCurrentWillPower(), ResMgr->GetMaxWillPower());
+		RefreshWillPowerState();
+	}
+
+	if (UThresholdManager* ThresholdMgr = ThresholdManager.Get())
+	{
+		ThresholdMgr->OnUltimateModeActivated.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleUltimateModeActivated);
+		ThresholdMgr->OnCriticalTimer.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleCriticalTimer);
+		ThresholdMgr->OnCriticalTimerExpired.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleCriticalTimerExpired);
+		ThresholdMgr->OnAbilityDisabled.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleAbilityDisabled);
+		ThresholdMgr->OnCriticalStateEntryUsed.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleCriticalStateEntryUsed);
+		ThresholdMgr->OnCombatStarted.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleCombatStarted);
+		ThresholdMgr->OnCombatEnded.AddUniqueDynamic(this, &UBlackholeHUDWidget::HandleCombatEnded);
+
+		bUltimateModeActive = ThresholdMgr->IsUltimateModeActive();
+		RefreshCriticalEntries(ThresholdMgr->GetCriticalStateEntriesRemaining());
+		if (ThresholdMgr->IsCriticalTimerActive())
+		{
+			HandleCriticalTimer(ThresholdMgr->GetCriticalTimeRemaining());
+		}
+	}
+
+	if (UltimateBanner)
+	{
+		UltimateBanner->SetVisibility(bUltimateModeActive ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+	}
+
+	for (FAbilityRow& Row : AbilityRows)
+	{
+		RefreshAbilityRow(Row, true);
+	}
+	RefreshDebugPanel();
+}
+
+void UBlackholeHUDWidget::UnbindDelegates()
+{
+	if (UResourceManager* ResMgr = ResourceManager.Get())
+	{
+		ResMgr->OnWillPowerChanged.RemoveDynamic(this, &UBlackholeHUDWidget::HandleWillPowerChanged);
+		ResMgr->OnWillPowerThresholdReached.RemoveDynamic(this, &UBlackholeHUDWidget::HandleWillPowerThresholdReached);
+	}
+
+	if (UThresholdManager* ThresholdMgr = ThresholdManager.Get())
+	{
+		ThresholdMgr->OnUltimateModeActivated.RemoveDynamic(this, &UBlackholeHUDWidget::HandleUltimateModeActivated);
+		ThresholdMgr->OnCriticalTimer.RemoveDynamic(this, &UBlackholeHUDWidget::HandleCriticalTimer);
+		ThresholdMgr->OnCriticalTimerExpired.RemoveDynamic(this, &UBlackholeHUDWidget::HandleCriticalTimerExpired);
+		ThresholdMgr->OnAbilityDisabled.RemoveDynamic(this, &UBlackholeHUDWidget::HandleAbilityDisabled);
+		ThresholdMgr->OnCriticalStateEntryUsed.RemoveDynamic(this, &UBlackholeHUDWidget::HandleCriticalStateEntryUsed);
+		ThresholdMgr->OnCombatStarted.RemoveDynamic(this, &UBlackholeHUDWidget::HandleCombatStarted);
+		ThresholdMgr->OnCombatEnded.RemoveDynamic(this, &UBlackholeHUDWidget::HandleCombatEnded);
+	}
+
+	ResourceManager = nullptr;
+	ThresholdManager = nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+UTextBlock* UBlackholeHUDWidget::MakeText(const FString& Text, const FLinearColor& Color, int32 FontSize)
+{
+	UTextBlock* TextBlock = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
+	TextBlock->SetText(FText::FromString(Text));
+	TextBlock->SetColorAndOpacity(FSlateColor(Color));
+	FSlateFontInfo Font = TextBlock->GetFont();
+	Font.Size = FontSize;
+	TextBlock->SetFont(Font);
+	return TextBlock;
+}
+
+void UBlackholeHUDWidget::BuildHUD()
+{
+	if (!WidgetTree)
+	{
+		return;
+	}
+
+	UCanvasPanel* Root = BuildRoot();
+
+	BuildWillPowerPanel(Root);
+	BuildAbilityGrid(Root);
+	BuildCriticalPanel(Root);
+	BuildNotificationStack(Root);
+	BuildDebugPanel(Root);
+
+	// The whole HUD is cached; only widgets whose values change get invalidated
+	UInvalidationBox* InvalidationRoot = WidgetTree->ConstructWidget<UInvalidationBox>(UInvalidationBox::StaticClass());
+	InvalidationRoot->SetCanCache(true);
+	InvalidationRoot->SetContent(Root);
+
+	WidgetTree->RootWidget = InvalidationRoot;
+
+	// Purely visual - never take mouse input away from the game
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+UCanvasPanel* UBlackholeHUDWidget::BuildRoot()
+{
+	UCanvasPanel* Root = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass());
+
+	// Crosshair
+	const float CrosshairSize = 20.0f;
+	const float CrosshairThickness = 2.0f;
+	for (int32 i = 0; i < 2; i++)
+	{
+		UBorder* Line = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass());
+		Line->SetBrushColor(FLinearColor::White);
+		UCanvasPanelSlot* LineSlot = Root->AddChildToCanvas(Line);
+		LineSlot->SetAnchors(FAnchors(0.5f));
+		LineSlot->SetAlignment(FVector2D(0.5f, 0.5f));
+		LineSlot->SetSize(i == 0 ? FVector2D(CrosshairSize, CrosshairThickness) : FVector2D(CrosshairThickness, CrosshairSize));
+	}
+
+	// Critical screen-edge flash (top, bottom, left, right)
+	const FAnchors EdgeAnchors[4] = { FAnchors(0, 0, 1, 0), FAnchors(0, 1, 1, 1), FAnchors(0, 0, 0, 1), FAnchors(1, 0, 1, 1) };
+	const FMargin EdgeOffsets[4] = { FMargin(0, 0, 0, 10), FMargin(0, -10, 0, 10), FMargin(0, 0, 10, 0), FMargin(-10, 0, 10, 0) };
+	for (int32 i = 0; i < 4; i++)
+	{
+		UBorder* Edge = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass());
+		Edge->SetBrushColor(FLinearColor(1.0f, 0.0f, 0.0f, 0.4f));
+		Edge->SetVisibility(ESlateVisibility::Collapsed);
+		UCanvasPanelSlot* EdgeSlot = Root->AddChildToCanvas(Edge);
+		EdgeSlot->SetAnchors(EdgeAnchors[i]);
+		EdgeSlot->SetOffsets(EdgeOffsets[i]);
+		ScreenFlashEdges[i] = Edge;
+	}
+
+	// Ultimate mode banner
+	UltimateBanner = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+	UltimateBanner->AddChildToVerticalBox(MakeText(TEXT("ULTIMATE MODE ACTIVE"), FLinearColor::Red, 24));
+	UltimateBanner->AddChildToVerticalBox(MakeText(TEXT("Use an ability to sacrifice it!"), FLinearColor::White));
+	UltimateBanner->SetVisibility(ESlateVisibility::Collapsed);
+	UCanvasPanelSlot* BannerSlot = Root->AddChildToCanvas(UltimateBanner);
+	BannerSlot->SetAnchors(FAnchors(0.5f, 0.0f));
+	BannerSlot->SetAlignment(FVector2D(0.5f, 0.0f));
+	BannerSlot->SetPosition(FVector2D(0.0f, 150.0f));
+	BannerSlot->SetAutoSize(true);
+
+	return Root;
+}
+
+void UBlackholeHUDWidget::BuildWillPowerPanel(UCanvasPanel* Root)
+{
+	UVerticalBox* Panel = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+
+	// State label sits above the bar
+	WPStateText = MakeText(TEXT(""), FLinearColor::White, 10);
+	UVerticalBoxSlot* StateSlot = Panel->AddChildToVerticalBox(WPStateText);
+	StateSlot->SetPadding(FMargin(180.0f, 0.0f, 0.0f, 0.0f));
+
+	UHorizontalBox* BarRow = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass());
+	UHorizontalBoxSlot* LabelSlot = BarRow->AddChildToHorizontalBox(MakeText(TEXT("Will Power"), FLinearColor::Green));
+	LabelSlot->SetPadding(FMargin(0.0f, 0.0f, 20.0f, 0.0f));
+	LabelSlot->SetVerticalAlignment(VAlign_Center);
+
+	// Bar with the 50% buff threshold marker on top
+	UOverlay* BarOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass());
+	WPBar = WidgetTree->ConstructWidget<UProgressBar>(UProgressBar::StaticClass());
+	WPBar->SetFillColorAndOpacity(FLinearColor::Green);
+	BarOverlay->AddChildToOverlay(WPBar);
+
+	USizeBox* MarkerSize = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass());
+	MarkerSize->SetWidthOverride(2.0f);
+	UBorder* Marker = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass());
+	Marker->SetBrushColor(FLinearColor::Yellow);
+	MarkerSize->AddChild(Marker);
+	UOverlaySlot* MarkerSlot = BarOverlay->AddChildToOverlay(MarkerSize);
+	MarkerSlot->SetHorizontalAlignment(HAlign_Center);
+	MarkerSlot->SetVerticalAlignment(VAlign_Fill);
+
+	USizeBox* BarSize = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass());
+	BarSize->SetWidthOverride(200.0f);
+	BarSize->SetHeightOverride(20.0f);
+	BarSize->AddChild(BarOverlay);
+	BarRow->AddChildToHorizontalBox(BarSize);
+
+	WPValueText = MakeText(TEXT(""), FLinearColor::White);
+	UHorizontalBoxSlot* ValueSlot = BarRow->AddChildToHorizontalBox(WPValueText);
+	ValueSlot->SetPadding(FMargin(10.0f, 0.0f, 0.0f, 0.0f));
+	ValueSlot->SetVerticalAlignment(VAlign_Center);
+
+	Panel->AddChildToVerticalBox(BarRow);
+
+	// Path is always Hacker now
+	UVerticalBoxSlot* PathSlot = Panel->AddChildToVerticalBox(MakeText(TEXT("Path: Hacker"), FLinearColor(FColor::Cyan)));
+	PathSlot->SetPadding(FMargin(0.0f, 10.0f, 0.0f, 0.0f));
+
+	CriticalEntriesText = MakeText(TEXT(""), FLinearColor::White);
+	UVerticalBoxSlot* EntriesSlot = Panel->AddChildToVerticalBox(CriticalEntriesText);
+	EntriesSlot->SetPadding(FMargin(0.0f, 10.0f, 0.0f, 0.0f));
+
+	UCanvasPanelSlot* PanelSlot = Root->AddChildToCanvas(Panel);
+	PanelSlot->SetPosition(FVector2D(50.0f, 35.0f));
+	PanelSlot->SetAutoSize(true);
+}
+
+void UBlackholeHUDWidget::AddAbilityRow(UAbilityComponent* Ability, const TCHAR* Name, const TCHAR* UltimateName, const TCHAR* Input, bool bIsJump)
+{
+	if (!Ability)
+	{
+		return;
+	}
+
+	FAbilityRow& Row = AbilityRows.AddDefaulted_GetRef();
+	Row.Ability = Ability;
+	Row.Name = Name;
+	Row.UltimateName = UltimateName ? UltimateName : Name;
+	Row.Input = Input;
+	Row.bIsJump = bIsJump;
+}
+
+void UBlackholeHUDWidget::BuildAbilityGrid(UCanvasPanel* Root)
+{
+	ABlackholePlayerCharacter* PlayerCharacter = Player.Get();
+	if (!PlayerCharacter)
+	{
+		return;
+	}
+
+	// Same order and labels as the immediate-mode HUD - built once, not per refresh
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<USlashAbilityComponent>(), TEXT("Slash"), nullptr, TEXT("LMB"));
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<UKillAbilityComponent>(), TEXT("Kill (Debug)"), nullptr, TEXT("K"));
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<UFirewallBreachAbility>(), TEXT("Firewall Breach"), TEXT("TOTAL SYSTEM COMPROMISE"), TEXT("RMB"));
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<UPulseHackAbility>(), TEXT("Pulse Hack"), TEXT("SYSTEM OVERLOAD"), TEXT("Q"));
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<UGravityPullAbilityComponent>(), TEXT("Gravity Pull"), TEXT("SINGULARITY"), TEXT("E"));
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<UHackerDashAbility>(), TEXT("Hacker Dash"), nullptr, TEXT("Shift"));
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<UHackerJumpAbility>(), TEXT("Hacker Jump"), nullptr, TEXT("Space"), true);
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<UDataSpikeAbility>(), TEXT("Data Spike"), TEXT("SYSTEM CORRUPTION"), TEXT("R"));
+	AddAbilityRow(PlayerCharacter->FindComponentByClass<USystemOverrideAbility>(), TEXT("System Override"), TEXT("TOTAL SYSTEM SHUTDOWN"), TEXT("F"));
+
+	UUniformGridPanel* Grid = WidgetTree->ConstructWidget<UUniformGridPanel>(UUniformGridPanel::StaticClass());
+	Grid->SetSlotPadding(FMargin(5.0f));
+
+	for (int32 i = 0; i < AbilityRows.Num(); i++)
+	{
+		FAbilityRow& Row = AbilityRows[i];
+
+		UVerticalBox* Content = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+
+		UHorizontalBox* Header = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass());
+		Row.NameText = MakeText(Row.Name, FLinearColor::White, 10);
+		Header->AddChildToHorizontalBox(Row.NameText);
+		if (Row.Ability->IsBasicAbility())
+		{
+			UHorizontalBoxSlot* BasicSlot = Header->AddChildToHorizontalBox(MakeText(TEXT("[Basic]"), HUDBasicBlue, 9));
+			BasicSlot->SetPadding(FMargin(6.0f, 0.0f, 0.0f, 0.0f));
+		}
+		Content->AddChildToVerticalBox(Header);
+
+		Row.InputText = MakeText(FString::Printf(TEXT("[%s]"), Row.Input), FLinearColor::Green, 10);
+		Content->AddChildToVerticalBox(Row.InputText);
+
+		USizeBox* BarSize = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass());
+		BarSize->SetHeightOverride(5.0f);
+		Row.CooldownBar = WidgetTree->ConstructWidget<UProgressBar>(UProgressBar::StaticClass());
+		Row.CooldownBar->SetFillColorAndOpacity(FLinearColor::Red);
+		Row.CooldownBar->SetVisibility(ESlateVisibility::Hidden);
+		BarSize->AddChild(Row.CooldownBar);
+		UVerticalBoxSlot* BarSlot = Content->AddChildToVerticalBox(BarSize);
+		BarSlot->SetPadding(FMargin(0.0f, 8.0f, 0.0f, 2.0f));
+
+		Row.StatusText = MakeText(TEXT(""), FLinearColor::Green, 10);
+		Content->AddChildToVerticalBox(Row.StatusText);
+
+		Row.Box = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass());
+		Row.Box->SetBrushColor(BoxDefaultColor);
+		Row.Box->SetPadding(FMargin(5.0f));
+		Row.Box->SetContent(Content);
+
+		USizeBox* BoxSize = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass());
+		BoxSize->SetWidthOverride(120.0f);
+		BoxSize->SetHeightOverride(80.0f);
+		BoxSize->AddChild(Row.Box);
+
+		Grid->AddChildToUniformGrid(BoxSize, i / AbilityColumns, i % AbilityColumns);
+	}
+
+	UCanvasPanelSlot* GridSlot = Root->AddChildToCanvas(Grid);
+	GridSlot->SetAnchors(FAnchors(0.0f, 1.0f));
+	GridSlot->SetAlignment(FVector2D(0.0f, 0.0f));
+	GridSlot->SetPosition(FVector2D(50.0f, -200.0f));
+	GridSlot->SetAutoSize(true);
+}
+
+void UBlackholeHUDWidget::BuildCriticalPanel(UCanvasPanel* Root)
+{
+	CriticalPanel = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+
+	CriticalTitleText = MakeText(TEXT("CRITICAL ERROR"), FLinearColor(FColor::Orange), 28);
+	CriticalPanel->AddChildToVerticalBox(CriticalTitleText)->SetHorizontalAlignment(HAlign_Center);
+
+	CriticalTimerText = MakeText(TEXT(""), FLinearColor::Yellow, 20);
+	CriticalPanel->AddChildToVerticalBox(CriticalTimerText)->SetHorizontalAlignment(HAlign_Center);
+
+	CriticalPanel->AddChildToVerticalBox(MakeText(TEXT("USE ANY ULTIMATE ABILITY OR DIE!"), FLinearColor::White))->SetHorizontalAlignment(HAlign_Center);
+
+	CriticalPanelEntriesText = MakeText(TEXT(""), FLinearColor::Yellow, 14);
+	CriticalPanel->AddChildToVerticalBox(CriticalPanelEntriesText)->SetHorizontalAlignment(HAlign_Center);
+
+	LastChanceText = MakeText(TEXT("LAST CHANCE - NO MORE RETRIES!"), FLinearColor::Red);
+	LastChanceText->SetVisibility(ESlateVisibility::Collapsed);
+	CriticalPanel->AddChildToVerticalBox(LastChanceText)->SetHorizontalAlignment(HAlign_Center);
+
+	CriticalPanel->SetVisibility(ESlateVisibility::Collapsed);
+
+	UCanvasPanelSlot* PanelSlot = Root->AddChildToCanvas(CriticalPanel);
+	PanelSlot->SetAnchors(FAnchors(0.5f, 0.3f));
+	PanelSlot->SetAlignment(FVector2D(0.5f, 0.5f));
+	PanelSlot->SetAutoSize(true);
+}
+
+void UBlackholeHUDWidget::BuildNotificationStack(UCanvasPanel* Root)
+{
+	UVerticalBox* Stack = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+
+	for (int32 i = 0; i < MaxNotifications; i++)
+	{
+		UBorder* Background = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass());
+		Background->SetBrushColor(FLinearColor(0.0f, 0.0f, 0.0f, 0.6f));
+		Background->SetPadding(FMargin(10.0f, 4.0f));
+
+		UTextBlock* Text = MakeText(TEXT(""), FLinearColor::White, 14);
+		Background->SetContent(Text);
+		Background->SetVisibility(ESlateVisibility::Collapsed);
+
+		UVerticalBoxSlot* NotificationSlot = Stack->AddChildToVerticalBox(Background);
+		NotificationSlot->SetPadding(FMargin(0.0f, 0.0f, 0.0f, 5.0f));
+
+		NotificationSlots[i] = Background;
+		NotificationTexts[i] = Text;
+	}
+
+	UCanvasPanelSlot* StackSlot = Root->AddChildToCanvas(Stack);
+	StackSlot->SetAnchors(FAnchors(0.5f, 0.2f));
+	StackSlot->SetAlignment(FVector2D(0.5f, 0.0f));
+	StackSlot->SetAutoSize(true);
+}
+
+void UBlackholeHUDWidget::BuildDebugPanel(UCanvasPanel* Root)
+{
+	UVerticalBox* Panel = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass());
+
+	Panel->AddChildToVerticalBox(MakeText(TEXT("=== ABILITY STATUS ==="), FLinearColor::Yellow));
+
+	DebugUltimateText = MakeText(TEXT(""), FLinearColor::White, 10);
+	Panel->AddChildToVerticalBox(DebugUltimateText)->SetPadding(FMargin(0.0f, 6.0f, 0.0f, 0.0f));
+
+	DebugCombatText = MakeText(TEXT(""), HUDGray, 10);
+	Panel->AddChildToVerticalBox(DebugCombatText);
+
+	DebugDisabledText = MakeText(TEXT(""), FLinearColor::Red, 10);
+	Panel->AddChildToVerticalBox(DebugDisabledText);
+
+	Panel->AddChildToVerticalBox(MakeText(TEXT("Abilities:"), FLinearColor(FColor::Cyan), 10))->SetPadding(FMargin(0.0f, 8.0f, 0.0f, 0.0f));
+	for (FAbilityRow& Row : AbilityRows)
+	{
+		Row.DebugLine = MakeText(TEXT(""), FLinearColor::White, 10);
+		Panel->AddChildToVerticalBox(Row.DebugLine)->SetPadding(FMargin(10.0f, 0.0f, 0.0f, 0.0f));
+	}
+
+	DebugWPText = MakeText(TEXT(""), FLinearColor::Blue, 10);
+	Panel->AddChildToVerticalBox(DebugWPText)->SetPadding(FMargin(0.0f, 18.0f, 0.0f, 0.0f));
+
+	DebugWPStateText = MakeText(TEXT(""), FLinearColor(FColor::Cyan), 10);
+	Panel->AddChildToVerticalBox(DebugWPStateText);
+
+	// Rarely changes - render into a retained target and only repaint every 4th frame
+	URetainerBox* Retainer = WidgetTree->ConstructWidget<URetainerBox>(URetainerBox::StaticClass());
+	Retainer->SetRenderingPhase(0, 4);
+	Retainer->AddChild(Panel);
+
+	UCanvasPanelSlot* PanelSlot = Root->AddChildToCanvas(Retainer);
+	PanelSlot->SetAnchors(FAnchors(1.0f, 0.0f));
+	PanelSlot->SetPosition(FVector2D(-400.0f, 250.0f));
+	PanelSlot->SetAutoSize(true);
+}
+
+// ---------------------------------------------------------------------------
+// Delegate handlers
+// ---------------------------------------------------------------------------
+
+void UBlackholeHUDWidget::HandleWillPowerChanged(float NewValue, float MaxValue)
+{
+	const int32 NewWP = FMath::RoundToInt(NewValue);
+	const int32 NewMaxWP = FMath::RoundToInt(MaxValue);
+
+	if (WPBar)
+	{
+		WPBar->SetPercent(MaxValue > 0.0f ? NewValue / MaxValue : 0.0f);
+	}
+
+	if (WPValueText && (NewWP != ShownWP || NewMaxWP != ShownMaxWP))
+	{
+		ShownWP = NewWP;
+		ShownMaxWP = NewMaxWP;
+		WPValueText->SetText(FText::FromString(FString::Printf(TEXT("%d/%d"), NewWP, NewMaxWP)));
+	}
+
+	const int32 NewPercent = MaxValue > 0.0f ? (int32)(NewValue / MaxValue * 100.0f) : 0;
+	if (DebugWPText && NewPercent != ShownWPPercent)
+	{
+		ShownWPPercent = NewPercent;
+		DebugWPText->SetText(FText::FromString(FString::Printf(TEXT("WP: %d%%"), NewPercent)));
+
+		// The 0% line only depends on the percent, not on a threshold crossing
+		RefreshWillPowerState();
+	}
+}
+
+void UBlackholeHUDWidget::HandleWillPowerThresholdReached(EResourceThreshold Threshold)
+{
+	WPThreshold = Threshold;
+	RefreshWillPowerState();
+	RefreshDebugPanel();
+}
+
+void UBlackholeHUDWidget::HandleUltimateModeActivated(bool bIsActive)
+{
+	bUltimateModeActive = bIsActive;
+
+	if (UltimateBanner)
+	{
+		UltimateBanner->SetVisibility(bIsActive ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+	}
+
+	for (FAbilityRow& Row : AbilityRows)
+	{
+		RefreshAbilityRow(Row, true);
+	}
+	RefreshDebugPanel();
+}
+
+void UBlackholeHUDWidget::HandleCriticalTimer(float TimeRemaining)
+{
+	if (TimeRemaining <= 0.0f)
+	{
+		HandleCriticalTimerExpired();
+		return;
+	}
+
+	if (!bCriticalTimerActive)
+	{
+		bCriticalTimerActive = true;
+		if (CriticalPanel)
+		{
+			CriticalPanel->SetVisibility(ESlateVisibility::HitTestInvisible);
+		}
+	}
+
+	// Displayed with one decimal - skip updates that wouldn't change the text
+	const int32 Tenths = FMath::CeilToInt(TimeRemaining * 10.0f);
+	if (CriticalTimerText && Tenths != ShownCriticalTenths)
+	{
+		ShownCriticalTenths = Tenths;
+		CriticalTimerText->SetText(FText::FromString(FString::Printf(TEXT("USE ULTIMATE IN: %.1f"), Tenths / 10.0f)));
+		CriticalTimerText->SetColorAndOpacity(FSlateColor(TimeRemaining <= 2.0f ? FLinearColor::Red : FLinearColor::Yellow));
+	}
+}
+
+void UBlackholeHUDWidget::HandleCriticalTimerExpired()
+{
+	bCriticalTimerActive = false;
+	ShownCriticalTenths = INDEX_NONE;
+
+	if (CriticalPanel)
+	{
+		CriticalPanel->SetVisibility(ESlateVisibility::Collapsed);
+	}
+
+	if (bScreenFlashVisible)
+	{
+		bScreenFlashVisible = false;
+		for (UBorder* Edge : ScreenFlashEdges)
+		{
+			if (Edge)
+			{
+				Edge->SetVisibility(ESlateVisibility::Collapsed);
+			}
+		}
+	}
+}
+
+void UBlackholeHUDWidget::HandleAbilityDisabled(UAbilityComponent* Ability, int32 TotalDisabled)
+{
+	for (FAbilityRow& Row : AbilityRows)
+	{
+		if (Row.Ability.Get() == Ability)
+		{
+			RefreshAbilityRow(Row, true);
+			break;
+		}
+	}
+	RefreshDebugPanel();
+}
+
+void UBlackholeHUDWidget::HandleCriticalStateEntryUsed(int32 EntriesUsed, int32 EntriesRemaining)
+{
+	RefreshCriticalEntries(EntriesRemaining);
+}
+
+void UBlackholeHUDWidget::HandleCombatStarted()
+{
+	RefreshDebugPanel();
+}
+
+void UBlackholeHUDWidget::HandleCombatEnded()
+{
+	RefreshDebugPanel();
+}
+
+// ---------------------------------------------------------------------------
+// Refresh
+// ---------------------------------------------------------------------------
+
+void UBlackholeHUDWidget::RefreshWillPowerState()
+{
+	FLinearColor BarColor = FLinearColor::Green;
+	const TCHAR* StateLabel = TEXT("");
+	FLinearColor StateColor = FLinearColor(FColor::Cyan);
+
+	switch (WPThreshold)
+	{
+	case EResourceThreshold::Critical:
+		BarColor = FLinearColor::Red;
+		StateLabel = TEXT("LOW ENERGY");
+		StateColor = FLinearColor::Red;
+		break;
+	case EResourceThreshold::Warning:
+		BarColor = FLinearColor::Yellow;
+		break;
+	default:
+		StateLabel = TEXT("BUFFED");
+		break;
+	}
+
+	if (WPBar)
+	{
+		WPBar->SetFillColorAndOpacity(BarColor);
+	}
+
+	if (WPStateText)
+	{
+		WPStateText->SetText(FText::FromString(StateLabel));
+		WPStateText->SetColorAndOpacity(FSlateColor(StateColor));
+	}
+
+	if (DebugWPStateText)
+	{
+		if (ShownWPPercent <= 0)
+		{
+			DebugWPStateText->SetText(FText::FromString(TEXT("ULTIMATE MODE ACTIVE!")));
+			DebugWPStateText->SetColorAndOpacity(FSlateColor(FLinearColor(FColor::Cyan)));
+		}
+		else if (WPThreshold == EResourceThreshold::Critical)
+		{
+			DebugWPStateText->SetText(FText::FromString(TEXT("LOW ENERGY - USE COMBOS!")));
+			DebugWPStateText->SetColorAndOpacity(FSlateColor(FLinearColor::Red));
+		}
+		else if (WPThreshold == EResourceThreshold::Normal)
+		{
+			DebugWPStateText->SetText(FText::FromString(TEXT("ABILITIES BUFFED")));
+			DebugWPStateText->SetColorAndOpacity(FSlateColor(FLinearColor(FColor::Cyan)));
+		}
+		else
+		{
+			DebugWPStateText->SetText(FText::GetEmpty());
+		}
+	}
+}
+
+void UBlackholeHUDWidget::RefreshCriticalEntries(int32 EntriesRemaining)
+{
+	const int32 TotalEntries = ThresholdManager.IsValid() ? ThresholdManager->GetCriticalStateLimit() : EntriesRemaining;
+
+	FLinearColor EntryColor = EntriesRemaining > 0 ? FLinearColor::White : FLinearColor::Red;
+	if (EntriesRemaining == 1)
+	{
+		EntryColor = FLinearColor::Yellow; // Warning color for last entry
+	}
+
+	if (CriticalEntriesText)
+	{
+		CriticalEntriesText->SetText(FText::FromString(FString::Printf(TEXT("Critical Entries: %d/%d"), EntriesRemaining, TotalEntries)));
+		CriticalEntriesText->SetColorAndOpacity(FSlateColor(EntryColor));
+	}
+
+	if (CriticalPanelEntriesText)
+	{
+		CriticalPanelEntriesText->SetText(FText::FromString(FString::Printf(TEXT("Critical Entries Remaining: %d"), EntriesRemaining)));
+		CriticalPanelEntriesText->SetColorAndOpacity(FSlateColor(EntriesRemaining > 0 ? FLinearColor::Yellow : FLinearColor::Red));
+	}
+
+	if (LastChanceText)
+	{
+		LastChanceText->SetVisibility(EntriesRemaining == 0 ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+	}
+}
+
+void UBlackholeHUDWidget::RefreshAbilityRow(FAbilityRow& Row, bool bForce)
+{
+	UAbilityComponent* Ability = Row.Ability.Get();
+	if (!Ability || !Row.Box)
+	{
+		return;
+	}
+
+	const bool bDisabled = ThresholdManager.IsValid() ? ThresholdManager->IsAbilityDisabled(Ability) : Ability->IsDisabled();
+
+	// Work out what the row should show
+	EAbilityRowState NewState = EAbilityRowState::Ready;
+	float Remaining = 0.0f;
+	float Duration = 0.0f;
+
+	if (bDisabled)
+	{
+		NewState = EAbilityRowState::Disabled;
+	}
+	else if (Ability->IsInUltimateMode())
+	{
+		NewState = EAbilityRowState::Ultimate;
+	}
+	else if (Row.bIsJump)
+	{
+		// HackerJump shows its air-jump cooldown rather than the ability cooldown
+		UHackerJumpAbility* HackerJump = static_cast<UHackerJumpAbility*>(Ability);
+		if (HackerJump->GetCurrentJumpCount() > 0 && HackerJump->GetCurrentJumpCount() < HackerJump->GetMaxJumpCount())
+		{
+			Duration = HackerJump->GetJumpCooldown();
+			Remaining = FMath::Max(0.0f, Duration - HackerJump->GetTimeSinceLastJump());
+		}
+		NewState = Remaining > 0.0f ? EAbilityRowState::Cooldown : EAbilityRowState::Ready;
+	}
+	else
+	{
+		Remaining = Ability->GetCooldownRemaining();
+		NewState = Remaining > 0.0f ? EAbilityRowState::Cooldown : EAbilityRowState::Ready;
+	}
+
+	const int32 Tenths = NewState == EAbilityRowState::Cooldown ? FMath::CeilToInt(Remaining * 10.0f) : INDEX_NONE;
+	const bool bStateChanged = bForce || NewState != Row.State;
+
+	if (bStateChanged)
+	{
+		Row.State = NewState;
+
+		FLinearColor BoxColor = BoxDefaultColor;
+		FLinearColor NameColor = FLinearColor::White;
+		bool bUltimateName = false;
+
+		switch (NewState)
+		{
+		case EAbilityRowState::Disabled:
+			BoxColor = BoxDisabledColor;
+			NameColor = HUDGray;
+			Row.StatusText->SetText(FText::FromString(TEXT("DISABLED")));
+			Row.StatusText->SetColorAndOpacity(FSlateColor(FLinearColor::Red));
+			break;
+		case EAbilityRowState::Ultimate:
+			NameColor = FLinearColor::Yellow;
+			bUltimateName = true;
+			Row.StatusText->SetText(FText::FromString(TEXT("ULTIMATE!")));
+			Row.StatusText->SetColorAndOpacity(FSlateColor(FLinearColor::Yellow));
+			break;
+		case EAbilityRowState::Cooldown:
+			Row.StatusText->SetColorAndOpacity(FSlateColor(Row.bIsJump ? FLinearColor(FColor::Orange) : FLinearColor::Red));
+			break;
+		default:
+			Row.StatusText->SetText(FText::FromString(TEXT("Ready")));
+			Row.StatusText->SetColorAndOpacity(FSlateColor(FLinearColor::Green));
+			break;
+		}
+
+		Row.Box->SetBrushColor(BoxColor);
+		Row.NameText->SetColorAndOpacity(FSlateColor(NameColor));
+		Row.InputText->SetColorAndOpacity(FSlateColor(NewState == EAbilityRowState::Disabled ? HUDGray : FLinearColor::Green));
+		Row.CooldownBar->SetVisibility(NewState == EAbilityRowState::Cooldown ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Hidden);
+
+		if (bUltimateName != Row.bShowingUltimateName || bForce)
+		{
+			Row.bShowingUltimateName = bUltimateName;
+			Row.NameText->SetText(FText::FromString(bUltimateName ? Row.UltimateName : Row.Name));
+		}
+
+		Row.CooldownTenths = INDEX_NONE;
+	}
+
+	// Cooldown text/bar only change when the displayed tenth changes
+	if (NewState == EAbilityRowState::Cooldown && Tenths != Row.CooldownTenths)
+	{
+		Row.CooldownTenths = Tenths;
+
+		if (Duration <= 0.0f)
+		{
+			// The cooldown as started, so reductions applied at the time keep the bar full on the first frame
+			Duration = FMath::Max(Ability->GetCooldownDuration(), KINDA_SMALL_NUMBER);
+		}
+		Row.CooldownBar->SetPercent(FMath::Clamp(Remaining / Duration, 0.0f, 1.0f));
+		Row.CooldownBar->SetFillColorAndOpacity(Row.bIsJump ? FLinearColor(FColor::Orange) : FLinearColor::Red);
+
+		const FString CooldownString = Row.bIsJump
+			? FString::Printf(TEXT("Jump CD: %.1fs"), Tenths / 10.0f)
+			: FString::Printf(TEXT("%.1fs"), Tenths / 10.0f);
+		Row.StatusText->SetText(FText::FromString(CooldownString));
+	}
+}
+
+void UBlackholeHUDWidget::RefreshDebugPanel()
+{
+	UThresholdManager* ThresholdMgr = ThresholdManager.Get();
+
+	if (DebugUltimateText)
+	{
+		DebugUltimateText->SetText(FText::FromString(bUltimateModeActive ? TEXT("Ultimate Mode: ACTIVE") : TEXT("Ultimate Mode: INACTIVE")));
+		DebugUltimateText->SetColorAndOpacity(FSlateColor(bUltimateModeActive ? FLinearColor::Red : FLinearColor::White));
+	}
+
+	if (ThresholdMgr)
+	{
+		const bool bInCombat = ThresholdMgr->IsInCombat();
+		DebugCombatText->SetText(FText::FromString(bInCombat ? TEXT("Combat: IN COMBAT") : TEXT("Combat: NOT IN COMBAT")));
+		DebugCombatText->SetColorAndOpacity(FSlateColor(bInCombat ? FLinearColor(FColor::Orange) : HUDGray));
+
+		DebugDisabledText->SetText(FText::FromString(FString::Printf(TEXT("Disabled Abilities: %d"), ThresholdMgr->GetDisabledAbilityCount())));
+	}
+
+	for (FAbilityRow& Row : AbilityRows)
+	{
+		UAbilityComponent* Ability = Row.Ability.Get();
+		if (!Ability || !Row.DebugLine)
+		{
+			continue;
+		}
+
+		const TCHAR* Status = TEXT("NORMAL");
+		FLinearColor StatusColor = FLinearColor::Green;
+
+		if (Row.State == EAbilityRowState::Disabled)
+		{
+			Status = TEXT("DISABLED");
+			StatusColor = FLinearColor::Red;
+		}
+		else if (Row.State == EAbilityRowState::Ultimate)
+		{
+			Status = TEXT("ULTIMATE");
+			StatusColor = FLinearColor::Yellow;
+		}
+		else if (Ability->IsBasicAbility())
+		{
+			Status = TEXT("BASIC");
+			StatusColor = HUDBasicBlue;
+		}
+		else if (WPThreshold == EResourceThreshold::Normal)
+		{
+			// Abilities are buffed in the 50-100% WP band
+			Status = TEXT("BUFFED");
+			StatusColor = FLinearColor(FColor::Cyan);
+		}
+
+		Row.DebugLine->SetText(FText::FromString(FString::Printf(TEXT("[%s] %s - %s"), Row.Input, Row.bShowingUltimateName ? Row.UltimateName : Row.Name, Status)));
+		Row.DebugLine->SetColorAndOpacity(FSlateColor(StatusColor));
+	}
+}
+
+void UBlackholeHUDWidget::RefreshNotifications()
+{
+	for (int32 i = 0; i < MaxNotifications; i++)
+	{
+		if (!NotificationSlots[i])
+		{
+			continue;
+		}
+
+		if (NotificationEntries.IsValidIndex(i))
+		{
+			const FNotificationEntry& Entry = NotificationEntries[i];
+			NotificationTexts[i]->SetText(Entry.Message);
+			NotificationTexts[i]->SetColorAndOpacity(FSlateColor(Entry.Color));
+			NotificationSlots[i]->SetRenderOpacity(FMath::Min(1.0f, Entry.TimeRemaining));
+			NotificationSlots[i]->SetVisibility(ESlateVisibility::HitTestInvisible);
+		}
+		else
+		{
+			NotificationSlots[i]->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	}
+}
+
+void UBlackholeHUDWidget::AddNotification(const FString& Message, const FColor& Color, float Duration)
+{
+	BLACKHOLE_LLM_SCOPE(UI);
+
+	FNotificationEntry& Entry = NotificationEntries.AddDefaulted_GetRef();
+	Entry.Message = FText::FromString(Message);
+	Entry.Color = FLinearColor(Color);
+	Entry.TimeRemaining = Duration;
+
+	// Limit the number of notifications to prevent spam
+	if (NotificationEntries.Num() > MaxNotifications)
+	{
+		NotificationEntries.RemoveAt(0);
+	}
+
+	RefreshNotifications();
+}
+
+// ---------------------------------------------------------------------------
+// Tick - only animating elements do work here
+// ---------------------------------------------------------------------------
+
+void UBlackholeHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	BLACKHOLE_SCOPE_CYCLE_COUNTER("HUD Widget Tick", STAT_Blackhole_HUDWidgetTick, BlackholeUIChannel);
+
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	TickAbilityCooldowns();
+
+	if (bUltimateModeActive)
+	{
+		TickUltimatePulse();
+	}
+
+	if (bCriticalTimerActive)
+	{
+		TickCriticalFlash();
+	}
+
+	if (NotificationEntries.Num() > 0)
+	{
+		TickNotifications(InDeltaTime);
+	}
+}
+
+void UBlackholeHUDWidget::TickAbilityCooldowns()
+{
+	// Cooldowns are timestamps; reading them is cheap and widgets are only touched on change
+	for (FAbilityRow& Row : AbilityRows)
+	{
+		if (Row.State != EAbilityRowState::Disabled)
+		{
+			RefreshAbilityRow(Row);
+		}
+	}
+}
+
+void UBlackholeHUDWidget::TickUltimatePulse()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float Pulse = FMath::Sin(World->GetTimeSeconds() * 3.0f) * 0.5f + 0.5f;
+	const FLinearColor PulseColor(FColor(
+		(uint8)FMath::Lerp(128, 255, Pulse),
+		(uint8)FMath::Lerp(0, 128, Pulse),
+		(uint8)FMath::Lerp(0, 128, Pulse)));
+
+	for (FAbilityRow& Row : AbilityRows)
+	{
+		if (Row.State == EAbilityRowState::Ultimate)
+		{
+			Row.Box->SetBrushColor(PulseColor);
+		}
+	}
+}
+
+void UBlackholeHUDWidget::TickCriticalFlash()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float FlashIntensity = FMath::Sin(World->GetTimeSeconds() * 8.0f) * 0.5f + 0.5f;
+
+	if (CriticalTitleText)
+	{
+		CriticalTitleText->SetColorAndOpacity(FSlateColor(FLinearColor(FColor(255, (uint8)(100 * FlashIntensity), 0, 255))));
+	}
+
+	const bool bShowEdges = FlashIntensity > 0.7f;
+	if (bShowEdges != bScreenFlashVisible)
+	{
+		bScreenFlashVisible = bShowEdges;
+		for (UBorder* Edge : ScreenFlashEdges)
+		{
+			if (Edge)
+			{
+				Edge->SetVisibility(bShowEdges ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+			}
+		}
+	}
+}
+
+void UBlackholeHUDWidget::TickNotifications(float DeltaTime)
+{
+	bool bRemoved = false;
+	for (int32 i = NotificationEntries.Num() - 1; i >= 0; i--)
+	{
+		FNotificationEntry& Entry = NotificationEntries[i];
+		Entry.TimeRemaining -= DeltaTime;
+
+		if (Entry.TimeRemaining <= 0.0f)
+		{
+			NotificationEntries.RemoveAt(i);
+			bRemoved = true;
+		}
+		else if (Entry.TimeRemaining < 1.0f && NotificationSlots[i])
+		{
+			// Fade out over the last second - render opacity is a paint-only invalidation
+			NotificationSlots[i]->SetRenderOpacity(Entry.TimeRemaining);
+		}
+	}
+
+	if (bRemoved)
+	{
+		RefreshNotifications();
+	}
+}
@@ -83,7 +83,6 @@ void UGameOverWidget::OnPlayAgainClicked()
 	if (UGameStateManager* GameStateMgr = GetGameStateManager())
 	{
 		HideMenu();
-		GameStateMgr->ResetGame();
-		GameStateMgr->StartGame();
+		GameStateMgr->RestartGame();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "UI/HUDTextCache.h"
+
+DEFINE_STAT(STAT_HUDTextReformats);
+DEFINE_STAT(STAT_HUDTextAllocations);
+
+void FHUDText::Assign(FString& Out, const TCHAR* Chars, int32 Len)
+{
+	// Snprintf reports -1 on truncation; the buffer is still terminated
+	if (Len < 0)
+	{
+		Len = FCString::Strlen(Chars);
+	}
+
+	const SIZE_T PreviousSize = Out.GetAllocatedSize();
+
+	// Reset keeps the allocation as long as it is big enough
+	Out.Reset(Len);
+	Out.AppendChars(Chars, Len);
+
+	if (Out.GetAllocatedSize() != PreviousSize)
+	{
+		INC_DWORD_STAT(STAT_HUDTextAllocations);
+	}
+}
@@ -1,4 +1,5 @@
 #include "UI/PauseMenuWidget.h"
+#include "blackhole.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
 #include "Components/VerticalBox.h"
@@ -12,7 +13,7 @@ void UPauseMenuWidget::SetupMenu()
 {
 	if (!MenuContainer)
 	{
-		UE_LOG(LogTemp, Error, TEXT("PauseMenuWidget: MenuContainer is null!"));
+		UE_LOG(LogBlackholeUI, Error, TEXT("PauseMenuWidget: MenuContainer is null!"));
 		return;
 	}
 	
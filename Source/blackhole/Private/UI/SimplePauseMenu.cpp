@@ -207,40 +207,31 @@ void USimplePauseMenu::OnRestartClicked()
 				}
 			}
 			
-			CRASH_CHECKPOINT_MSG("Clearing button callbacks");
-			// Clear button callbacks after disabling to prevent any further input
-			ButtonCallbacks.Empty();
+			// Leave the viewport before restarting - a soft restart keeps this widget alive for
+			// the next pause, a level reload destroys it with the world
+			CRASH_CHECKPOINT_MSG("Hiding widget");
+			HideMenu();
 			
-			// First, ensure we're in game-only input mode to prevent UI access during transition
-			CRASH_CHECKPOINT_MSG("Getting World");
-			if (UWorld* World = GetWorld())
+			// Unpause the game before restart
+			CRASH_CHECKPOINT_MSG("Unpausing game");
+			if (APlayerController* PC = GetOwningPlayer())
 			{
-				CRASH_CHECKPOINT_MSG("Getting PlayerController");
-				if (APlayerController* PC = World->GetFirstPlayerController())
-				{
-					CRASH_CHECKPOINT_MSG("Setting input mode");
-					FInputModeGameOnly InputMode;
-					PC->SetInputMode(InputMode);
-					PC->bShowMouseCursor = false;
-					
-					// Unpause the game before restart
-					CRASH_CHECKPOINT_MSG("Unpausing game");
-					PC->SetPause(false);
-				}
+				PC->SetPause(false);
 			}
 			
-			// Mark widget for pending kill to prevent access during level transition
-			CRASH_CHECKPOINT_MSG("Marking widget as garbage");
-			MarkAsGarbage();
-			
-			// Hide widget instead of removing immediately
-			CRASH_CHECKPOINT_MSG("Hiding widget");
-			SetVisibility(ESlateVisibility::Collapsed);
-			
 			// Perform restart - GameStateManager will handle cleanup
 			CRASH_CHECKPOINT_MSG("Calling RestartGame");
 			GameStateMgr->RestartGame();
 			
+			// Ready for the next time the menu is shown
+			for (auto& Pair : ButtonCallbacks)
+			{
+				if (UButton* Button = Pair.Key)
+				{
+					Button->SetIsEnabled(true);
+				}
+			}
+			
 			CRASH_CHECKPOINT_MSG("OnRestartClicked End");
 		}
 	}
@@ -3,5 +3,12 @@
 #include "blackhole.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogBlackhole);
+DEFINE_LOG_CATEGORY(LogBlackholeAI);
+DEFINE_LOG_CATEGORY(LogBlackholeAbilities);
+DEFINE_LOG_CATEGORY(LogBlackholeMovement);
+DEFINE_LOG_CATEGORY(LogBlackholeResources);
+DEFINE_LOG_CATEGORY(LogBlackholeUI);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, blackhole, "blackhole" );
  
\ No newline at end of file
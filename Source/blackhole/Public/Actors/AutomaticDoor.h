@@ -24,6 +24,9 @@ class BLACKHOLE_API AAutomaticDoor : public AActor
 public:    
     AAutomaticDoor();
 
+    // Snap shut and forget the player, as at level start
+    void ResetDoor();
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
@@ -91,4 +91,7 @@ protected:
 	
 public:
 	virtual void Tick(float DeltaTime) override;
+	
+	// Make the pickup available again, whether it is waiting to respawn or used up
+	void ResetPickup();
 };
\ No newline at end of file
@@ -3,10 +3,14 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Interfaces/ResourceConsumer.h"
+#include "blackhole.h"
 #include "AbilityComponent.generated.h"
 
 class UResourceManager;
 class UThresholdManager;
+class UBuffManager;
+class UAbilityCooldownManager;
+struct FAbilityAssetManifest;
 
 UENUM(BlueprintType)
 enum class EAbilityState : uint8
@@ -42,20 +46,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ability")
 	float Range;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Ability")
-	float CurrentCooldown;
-
-	UPROPERTY(BlueprintReadOnly, Category = "Ability")
-	bool bIsOnCooldown;
-	
 	// Improved state tracking
 	UPROPERTY(BlueprintReadOnly, Category = "Ability")
 	EAbilityState CurrentState = EAbilityState::Ready;
 	
-	// Tick optimization
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Optimization")
-	bool bTickOnlyWhenActive = true;
-	
 	// Track if ability is in ultimate mode
 	UPROPERTY(BlueprintReadOnly, Category = "Ability")
 	bool bIsInUltimateMode;
@@ -79,8 +73,6 @@ protected:
 	float UltimateDurationMultiplier = 1.5f;
 
 public:
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	UFUNCTION(BlueprintCallable, Category = "Ability")
 	virtual bool CanExecute() const;
 
@@ -90,14 +82,35 @@ public:
 	// Execute the ultimate version of this ability
 	virtual void ExecuteUltimate();
 
+	// Called by the player input buffer the frame before a buffered request is expected to fire.
+	// Override to warm up hit queries / target selection so Execute() has less work on the trigger frame.
+	virtual void PrepareExecution() {}
+
+	// CanExecute() with the cooldown left out - true when only the cooldown stands in the way
+	bool CanExecuteIgnoringCooldown() const;
+
+	// Cooldown queries are computed from the expiry timestamp in UAbilityCooldownManager
+	UFUNCTION(BlueprintCallable, Category = "Ability")
+	float GetCooldownRemaining() const;
+
+	// Length of the last cooldown as started, after reductions
 	UFUNCTION(BlueprintCallable, Category = "Ability")
-	float GetCooldownRemaining() const { return CurrentCooldown; }
+	float GetCooldownDuration() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Ability")
 	float GetCooldownPercentage() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Ability")
-	bool IsOnCooldown() const { return bIsOnCooldown; }
+	bool IsOnCooldown() const;
+	
+	// Called by UAbilityCooldownManager when this ability's cooldown expires
+	virtual void OnCooldownReady();
+
+	// Clears any running cooldown and returns the ability to Ready - used by in-place level restarts
+	void ResetCooldownForRestart();
+
+	// Soft effect/sound references this ability can spawn, preloaded by UAbilityAssetPreloader
+	virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const {}
 
 	UFUNCTION(BlueprintCallable, Category = "Ability")
 	float GetRange() const { return Range; }
@@ -122,7 +135,7 @@ public:
 	void SetDisabled(bool bNewDisabled) 
 	{ 
 		bIsDisabled = bNewDisabled; 
-		UE_LOG(LogTemp, Error, TEXT("Ability %s: SetDisabled called with %s"), 
+		UE_LOG(LogBlackholeAbilities, Error, TEXT("Ability %s: SetDisabled called with %s"), 
 			*GetName(), bNewDisabled ? TEXT("TRUE") : TEXT("FALSE"));
 	}
 	
@@ -139,6 +152,10 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Ability")
 	void SetCooldown(float NewCooldown) { Cooldown = NewCooldown; }
+	
+	// Stable slot in the ThresholdManager player ability registry (INDEX_NONE if unregistered)
+	int32 GetRegistrySlot() const { return RegistrySlot; }
+	void SetRegistrySlot(int32 NewSlot) { RegistrySlot = NewSlot; }
 
 protected:
 	void StartCooldown();
@@ -151,7 +168,7 @@ protected:
 	// Helper to get resource manager
 	UResourceManager* GetResourceManager() const;
 	
-	// Apply survivor buff modifiers
+	// Apply combat buff modifiers (player abilities only)
 	virtual float GetDamageMultiplier() const;
 	virtual float GetCooldownWithReduction() const;
 	
@@ -159,8 +176,28 @@ protected:
 	UPROPERTY()
 	UThresholdManager* ThresholdManager;
 	
-	// Optimized tick management
-	void SetTickEnabled(bool bEnabled);
+	// Cached buff manager - only set for player-owned abilities
+	UPROPERTY()
+	UBuffManager* BuffManager;
+	
+	// Central cooldown table and this ability's row in it
+	UPROPERTY()
+	UAbilityCooldownManager* CooldownManager;
+	
+	int32 CooldownEntry = INDEX_NONE;
+	
+	// Preloaded effect/sound, or a blocking load if it's needed before the preload got to it
+	template<typename T>
+	static T* ResolveAbilityAsset(const TSoftObjectPtr<T>& Asset)
+	{
+		T* Loaded = Asset.Get();
+		if (!Loaded && !Asset.IsNull())
+		{
+			UE_LOG(LogBlackholeAbilities, Warning, TEXT("Ability asset %s used before it was preloaded"), *Asset.ToString());
+			Loaded = Asset.LoadSynchronous();
+		}
+		return Loaded;
+	}
 	
 	// Resource validation helpers
 	bool ValidateResources() const;
@@ -168,4 +205,10 @@ protected:
 	
 	// Get resource consumer interface from owner
 	IResourceConsumer* GetOwnerResourceInterface() const;
-};
\ No newline at end of file
+	
+private:
+	int32 RegistrySlot = INDEX_NONE;
+
+	// Set for the duration of CanExecuteIgnoringCooldown() so overrides that call Super keep working
+	mutable bool bIgnoreCooldownCheck = false;
+};
\ No newline at end of file
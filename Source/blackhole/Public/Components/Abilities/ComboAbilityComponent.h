@@ -48,10 +48,10 @@ public:
 
     // Sound/Haptic feedback
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combo|Feedback")
-    USoundBase* ComboSound = nullptr;
+    TSoftObjectPtr<USoundBase> ComboSound;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combo|Feedback")
-    UParticleSystem* ComboParticle = nullptr;
+    TSoftObjectPtr<UParticleSystem> ComboParticle;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combo|Feedback", meta = (ClampMin = "0.0", ClampMax = "5.0"))
     float CameraShakeScale = 1.0f;
@@ -59,6 +59,7 @@ public:
     // Override Execute to prevent direct execution - combos are triggered differently
     virtual void Execute() override;
     virtual bool CanExecute() const override;
+    virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const override;
 
 protected:
     // Pure virtual function that derived classes must implement
@@ -35,12 +35,13 @@ public:
 
     // Visual effects
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Phantom Strike|Visual")
-    UParticleSystem* TeleportParticle = nullptr;
+    TSoftObjectPtr<UParticleSystem> TeleportParticle;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Phantom Strike|Visual")
-    USoundBase* TeleportSound = nullptr;
+    TSoftObjectPtr<USoundBase> TeleportSound;
 
     virtual void ExecuteCombo() override;
+    virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const override;
 
 private:
     bool TeleportBehindTarget(AActor* Target);
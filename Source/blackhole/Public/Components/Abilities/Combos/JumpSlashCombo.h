@@ -38,15 +38,16 @@ public:
 
     // Visual effects
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aerial Rave|Visual")
-    UParticleSystem* ShockwaveParticle = nullptr;
+    TSoftObjectPtr<UParticleSystem> ShockwaveParticle;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aerial Rave|Visual")
-    USoundBase* ShockwaveSound = nullptr;
+    TSoftObjectPtr<USoundBase> ShockwaveSound;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aerial Rave|Visual")
     FLinearColor ShockwaveColor = FLinearColor(0.2f, 0.5f, 1.0f, 1.0f);
 
     virtual void ExecuteCombo() override;
+    virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const override;
 
 private:
     void CreateShockwave();
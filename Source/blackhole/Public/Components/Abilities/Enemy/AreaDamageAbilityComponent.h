@@ -20,10 +20,10 @@ struct FAreaDamageVisualEffect
     GENERATED_BODY()
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
-    UParticleSystem* ImpactParticle = nullptr;
+    TSoftObjectPtr<UParticleSystem> ImpactParticle;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
-    USoundBase* ImpactSound = nullptr;
+    TSoftObjectPtr<USoundBase> ImpactSound;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
     TSubclassOf<UCameraShakeBase> CameraShake = nullptr;
@@ -133,6 +133,7 @@ public:
 public:
     virtual void Execute() override;
     virtual void ExecuteUltimate() override;
+    virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const override;
 
 private:
     void PerformAreaDamage();
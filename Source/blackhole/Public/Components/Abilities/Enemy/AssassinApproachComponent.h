@@ -21,6 +21,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Assassin Approach", meta = (DisplayName = "Dash Behind Distance"))
 	float DashBehindDistance = 150.0f;
 	
+	// Dash speed in cm/s
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Assassin Approach", meta = (DisplayName = "Dash Force", ClampMin = "1000.0", ClampMax = "10000.0"))
 	float DashForce = 3000.0f;
 	
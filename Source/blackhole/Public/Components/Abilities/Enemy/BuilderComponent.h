@@ -2,10 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Enemy/AI/EnemyStates.h"
 #include "BuilderComponent.generated.h"
 
 class APsiDisruptor;
 class AStandardEnemy;
+class UEnemyStateMachine;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBuildingStarted, const FVector&, BuildLocation);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBuildingComplete);
@@ -65,7 +67,7 @@ public:
 	bool IsBuilding() const { return bIsBuilding; }
 	
 	UFUNCTION(BlueprintPure, Category = "Builder")
-	bool IsBuildPaused() const { return bBuildPaused; }
+	bool IsBuildPaused() const;
 	
 	UFUNCTION(BlueprintPure, Category = "Builder")
 	bool IsLeader() const { return bIsBuildLeader; }
@@ -76,29 +78,27 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Builder")
 	FVector GetBuildLocation() const { return CurrentBuildLocation; }
 
-	// Static build coordination
-	static UBuilderComponent* FindNearestBuildLeader(AActor* SearchOrigin, float MaxRange);
-	static TArray<UBuilderComponent*> GetAllActiveBuilders();
+	// Owner died; leaves the build (cancelling it if leading) and stops counting as a builder
+	void OnOwnerDied();
+
+	// Owner revived by a level restart; counts as an idle builder again
+	void OnOwnerRevived();
 
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
+	// Build groups are driven by the coordination subsystem
+	friend class UBuildCoordinationSubsystem;
+
 	bool bIsBuilding;
 	bool bIsBuildLeader;
-	bool bBuildPaused;
-	float BuildProgress;
-	float CurrentBuildTime; // Actual time remaining
-	float TimeSpentBuilding; // Time already spent
+	int32 BuildGroup;
 	FVector CurrentBuildLocation;
 	
 	UPROPERTY()
-	UBuilderComponent* LeaderComponent;
-	
-	UPROPERTY()
-	TArray<UBuilderComponent*> ParticipatingBuilders;
+	class UBuildCoordinationSubsystem* Coordination;
 	
 	UPROPERTY()
 	APsiDisruptor* SpawnedDisruptor;
@@ -110,15 +110,17 @@ private:
 	UPROPERTY()
 	class AActor* BuildSphereActor;
 	
-	FTimerHandle BuildTimerHandle;
-	int32 InitialBuilderCount; // Track initial builders for timer calculation
+	// Called by the coordination subsystem
+	void EnterBuild(int32 Group, const FVector& BuildLocation, bool bLeader);
+	void ExitBuild();
+	void HandleBuildStarted();
+	void HandleBuildCompleted();
+	void HandleBuildCancelled();
+	void HandleBuildPaused();
 	
-	void UpdateBuildProgress();
-	void CompleteBuild();
 	void SpawnPsiDisruptor();
 	void CreateBuildSphere();
 	void DestroyBuildSphere();
-	
-	// Static tracking of all active builders
-	static TArray<UBuilderComponent*> AllActiveBuilders;
+	UEnemyStateMachine* GetOwnerStateMachine() const;
+	void LeaveBuildingState(EEnemyState NextState);
 };
\ No newline at end of file
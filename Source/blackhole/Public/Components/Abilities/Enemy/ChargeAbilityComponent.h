@@ -4,6 +4,11 @@
 #include "Components/Abilities/AbilityComponent.h"
 #include "ChargeAbilityComponent.generated.h"
 
+/**
+ * Straight-line charge at the player. The run is a root motion source on the owner's
+ * CharacterMovement, so it sweeps and steps like normal movement; a blocking hit reported by
+ * the movement ends the charge with an impact.
+ */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class BLACKHOLE_API UChargeAbilityComponent : public UAbilityComponent
 {
@@ -32,6 +37,7 @@ public:
 	float MinChargeDistance = 300.0f;
 
 	virtual void Execute() override;
+	virtual void Deactivate() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	
 	UFUNCTION(BlueprintPure, Category = "Charge")
@@ -39,18 +45,21 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	bool bIsCharging;
 	FVector ChargeDirection;
-	FVector ChargeStartLocation;
-	float ChargeTimeElapsed;
+	uint16 ChargeSourceID;
 	
 	UPROPERTY()
 	AActor* ChargeTarget;
 	
 	void StartCharge();
-	void UpdateCharge(float DeltaTime);
+	void UpdateCharge();
 	void EndCharge(bool bHitTarget);
 	void ApplyImpactDamage(const FVector& ImpactLocation);
+
+	UFUNCTION()
+	void OnOwnerHit(AActor* SelfActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit);
 };
\ No newline at end of file
@@ -4,6 +4,11 @@
 #include "Components/Abilities/AbilityComponent.h"
 #include "HeatAuraComponent.generated.h"
 
+/**
+ * Passive WP drain around the owner. The drain itself is applied by UAuraFieldSubsystem,
+ * which evaluates every active aura in one pass; this component only registers and
+ * unregisters its emitter.
+ */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class BLACKHOLE_API UHeatAuraComponent : public UAbilityComponent
 {
@@ -19,7 +24,8 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Heat Aura", meta = (DisplayName = "Aura Radius"))
 	float AuraRadius = 300.0f;
 	
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Heat Aura", meta = (DisplayName = "Tick Interval"))
+	// Seconds between drains; each drains DamagePerSecond * TickInterval, the first on activation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Heat Aura", meta = (DisplayName = "Tick Interval", ClampMin = "0.01"))
 	float TickInterval = 1.0f;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Heat Aura", meta = (DisplayName = "Affects Enemies"))
@@ -31,6 +37,10 @@ public:
 	// Toggle aura on/off
 	UFUNCTION(BlueprintCallable, Category = "Heat Aura")
 	void SetAuraActive(bool bActive);
+
+	// Push changed DamagePerSecond/AuraRadius/TickInterval/bAffectsEnemies to an active aura
+	UFUNCTION(BlueprintCallable, Category = "Heat Aura")
+	void RefreshAura();
 	
 	UFUNCTION(BlueprintPure, Category = "Heat Aura")
 	bool IsAuraActive() const { return bAuraActive; }
@@ -40,9 +50,8 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	FTimerHandle AuraTickHandle;
 	bool bAuraActive;
-	
-	void AuraTick();
-	void ApplyAuraDamage();
+
+	// Emitter handle in the world's aura field while active
+	int32 AuraFieldHandle = INDEX_NONE;
 };
\ No newline at end of file
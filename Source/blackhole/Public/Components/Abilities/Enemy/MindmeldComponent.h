@@ -6,6 +6,10 @@
 
 class UWillPowerComponent;
 
+/**
+ * Sustained WP corruption beam. The component itself never ticks: while active, the channel is
+ * owned by UMindmeldChannelSubsystem, which checks line of sight and applies the corruption.
+ */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class BLACKHOLE_API UMindmeldComponent : public UAbilityComponent
 {
@@ -21,7 +25,7 @@ public:
 	bool bIsMindmeldActive;
 
 	virtual void Execute() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void Deactivate() override;
 
 	UFUNCTION(BlueprintCallable, Category = "Mindmeld")
 	void SetTarget(AActor* NewTarget);
@@ -29,12 +33,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Mindmeld")
 	void StopMindmeld();
 
+	// Traces to the target. The channel subsystem only calls this when the caster's AI has no
+	// cached line of sight for the target.
+	bool HasLineOfSight() const;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	UPROPERTY()
 	AActor* TargetActor;
-
-	bool HasLineOfSight() const;
 };
\ No newline at end of file
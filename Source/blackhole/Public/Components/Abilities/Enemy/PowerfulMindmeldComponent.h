@@ -8,6 +8,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMindmeldStarted, float, CastTime)
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMindmeldComplete);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMindmeldInterrupted);
 
+/**
+ * Long timed channel that drops the player's WP to zero on completion. The component does not
+ * tick; while channeling, UMindmeldChannelSubsystem drives UpdateChannel.
+ */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class BLACKHOLE_API UPowerfulMindmeldComponent : public UAbilityComponent
 {
@@ -57,9 +61,10 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
+	friend class UMindmeldChannelSubsystem;
+
 	bool bIsChanneling;
 	float ChannelStartTime;
 	FTimerHandle ChannelCompleteTimer;
@@ -19,10 +19,13 @@ public:
 
 	virtual void Execute() override;
 	virtual bool CanExecute() const override;
-	
+
 	// Basic abilities don't have ultimate versions
 	virtual void ExecuteUltimate() override { Execute(); }
 
+	// Pre-gathers the sphere candidates around the player for a buffered slash
+	virtual void PrepareExecution() override;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -30,4 +33,20 @@ private:
 	// Cached owner reference
 	UPROPERTY()
 	class ABlackholePlayerCharacter* OwnerCharacter;
+
+	// Attack sphere around the player used for target validation
+	static constexpr float TargetSphereRadius = 300.0f;
+
+	// Extra radius on the warm-up query so targets moving during the next frame stay in the candidate set
+	static constexpr float WarmupRadiusMargin = 150.0f;
+
+	// Candidates from the last PrepareExecution(), reused by Execute() on the following frame
+	TArray<TWeakObjectPtr<AActor>> WarmCandidates;
+	uint64 WarmFrame = 0;
+
+	// True if the warm-up ran on this or the previous frame
+	bool HasFreshWarmup() const;
+
+	// Is the traced target inside the attack sphere? Uses warm candidates when available.
+	bool IsTargetInSphere(const FHitResult& TraceHit, const FVector& PlayerLocation) const;
 };
\ No newline at end of file
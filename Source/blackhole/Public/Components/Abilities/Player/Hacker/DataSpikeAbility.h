@@ -53,6 +53,7 @@ public:
 	virtual void Execute() override;
 	virtual bool CanExecute() const override;
 	virtual void ExecuteUltimate() override;
+	virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const override;
 
 	// Clean up DOT effects on EndPlay
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -95,19 +96,19 @@ protected:
 
 	// Visual and audio effects
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	UParticleSystem* ProjectileEffect;
+	TSoftObjectPtr<UParticleSystem> ProjectileEffect;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	UParticleSystem* HitEffect;
+	TSoftObjectPtr<UParticleSystem> HitEffect;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	UParticleSystem* DOTEffect;
+	TSoftObjectPtr<UParticleSystem> DOTEffect;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	USoundBase* FireSound;
+	TSoftObjectPtr<USoundBase> FireSound;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	USoundBase* HitSound;
+	TSoftObjectPtr<USoundBase> HitSound;
 
 private:
 	// DOT tracking - Use weak pointers to prevent crashes when enemies are destroyed
@@ -17,6 +17,7 @@ public:
 	virtual void Execute() override;
 	virtual bool CanExecute() const override;
 	virtual void ExecuteUltimate() override;
+	virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const override;
 
 protected:
 	// Ability parameters
@@ -47,10 +48,10 @@ protected:
 
 	// Visual effect
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	UParticleSystem* PulseEffect;
+	TSoftObjectPtr<UParticleSystem> PulseEffect;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	USoundBase* PulseSound;
+	TSoftObjectPtr<USoundBase> PulseSound;
 
 private:
 	void ApplySlowToEnemy(class ABaseEnemy* Enemy);
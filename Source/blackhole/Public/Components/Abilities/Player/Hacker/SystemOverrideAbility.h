@@ -46,6 +46,7 @@ public:
 	virtual void Execute() override;
 	virtual bool CanExecute() const override;
 	virtual void ExecuteUltimate() override;
+	virtual void GatherAssetManifest(FAbilityAssetManifest& Manifest) const override;
 
 	// Clean up disable effects on EndPlay
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -76,16 +77,16 @@ protected:
 
 	// Visual and audio effects
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	UParticleSystem* OverrideEffect;
+	TSoftObjectPtr<UParticleSystem> OverrideEffect;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	UParticleSystem* DisableEffect;
+	TSoftObjectPtr<UParticleSystem> DisableEffect;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	USoundBase* ActivationSound;
+	TSoftObjectPtr<USoundBase> ActivationSound;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
-	USoundBase* DisableSound;
+	TSoftObjectPtr<USoundBase> DisableSound;
 
 private:
 	// Disable tracking - Use weak pointers to prevent crashes when enemies are destroyed
@@ -22,5 +22,7 @@ public:
 	void DrainWillPower(float Amount);
 
 protected:
+	// Registers with the aura field as a drain receiver
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
\ No newline at end of file
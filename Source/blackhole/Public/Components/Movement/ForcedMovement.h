@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ACharacter;
+
+/**
+ * Ability-driven motion (charges, dashes, knockback) applied as root motion sources.
+ *
+ * The source is evaluated inside UCharacterMovementComponent, so the move is swept, steps up
+ * and follows floors like normal walking, and blocking hits arrive through the usual
+ * OnActorHit/MoveBlockedBy path. Callers never trace or SetActorLocation themselves.
+ * Each helper returns the source ID (0 on failure) for IsActive/Stop.
+ */
+struct BLACKHOLE_API FForcedMovement
+{
+	// Constant horizontal velocity for Duration seconds; velocity is zeroed when it ends
+	static uint16 ApplyCharge(ACharacter* Character, const FVector& Velocity, float Duration);
+
+	// Straight move to Destination over Duration seconds, keeping the character's height
+	static uint16 ApplyDash(ACharacter* Character, const FVector& Destination, float Duration);
+
+	// Ballistic arc equivalent to Launch(LaunchVelocity), but the target's own input, AI
+	// pathing and braking can't cut it short
+	static uint16 ApplyKnockback(ACharacter* Character, const FVector& LaunchVelocity);
+
+	static bool IsActive(ACharacter* Character, uint16 SourceID);
+	static void Stop(ACharacter* Character, uint16 SourceID);
+};
@@ -18,6 +18,31 @@ namespace GameplayConfig
 		constexpr float DEATH_IMPULSE_MAGNITUDE = 5000.0f;		// Force units
 		constexpr float CORPSE_LIFESPAN = 10.0f;				// Seconds
 		constexpr float COMBAT_MESSAGE_DURATION = 3.0f;		// Seconds
+
+		// Psi-Disruptor build coordination
+		namespace Building
+		{
+			constexpr float UPDATE_INTERVAL = 0.1f;				// Seconds per build progress step
+			constexpr float LEAVE_RADIUS_SCALE = 1.5f;			// Builders past BuildRadius * this drop out
+			constexpr float LOST_BUILDER_TIME_SCALE = 1.5f;		// Remaining time multiplier per lost builder
+		}
+
+		// Which enemies hear a player action
+		namespace PlayerActions
+		{
+			constexpr float DASH_RADIUS = 1500.0f;				// Units
+			constexpr float ATTACK_RADIUS = 800.0f;				// Units
+			constexpr float ATTACK_CONE_COS = 0.5f;				// Only enemies within 60 degrees of the attack facing
+			constexpr float ULTIMATE_RADIUS = 3000.0f;			// Units
+		}
+
+		// Shared per-step perception pass
+		namespace Perception
+		{
+			constexpr float ENGAGE_RANGE_SCALE = 1.5f;			// Combat holds until AttackRange * this
+			constexpr float CHASE_LEASH_SCALE = 1.5f;			// Chase gives up past ChaseRange * this
+			constexpr int32 MIN_PARALLEL_ENEMIES = 32;			// Smaller rosters are stepped on the game thread
+		}
 	}
 
 	// Resource System Configuration
@@ -59,6 +84,12 @@ namespace GameplayConfig
 			constexpr float RANGE = 1000.0f;					// Units
 		}
 
+		// Player input buffering
+		namespace InputBuffer
+		{
+			constexpr float WINDOW = 0.2f;						// Seconds a rejected press stays queued
+		}
+
 		// Pulse Hack (Hacker)
 		namespace PulseHack
 		{
@@ -115,6 +146,19 @@ namespace GameplayConfig
 			constexpr float WP_CLEANSE = 30.0f;				// WP units
 			constexpr float DAMAGE = 50.0f;					// HP damage to all enemies
 		}
+
+		// Aura field (heat auras and other area drains)
+		namespace AuraField
+		{
+			constexpr float TICK_INTERVAL = 0.25f;				// Seconds between field passes
+		}
+
+		// Effect/sound preloading at level start
+		namespace Preload
+		{
+			constexpr int32 WARMS_PER_FRAME = 4;				// Loaded assets warmed per tick
+			constexpr float WARM_DEPTH = -100000.0f;			// Z for the hidden warm-up spawns
+		}
 	}
 
 	// Attribute System Configuration
@@ -150,5 +194,40 @@ namespace GameplayConfig
 		constexpr float DEFAULT_BAR_WIDTH = 200.0f;			// Pixels
 		constexpr float DEFAULT_BAR_HEIGHT = 20.0f;			// Pixels
 		constexpr float COOLDOWN_ICON_SIZE = 64.0f;			// Pixels
+		
+		// Enemy overhead indicators
+		constexpr int32 MAX_ENEMY_INDICATORS = 24;				// Drawn per frame, nearest first
+		constexpr float ENEMY_INDICATOR_RANGE = 4500.0f;		// Units (matches enemy detection range)
+		constexpr float TARGET_SELECT_RADIUS = 80.0f;			// Pixels from the crosshair
+	}
+
+	// Headless arena benchmark (-ArenaBenchmark)
+	namespace Benchmark
+	{
+		constexpr int32 WARMUP_FRAMES = 120;					// Discarded after each spawn wave
+		constexpr int32 MEASURE_FRAMES = 600;					// Sampled per enemy count
+		constexpr float SPAWN_RADIUS_MIN = 1200.0f;			// Units from the player start
+		constexpr float SPAWN_RADIUS_MAX = 3500.0f;
+		constexpr float BOT_PATROL_RADIUS = 800.0f;			// Bot circles the arena centre
+		constexpr float BOT_ACTION_INTERVAL = 0.4f;			// Seconds between scripted inputs
+		constexpr float BOT_WP_REFILL_PERCENT = 0.5f;			// Keep the bot alive for the whole run
+		constexpr float BOT_WALLRUN_INTERVAL = 8.0f;			// Seconds between wall-run attempts
+		constexpr float BOT_WALLRUN_SEEK_DISTANCE = 1000.0f;	// Units to look for a wall
+		constexpr float BOT_WALLRUN_JUMP_DISTANCE = 150.0f;	// Jump this close to the wall
+		constexpr float BOT_WALLRUN_APPROACH_ANGLE = 30.0f;	// Degrees into the wall (looks at it enough to start)
+		constexpr float BOT_WALLRUN_MAX_TIME = 6.0f;			// Seconds before the bot gives up and resumes patrol
+	}
+
+	// Accelerated AI soak test (-AISoak); times are game seconds
+	namespace Soak
+	{
+		constexpr float DURATION_HOURS = 4.0f;
+		constexpr float STEP_HZ = 30.0f;						// Fixed timestep
+		constexpr float TIME_SCALE = 4.0f;					// World time dilation on top of the unthrottled fixed step
+		constexpr int32 WAVE_SIZE = 12;
+		constexpr float WAVE_INTERVAL = 45.0f;
+		constexpr float WAVE_LIFETIME = 120.0f;				// Survivors are killed after this long
+		constexpr int32 MAX_ALIVE = 60;						// Waves shrink to stay under this
+		constexpr float SAMPLE_INTERVAL = 60.0f;
 	}
 }
\ No newline at end of file
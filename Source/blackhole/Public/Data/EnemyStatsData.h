@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "Enemy/AI/EnemyStates.h"
 #include "EnemyStatsData.generated.h"
 
 UENUM(BlueprintType)
@@ -203,6 +204,38 @@ struct BLACKHOLE_API FEnemyStatsData : public FTableRowBase
 	}
 };
 
+// Groups of archetype fields, for applying only what changed in a live reload
+enum class EEnemyArchetypeFields : uint8
+{
+	None		= 0,
+	Health		= 1 << 0,	// Live enemies keep their health fraction
+	Movement	= 1 << 1,	// Live enemies keep any active speed modifier
+	AI			= 1 << 2,	// State machine parameters and the per-class range/chance copies
+	Abilities	= 1 << 3,	// Ability components and per-class tuning
+	All			= Health | Movement | AI | Abilities,
+	
+	Spawn		= 1 << 4	// Fresh enemy with no live state to preserve
+};
+ENUM_CLASS_FLAGS(EEnemyArchetypeFields);
+
+// One FEnemyStatsData row resolved for use: validated, with derived values precomputed.
+// Built once per row by UEnemyArchetypeCache, shared by every enemy using the row and never
+// modified afterwards. Enemies apply it through ABaseEnemy::ApplyArchetype.
+struct BLACKHOLE_API FEnemyArchetype
+{
+	FName RowName;
+	
+	// Validated copy of the row
+	FEnemyStatsData Stats;
+	
+	// Ready for UEnemyStateMachine::SetAIParameters
+	FEnemyAIParameters AIParameters;
+	
+	// Attack speed already applied
+	float SmashCooldown = 0.0f;
+	float GroundSlamDamage = 0.0f;
+};
+
 // Manager class to handle data table loading
 UCLASS(BlueprintType)
 class BLACKHOLE_API UEnemyStatsManager : public UObject
@@ -217,4 +250,11 @@ public:
 	// Static function to apply stats to an enemy
 	UFUNCTION(BlueprintCallable, Category = "Enemy Stats")
 	static void ApplyStatsToEnemy(class ABaseEnemy* Enemy, const FEnemyStatsData& Stats);
+	
+	// Validates a row and precomputes what enemies need from it. Every problem is logged here,
+	// once per row, rather than at each spawn.
+	static void BuildArchetype(FName RowName, const FEnemyStatsData& Stats, FEnemyArchetype& OutArchetype);
+	
+	// Which field groups differ between two builds of the same row
+	static EEnemyArchetypeFields DiffArchetypes(const FEnemyArchetype& Old, const FEnemyArchetype& New);
 };
\ No newline at end of file
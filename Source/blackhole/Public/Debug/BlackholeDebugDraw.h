@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Category-gated debug drawing.
+ *
+ * Every category has a console variable (blackhole.debug.ai.los, blackhole.debug.movement.wallrun, ...)
+ * plus blackhole.debug.all; all are off by default. Wrap draw calls in BLACKHOLE_DEBUG_DRAW:
+ *
+ *   BLACKHOLE_DEBUG_DRAW(AI_LOS, DrawDebugLine(GetWorld(), Start, End, FColor::Green, false, 0.2f));
+ *
+ * When the category is off only a bitmask test runs - the draw call's arguments are never
+ * evaluated. When it is on, lines, boxes, circles, spheres and arrows are tessellated into a
+ * per-world buffer and handed to the world's line batchers in one submission per frame.
+ * Strings, capsules and cones go straight to the engine helpers.
+ * In builds without ENABLE_DRAW_DEBUG (Shipping) the macro expands to nothing.
+ */
+
+enum class EBlackholeDebugDraw : uint32
+{
+	AI_LOS			= 1 << 0,	// ai.los
+	AI_State		= 1 << 1,	// ai.state
+	Abilities_AoE	= 1 << 2,	// abilities.aoe
+	Abilities_Hits	= 1 << 3,	// abilities.hits
+	Abilities_Combos = 1 << 4,	// abilities.combos
+	Movement_WallRun = 1 << 5,	// movement.wallrun
+	Movement_Gravity = 1 << 6,	// movement.gravity
+	World			= 1 << 7,	// world (doors, volumes, disruptors)
+};
+
+#if ENABLE_DRAW_DEBUG
+
+class AActor;
+class UWorld;
+
+class BLACKHOLE_API FBlackholeDebugDraw
+{
+public:
+	static bool IsEnabled(EBlackholeDebugDraw Category)
+	{
+		return (EnabledMask & (uint32)Category) != 0;
+	}
+
+	// Same signatures as the DrawDebugHelpers functions, so call sites only gain the macro
+	static void DrawDebugLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color,
+		bool bPersistent = false, float LifeTime = -1.0f, uint8 DepthPriority = 0, float Thickness = 0.0f);
+	static void DrawDebugDirectionalArrow(const UWorld* World, const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color,
+		bool bPersistent = false, float LifeTime = -1.0f, uint8 DepthPriority = 0, float Thickness = 0.0f);
+	static void DrawDebugBox(const UWorld* World, const FVector& Center, const FVector& Extent, const FColor& Color,
+		bool bPersistent = false, float LifeTime = -1.0f, uint8 DepthPriority = 0, float Thickness = 0.0f);
+	static void DrawDebugCircle(const UWorld* World, const FVector& Center, float Radius, int32 Segments, const FColor& Color,
+		bool bPersistent = false, float LifeTime = -1.0f, uint8 DepthPriority = 0, float Thickness = 0.0f,
+		const FVector& YAxis = FVector(0.0f, 1.0f, 0.0f), const FVector& ZAxis = FVector(0.0f, 0.0f, 1.0f), bool bDrawAxis = true);
+	static void DrawDebugSphere(const UWorld* World, const FVector& Center, float Radius, int32 Segments, const FColor& Color,
+		bool bPersistent = false, float LifeTime = -1.0f, uint8 DepthPriority = 0, float Thickness = 0.0f);
+
+	// Not batched - forwarded to the engine helpers
+	static void DrawDebugCapsule(const UWorld* World, const FVector& Center, float HalfHeight, float Radius, const FQuat& Rotation, const FColor& Color,
+		bool bPersistent = false, float LifeTime = -1.0f, uint8 DepthPriority = 0, float Thickness = 0.0f);
+	static void DrawDebugCone(const UWorld* World, const FVector& Origin, const FVector& Direction, float Length, float AngleWidth, float AngleHeight,
+		int32 NumSides, const FColor& Color, bool bPersistent = false, float LifeTime = -1.0f, uint8 DepthPriority = 0, float Thickness = 0.0f);
+	static void DrawDebugString(const UWorld* World, const FVector& TextLocation, const FString& Text, AActor* TestBaseActor = nullptr,
+		const FColor& TextColor = FColor::White, float Duration = -1.0f, bool bDrawShadow = false, float FontScale = 1.0f);
+
+private:
+	friend struct FBlackholeDebugDrawRegistration;
+
+	static void AddLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color,
+		bool bPersistent, float LifeTime, uint8 DepthPriority, float Thickness);
+
+	// Hands buffered lines to the world's line batchers; bound to the end of the world tick
+	static void FlushWorld(UWorld* World);
+	static void ForgetWorld(UWorld* World);
+
+	static void RefreshEnabledMask();
+
+	static uint32 EnabledMask;
+};
+
+#define BLACKHOLE_DEBUG_DRAW(Category, DrawCall) \
+	do \
+	{ \
+		if (FBlackholeDebugDraw::IsEnabled(EBlackholeDebugDraw::Category)) \
+		{ \
+			FBlackholeDebugDraw::DrawCall; \
+		} \
+	} while (0)
+
+#else
+
+#define BLACKHOLE_DEBUG_DRAW(Category, DrawCall)
+
+#endif
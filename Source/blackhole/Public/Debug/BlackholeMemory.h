@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+class FOutputDevice;
+class UWorld;
+
+/**
+ * Memory attribution for the blackhole module.
+ *
+ * Low-level memory tracker: allocations made inside BLACKHOLE_LLM_SCOPE are charged to a
+ * Blackhole/<System> tag. Run with -llm and use "stat LLMFULL", or -llmcsv for per-frame
+ * values and peaks in test runs. Asset loads are tracked by the engine's own asset tag set
+ * (-llmtagsets=assets), so the Data tag only covers runtime copies of table rows and combos.
+ *
+ * Memory report: "blackhole.MemReport" logs object counts and bytes per system for the
+ * current world, along with the high-water mark of every sample taken since the last
+ * "blackhole.MemReport.Reset". Set blackhole.MemReport.SampleInterval to sample periodically.
+ */
+
+LLM_DECLARE_TAG_API(Blackhole, BLACKHOLE_API);
+LLM_DECLARE_TAG_API(Blackhole_Enemies, BLACKHOLE_API);
+LLM_DECLARE_TAG_API(Blackhole_EnemyAI, BLACKHOLE_API);
+LLM_DECLARE_TAG_API(Blackhole_ObjectPools, BLACKHOLE_API);
+LLM_DECLARE_TAG_API(Blackhole_Combos, BLACKHOLE_API);
+LLM_DECLARE_TAG_API(Blackhole_StatusEffects, BLACKHOLE_API);
+LLM_DECLARE_TAG_API(Blackhole_UI, BLACKHOLE_API);
+LLM_DECLARE_TAG_API(Blackhole_Data, BLACKHOLE_API);
+
+// Charge allocations in the current scope to Blackhole/<Tag>, e.g. BLACKHOLE_LLM_SCOPE(Enemies)
+#define BLACKHOLE_LLM_SCOPE(Tag) LLM_SCOPE_BYTAG(Blackhole_##Tag)
+
+enum class EBlackholeMemoryCategory : uint8
+{
+	Enemies,		// Enemy actors and their components, minus the ones counted below
+	EnemyAI,		// State machines and state objects
+	ObjectPools,	// Pool bookkeeping and pooled actors
+	Combos,			// Combo systems and input histories
+	StatusEffects,	// Status effect components
+	UI,				// HUD, HUD widget and notifications
+	Data,			// Combo data assets and enemy stats tables
+	Count
+};
+
+struct FBlackholeMemorySample
+{
+	int32 Objects = 0;
+	uint64 Bytes = 0;
+};
+
+class BLACKHOLE_API FBlackholeMemoryReport
+{
+public:
+	static constexpr int32 NumCategories = (int32)EBlackholeMemoryCategory::Count;
+
+	// Measures every category for the given world and raises the high-water marks
+	static void Sample(UWorld* World, FBlackholeMemorySample (&OutSamples)[NumCategories]);
+
+	// Samples, then writes current and peak values per category
+	static void Dump(UWorld* World, FOutputDevice& Ar);
+
+	static void ResetHighWater();
+
+	static const TCHAR* GetCategoryName(EBlackholeMemoryCategory Category);
+
+private:
+	static FBlackholeMemorySample HighWater[NumCategories];
+};
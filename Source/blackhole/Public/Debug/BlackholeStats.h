@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Profiling hooks for the blackhole module.
+ *
+ * "stat Blackhole" lists per-system cycle counters plus per-frame counters for traces and
+ * hit queries. The same scopes are emitted to Unreal Insights on per-system trace channels,
+ * enable them with e.g. -trace=cpu,BlackholeAI,BlackholeAbilities,BlackholeMovement.
+ */
+
+DECLARE_STATS_GROUP(TEXT("Blackhole"), STATGROUP_Blackhole, STATCAT_Advanced);
+
+// Per-frame counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOS Traces"), STAT_Blackhole_LOSTraces, STATGROUP_Blackhole, BLACKHOLE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hit Queries"), STAT_Blackhole_HitQueries, STATGROUP_Blackhole, BLACKHOLE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Movement Traces"), STAT_Blackhole_MovementTraces, STATGROUP_Blackhole, BLACKHOLE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ability Executions"), STAT_Blackhole_AbilityExecutions, STATGROUP_Blackhole, BLACKHOLE_API);
+
+// Running totals
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Enemies"), STAT_Blackhole_ActiveEnemies, STATGROUP_Blackhole, BLACKHOLE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Status Effects Alive"), STAT_Blackhole_StatusEffectsAlive, STATGROUP_Blackhole, BLACKHOLE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Unwarmed Ability Assets"), STAT_Blackhole_UnwarmedAbilityAssets, STATGROUP_Blackhole, BLACKHOLE_API);
+
+// Insights channels, one per system
+UE_TRACE_CHANNEL_EXTERN(BlackholeAIChannel, BLACKHOLE_API);
+UE_TRACE_CHANNEL_EXTERN(BlackholeAbilitiesChannel, BLACKHOLE_API);
+UE_TRACE_CHANNEL_EXTERN(BlackholeMovementChannel, BLACKHOLE_API);
+UE_TRACE_CHANNEL_EXTERN(BlackholeSystemsChannel, BLACKHOLE_API);
+UE_TRACE_CHANNEL_EXTERN(BlackholeUIChannel, BLACKHOLE_API);
+
+// Plain copies of the query counters, readable in builds without stats (the arena benchmark
+// samples these). Game thread only; whoever samples them resets them.
+struct BLACKHOLE_API FBlackholeFrameCounters
+{
+	static uint32 LOSTraces;
+	static uint32 HitQueries;
+	static uint32 MovementTraces;
+
+	static void Reset()
+	{
+		LOSTraces = 0;
+		HitQueries = 0;
+		MovementTraces = 0;
+	}
+};
+
+// Count one trace/sweep/overlap in both the stat counter and the plain counter
+#define BLACKHOLE_COUNT_QUERY(Counter) \
+	do \
+	{ \
+		INC_DWORD_STAT(STAT_Blackhole_##Counter); \
+		++FBlackholeFrameCounters::Counter; \
+	} while (0)
+
+// Cycle counter under STATGROUP_Blackhole plus a CPU event on the given trace channel.
+// Declares its own stat, so each call site shows up as a separate row.
+#define BLACKHOLE_SCOPE_CYCLE_COUNTER(Description, StatId, Channel) \
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT(Description), StatId, STATGROUP_Blackhole); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(StatId, Channel)
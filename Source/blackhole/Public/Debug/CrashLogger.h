@@ -1,36 +1,104 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FRunnableThread;
+class FArchive;
 
 /**
  * Crash detection and logging system to help identify crash locations
  * Usage: Add CRASH_CHECKPOINT() at key points in your code
+ *
+ * Checkpoints are copied into a fixed-size in-memory ring buffer and written to
+ * Saved/CrashCheckpoints.log by a background thread, so the calling thread never touches
+ * the disk. On a crash or ensure the remaining records are flushed from the crash handler.
+ * If producers outrun the writer the oldest unwritten records are dropped and counted.
  */
 
-class BLACKHOLE_API FCrashLogger
+// Set to 0 to compile checkpoints out entirely
+#ifndef BLACKHOLE_CRASH_CHECKPOINTS
+	#define BLACKHOLE_CRASH_CHECKPOINTS 1
+#endif
+
+class BLACKHOLE_API FCrashLogger : public FRunnable
 {
 public:
 	static FCrashLogger& Get();
-	
-	void LogCheckpoint(const FString& Function, const FString& File, int32 Line, const FString& Context = "");
-	void LogError(const FString& Function, const FString& File, int32 Line, const FString& Error);
+
+	// Context is copied into the record, truncated to MaxContextLength characters
+	void LogCheckpoint(const TCHAR* Function, const TCHAR* File, int32 Line, const TCHAR* Context = TEXT(""));
+	void LogCheckpoint(const TCHAR* Function, const TCHAR* File, int32 Line, const ANSICHAR* Context);
+	void LogCheckpoint(const TCHAR* Function, const TCHAR* File, int32 Line, const FString& Context);
+	void LogError(const TCHAR* Function, const TCHAR* File, int32 Line, const FString& Error);
 	void ClearLog();
-	
+
+	// Writes everything currently in the ring buffer on the calling thread
+	void Flush();
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
 private:
+	static constexpr int32 RingCapacity = 512; // Must be a power of two
+	static constexpr int32 MaxContextLength = 111;
+
+	// One fixed-size slot. Function and File point at string literals, so only Context is copied.
+	struct FCheckpointRecord
+	{
+		// Claim index + 1 once the record is fully written, 0 while empty
+		std::atomic<uint64> Sequence{0};
+		uint64 Cycles = 0;
+		const TCHAR* Function = nullptr;
+		const TCHAR* File = nullptr;
+		int32 Line = 0;
+		uint32 ThreadId = 0;
+		bool bIsError = false;
+		TCHAR Context[MaxContextLength + 1];
+	};
+
 	FCrashLogger();
 	~FCrashLogger();
-	
+
+	// Claims a slot and fills everything except Context; returns the slot to finish
+	FCheckpointRecord& BeginRecord(const TCHAR* Function, const TCHAR* File, int32 Line, bool bIsError, uint64& OutIndex);
+	void PublishRecord(FCheckpointRecord& Record, uint64 Index);
+
+	// Drains published records to the file; only one thread drains at a time
+	void DrainRing();
+	void WriteRecord(const FCheckpointRecord& Record);
+
+	void OnSystemError();
+	void OnEnginePreExit();
+
 	static FCrashLogger* Instance;
+
+	FCheckpointRecord Records[RingCapacity];
+	std::atomic<uint64> WriteIndex{0};
+	uint64 ReadIndex = 0;
+	uint64 DroppedRecords = 0;
+
+	// Wall clock at startup, used to turn record cycle counts into timestamps off the game thread
+	FDateTime StartTime;
+	uint64 StartCycles = 0;
+
+	FCriticalSection DrainLock;
+	FArchive* LogFile = nullptr;
+	FRunnableThread* WriterThread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopping{false};
 };
 
 // Macro for easy checkpoint logging
-#if !UE_BUILD_SHIPPING
+#if BLACKHOLE_CRASH_CHECKPOINTS
 	#define CRASH_CHECKPOINT() \
 		FCrashLogger::Get().LogCheckpoint(TEXT(__FUNCTION__), TEXT(__FILE__), __LINE__)
-		
+
 	#define CRASH_CHECKPOINT_MSG(Context) \
 		FCrashLogger::Get().LogCheckpoint(TEXT(__FUNCTION__), TEXT(__FILE__), __LINE__, Context)
-		
+
 	#define CRASH_LOG_ERROR(Error) \
 		FCrashLogger::Get().LogError(TEXT(__FUNCTION__), TEXT(__FILE__), __LINE__, Error)
 #else
@@ -7,6 +7,7 @@
 
 class ABaseEnemy;
 class UEnemyStateMachine;
+enum class EEnemyRangeBand : uint8;
 
 UCLASS(Abstract, Blueprintable)
 class BLACKHOLE_API UEnemyStateBase : public UObject
@@ -36,6 +37,8 @@ protected:
     bool IsPlayerInRange(ABaseEnemy* Enemy, float Range) const;
     bool HasLineOfSightToPlayer(ABaseEnemy* Enemy) const;
     float GetDistanceToPlayer(ABaseEnemy* Enemy) const;
+    EEnemyRangeBand GetRangeBand(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine) const;
+    FVector GetDirectionToPlayer(ABaseEnemy* Enemy, UEnemyStateMachine* StateMachine) const;
     float GetHealthPercent(ABaseEnemy* Enemy) const;
     bool IsAbilityOnCooldown(ABaseEnemy* Enemy, const FString& AbilityName) const;
     void StartAbilityCooldown(ABaseEnemy* Enemy, const FString& AbilityName, float Duration) const;
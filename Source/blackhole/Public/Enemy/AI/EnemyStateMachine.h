@@ -8,6 +8,8 @@
 class UEnemyStateBase;
 class ABaseEnemy;
 class ABlackholePlayerCharacter;
+class UEnemyPerceptionSubsystem;
+struct FEnemyPerception;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStateChanged, EEnemyState, OldState, EEnemyState, NewState);
 
@@ -39,6 +41,9 @@ public:
 
     // Initialization - must be called by derived classes after setup
     void Initialize();
+
+    // Back to Idle with no cooldowns, re-entering perception and LOS checks if Dead dropped them
+    void ResetForRestart(AActor* NewTarget);
     
     // Player reactions
     void NotifyPlayerDashed();
@@ -65,6 +70,9 @@ public:
 
     void UpdateLastKnownTargetLocation();
 
+    // This AI step's view of the target, or null if the target isn't the player
+    const FEnemyPerception* GetPerception() const;
+
     // Cooldown management
     void StartCooldown(const FString& CooldownName, float Duration);
     bool IsCooldownActive(const FString& CooldownName) const;
@@ -105,6 +113,13 @@ protected:
     // Cooldowns
     TMap<FString, float> ActiveCooldowns;
 
+    // Shared perception step
+    UPROPERTY()
+    UEnemyPerceptionSubsystem* PerceptionSubsystem = nullptr;
+
+    int32 PerceptionHandle = INDEX_NONE;
+    void UnregisterPerception();
+
     // Initialization
     virtual void InitializeStates();
     virtual void CreateDefaultStates();
@@ -15,6 +15,9 @@ class BLACKHOLE_API AAgileEnemy : public ABaseEnemy
 
 public:
 	AAgileEnemy();
+	
+	virtual void ApplyArchetype(const struct FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields) override;
+	virtual void ResetForRestart(const FTransform& SpawnTransform) override;
 
 protected:
 	virtual void BeginPlay() override;
@@ -9,6 +9,7 @@ class ABlackholePlayerCharacter;
 class UEnemyStateMachine;
 class UStatusEffectComponent;
 class UGravityDirectionComponent;
+enum class EEnemyArchetypeFields : uint8;
 
 UCLASS()
 class BLACKHOLE_API ABaseEnemy : public ACharacter
@@ -104,10 +105,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stats")
 	void LoadStatsFromDataTable();
 	
+	// Apply the given field groups of a resolved stats row. Subclasses extend this for their own
+	// components and tuning.
+	virtual void ApplyArchetype(const struct FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields);
+	
 	virtual void Tick(float DeltaTime) override;
 	
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
+	// Set by ULevelRestartSubsystem for recorded enemies: the corpse is parked instead of
+	// destroyed so a soft restart can revive it in place
+	void SetRetainedForRestart(bool bRetain) { bRetainedForRestart = bRetain; }
+	
+	// Undo OnDeath() and clear combat and AI state for an in-place level restart
+	virtual void ResetForRestart(const FTransform& SpawnTransform);
+	
 	// Utility accessors for EnemyUtility
 	UFUNCTION(BlueprintPure, Category = "Enemy")
 	bool IsDead() const { return bIsDead; }
@@ -177,4 +189,10 @@ public:
 	
 private:
 	FTimerHandle SpeedResetTimerHandle;
+	
+	bool bRetainedForRestart = false;
+	FTimerHandle CorpseTimerHandle;
+	
+	// Hides a retained corpse and stops its abilities until the next restart
+	void ParkCorpse();
 };
\ No newline at end of file
@@ -16,6 +16,8 @@ class BLACKHOLE_API ACombatEnemy : public ABaseEnemy
 
 public:
 	ACombatEnemy();
+	
+	virtual void ApplyArchetype(const struct FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields) override;
 
 protected:
 	virtual void BeginPlay() override;
@@ -13,6 +13,8 @@ class BLACKHOLE_API AHackerEnemy : public ABaseEnemy
 
 public:
 	AHackerEnemy();
+	
+	virtual void ApplyArchetype(const struct FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields) override;
 
 protected:
 	virtual void BeginPlay() override;
@@ -14,6 +14,8 @@ class BLACKHOLE_API AMindMelderEnemy : public ABaseEnemy
 
 public:
 	AMindMelderEnemy();
+	
+	virtual void ApplyArchetype(const struct FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields) override;
 
 protected:
 	virtual void BeginPlay() override;
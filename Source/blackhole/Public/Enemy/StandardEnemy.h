@@ -15,10 +15,14 @@ class BLACKHOLE_API AStandardEnemy : public ABaseEnemy
 
 public:
 	AStandardEnemy();
+	
+	virtual void ApplyArchetype(const struct FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields) override;
+	virtual void ResetForRestart(const FTransform& SpawnTransform) override;
 
 protected:
 	virtual void BeginPlay() override;
 	virtual void UpdateAIBehavior(float DeltaTime) override;
+	virtual void OnDeath() override;
 	
 	// Override base enemy capabilities
 	virtual bool CanBlock() const override { return true; }
@@ -17,6 +17,9 @@ class BLACKHOLE_API ATankEnemy : public ABaseEnemy
 
 public:
 	ATankEnemy();
+	
+	virtual void ApplyArchetype(const struct FEnemyArchetype& Archetype, EEnemyArchetypeFields Fields) override;
+	virtual void ResetForRestart(const FTransform& SpawnTransform) override;
 
 protected:
 	virtual void BeginPlay() override;
@@ -28,6 +28,8 @@ class UInputAction;
 class UStaticMeshComponent;
 class UWallRunComponent;
 class UStatusEffectComponent;
+class UAbilityComponent;
+enum class EPlayerActionType : uint8;
 
 UCLASS()
 class BLACKHOLE_API ABlackholePlayerCharacter : public ACharacter, public IResourceConsumer
@@ -44,7 +46,10 @@ public:
 	
 	UFUNCTION(BlueprintPure, Category = "Character")
 	bool IsDead() const { return bIsDead; }
-	
+
+	// Undo Die() and clear combat state for an in-place level restart
+	void ResetForRestart(const FTransform& SpawnTransform);
+
 	// Update camera settings at runtime
 	UFUNCTION(BlueprintCallable, Category = "Camera Settings")
 	void UpdateCameraSettings();
@@ -313,6 +318,47 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo", meta = (AllowPrivateAccess = "true"))
 	UComboDataAsset* ComboDataAsset;
 	
+	// Ability input buffer - a press rejected because the ability is busy or cooling down
+	// is held for a short window and fired on the first frame it becomes legal
+	enum class EBufferedAbilityInput : uint8
+	{
+		None,
+		Kill,
+		Dash,
+		Slot1,
+		Slot2,
+		Slot3,
+		Slot4,
+		Slot5,
+		Slot6,
+		Slot7
+	};
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input", meta = (AllowPrivateAccess = "true", ClampMin = "0.0", ClampMax = "1.0"))
+	float AbilityInputBufferWindow;
+	
+	EBufferedAbilityInput BufferedInput = EBufferedAbilityInput::None;
+	float BufferedInputExpiryTime = 0.0f;
+	bool bBufferedInputWarmed = false;
+	
+	// Run the input now if legal, otherwise queue it
+	void HandleAbilityInput(EBufferedAbilityInput Input);
+	
+	// Perform the input's action if it is legal this frame - returns true if something executed
+	bool TryAbilityInput(EBufferedAbilityInput Input);
+	bool TryUseDash();
+	bool TryUseSlash();
+	bool TryExecuteAbility(UAbilityComponent* Ability);
+	
+	UAbilityComponent* GetAbilityForInput(EBufferedAbilityInput Input) const;
+	
+	// Tell nearby enemy AI what the input just did
+	void PublishPlayerAction(EPlayerActionType ActionType);
+	
+	// Retry the buffered input and warm up its ability the frame before it is expected to fire
+	void ProcessBufferedAbilityInput(float DeltaTime);
+	void ClearBufferedAbilityInput() { BufferedInput = EBufferedAbilityInput::None; bBufferedInputWarmed = false; }
+	
 	// Handle ThresholdManager death event
 	UFUNCTION()
 	void OnThresholdDeath();
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Systems/ArenaSimulation.h"
+#include "AISoakSubsystem.generated.h"
+
+class ABaseEnemy;
+
+/**
+ * Accelerated AI soak test. Only created when the game is launched with -AISoak:
+ *
+ *   UnrealEditor blackhole.uproject ThirdPersonMap -game -NullRHI -nosound -unattended -AISoak
+ *       [-SoakHours=4] [-SoakStepHz=30] [-SoakTimeScale=4]
+ *       [-SoakWaveSize=12] [-SoakWaveInterval=45] [-SoakWaveLifetime=120] [-SoakMaxAlive=60]
+ *       [-SoakMix=Tank:1,Agile:1,...] [-SoakSeed=1337] [-SoakSampleInterval=60] [-SoakOut=path.csv]
+ *
+ * The engine runs on a fixed timestep without frame rate limiting, so with -NullRHI each frame
+ * costs only game thread work and game time runs far ahead of wall time. SoakTimeScale
+ * stretches every step further through world time dilation, at the cost of coarser AI and
+ * movement updates.
+ *
+ * Waves of enemies spawn around the player start on an interval. A scripted bot fights them,
+ * and any wave still alive past its lifetime is killed through the normal damage path. That
+ * way spawn, death and cleanup all run many times per hour of game time.
+ *
+ * Every sample interval (in game time) a garbage collection is forced. Once it has run, one
+ * CSV row is appended covering:
+ * - live UObjects
+ * - enemies and their state objects, including rooted ones
+ * - active builders, combo bookkeeping and status effects
+ * - game thread cost per frame
+ * - the per-system memory report
+ * The file is flushed per row, so a crash keeps everything up to that point.
+ */
+UCLASS()
+class BLACKHOLE_API UAISoakSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	bool IsRunning() const { return Phase == EPhase::Running; }
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		WaitingForPlayer,
+		Running,
+		Done
+	};
+
+	struct FWave
+	{
+		float SpawnTime = 0.0f;
+		TArray<TWeakObjectPtr<ABaseEnemy>> Enemies;
+	};
+
+	void ParseCommandLine();
+	void ApplyTimeSettings();
+	void RestoreTimeSettings();
+
+	void SpawnWave();
+	void ExpireWaves();
+	int32 CountAliveEnemies() const;
+
+	void RequestSample();
+	void OnPostGarbageCollect();
+	void WriteSample();
+	void FinishSoak();
+
+	void OnBeginFrame();
+	void OnEndFrame();
+
+	// Config
+	float DurationSeconds = 0.0f;
+	float StepHz = 0.0f;
+	float TimeScale = 1.0f;
+	int32 WaveSize = 0;
+	float WaveInterval = 0.0f;
+	float WaveLifetime = 0.0f;
+	int32 MaxAlive = 0;
+	float SampleInterval = 0.0f;
+	FArenaEnemyMix EnemyMix;
+	FRandomStream Random;
+	FString OutputPath;
+
+	// Previous engine timing, restored when the soak ends
+	bool bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+
+	// Run state
+	EPhase Phase = EPhase::Idle;
+	FArenaBot Bot;
+	TArray<FWave> Waves;
+	float GameTime = 0.0f;
+	float NextWaveTime = 0.0f;
+	float NextSampleTime = 0.0f;
+	double WallStartSeconds = 0.0;
+	int32 WavesSpawned = 0;
+	int32 EnemiesSpawned = 0;
+	int32 EnemiesExpired = 0;
+
+	// Sampling
+	bool bSampleRequested = false;
+	bool bGarbageCollected = false;
+	int32 SamplesWritten = 0;
+	int32 FirstSampleObjects = 0;
+	FDelegateHandle PostGCHandle;
+	FDelegateHandle BeginFrameHandle;
+	FDelegateHandle EndFrameHandle;
+	uint64 FrameStartCycles = 0;
+	double FrameMsTotal = 0.0;
+	float FrameMsMax = 0.0f;
+	int32 FramesSinceSample = 0;
+};
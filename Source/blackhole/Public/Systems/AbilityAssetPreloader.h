@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/SoftObjectPtr.h"
+#include "Templates/SubclassOf.h"
+#include "AbilityAssetPreloader.generated.h"
+
+class AActor;
+class UAbilityComponent;
+class UParticleSystemComponent;
+struct FStreamableHandle;
+
+// Soft effect and sound references an ability may spawn, gathered for the preload
+struct BLACKHOLE_API FAbilityAssetManifest
+{
+	TArray<FSoftObjectPath> Assets;
+
+	template<typename T>
+	void Add(const TSoftObjectPtr<T>& Asset)
+	{
+		if (!Asset.IsNull())
+		{
+			Assets.AddUnique(Asset.ToSoftObjectPath());
+		}
+	}
+};
+
+/**
+ * Streams in and warms the effects and sounds abilities reference, before they're first used.
+ *
+ * Ability effect/sound properties are soft references, so the player's loadout and the enemy
+ * roster no longer pull every asset in through the class defaults. When the world begins play,
+ * the enemy classes the level can spawn (placed enemies recorded by ULevelRestartSubsystem,
+ * the arena modes' enemy mixes) are requested from their class defaults, before any instance
+ * exists. Each ability also hands its manifest over on BeginPlay, which covers the player and
+ * anything spawned from a class nobody announced. Requests made in the same frame are merged
+ * into one async load. Loaded assets are warmed a few per frame: particle systems are spawned
+ * once out of sight so their emitter instances and render resources get created, and sound
+ * waves are precached on the audio device. The streamable handles keep everything resident
+ * until the world goes away.
+ *
+ * An ability that fires before its asset has arrived falls back to a blocking load (see
+ * UAbilityComponent::ResolveAbilityAsset). STAT_Blackhole_UnwarmedAbilityAssets shows how
+ * many requested assets are still loading or waiting to be warmed.
+ */
+UCLASS()
+class BLACKHOLE_API UAbilityAssetPreloader : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Queue everything in the ability's manifest that hasn't been requested yet
+	void RequestAbilityAssets(const UAbilityComponent* Ability);
+
+	// Queue the manifests of every ability component on the class defaults, Blueprint-added ones included
+	void RequestActorClassAssets(TSubclassOf<AActor> ActorClass);
+
+	UFUNCTION(BlueprintPure, Category = "Abilities")
+	int32 GetUnwarmedAssetCount() const { return RequestedAssets.Num() - WarmedCount; }
+
+private:
+	void StartPendingLoad();
+	void HandleBatchLoaded(TArray<FSoftObjectPath> Batch);
+	void WarmAsset(UObject* Asset);
+	void UpdateStat() const;
+
+	// Every path ever requested in this world, so each asset loads and warms once
+	TSet<FSoftObjectPath> RequestedAssets;
+	TSet<const UClass*> RequestedClasses;
+
+	// Requested this frame, loaded together on the next tick
+	TArray<FSoftObjectPath> PendingLoad;
+
+	// Loaded and waiting for their warm-up spawn/precache
+	TArray<FSoftObjectPath> PendingWarm;
+
+	// Warm-up spawns from last tick, stopped once they've had a frame to create render state
+	TArray<TWeakObjectPtr<UParticleSystemComponent>> WarmingEmitters;
+
+	TArray<TSharedPtr<FStreamableHandle>> LoadHandles;
+	int32 WarmedCount = 0;
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AbilityCooldownManager.generated.h"
+
+class UAbilityComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityCooldownReady, UAbilityComponent*, Ability);
+
+// One row of the cooldown table
+struct FAbilityCooldownEntry
+{
+	TWeakObjectPtr<UAbilityComponent> Ability;
+	double StartTime = 0.0;
+	double ExpiryTime = 0.0;
+
+	// Reassigned whenever the cooldown is restarted or cleared so stale deadlines are ignored.
+	// Drawn from a manager-wide counter, so a deadline left behind by a removed row can't
+	// match the row that later reuses its index.
+	uint32 Generation = 0;
+};
+
+// Min-heap node, ordered by expiry
+struct FAbilityCooldownDeadline
+{
+	double ExpiryTime = 0.0;
+	int32 EntryIndex = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool operator<(const FAbilityCooldownDeadline& Other) const { return ExpiryTime < Other.ExpiryTime; }
+};
+
+/**
+ * Central cooldown table for every ability component (player and enemy).
+ * Cooldowns are stored as absolute expiry timestamps in world time, so remaining
+ * time and percentages are computed on demand and no ability ever ticks to count down.
+ * Ready notifications come from a deadline heap drained by a single timer that is
+ * always armed for the earliest pending expiry.
+ */
+UCLASS()
+class BLACKHOLE_API UAbilityCooldownManager : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Table rows - abilities register at BeginPlay and release at EndPlay
+	int32 RegisterAbility(UAbilityComponent* Ability);
+	void UnregisterAbility(int32 EntryIndex);
+
+	void StartCooldown(int32 EntryIndex, float Duration);
+	void ClearCooldown(int32 EntryIndex);
+
+	// On-demand queries
+	bool IsOnCooldown(int32 EntryIndex) const { return GetCooldownRemaining(EntryIndex) > 0.0f; }
+	float GetCooldownRemaining(int32 EntryIndex) const;
+	float GetCooldownDuration(int32 EntryIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "Cooldowns")
+	int32 GetActiveCooldownCount() const { return ActiveCooldownCount; }
+
+	// Fired once per cooldown when it expires (not for cleared cooldowns)
+	UPROPERTY(BlueprintAssignable, Category = "Cooldowns")
+	FOnAbilityCooldownReady OnAbilityCooldownReady;
+
+private:
+	TSparseArray<FAbilityCooldownEntry> Entries;
+
+	// Earliest expiry at the top
+	TArray<FAbilityCooldownDeadline> DeadlineHeap;
+
+	FTimerHandle DispatchTimerHandle;
+
+	// Expiry the dispatch timer is currently armed for (0 when idle)
+	double ArmedDeadline = 0.0;
+
+	int32 ActiveCooldownCount = 0;
+
+	// Source of entry generations; never reset while the manager lives
+	uint32 NextGeneration = 1;
+
+	double GetNow() const;
+
+	// Fire ready events for every expired deadline, then re-arm for the next one
+	void DispatchExpiredCooldowns();
+	void ArmDispatchTimer();
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Systems/ArenaSimulation.h"
+#include "ArenaBenchmarkSubsystem.generated.h"
+
+class ABaseEnemy;
+
+/**
+ * Headless arena benchmark. Only created when the game is launched with -ArenaBenchmark:
+ *
+ *   UnrealEditor blackhole.uproject ThirdPersonMap -game -NullRHI -unattended -nosound
+ *       -benchmark -fps=60 -ArenaBenchmark [-BenchEnemies=10,50,100,200]
+ *       [-BenchMix=Tank:1,Agile:1,Combat:1,Hacker:1,Standard:1,MindMelder:1]
+ *       [-BenchFrames=600] [-BenchWarmup=120] [-BenchSeed=1337] [-BenchOut=path.csv] [-BenchNoExit]
+ *
+ * For each enemy count it spawns that many enemies around the player start, lets a scripted
+ * bot circle the arena dashing, jumping and firing abilities, then samples frames. One CSV
+ * row per enemy count is written to Saved/Benchmarks (game thread ms p50/p95/p99/max,
+ * traces and hit queries per frame, memory), and the game exits.
+ */
+UCLASS()
+class BLACKHOLE_API UArenaBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	bool IsRunning() const { return Phase != EPhase::Idle && Phase != EPhase::Done; }
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		WaitingForPlayer,
+		Warmup,
+		Measure,
+		Done
+	};
+
+	struct FStageResult
+	{
+		int32 EnemyCount = 0;
+		int32 SpawnedCount = 0;
+		int32 Frames = 0;
+		float P50Ms = 0.0f;
+		float P95Ms = 0.0f;
+		float P99Ms = 0.0f;
+		float MaxMs = 0.0f;
+		float LOSTracesPerFrame = 0.0f;
+		float HitQueriesPerFrame = 0.0f;
+		float MovementTracesPerFrame = 0.0f;
+		uint64 UsedPhysicalMB = 0;
+		uint64 PeakUsedPhysicalMB = 0;
+	};
+
+	void ParseCommandLine();
+	void StartStage(int32 StageIndex);
+	void FinishStage();
+	void FinishBenchmark();
+
+	void DestroySpawnedEnemies();
+
+	// Game thread work per frame, bracketed by the engine's begin/end frame delegates
+	void OnBeginFrame();
+	void OnEndFrame();
+
+	FString BuildCsv() const;
+
+	// Config
+	TArray<int32> EnemyCounts;
+	FArenaEnemyMix EnemyMix;
+	int32 WarmupFrames = 0;
+	int32 MeasureFrames = 0;
+	FString OutputPath;
+	bool bExitWhenDone = true;
+	FRandomStream Random;
+
+	// Run state
+	EPhase Phase = EPhase::Idle;
+	int32 CurrentStage = INDEX_NONE;
+	int32 PhaseFrames = 0;
+
+	UPROPERTY()
+	TArray<TObjectPtr<ABaseEnemy>> SpawnedEnemies;
+
+	FArenaBot Bot;
+
+	// Sampling
+	FDelegateHandle BeginFrameHandle;
+	FDelegateHandle EndFrameHandle;
+	uint64 FrameStartCycles = 0;
+	TArray<float> FrameTimesMs;
+	uint64 LOSTraceTotal = 0;
+	uint64 HitQueryTotal = 0;
+	uint64 MovementTraceTotal = 0;
+
+	TArray<FStageResult> Results;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ABaseEnemy;
+class ABlackholePlayerCharacter;
+class UAbilityComponent;
+class UWorld;
+
+/**
+ * Building blocks shared by the headless arena modes (-ArenaBenchmark, -AISoak):
+ * a weighted enemy mix, a navmesh-aware spawner and a scripted player bot.
+ */
+
+// Weighted enemy classes, parsed from "Name:Weight,..." (Tank, Agile, Combat, Hacker, Standard, MindMelder)
+class BLACKHOLE_API FArenaEnemyMix
+{
+public:
+	// Reads Key (e.g. TEXT("BenchMix=")) from the command line. Missing or empty means an even mix.
+	void ParseCommandLine(const TCHAR* CommandLine, const TCHAR* Key);
+
+	TSubclassOf<ABaseEnemy> Pick(FRandomStream& Random) const;
+
+	// Every class the mix can pick, for preloading
+	void GetClasses(TArray<TSubclassOf<ABaseEnemy>>& OutClasses) const;
+
+	// "Tank:1 Agile:2 ..." for reports
+	FString Describe() const;
+
+private:
+	struct FEntry
+	{
+		FString Name;
+		TSubclassOf<ABaseEnemy> Class;
+		int32 Weight = 1;
+	};
+
+	TArray<FEntry> Entries;
+	int32 TotalWeight = 0;
+};
+
+namespace ArenaSimulation
+{
+	// Spawns Count enemies on the navmesh in a ring around Center, facing it
+	BLACKHOLE_API void SpawnEnemies(UWorld* World, const FVector& Center, int32 Count, const FArenaEnemyMix& Mix,
+		FRandomStream& Random, TArray<ABaseEnemy*>& OutSpawned);
+
+	// Starts loading the ability assets of every class in the mix, before the first wave
+	BLACKHOLE_API void PreloadEnemyMix(UWorld* World, const FArenaEnemyMix& Mix);
+}
+
+// Scripted player input: circles the arena centre, faces the nearest enemy, cycles through
+// the movement and combat abilities and keeps WP topped up so the script never stops. Every
+// so often it breaks off to run at the nearest wall, jump and steer into it so wall running
+// gets exercised too.
+class BLACKHOLE_API FArenaBot
+{
+public:
+	void Setup(ABlackholePlayerCharacter* InPlayer, const FVector& InCenter);
+	void Tick(float DeltaTime);
+
+	ABlackholePlayerCharacter* GetPlayer() const { return Player.Get(); }
+	const FVector& GetCenter() const { return Center; }
+
+private:
+	// Drives movement and facing while a wall-run attempt is running; false when patrolling
+	bool TickWallRun(ABlackholePlayerCharacter* PlayerCharacter, float DeltaTime);
+	bool FindWall(const ABlackholePlayerCharacter* PlayerCharacter);
+
+	TWeakObjectPtr<ABlackholePlayerCharacter> Player;
+	TArray<TWeakObjectPtr<UAbilityComponent>> Abilities;
+	TWeakObjectPtr<UAbilityComponent> JumpAbility;
+	FVector Center = FVector::ZeroVector;
+	int32 NextAbility = 0;
+	float PatrolAngle = 0.0f;
+	float ActionTimer = 0.0f;
+
+	// Current wall-run attempt
+	FVector WallPoint = FVector::ZeroVector;
+	FVector WallNormal = FVector::ZeroVector;
+	float WallRunCooldown = 0.0f;
+	float WallRunTimeLeft = 0.0f;
+	bool bWallRunJumped = false;
+};
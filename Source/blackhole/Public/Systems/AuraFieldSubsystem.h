@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Utils/PackedHandleTable.h"
+#include "AuraFieldSubsystem.generated.h"
+
+class AActor;
+class UWillPowerComponent;
+
+/**
+ * Evaluates every area drain aura in the world in one pass.
+ *
+ * Aura emitters (e.g. UHeatAuraComponent) register a radius, a drain rate and a pulse interval;
+ * each pulse drains DrainPerSecond * PulseInterval. WillPower components register themselves as
+ * receivers. Every TICK_INTERVAL, or on the next frame after an emitter registers so that its
+ * first pulse lands on activation, the subsystem refreshes emitter and receiver positions into
+ * packed arrays. It then tests each receiver against each emitter whose pulse is due by squared
+ * distance and applies the summed drain with a single DrainWillPower call per receiver. No
+ * overlap queries or component lookups happen per tick, and several auras on the same player
+ * cost one drain instead of one query each.
+ */
+UCLASS()
+class BLACKHOLE_API UAuraFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Emitters follow their owner's location. Returns a handle for UpdateEmitter/UnregisterEmitter.
+	int32 RegisterEmitter(AActor* Owner, float Radius, float DrainPerSecond, float PulseInterval, bool bAffectsEnemies);
+	void UpdateEmitter(int32 Handle, float Radius, float DrainPerSecond, float PulseInterval, bool bAffectsEnemies);
+	void UnregisterEmitter(int32 Handle);
+
+	// Only the player and enemies take aura drain; other owners are ignored
+	void RegisterReceiver(UWillPowerComponent* WillPower);
+	void UnregisterReceiver(UWillPowerComponent* WillPower);
+
+	UFUNCTION(BlueprintPure, Category = "Aura Field")
+	int32 GetEmitterCount() const { return EmitterOwners.Num(); }
+
+private:
+	void RemoveEmitterAt(int32 Index);
+	void RemoveReceiverAt(int32 Index);
+
+	// Emitters, packed
+	FPackedHandleTable EmitterTable;
+	TArray<TWeakObjectPtr<AActor>> EmitterOwners;
+	TArray<FVector> EmitterLocations;
+	TArray<float> EmitterRadiiSq;
+	TArray<float> EmitterDrainPerSecond;
+	TArray<float> EmitterPulseIntervals;
+	TArray<float> EmitterTimeToPulse;
+	TArray<float> EmitterPulseDrain;		// This pass's drain, 0 if the emitter isn't due
+	TArray<bool> EmitterAffectsEnemies;
+
+	// Receivers, packed
+	TArray<TWeakObjectPtr<UWillPowerComponent>> ReceiverComponents;
+	TArray<TWeakObjectPtr<AActor>> ReceiverOwners;
+	TArray<FVector> ReceiverLocations;
+	TArray<bool> ReceiverIsEnemy;
+	TArray<float> ReceiverDrain;
+
+	float TimeSinceLastPass = 0.0f;
+
+	// An emitter registered since the last pass; run the next one without waiting for TICK_INTERVAL
+	bool bPulsePending = false;
+};
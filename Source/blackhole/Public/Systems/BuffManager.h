@@ -5,6 +5,77 @@
 #include "Config/GameplayConfig.h"
 #include "BuffManager.generated.h"
 
+// Attributes that combat modifiers can affect
+UENUM(BlueprintType)
+enum class EBuffAttribute : uint8
+{
+    Damage              UMETA(DisplayName = "Damage Multiplier"),
+    CooldownReduction   UMETA(DisplayName = "Cooldown Reduction"),
+    AttackSpeed         UMETA(DisplayName = "Attack Speed Multiplier"),
+    MovementSpeed       UMETA(DisplayName = "Movement Speed Multiplier"),
+    Count               UMETA(Hidden)
+};
+
+// How a modifier is folded into its attribute: Final = (Base + Sum(Additive)) * Product(Multiplicative)
+UENUM(BlueprintType)
+enum class EBuffModifierOp : uint8
+{
+    Additive,
+    Multiplicative
+};
+
+// Opaque handle returned by AddModifier, used to remove that exact modifier later
+USTRUCT(BlueprintType)
+struct FBuffModifierHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Id = INDEX_NONE;
+
+    bool IsValid() const { return Id != INDEX_NONE; }
+    void Invalidate() { Id = INDEX_NONE; }
+
+    bool operator==(const FBuffModifierHandle& Other) const { return Id == Other.Id; }
+    bool operator!=(const FBuffModifierHandle& Other) const { return Id != Other.Id; }
+    friend uint32 GetTypeHash(const FBuffModifierHandle& Handle) { return ::GetTypeHash(Handle.Id); }
+};
+
+USTRUCT()
+struct FBuffModifier
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FName SourceId;
+
+    UPROPERTY()
+    EBuffAttribute Attribute = EBuffAttribute::Damage;
+
+    UPROPERTY()
+    EBuffModifierOp Op = EBuffModifierOp::Additive;
+
+    UPROPERTY()
+    float Magnitude = 0.0f;
+};
+
+/**
+ * Running aggregate for a single attribute.
+ * Both channels are updated incrementally on add/remove and snap back to
+ * their identity values once the last modifier of that channel is removed.
+ */
+struct FBuffAttributeAggregate
+{
+    float BaseValue = 0.0f;
+    float AdditiveSum = 0.0f;
+    float MultiplicativeProduct = 1.0f;
+    int32 AdditiveCount = 0;
+    int32 MultiplicativeCount = 0;
+    int32 ZeroFactorCount = 0; // Multiplicative modifiers of ~0 can't be divided back out
+    float CachedFinalValue = 0.0f;
+    bool bDirty = false;
+};
+
 USTRUCT(BlueprintType)
 struct FCombatBuff
 {
@@ -33,22 +104,16 @@ struct FCombatBuff
         MovementSpeedMultiplier = 1.0f;
         BuffSource.Empty();
     }
-
-    // Combine with another buff (multiplicative for multipliers, additive for reductions)
-    void CombineWith(const FCombatBuff& Other)
-    {
-        DamageMultiplier *= Other.DamageMultiplier;
-        CooldownReduction = FMath::Min(CooldownReduction + Other.CooldownReduction, 0.9f); // Cap at 90% CDR
-        AttackSpeedMultiplier *= Other.AttackSpeedMultiplier;
-        MovementSpeedMultiplier *= Other.MovementSpeedMultiplier;
-    }
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBuffsChanged, const FCombatBuff&, CurrentBuffs);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBuffAttributeChanged, EBuffAttribute, Attribute, float, NewValue);
 
 /**
- * Manages combat buffs from various sources (WP thresholds, ability losses, etc.)
- * Separated from ThresholdManager for cleaner architecture
+ * Single modifier stack for all combat buffs (WP thresholds, lost abilities, etc.)
+ * Modifiers are keyed by source FName and individual handles. Each attribute keeps
+ * a cached final value that is only re-finalized when dirty, and listeners are
+ * notified only when a final value actually changes.
  */
 UCLASS()
 class BLACKHOLE_API UBuffManager : public UWorldSubsystem
@@ -60,16 +125,30 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
-    // Buff management
+    // Modifier management
+    FBuffModifierHandle AddModifier(FName SourceId, EBuffAttribute Attribute, EBuffModifierOp Op, float Magnitude);
+    bool RemoveModifier(FBuffModifierHandle& Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "Buffs")
+    void RemoveModifiersFromSource(FName SourceId);
+
+    UFUNCTION(BlueprintPure, Category = "Buffs")
+    bool HasModifiersFromSource(FName SourceId) const { return SourceModifiers.Contains(SourceId); }
+
+    // Legacy bundle API - replaces every modifier registered under BuffID
     UFUNCTION(BlueprintCallable, Category = "Buffs")
-    void AddBuff(const FString& BuffID, const FCombatBuff& Buff);
+    void AddBuff(FName BuffID, const FCombatBuff& Buff);
 
     UFUNCTION(BlueprintCallable, Category = "Buffs")
-    void RemoveBuff(const FString& BuffID);
+    void RemoveBuff(FName BuffID) { RemoveModifiersFromSource(BuffID); }
 
     UFUNCTION(BlueprintCallable, Category = "Buffs")
     void ClearAllBuffs();
 
+    // Cached final value of an attribute
+    UFUNCTION(BlueprintPure, Category = "Buffs")
+    float GetAttributeValue(EBuffAttribute Attribute) const;
+
     // Get combined buffs
     UFUNCTION(BlueprintPure, Category = "Buffs")
     const FCombatBuff& GetCombinedBuffs() const { return CombinedBuffs; }
@@ -82,16 +161,16 @@ public:
     float CalculateFinalCooldown(float BaseCooldown) const;
 
     UFUNCTION(BlueprintPure, Category = "Buffs")
-    float GetAttackSpeedMultiplier() const { return CombinedBuffs.AttackSpeedMultiplier; }
+    float GetAttackSpeedMultiplier() const { return GetAttributeValue(EBuffAttribute::AttackSpeed); }
 
     UFUNCTION(BlueprintPure, Category = "Buffs")
-    float GetMovementSpeedMultiplier() const { return CombinedBuffs.MovementSpeedMultiplier; }
+    float GetMovementSpeedMultiplier() const { return GetAttributeValue(EBuffAttribute::MovementSpeed); }
 
-    // WP threshold buffs
+    // WP threshold buffs (50%+ WP)
     UFUNCTION(BlueprintCallable, Category = "Buffs")
-    void UpdateWPThresholdBuffs(float WPPercentage);
+    void SetWPThresholdBuffActive(bool bActive);
 
-    // Lost ability buffs
+    // Survivor buffs scale with abilities sacrificed to ultimates
     UFUNCTION(BlueprintCallable, Category = "Buffs")
     void UpdateLostAbilityBuffs(int32 AbilitiesLost);
 
@@ -99,21 +178,56 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Buffs")
     FOnBuffsChanged OnBuffsChanged;
 
+    UPROPERTY(BlueprintAssignable, Category = "Buffs")
+    FOnBuffAttributeChanged OnAttributeChanged;
+
+    // Well-known modifier sources
+    static const FName WPThresholdSource;
+    static const FName LostAbilitiesSource;
+
 protected:
-    // Active buffs
+    // Active modifiers keyed by handle id
     UPROPERTY()
-    TMap<FString, FCombatBuff> ActiveBuffs;
+    TMap<int32, FBuffModifier> ActiveModifiers;
+
+    // Handle ids owned by each source, for O(1) source removal lookup
+    TMap<FName, TArray<int32>> SourceModifiers;
+
+    // Per-attribute running aggregates
+    FBuffAttributeAggregate Aggregates[(int32)EBuffAttribute::Count];
 
-    // Combined result
+    // Combined result, mirrored from the cached final values
     UPROPERTY()
     FCombatBuff CombinedBuffs;
 
-    // Recalculate combined buffs
-    void RecalculateBuffs();
+    int32 NextModifierId = 0;
 
-    // Create buff for WP threshold
-    FCombatBuff CreateWPThresholdBuff(float WPPercentage) const;
+    // Nested Add/Remove calls defer notifications until the outermost call returns
+    int32 BatchDepth = 0;
 
-    // Create buff for lost abilities
-    FCombatBuff CreateLostAbilityBuff(int32 AbilitiesLost) const;
-};
\ No newline at end of file
+    void ApplyModifierToAggregate(const FBuffModifier& Modifier, bool bAdding);
+    float FinalizeAttribute(EBuffAttribute Attribute) const;
+
+    // Re-finalize dirty attributes and broadcast only the ones that changed
+    void FlushDirtyAttributes();
+
+    void ResetAggregates();
+
+    FBuffModifierHandle AddModifierInternal(FName SourceId, EBuffAttribute Attribute, EBuffModifierOp Op, float Magnitude);
+
+    struct FScopedBuffBatch
+    {
+        UBuffManager& Manager;
+        explicit FScopedBuffBatch(UBuffManager& InManager) : Manager(InManager) { ++Manager.BatchDepth; }
+        ~FScopedBuffBatch()
+        {
+            if (--Manager.BatchDepth == 0)
+            {
+                Manager.FlushDirtyAttributes();
+            }
+        }
+    };
+
+    // Number of abilities currently feeding the survivor buff
+    int32 CurrentLostAbilityCount = 0;
+};
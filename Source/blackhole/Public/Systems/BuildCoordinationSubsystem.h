@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Utils/PackedHandleTable.h"
+#include "BuildCoordinationSubsystem.generated.h"
+
+class AActor;
+class UBuilderComponent;
+
+/**
+ * Coordinates Psi-Disruptor builds for the whole world.
+ *
+ * Builder components and disruptors register themselves at BeginPlay and leave at EndPlay (or
+ * when the builder dies), so "who can build nearby" and "is there already a disruptor" never
+ * need an actor search. Build groups keep their state in packed arrays:
+ * - one entry per group for leader, location, progress and pause state
+ * - one flat member list tagged with each member's group
+ * Every UPDATE_INTERVAL one batched pass drops members that died or wandered out of range and
+ * advances every running group. Groups that fall below their minimum are cancelled, finished
+ * ones spawn their disruptor. Builder components don't tick.
+ */
+UCLASS()
+class BLACKHOLE_API UBuildCoordinationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Builder registry. Unregistering also takes the builder out of its group.
+	void RegisterBuilder(UBuilderComponent* Builder);
+	void UnregisterBuilder(UBuilderComponent* Builder);
+
+	// Live Psi-Disruptors
+	void RegisterDisruptor(AActor* Disruptor);
+	void UnregisterDisruptor(AActor* Disruptor);
+	bool HasActiveDisruptor() const { return Disruptors.Num() > 0; }
+
+	// Recruits idle builders within the leader's BuildRadius of Location. Returns the group
+	// handle, or INDEX_NONE (and changes nothing) if fewer than MinBuildersRequired are available.
+	int32 StartGroup(UBuilderComponent* Leader, const FVector& Location);
+	bool JoinGroup(int32 Group, UBuilderComponent* Builder);
+	void LeaveGroup(UBuilderComponent* Builder);
+	void CancelGroup(int32 Group);
+	void SetGroupPaused(int32 Group, bool bPaused);
+
+	bool IsGroupPaused(int32 Group) const;
+	float GetGroupProgress(int32 Group) const;
+
+	UBuilderComponent* FindNearestBuildLeader(const FVector& Origin, float MaxRange) const;
+
+	// Registered builders other than Exclude within Radius of Origin; their locations are
+	// added to OutLocationSum
+	int32 GatherBuildersInRadius(const FVector& Origin, float Radius, const UBuilderComponent* Exclude, FVector& OutLocationSum) const;
+
+	UFUNCTION(BlueprintPure, Category = "Building")
+	int32 GetBuilderCount() const { return Builders.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Building")
+	int32 GetActiveGroupCount() const { return GroupLeaders.Num(); }
+
+private:
+	void AddMember(int32 Group, UBuilderComponent* Builder);
+	void RemoveMemberAt(int32 MemberIndex, bool bReleaseBuilder);
+	void RemoveGroupAt(int32 GroupIndex);
+	void FinishGroupAt(int32 GroupIndex, bool bCompleted);
+
+	TArray<TWeakObjectPtr<UBuilderComponent>> Builders;
+	TArray<TWeakObjectPtr<AActor>> Disruptors;
+
+	// Groups, packed
+	FPackedHandleTable GroupTable;
+	TArray<TWeakObjectPtr<UBuilderComponent>> GroupLeaders;
+	TArray<FVector> GroupLocations;
+	TArray<float> GroupLeaveRadiiSq;
+	TArray<int32> GroupMinBuilders;
+	TArray<int32> GroupMemberCounts;
+	TArray<float> GroupTimeSpent;
+	TArray<float> GroupBuildTime;
+	TArray<bool> GroupPaused;
+
+	// Members of every group, packed, tagged with their group handle
+	TArray<TWeakObjectPtr<UBuilderComponent>> MemberBuilders;
+	TArray<TWeakObjectPtr<AActor>> MemberOwners;
+	TArray<int32> MemberGroups;
+
+	float TimeSinceLastUpdate = 0.0f;
+};
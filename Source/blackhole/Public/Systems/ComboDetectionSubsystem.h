@@ -59,6 +59,9 @@ public:
     virtual void Deinitialize() override;
     virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
 
+    // Reports the input histories, which the serializer can't see
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
     // Input registration
     UFUNCTION(BlueprintCallable, Category = "Combo")
     void RegisterInput(AActor* InputOwner, EComboInput Input, FVector InputLocation = FVector::ZeroVector);
@@ -73,6 +76,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Combo")
     int32 GetComboProgress(AActor* Owner) const;
 
+    // Bookkeeping sizes, for leak checks (entries should go away with their owners)
+    int32 GetActiveComboCount() const { return ActiveCombos.Num(); }
+    int32 GetInputHistoryCount() const { return InputHistories.Num(); }
+
     // Configuration
     UFUNCTION(BlueprintCallable, Category = "Combo")
     void SetComboDataAsset(UComboDataAsset* DataAsset);
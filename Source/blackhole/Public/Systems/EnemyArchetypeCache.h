@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Data/EnemyStatsData.h"
+#include "EnemyArchetypeCache.generated.h"
+
+class UDataTable;
+
+/**
+ * Resolved enemy archetypes, one per FEnemyStatsData row.
+ *
+ * The first lookup into a stats table builds archetypes for every row in it (validation and
+ * derived values included), so the FName row search and the validation run once per table
+ * instead of once per spawn. Returned archetypes stay valid until the table changes, is
+ * invalidated or the game instance shuts down.
+ *
+ * Resolved tables are watched: when one is reimported or edited (e.g. the CSV during PIE) its
+ * rows are rebuilt and diffed, and live enemies using a changed row get only the changed
+ * field groups re-applied - no respawn, health fraction and active speed modifiers kept.
+ */
+UCLASS()
+class BLACKHOLE_API UEnemyArchetypeCache : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual void Deinitialize() override;
+
+	// Null if the row doesn't exist
+	const FEnemyArchetype* FindArchetype(UDataTable* Table, FName RowName);
+
+	// Drops the resolved rows; the next lookup rebuilds them
+	void Invalidate(UDataTable* Table);
+
+private:
+	struct FTableArchetypes
+	{
+		// Never resized after the build, so pointers into it stay valid
+		TArray<FEnemyArchetype> Archetypes;
+		TMap<FName, int32> RowToIndex;
+
+		TWeakObjectPtr<UDataTable> Table;
+		FDelegateHandle ChangedHandle;
+	};
+
+	static TUniquePtr<FTableArchetypes> BuildTable(UDataTable* Table);
+	const FTableArchetypes* GetOrBuild(UDataTable* Table);
+	void StopWatching(FTableArchetypes& Resolved);
+
+	// Rebuilds a changed table and pushes the differences to live enemies
+	void HandleTableChanged(TWeakObjectPtr<UDataTable> WeakTable);
+
+	TMap<TObjectKey<UDataTable>, TUniquePtr<FTableArchetypes>> Tables;
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Utils/PackedHandleTable.h"
+#include "EnemyPerceptionSubsystem.generated.h"
+
+class ACharacter;
+class ABaseEnemy;
+class UEnemyStateMachine;
+
+// Where the player sits relative to an enemy's AI ranges, nearest first
+enum class EEnemyRangeBand : uint8
+{
+	Attack,		// Within AttackRange
+	Engage,		// Within AttackRange * ENGAGE_RANGE_SCALE - combat holds
+	Chase,		// Within ChaseRange * CHASE_LEASH_SCALE - chase holds
+	Sight,		// Within SightRange
+	Beyond
+};
+
+// One enemy's view of the player, computed once per AI step
+struct FEnemyPerception
+{
+	FVector EnemyLocation = FVector::ZeroVector;
+	FVector PlayerLocation = FVector::ZeroVector;
+	FVector PlayerVelocity = FVector::ZeroVector;
+
+	// Unit vector from the enemy to the player
+	FVector ToPlayer = FVector::ForwardVector;
+
+	float Distance = MAX_FLT;
+
+	// Enemy forward . ToPlayer (1 = facing the player)
+	float FacingDot = 0.0f;
+
+	// Player forward . direction to the enemy (1 = player looking straight at the enemy)
+	float PlayerFacingDot = 0.0f;
+
+	// Horizontal angle between the player's forward and the enemy, 0 in front to 180 behind
+	float FlankAngle = 0.0f;
+
+	EEnemyRangeBand RangeBand = EEnemyRangeBand::Beyond;
+};
+
+/**
+ * Shared perception pass for every enemy state machine.
+ *
+ * State machines register on BeginPlay and get a handle. The first one to ask for its
+ * perception in a frame triggers the step: the player is looked up once, player and enemy
+ * transforms and AI ranges are copied into packed arrays on the game thread, then distance,
+ * facing, range band and flank angle are computed for all enemies in a ParallelFor over those
+ * arrays. Every other state machine ticking that frame just reads its row, so state updates
+ * do no player lookups, component searches or transform reads of their own.
+ */
+UCLASS()
+class BLACKHOLE_API UEnemyPerceptionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// Returns a handle for GetPerception/UnregisterEnemy
+	int32 RegisterEnemy(UEnemyStateMachine* StateMachine);
+	void UnregisterEnemy(int32 Handle);
+
+	// This frame's results for the enemy, or null for an invalid handle or no player
+	const FEnemyPerception* GetPerception(int32 Handle);
+
+	// The player the current step was taken against
+	ACharacter* GetPlayer();
+
+	UFUNCTION(BlueprintPure, Category = "Enemies")
+	int32 GetPerceivingEnemyCount() const { return EnemyOwners.Num(); }
+
+	static EEnemyRangeBand ClassifyRange(float Distance, float AttackRange, float ChaseRange, float SightRange);
+
+private:
+	void RefreshIfStale();
+
+	TWeakObjectPtr<ACharacter> Player;
+	bool bHasPlayer = false;
+	uint64 LastStepFrame = MAX_uint64;
+
+	// Enemies, packed
+	FPackedHandleTable EnemyTable;
+	TArray<TWeakObjectPtr<ABaseEnemy>> EnemyOwners;
+	TArray<TWeakObjectPtr<UEnemyStateMachine>> EnemyStateMachines;
+
+	// Snapshot inputs, refreshed each step
+	TArray<FVector> EnemyLocations;
+	TArray<FVector> EnemyForwards;
+	TArray<FVector> EnemyRanges;		// AttackRange, ChaseRange, SightRange
+
+	// Step outputs, same order
+	TArray<FEnemyPerception> Results;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyTrackingManager.generated.h"
+
+class ABaseEnemy;
+class UEnemyStateMachine;
+class UBuilderComponent;
+class UPowerfulMindmeldComponent;
+
+// One live enemy plus the components the HUD reads every frame, resolved once at registration
+struct FTrackedEnemy
+{
+	TWeakObjectPtr<ABaseEnemy> Enemy;
+	TWeakObjectPtr<UEnemyStateMachine> StateMachine;
+	TWeakObjectPtr<UBuilderComponent> Builder;
+	TWeakObjectPtr<UPowerfulMindmeldComponent> Mindmeld;
+};
+
+/**
+ * Registry of live enemies in the world.
+ * Enemies add themselves at BeginPlay and remove themselves at EndPlay, so consumers such as
+ * the HUD can walk a flat list instead of using actor iterators or FindComponentByClass.
+ * Visibility comes from the line-of-sight flag the enemy state machine already maintains -
+ * this manager never runs traces of its own.
+ */
+UCLASS()
+class BLACKHOLE_API UEnemyTrackingManager : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	void RegisterEnemy(ABaseEnemy* Enemy);
+	void UnregisterEnemy(ABaseEnemy* Enemy);
+
+	const TArray<FTrackedEnemy>& GetTrackedEnemies() const { return TrackedEnemies; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemies")
+	int32 GetTrackedEnemyCount() const { return TrackedEnemies.Num(); }
+
+	// True if the enemy's AI currently has line of sight to the player (cached, no trace)
+	static bool IsVisibleToPlayer(const FTrackedEnemy& Tracked);
+
+private:
+	TArray<FTrackedEnemy> TrackedEnemies;
+};
@@ -4,6 +4,8 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameStateManager.generated.h"
 
+class APlayerController;
+
 UENUM(BlueprintType)
 enum class EGameState : uint8
 {
@@ -89,4 +91,7 @@ private:
 	void CleanupTimers();
 	void CleanupDelegates();
 	void ResetPlayerState();
+	
+	// Full map reload, used when the level can't be restarted in place
+	void TravelRestart(APlayerController* PC);
 };
\ No newline at end of file
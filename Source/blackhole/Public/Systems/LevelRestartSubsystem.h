@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LevelRestartSubsystem.generated.h"
+
+class ABaseEnemy;
+class ABlackholePlayerCharacter;
+class FProperty;
+
+/**
+ * Restarts the current level in place instead of travelling to it again.
+ *
+ * Every enemy placed in the level is recorded when the world begins play, and its corpse is
+ * parked rather than destroyed. A soft restart puts the world back into that state without
+ * reloading anything: recorded enemies are revived in place at their spawn transform, runtime
+ * spawns are removed, pooled objects go back to their pools, threshold/death/resource state is
+ * reset, the player is revived and moved to a player start, and pickups and doors are restored.
+ * A recorded enemy that was destroyed anyway is spawned again with its per-instance edits.
+ * Classes and assets stay resident, so this takes a frame instead of a map load.
+ *
+ * UGameStateManager::RestartGame uses this first and falls back to ClientTravel if it fails.
+ */
+UCLASS()
+class BLACKHOLE_API ULevelRestartSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// False if the world can't be restored in place and a full reload is needed
+	bool SoftRestart();
+
+	UFUNCTION(BlueprintPure, Category = "Game State")
+	int32 GetRecordedEnemyCount() const { return EnemySpawns.Num(); }
+
+private:
+	// One instance-editable property that differs from the class defaults, as exported text
+	struct FEnemyPropertyOverride
+	{
+		const FProperty* Property = nullptr;
+		FString Value;
+	};
+
+	struct FEnemySpawnRecord
+	{
+		TSubclassOf<ABaseEnemy> EnemyClass;
+		FTransform Transform;
+		TArray<FEnemyPropertyOverride> PropertyOverrides;
+
+		// The placed enemy, reset in place on restart; null once destroyed
+		TWeakObjectPtr<ABaseEnemy> Enemy;
+	};
+
+	void RecordEnemy(ABaseEnemy* Enemy);
+	ABaseEnemy* SpawnFromRecord(const FEnemySpawnRecord& Record) const;
+
+	void ResetManagers();
+	void ResetEnemies();
+	void ResetLevelActors();
+	bool FindPlayerRestartTransform(ABlackholePlayerCharacter* Player, FTransform& OutTransform) const;
+
+	TArray<FEnemySpawnRecord> EnemySpawns;
+	bool bRecorded = false;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MindmeldChannelSubsystem.generated.h"
+
+class AActor;
+class UMindmeldComponent;
+class UPowerfulMindmeldComponent;
+class UResourceManager;
+
+/**
+ * Owns every active Mindmeld and PowerfulMindmeld channel in the world.
+ *
+ * Neither component ticks. Starting a channel registers it here and ending it removes it, so
+ * with no channel running nothing is updated at all. While channels are active, one tick:
+ * - checks each sustained Mindmeld against the line-of-sight flag the caster's state machine
+ *   already maintains, tracing only when the caster has no cached result for that target
+ * - sums the WP corruption of every sustained channel and commits it with one AddWillPower
+ * - advances every timed PowerfulMindmeld channel
+ */
+UCLASS()
+class BLACKHOLE_API UMindmeldChannelSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Sustained WP corruption (UMindmeldComponent)
+	void StartCorruption(UMindmeldComponent* Mindmeld, AActor* Target);
+	void StopCorruption(UMindmeldComponent* Mindmeld);
+
+	// Timed channels (UPowerfulMindmeldComponent)
+	void StartTimedChannel(UPowerfulMindmeldComponent* Mindmeld);
+	void StopTimedChannel(UPowerfulMindmeldComponent* Mindmeld);
+
+	UFUNCTION(BlueprintPure, Category = "Mindmeld")
+	int32 GetActiveChannelCount() const { return CorruptionChannels.Num() + TimedChannels.Num(); }
+
+	// Reads the caster's cached AI line of sight to Target. Returns false if the caster's state
+	// machine isn't currently tracking Target, in which case the caller has to trace itself.
+	static bool GetCachedLineOfSight(const AActor* Caster, const AActor* Target, bool& bOutHasLineOfSight);
+
+private:
+	// Resolved once when the channel starts
+	struct FCorruptionChannel
+	{
+		TWeakObjectPtr<UMindmeldComponent> Mindmeld;
+		TWeakObjectPtr<AActor> Caster;
+		TWeakObjectPtr<AActor> Target;
+	};
+
+	UResourceManager* GetResourceManager();
+
+	TArray<FCorruptionChannel> CorruptionChannels;
+	TArray<TWeakObjectPtr<UPowerfulMindmeldComponent>> TimedChannels;
+
+	TWeakObjectPtr<UResourceManager> CachedResourceManager;
+};
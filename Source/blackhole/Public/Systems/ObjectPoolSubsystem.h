@@ -76,6 +76,11 @@ public:
     UFUNCTION(BlueprintPure, Category = "Object Pool")
     void GetPoolStats(FName PoolName, int32& OutAvailable, int32& OutActive, int32& OutTotal) const;
 
+    /**
+     * Collect every pooled object, available and active, across all pools
+     */
+    void GetPooledObjects(TArray<AActor*>& OutObjects) const;
+
     /**
      * Pre-warm a pool by spawning objects
      */
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerActionEventBus.generated.h"
+
+class AActor;
+
+UENUM(BlueprintType)
+enum class EPlayerActionType : uint8
+{
+	Dash,
+	Attack,
+	Ultimate
+};
+
+struct FPlayerActionEvent
+{
+	EPlayerActionType Type = EPlayerActionType::Attack;
+	TWeakObjectPtr<AActor> Instigator;
+	FVector Location = FVector::ZeroVector;
+	FVector Facing = FVector::ForwardVector;		// Horizontal, normalized
+};
+
+/**
+ * Delivers player actions to the enemy AI that should react to them.
+ *
+ * The player publishes dash, attack and ultimate events with a position and facing. Events are
+ * queued and dispatched once per frame: one walk over the enemy registry
+ * (UEnemyTrackingManager) tests every enemy against every queued event and calls the matching
+ * UEnemyStateMachine::NotifyPlayer* hook. Dashes and ultimates reach enemies within a radius;
+ * attacks also need the enemy inside the attack cone. Only enemies targeting the instigator
+ * are notified.
+ */
+UCLASS()
+class BLACKHOLE_API UPlayerActionEventBus : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Subsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void Publish(EPlayerActionType Type, AActor* Instigator, const FVector& Location, const FVector& Facing);
+
+	UFUNCTION(BlueprintPure, Category = "AI")
+	int32 GetPendingEventCount() const { return PendingEvents.Num(); }
+
+private:
+	TArray<FPlayerActionEvent> PendingEvents;
+
+	// Swapped with PendingEvents for dispatch, so reactions can publish for the next frame
+	TArray<FPlayerActionEvent> DispatchEvents;
+};
@@ -2,10 +2,13 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
 #include "blackhole.h"
 #include "Config/GameplayConfig.h"
 #include "ResourceManager.generated.h"
 
+class UWillPowerComponent;
+
 UENUM(BlueprintType)
 enum class EResourceThreshold : uint8
 {
@@ -121,6 +124,13 @@ public:
 	void SetCriticalState(bool bCritical) { bInCriticalState = bCritical; }
 	bool IsInCriticalState() const { return bInCriticalState; }
 	
+	// WP changes are coalesced and committed once per frame after all actors have ticked.
+	// Call this to push a pending change to listeners immediately.
+	void FlushWillPowerChanges();
+	
+	// True if WP changed this frame and listeners haven't been notified yet
+	bool HasPendingWillPowerChange() const { return bWPChangePending; }
+	
 private:
 	// Resource values
 	UPROPERTY()
@@ -146,9 +156,32 @@ private:
 	// Flag to prevent resets during critical gameplay moments
 	bool bInCriticalState = false;
 	
+	// Per-frame WP change coalescing
+	// Last value listeners were told about
+	float CommittedWP = 0.0f;
+	
+	// Number of raw changes folded into the pending commit (diagnostics)
+	int32 PendingWPChangeCount = 0;
+	
+	bool bWPChangePending = false;
+	
+	// WP crossed from >0 to 0 at some point since the last commit
+	bool bWPDepletedPending = false;
+	
+	FDelegateHandle PostActorTickHandle;
+	
+	// Cached so commits don't search the player's components every time
+	TWeakObjectPtr<UWillPowerComponent> CachedWillPowerComponent;
+	
 	// Helper functions
 	void CheckWPThreshold();
 	void SyncWillPowerComponent(); // Keep player's WillPowerComponent in sync with ResourceManager
+	UWillPowerComponent* ResolveWillPowerComponent();
+	
+	// Record a raw WP change for the end-of-frame commit
+	void MarkWillPowerChanged(float OldWP);
+	
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
 	
 	// Default values now in GameplayConfig.h
 };
\ No newline at end of file
@@ -2,11 +2,13 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Systems/BuffManager.h"
 #include "ThresholdManager.generated.h"
 
 class UAbilityComponent;
 class ABlackholePlayerCharacter;
 class UResourceManager;
+class UBuffManager;
 
 USTRUCT(BlueprintType)
 struct FThresholdState
@@ -101,7 +103,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Threshold")
 	void EndCombat();
 	
-	// Get current survivor buff
+	// Get current survivor buff (mirrors the combined values held by UBuffManager)
 	UFUNCTION(BlueprintPure, Category = "Threshold")
 	const FSurvivorBuff& GetCurrentBuff() const { return CurrentBuff; }
 	
@@ -111,7 +113,7 @@ public:
 	
 	// Get disabled ability count
 	UFUNCTION(BlueprintPure, Category = "Threshold")
-	int32 GetDisabledAbilityCount() const { return DisabledAbilities.Num(); }
+	int32 GetDisabledAbilityCount() const { return FMath::CountBits(DisabledSlotMask); }
 	
 	// Check if ultimate mode is active
 	UFUNCTION(BlueprintPure, Category = "Threshold")
@@ -138,11 +140,18 @@ public:
 	// Start critical timer when WP reaches 0
 	void StartCriticalTimer();
 	
-	// Force cache player abilities (for testing)
+	// Player ability registry - abilities claim a stable slot at BeginPlay and release it at EndPlay
+	bool RegisterPlayerAbility(UAbilityComponent* Ability);
+	void UnregisterPlayerAbility(UAbilityComponent* Ability);
+	
+	UFUNCTION(BlueprintPure, Category = "Threshold")
+	int32 GetRegisteredAbilityCount() const { return FMath::CountBits(RegisteredSlotMask); }
+	
+	// Register any player abilities that missed BeginPlay registration (fallback/testing)
 	void CachePlayerAbilities();
 	
-	// Get random enabled ability
-	UAbilityComponent* GetRandomEnabledAbility() const;
+	// Get random enabled ability (optionally excluding one), without allocating
+	UAbilityComponent* GetRandomEnabledAbility(const UAbilityComponent* ExcludedAbility = nullptr) const;
 	UAbilityComponent* GetRandomEnabledAbilityExcludingSlash() const;
 	
 	// Critical state limit functions
@@ -164,6 +173,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Critical State")
 	void ResetCriticalStateEntries();
 	
+	// Back to a fresh level: ends combat, stops the critical timer and restores sacrificed abilities
+	void ResetForRestart();
+	
 private:
 	// Clean up invalid ability references
 	void CleanupInvalidAbilities();
@@ -199,13 +211,25 @@ private:
 	UPROPERTY()
 	int32 CriticalStateEntriesUsed = 0;
 	
-	// Disabled abilities
-	UPROPERTY()
-	TArray<UAbilityComponent*> DisabledAbilities;
+	// Player ability registry: slot index -> ability (nullptr for free slots)
+	static constexpr int32 MaxAbilitySlots = 64;
 	
-	// All player abilities (cached)
 	UPROPERTY()
-	TArray<UAbilityComponent*> AllPlayerAbilities;
+	TArray<UAbilityComponent*> AbilitySlots;
+	
+	// One bit per slot
+	uint64 RegisteredSlotMask = 0;
+	uint64 DisabledSlotMask = 0;		// Sacrificed to an ultimate - persists across combats
+	uint64 BasicSlotMask = 0;			// Basic abilities never enter ultimate mode
+	
+	uint64 GetEnabledSlotMask() const { return RegisteredSlotMask & ~DisabledSlotMask; }
+	uint64 GetSlotMask(const UAbilityComponent* Ability) const;
+	
+	// Pick a uniformly random set bit of CandidateMask (popcount + select)
+	UAbilityComponent* PickRandomAbility(uint64 CandidateMask) const;
+	
+	// Enabling affects enabled non-basic abilities; disabling clears every registered ability
+	int32 ApplyUltimateModeToAbilities(bool bEnabled);
 	
 	// Cached references
 	UPROPERTY()
@@ -214,6 +238,9 @@ private:
 	UPROPERTY()
 	UResourceManager* ResourceManager;
 	
+	UPROPERTY()
+	UBuffManager* BuffManager;
+	
 	// Handle WP threshold changes
 	UFUNCTION()
 	void OnWPThresholdChanged(EResourceThreshold NewThreshold);
@@ -221,11 +248,18 @@ private:
 	// Deactivate ultimate mode and disable the used ability
 	void DeactivateUltimateMode(UAbilityComponent* UsedAbility);
 	
-	// Update survivor buffs
+	// Push survivor buff sources into the BuffManager modifier stack
 	void UpdateSurvivorBuffs();
 	
+	// Drop all survivor buff sources (combat start/end)
+	void ResetSurvivorBuffs();
+	
+	// Mirror BuffManager's combined values into CurrentBuff when they change
+	UFUNCTION()
+	void OnBuffsChanged(const FCombatBuff& CombinedBuffs);
+	
 	// Critical timer functions
 	void StopCriticalTimer();
 	void OnCriticalTimerExpiredInternal(); // Internal function for timer callback
 	void UpdateCriticalTimer();
-};
\ No newline at end of file
+};
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "GameFramework/HUD.h"
 #include "blackhole.h"
 #include "Systems/GameStateManager.h"
+#include "UI/HUDTextCache.h"
 #include "BlackholeHUD.generated.h"
 
 class ABlackholePlayerCharacter;
@@ -20,8 +21,11 @@ class USystemOverrideAbility;
 class UHackerDashAbility;
 class UHackerJumpAbility;
 class USimplePauseMenu;
+class UBlackholeHUDWidget;
 class UThresholdManager;
 class UWallRunComponent;
+class UEnemyTrackingManager;
+class ABaseEnemy;
 
 UCLASS()
 class BLACKHOLE_API ABlackholeHUD : public AHUD
@@ -32,6 +36,9 @@ public:
 	ABlackholeHUD();
 
 	virtual void DrawHUD() override;
+
+	// Reports the canvas notification queue, which the serializer can't see
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 	
 	// Called when the menu toggle key is pressed
 	void OnMenuTogglePressed();
@@ -99,6 +106,13 @@ protected:
 	UPROPERTY()
 	class UGameOverWidget* GameOverWidget;
 	
+	// Retained-mode gameplay HUD. When enabled, DrawHUD only paints what still needs the canvas.
+	UPROPERTY(EditDefaultsOnly, Category = "HUD")
+	bool bUseRetainedHUD = true;
+	
+	UPROPERTY()
+	UBlackholeHUDWidget* HUDWidget;
+	
 	UPROPERTY()
 	class UGameStateManager* GameStateManager;
 	
@@ -108,6 +122,9 @@ protected:
 	UPROPERTY()
 	class UThresholdManager* ThresholdManager;
 	
+	UPROPERTY()
+	UEnemyTrackingManager* EnemyTrackingManager;
+	
 	// Cached ability components
 	UPROPERTY()
 	class USlashAbilityComponent* CachedSlashAbility;
@@ -152,6 +169,17 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "HUD")
 	float CooldownIconSize;
 	
+	// Enemy overhead indicators
+	UPROPERTY(EditDefaultsOnly, Category = "HUD|Enemy Indicators")
+	int32 MaxEnemyIndicators;
+	
+	UPROPERTY(EditDefaultsOnly, Category = "HUD|Enemy Indicators")
+	float EnemyIndicatorRange;
+	
+	// Screen-space radius around the crosshair used to pick the targeted enemy
+	UPROPERTY(EditDefaultsOnly, Category = "HUD|Enemy Indicators")
+	float TargetSelectRadius;
+	
 	// Performance optimization
 	UPROPERTY(EditDefaultsOnly, Category = "Performance")
 	float CacheUpdateInterval = 0.1f; // Update cache every 0.1 seconds
@@ -214,7 +242,25 @@ protected:
 	
 
 private:
-	AActor* GetTargetedActor() const;
+	// Enemy nearest the crosshair from the last indicator pass (replaces the per-frame line trace)
+	TWeakObjectPtr<ABaseEnemy> TargetedEnemy;
+	
+	// One entry per enemy that survived culling this frame; storage is reused between frames
+	struct FEnemyIndicator
+	{
+		ABaseEnemy* Enemy;
+		FVector2D ScreenPosition;
+		float DistanceSq;
+		float WPPercent;
+		float BuildProgress;	// < 0 when not building
+		float CastProgress;		// < 0 when not channeling
+		bool bVisible;
+	};
+	
+	TArray<FEnemyIndicator> EnemyIndicators;
+	
+	// Gather, cull and draw all enemy overhead indicators in a single pass
+	void DrawEnemyIndicators();
 	
 	// Draw all abilities with their inputs and cooldowns
 	void DrawAbilityInfo();
@@ -226,22 +272,44 @@ private:
 	struct FAbilityDisplayInfo
 	{
 		FString Name;
+		FString UltimateName;
 		FString Input;
+		FString InputLabel;
 		class UAbilityComponent* Ability;
 		bool bIsActive;
 		bool bIsDisabled;
 		bool bIsInUltimateMode;
 		bool bIsBasicAbility;
+		
+		// Per-ability formatted text, reformatted only when the shown value changes
+		FHUDCachedText CooldownText;
+		FHUDCachedText DebugText;
+		
+		const FString& GetDisplayName() const { return bIsInUltimateMode ? UltimateName : Name; }
 	};
 	
-	// Get current path abilities
-	TArray<FAbilityDisplayInfo> GetCurrentAbilities() const;
+	// Display entries are built once in BeginPlay; only the state flags are refreshed per call
+	TArray<FAbilityDisplayInfo> AbilityDisplayInfos;
+	void BuildAbilityDisplayInfos();
 	
-	// String formatting helpers to avoid per-frame allocations
-	TCHAR AttributeTextBuffer[64];
-	TCHAR TargetTextBuffer[128];
-	TCHAR CooldownTextBuffer[32];
-	TCHAR DebugTextBuffer[256];
+	// Get current path abilities
+	TArray<FAbilityDisplayInfo>& GetCurrentAbilities();
+	
+	// Formatted HUD text - cached by quantized value so steady values cost no allocations
+	FString AttributeText;
+	FHUDCachedText TargetText;
+	FHUDCachedText CriticalEntriesText;
+	FHUDCachedText CriticalTimerText;
+	FHUDCachedText CriticalPanelEntriesText;
+	FHUDCachedText VelocityText;
+	FHUDCachedText WallRunSideText;
+	FHUDCachedText WallRunSpeedText;
+	FHUDCachedText DebugUltimateText;
+	FHUDCachedText DebugCombatText;
+	FHUDCachedText DebugDisabledText;
+	FHUDCachedText DebugWPText;
+	FHUDCachedText PsiDisruptorProgressText;
+	FHUDCachedText MindmeldProgressText;
 	
 	// Notification system
 	struct FNotification
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Systems/ResourceManager.h"
+#include "BlackholeHUDWidget.generated.h"
+
+class ABlackholePlayerCharacter;
+class UAbilityComponent;
+class UThresholdManager;
+class UCanvasPanel;
+class UVerticalBox;
+class UUniformGridPanel;
+class UBorder;
+class UTextBlock;
+class UProgressBar;
+
+/**
+ * Retained-mode gameplay HUD built directly from C++ (no Blueprint asset needed).
+ * Widgets are created once and only touched when the value they show changes, which
+ * is driven by ResourceManager / ThresholdManager delegates. The per-frame tick only
+ * does work for things that are genuinely animating (cooldowns, ultimate pulse,
+ * critical flash, notification fades) - a static HUD leaves the Slate tree untouched.
+ */
+UCLASS()
+class BLACKHOLE_API UBlackholeHUDWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	// Create and build the widget tree for the given player
+	static UBlackholeHUDWidget* CreateHUDWidget(APlayerController* PlayerController, ABlackholePlayerCharacter* Player);
+
+	// Timed message in the notification stack (oldest is dropped past the slot limit)
+	void AddNotification(const FString& Message, const FColor& Color, float Duration = 5.0f);
+
+	// Reports ability rows and queued notifications, which the serializer can't see
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+protected:
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+	// Build the widget hierarchy
+	void BuildHUD();
+
+	// Delegate handlers - each one updates only the widgets that depend on it
+	UFUNCTION()
+	void HandleWillPowerChanged(float NewValue, float MaxValue);
+
+	UFUNCTION()
+	void HandleWillPowerThresholdReached(EResourceThreshold Threshold);
+
+	UFUNCTION()
+	void HandleUltimateModeActivated(bool bIsActive);
+
+	UFUNCTION()
+	void HandleCriticalTimer(float TimeRemaining);
+
+	UFUNCTION()
+	void HandleCriticalTimerExpired();
+
+	UFUNCTION()
+	void HandleAbilityDisabled(UAbilityComponent* Ability, int32 TotalDisabled);
+
+	UFUNCTION()
+	void HandleCriticalStateEntryUsed(int32 EntriesUsed, int32 EntriesRemaining);
+
+	UFUNCTION()
+	void HandleCombatStarted();
+
+	UFUNCTION()
+	void HandleCombatEnded();
+
+private:
+	enum class EAbilityRowState : uint8
+	{
+		Unset,
+		Ready,
+		Cooldown,
+		Ultimate,
+		Disabled
+	};
+
+	struct FAbilityRow
+	{
+		TWeakObjectPtr<UAbilityComponent> Ability;
+		const TCHAR* Name = nullptr;
+		const TCHAR* UltimateName = nullptr;
+		const TCHAR* Input = nullptr;
+		bool bIsJump = false;
+
+		UBorder* Box = nullptr;
+		UTextBlock* NameText = nullptr;
+		UTextBlock* InputText = nullptr;
+		UTextBlock* StatusText = nullptr;
+		UProgressBar* CooldownBar = nullptr;
+		UTextBlock* DebugLine = nullptr;
+
+		// Last values pushed to the widgets
+		EAbilityRowState State = EAbilityRowState::Unset;
+		int32 CooldownTenths = INDEX_NONE;
+		bool bShowingUltimateName = false;
+	};
+
+	struct FNotificationEntry
+	{
+		FText Message;
+		FLinearColor Color = FLinearColor::White;
+		float TimeRemaining = 0.0f;
+	};
+
+	static constexpr int32 MaxNotifications = 5;
+	static constexpr int32 AbilityColumns = 6;
+
+	TWeakObjectPtr<ABlackholePlayerCharacter> Player;
+	TWeakObjectPtr<UResourceManager> ResourceManager;
+	TWeakObjectPtr<UThresholdManager> ThresholdManager;
+
+	TArray<FAbilityRow> AbilityRows;
+
+	// Notification stack - entries are data, slots are the pre-built widgets that show them
+	TArray<FNotificationEntry> NotificationEntries;
+	UBorder* NotificationSlots[MaxNotifications] = {};
+	UTextBlock* NotificationTexts[MaxNotifications] = {};
+
+	// Will Power
+	UProgressBar* WPBar = nullptr;
+	UTextBlock* WPValueText = nullptr;
+	UTextBlock* WPStateText = nullptr;
+	int32 ShownWP = INDEX_NONE;
+	int32 ShownMaxWP = INDEX_NONE;
+	int32 ShownWPPercent = INDEX_NONE;
+	EResourceThreshold WPThreshold = EResourceThreshold::Normal;
+
+	// Critical state
+	UTextBlock* CriticalEntriesText = nullptr;
+	UVerticalBox* CriticalPanel = nullptr;
+	UTextBlock* CriticalTitleText = nullptr;
+	UTextBlock* CriticalTimerText = nullptr;
+	UTextBlock* CriticalPanelEntriesText = nullptr;
+	UTextBlock* LastChanceText = nullptr;
+	UBorder* ScreenFlashEdges[4] = {};
+	bool bCriticalTimerActive = false;
+	bool bScreenFlashVisible = false;
+	int32 ShownCriticalTenths = INDEX_NONE;
+
+	// Ultimate mode
+	UVerticalBox* UltimateBanner = nullptr;
+	bool bUltimateModeActive = false;
+
+	// Debug status panel (lives in a retainer so it re-renders at a reduced rate)
+	UTextBlock* DebugUltimateText = nullptr;
+	UTextBlock* DebugCombatText = nullptr;
+	UTextBlock* DebugDisabledText = nullptr;
+	UTextBlock* DebugWPText = nullptr;
+	UTextBlock* DebugWPStateText = nullptr;
+
+	// Widget construction helpers
+	UTextBlock* MakeText(const FString& Text, const FLinearColor& Color, int32 FontSize = 12);
+	UCanvasPanel* BuildRoot();
+	void BuildWillPowerPanel(UCanvasPanel* Root);
+	void BuildAbilityGrid(UCanvasPanel* Root);
+	void BuildCriticalPanel(UCanvasPanel* Root);
+	void BuildNotificationStack(UCanvasPanel* Root);
+	void BuildDebugPanel(UCanvasPanel* Root);
+	void AddAbilityRow(UAbilityComponent* Ability, const TCHAR* Name, const TCHAR* UltimateName, const TCHAR* Input, bool bIsJump = false);
+
+	// Push current values into widgets (no-ops when nothing changed)
+	void RefreshWillPowerState();
+	void RefreshCriticalEntries(int32 EntriesRemaining);
+	void RefreshAbilityRow(FAbilityRow& Row, bool bForce = false);
+	void RefreshDebugPanel();
+	void RefreshNotifications();
+
+	// Per-frame animation, only while something is actually changing
+	void TickAbilityCooldowns();
+	void TickUltimatePulse();
+	void TickCriticalFlash();
+	void TickNotifications(float DeltaTime);
+
+	void BindDelegates();
+	void UnbindDelegates();
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Allocation-free text formatting for the canvas HUD.
+ *
+ * FHUDCachedText keeps a pre-formatted string keyed by a quantized value (integer speed,
+ * tenths of a second, ...) and only reformats when the key changes. FHUDText::Format
+ * prints into a fixed inline buffer and copies into a reusable FString, so once the
+ * target string has grown to its working size no further heap allocations happen.
+ *
+ * "stat BlackholeHUD" shows how many reformats and allocations this path made per frame.
+ */
+
+DECLARE_STATS_GROUP(TEXT("BlackholeHUD"), STATGROUP_BlackholeHUD, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD Text Reformats"), STAT_HUDTextReformats, STATGROUP_BlackholeHUD, BLACKHOLE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD Text Allocations"), STAT_HUDTextAllocations, STATGROUP_BlackholeHUD, BLACKHOLE_API);
+
+struct BLACKHOLE_API FHUDText
+{
+	// Longest line the HUD formats - anything longer is truncated
+	static constexpr int32 InlineBufferSize = 256;
+
+	// printf-style format into Out, reusing its existing allocation
+	template <typename FmtType, typename... Types>
+	static void Format(FString& Out, const FmtType& Fmt, Types... Args)
+	{
+		TCHAR Buffer[InlineBufferSize];
+		const int32 Len = FCString::Snprintf(Buffer, InlineBufferSize, Fmt, Args...);
+		Assign(Out, Buffer, Len);
+	}
+
+	// Copy Len characters into Out without releasing its allocation
+	static void Assign(FString& Out, const TCHAR* Chars, int32 Len);
+
+	// Quantize helpers - the key and the printed value must round the same way
+	static int32 ToTenths(float Value) { return FMath::RoundToInt(Value * 10.0f); }
+	static float FromTenths(int32 Tenths) { return Tenths / 10.0f; }
+};
+
+struct FHUDCachedText
+{
+	// Returns the cached string, reformatting only if Key differs from the last call
+	template <typename FmtType, typename... Types>
+	const FString& Get(int64 Key, const FmtType& Fmt, Types... Args)
+	{
+		if (Key != CachedKey)
+		{
+			CachedKey = Key;
+			FHUDText::Format(Text, Fmt, Args...);
+			INC_DWORD_STAT(STAT_HUDTextReformats);
+		}
+		return Text;
+	}
+
+	// For arguments that allocate when evaluated (e.g. GetName()), check before building them
+	bool IsCurrent(int64 Key) const { return Key == CachedKey; }
+	const FString& GetCached() const { return Text; }
+
+	void Invalidate() { CachedKey = TNumericLimits<int64>::Min(); }
+
+private:
+	int64 CachedKey = TNumericLimits<int64>::Min();
+	FString Text;
+};
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "blackhole.h"
 
 /**
  * Comprehensive error handling macros for the Blackhole project.
@@ -11,7 +13,7 @@
 #define CHECK_VALID(Ptr, ReturnValue) \
 	if (!IsValid(Ptr)) \
 	{ \
-		UE_LOG(LogTemp, Error, TEXT("%s: Invalid pointer %s at %s:%d"), \
+		UE_LOG(LogBlackhole, Error, TEXT("%s: Invalid pointer %s at %s:%d"), \
 			*FString(__FUNCTION__), TEXT(#Ptr), TEXT(__FILE__), __LINE__); \
 		return ReturnValue; \
 	}
@@ -20,7 +22,7 @@
 #define CHECK_VALID_VOID(Ptr) \
 	if (!IsValid(Ptr)) \
 	{ \
-		UE_LOG(LogTemp, Error, TEXT("%s: Invalid pointer %s at %s:%d"), \
+		UE_LOG(LogBlackhole, Error, TEXT("%s: Invalid pointer %s at %s:%d"), \
 			*FString(__FUNCTION__), TEXT(#Ptr), TEXT(__FILE__), __LINE__); \
 		return; \
 	}
@@ -29,7 +31,7 @@
 #define CHECK_CAST(CastResult, ReturnValue) \
 	if (!(CastResult)) \
 	{ \
-		UE_LOG(LogTemp, Error, TEXT("%s: Cast failed for %s at %s:%d"), \
+		UE_LOG(LogBlackhole, Error, TEXT("%s: Cast failed for %s at %s:%d"), \
 			*FString(__FUNCTION__), TEXT(#CastResult), TEXT(__FILE__), __LINE__); \
 		return ReturnValue; \
 	}
@@ -38,7 +40,7 @@
 #define CHECK_CAST_VOID(CastResult) \
 	if (!(CastResult)) \
 	{ \
-		UE_LOG(LogTemp, Error, TEXT("%s: Cast failed for %s at %s:%d"), \
+		UE_LOG(LogBlackhole, Error, TEXT("%s: Cast failed for %s at %s:%d"), \
 			*FString(__FUNCTION__), TEXT(#CastResult), TEXT(__FILE__), __LINE__); \
 		return; \
 	}
@@ -47,7 +49,7 @@
 #define CHECK_ARRAY_BOUNDS(Array, Index, ReturnValue) \
 	if ((Index) < 0 || (Index) >= (Array).Num()) \
 	{ \
-		UE_LOG(LogTemp, Error, TEXT("%s: Array index out of bounds %s[%d] (Size: %d) at %s:%d"), \
+		UE_LOG(LogBlackhole, Error, TEXT("%s: Array index out of bounds %s[%d] (Size: %d) at %s:%d"), \
 			*FString(__FUNCTION__), TEXT(#Array), (Index), (Array).Num(), TEXT(__FILE__), __LINE__); \
 		return ReturnValue; \
 	}
@@ -56,7 +58,7 @@
 #define CHECK_COMPONENT(Component, ReturnValue) \
 	if (!(Component)) \
 	{ \
-		UE_LOG(LogTemp, Warning, TEXT("%s: Component %s is null at %s:%d"), \
+		UE_LOG(LogBlackhole, Warning, TEXT("%s: Component %s is null at %s:%d"), \
 			*FString(__FUNCTION__), TEXT(#Component), TEXT(__FILE__), __LINE__); \
 		return ReturnValue; \
 	}
@@ -65,7 +67,7 @@
 #define LOG_RETURN_IF(Condition, LogLevel, Message, ReturnValue) \
 	if (Condition) \
 	{ \
-		UE_LOG(LogTemp, LogLevel, TEXT("%s: %s"), *FString(__FUNCTION__), Message); \
+		UE_LOG(LogBlackhole, LogLevel, TEXT("%s: %s"), *FString(__FUNCTION__), Message); \
 		return ReturnValue; \
 	}
 
@@ -73,7 +75,7 @@
 #define VALIDATE_POSITIVE(Value, ParamName) \
 	if ((Value) <= 0.0f) \
 	{ \
-		UE_LOG(LogTemp, Warning, TEXT("%s: Invalid %s value: %.2f"), \
+		UE_LOG(LogBlackhole, Warning, TEXT("%s: Invalid %s value: %.2f"), \
 			*FString(__FUNCTION__), TEXT(ParamName), (Value)); \
 		return false; \
 	}
@@ -87,7 +89,7 @@ T SafeArrayAccess(const TArray<T>& Array, int32 Index, const T& DefaultValue)
 		return Array[Index];
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("SafeArrayAccess: Index %d out of bounds (Array size: %d)"), 
+	UE_LOG(LogBlackhole, Warning, TEXT("SafeArrayAccess: Index %d out of bounds (Array size: %d)"), 
 		Index, Array.Num());
 	return DefaultValue;
 }
@@ -97,7 +99,7 @@ FORCEINLINE float SafeDivide(float Numerator, float Denominator, float DefaultVa
 {
 	if (FMath::IsNearlyZero(Denominator))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SafeDivide: Division by zero prevented"));
+		UE_LOG(LogBlackhole, Warning, TEXT("SafeDivide: Division by zero prevented"));
 		return DefaultValue;
 	}
 	return Numerator / Denominator;
@@ -111,15 +113,63 @@ FORCEINLINE bool IsActorValidForOperation(const AActor* Actor)
 
 // Log execution context for debugging
 #define LOG_EXECUTION_CONTEXT() \
-	UE_LOG(LogTemp, VeryVerbose, TEXT("%s called from %s:%d"), \
+	UE_LOG(LogBlackhole, VeryVerbose, TEXT("%s called from %s:%d"), \
 		*FString(__FUNCTION__), TEXT(__FILE__), __LINE__)
 
+// Rate-limited logging for hot paths. State is per call site; the checks are skipped entirely
+// when the category/verbosity is compiled out or disabled at runtime.
+
+// Log at most once every IntervalSeconds (real time)
+#define BLACKHOLE_LOG_RATE_LIMITED(CategoryName, Verbosity, IntervalSeconds, Format, ...) \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+		{ \
+			static double BlackholeLogLastTime = -DBL_MAX; \
+			const double BlackholeLogNow = FPlatformTime::Seconds(); \
+			if (BlackholeLogNow - BlackholeLogLastTime >= (IntervalSeconds)) \
+			{ \
+				BlackholeLogLastTime = BlackholeLogNow; \
+				UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+// Log the first call and then every Nth call after it
+#define BLACKHOLE_LOG_EVERY_N(CategoryName, Verbosity, N, Format, ...) \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+		{ \
+			static uint32 BlackholeLogCounter = 0; \
+			if ((BlackholeLogCounter++ % (uint32)(N)) == 0) \
+			{ \
+				UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+// Log only the first time this line is reached
+#define BLACKHOLE_LOG_ONCE(CategoryName, Verbosity, Format, ...) \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+		{ \
+			static bool bBlackholeLogged = false; \
+			if (!bBlackholeLogged) \
+			{ \
+				bBlackholeLogged = true; \
+				UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
 // Assert with custom message in debug builds
 #if !UE_BUILD_SHIPPING
 	#define BLACKHOLE_ASSERT(Condition, Message) \
 		if (!(Condition)) \
 		{ \
-			UE_LOG(LogTemp, Fatal, TEXT("ASSERTION FAILED: %s at %s:%d - %s"), \
+			UE_LOG(LogBlackhole, Fatal, TEXT("ASSERTION FAILED: %s at %s:%d - %s"), \
 				TEXT(#Condition), TEXT(__FILE__), __LINE__, Message); \
 		}
 #else
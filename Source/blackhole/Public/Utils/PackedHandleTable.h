@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Stable int32 handles for rows in packed, parallel arrays.
+ *
+ * The owner keeps its data as one TArray per field so batched passes stay dense. Rows are
+ * appended at Num() and removed by swapping the last row into the hole. The table recycles
+ * freed handles, maps handles to rows and back, and re-points the moved row's handle on removal.
+ */
+class FPackedHandleTable
+{
+public:
+	// Handle for a new row at index Num(); the owner appends to its arrays after this
+	int32 Add()
+	{
+		const int32 Handle = FreeHandles.Num() > 0 ? FreeHandles.Pop(EAllowShrinking::No) : HandleToIndex.AddUninitialized();
+		HandleToIndex[Handle] = IndexToHandle.Add(Handle);
+		return Handle;
+	}
+
+	// Row index for Handle, INDEX_NONE if the handle is invalid or freed
+	int32 Find(int32 Handle) const
+	{
+		return HandleToIndex.IsValidIndex(Handle) ? HandleToIndex[Handle] : INDEX_NONE;
+	}
+
+	int32 GetHandle(int32 Index) const { return IndexToHandle[Index]; }
+	int32 Num() const { return IndexToHandle.Num(); }
+
+	// Frees the row's handle and swap-removes the row from each of the owner's arrays
+	template<typename... ArrayTypes>
+	void RemoveAtSwap(int32 Index, ArrayTypes&... Arrays)
+	{
+		const int32 Handle = IndexToHandle[Index];
+		const int32 LastIndex = IndexToHandle.Num() - 1;
+
+		// The last row now lives at Index
+		if (Index != LastIndex)
+		{
+			HandleToIndex[IndexToHandle[LastIndex]] = Index;
+		}
+
+		IndexToHandle.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		(Arrays.RemoveAtSwap(Index, 1, EAllowShrinking::No), ...);
+
+		HandleToIndex[Handle] = INDEX_NONE;
+		FreeHandles.Add(Handle);
+	}
+
+	void Empty()
+	{
+		HandleToIndex.Empty();
+		IndexToHandle.Empty();
+		FreeHandles.Empty();
+	}
+
+private:
+	TArray<int32> HandleToIndex;	// INDEX_NONE for free handles
+	TArray<int32> IndexToHandle;
+	TArray<int32> FreeHandles;
+};
@@ -4,6 +4,21 @@
 
 #include "CoreMinimal.h"
 
+// Per-subsystem log categories. Test and Shipping builds compile out everything below Warning,
+// so Log/Verbose diagnostics in hot paths cost nothing there.
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+	#define BLACKHOLE_LOG_COMPILE_VERBOSITY Warning
+#else
+	#define BLACKHOLE_LOG_COMPILE_VERBOSITY All
+#endif
+
+BLACKHOLE_API DECLARE_LOG_CATEGORY_EXTERN(LogBlackhole, Log, BLACKHOLE_LOG_COMPILE_VERBOSITY);			// Game flow, world actors
+BLACKHOLE_API DECLARE_LOG_CATEGORY_EXTERN(LogBlackholeAI, Log, BLACKHOLE_LOG_COMPILE_VERBOSITY);		// Enemies, state machines, AI controller
+BLACKHOLE_API DECLARE_LOG_CATEGORY_EXTERN(LogBlackholeAbilities, Log, BLACKHOLE_LOG_COMPILE_VERBOSITY);	// Player and enemy ability components, combos
+BLACKHOLE_API DECLARE_LOG_CATEGORY_EXTERN(LogBlackholeMovement, Log, BLACKHOLE_LOG_COMPILE_VERBOSITY);	// Player character movement, wall run, gravity
+BLACKHOLE_API DECLARE_LOG_CATEGORY_EXTERN(LogBlackholeResources, Log, BLACKHOLE_LOG_COMPILE_VERBOSITY);	// WP, thresholds, buffs
+BLACKHOLE_API DECLARE_LOG_CATEGORY_EXTERN(LogBlackholeUI, Log, BLACKHOLE_LOG_COMPILE_VERBOSITY);		// HUD and menus
+
 // Character path enumeration
 UENUM(BlueprintType)
 enum class ECharacterPath : uint8